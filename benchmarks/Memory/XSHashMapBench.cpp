@@ -0,0 +1,213 @@
+/**
+ * Copyright Matthew Oliver
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "XSBenchConfig.h"
+#include "XSCompiler.h"
+
+#include <benchmark/benchmark.h>
+
+#define BENCHMARKT(n) BENCHMARK(n)
+
+constexpr int64_t hashMapStartRange = 1 << 4;
+constexpr int64_t hashMapEndRange = 1 << 20;
+
+/**
+ * Generate a sequence of pseudo random keys.
+ * @param state The current random state.
+ * @returns The next key.
+ */
+inline uint64_t hashMapBenchKey(uint64_t& state) noexcept
+{
+    // splitmix64
+    state += 0x9E3779B97F4A7C15ULL;
+    uint64_t ret = state;
+    ret = (ret ^ (ret >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    ret = (ret ^ (ret >> 27)) * 0x94D049BB133111EBULL;
+    return ret ^ (ret >> 31);
+}
+
+#define ENABLE_HASHMAP_TEST XS_BENCH_HASHMAP
+#ifndef XSBENCHMAIN
+#    if ENABLE_HASHMAP_TEST
+#        include "../tests/XSCompilerOptions.h"
+
+#        define XS_OVERRIDE_SHIFT_NS TESTISA(HashMapTest)
+
+namespace XS_OVERRIDE_SHIFT_NS {
+#        include "Memory/XSHashMap.hpp"
+}
+
+using namespace XS_OVERRIDE_SHIFT_NS;
+using namespace XS_OVERRIDE_SHIFT_NS::Shift;
+
+#        define BENCH_INSERT_NAME TESTISA(HashMapInsert)
+#        define BENCH_FIND_NAME TESTISA(HashMapFind)
+#        define BENCH_MISS_NAME TESTISA(HashMapFindMiss)
+#        define BENCH_REMOVE_NAME TESTISA(HashMapRemove)
+
+void TESTISA(HashMapInsert)(benchmark::State& state)
+{
+    for (auto _ : state) {
+        HashMap<uint64_t, uint64_t> map;
+        uint64_t seed = 0;
+        for (int64_t i = 0; i < state.range(0); ++i) {
+            map.add(hashMapBenchKey(seed), static_cast<uint64_t>(i));
+        }
+        benchmark::DoNotOptimize(map.getLength());
+    }
+    state.SetItemsProcessed(int64_t(state.iterations()) * int64_t(state.range(0)));
+}
+
+void TESTISA(HashMapFind)(benchmark::State& state)
+{
+    HashMap<uint64_t, uint64_t> map;
+    uint64_t seed = 0;
+    for (int64_t i = 0; i < state.range(0); ++i) {
+        map.add(hashMapBenchKey(seed), static_cast<uint64_t>(i));
+    }
+    for (auto _ : state) {
+        seed = 0;
+        uint64_t sum = 0;
+        for (int64_t i = 0; i < state.range(0); ++i) {
+            sum += *map.find(hashMapBenchKey(seed));
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(int64_t(state.iterations()) * int64_t(state.range(0)));
+}
+
+void TESTISA(HashMapFindMiss)(benchmark::State& state)
+{
+    HashMap<uint64_t, uint64_t> map;
+    uint64_t seed = 0;
+    for (int64_t i = 0; i < state.range(0); ++i) {
+        map.add(hashMapBenchKey(seed), static_cast<uint64_t>(i));
+    }
+    for (auto _ : state) {
+        uint64_t missSeed = ~0ULL;
+        uint64_t found = 0;
+        for (int64_t i = 0; i < state.range(0); ++i) {
+            found += map.contains(hashMapBenchKey(missSeed));
+        }
+        benchmark::DoNotOptimize(found);
+    }
+    state.SetItemsProcessed(int64_t(state.iterations()) * int64_t(state.range(0)));
+}
+
+void TESTISA(HashMapRemove)(benchmark::State& state)
+{
+    for (auto _ : state) {
+        state.PauseTiming();
+        HashMap<uint64_t, uint64_t> map(static_cast<uint0>(state.range(0)));
+        uint64_t seed = 0;
+        for (int64_t i = 0; i < state.range(0); ++i) {
+            map.add(hashMapBenchKey(seed), static_cast<uint64_t>(i));
+        }
+        state.ResumeTiming();
+        seed = 0;
+        for (int64_t i = 0; i < state.range(0); ++i) {
+            map.remove(hashMapBenchKey(seed));
+        }
+        benchmark::DoNotOptimize(map.getLength());
+    }
+    state.SetItemsProcessed(int64_t(state.iterations()) * int64_t(state.range(0)));
+}
+#    endif
+#else
+#    if XS_BENCH_HASHMAP_STD
+#        include <unordered_map>
+
+#        define BENCH_INSERT_NAME HashMapInsert_std
+#        define BENCH_FIND_NAME HashMapFind_std
+#        define BENCH_MISS_NAME HashMapFindMiss_std
+#        define BENCH_REMOVE_NAME HashMapRemove_std
+
+void HashMapInsert_std(benchmark::State& state)
+{
+    for (auto _ : state) {
+        std::unordered_map<uint64_t, uint64_t> map;
+        uint64_t seed = 0;
+        for (int64_t i = 0; i < state.range(0); ++i) {
+            map.insert_or_assign(hashMapBenchKey(seed), static_cast<uint64_t>(i));
+        }
+        benchmark::DoNotOptimize(map.size());
+    }
+    state.SetItemsProcessed(int64_t(state.iterations()) * int64_t(state.range(0)));
+}
+
+void HashMapFind_std(benchmark::State& state)
+{
+    std::unordered_map<uint64_t, uint64_t> map;
+    uint64_t seed = 0;
+    for (int64_t i = 0; i < state.range(0); ++i) {
+        map.insert_or_assign(hashMapBenchKey(seed), static_cast<uint64_t>(i));
+    }
+    for (auto _ : state) {
+        seed = 0;
+        uint64_t sum = 0;
+        for (int64_t i = 0; i < state.range(0); ++i) {
+            sum += map.find(hashMapBenchKey(seed))->second;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(int64_t(state.iterations()) * int64_t(state.range(0)));
+}
+
+void HashMapFindMiss_std(benchmark::State& state)
+{
+    std::unordered_map<uint64_t, uint64_t> map;
+    uint64_t seed = 0;
+    for (int64_t i = 0; i < state.range(0); ++i) {
+        map.insert_or_assign(hashMapBenchKey(seed), static_cast<uint64_t>(i));
+    }
+    for (auto _ : state) {
+        uint64_t missSeed = ~0ULL;
+        uint64_t found = 0;
+        for (int64_t i = 0; i < state.range(0); ++i) {
+            found += map.contains(hashMapBenchKey(missSeed));
+        }
+        benchmark::DoNotOptimize(found);
+    }
+    state.SetItemsProcessed(int64_t(state.iterations()) * int64_t(state.range(0)));
+}
+
+void HashMapRemove_std(benchmark::State& state)
+{
+    for (auto _ : state) {
+        state.PauseTiming();
+        std::unordered_map<uint64_t, uint64_t> map(static_cast<size_t>(state.range(0)));
+        uint64_t seed = 0;
+        for (int64_t i = 0; i < state.range(0); ++i) {
+            map.insert_or_assign(hashMapBenchKey(seed), static_cast<uint64_t>(i));
+        }
+        state.ResumeTiming();
+        seed = 0;
+        for (int64_t i = 0; i < state.range(0); ++i) {
+            map.erase(hashMapBenchKey(seed));
+        }
+        benchmark::DoNotOptimize(map.size());
+    }
+    state.SetItemsProcessed(int64_t(state.iterations()) * int64_t(state.range(0)));
+}
+#    endif
+#endif
+
+#if (ENABLE_HASHMAP_TEST && !defined(XSBENCHMAIN)) || (XS_BENCH_HASHMAP_STD && defined(XSBENCHMAIN))
+BENCHMARKT(BENCH_INSERT_NAME)->RangeMultiplier(4)->Range(hashMapStartRange, hashMapEndRange);
+BENCHMARKT(BENCH_FIND_NAME)->RangeMultiplier(4)->Range(hashMapStartRange, hashMapEndRange);
+BENCHMARKT(BENCH_MISS_NAME)->RangeMultiplier(4)->Range(hashMapStartRange, hashMapEndRange);
+BENCHMARKT(BENCH_REMOVE_NAME)->RangeMultiplier(4)->Range(hashMapStartRange, hashMapEndRange);
+#endif
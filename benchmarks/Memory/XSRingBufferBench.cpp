@@ -0,0 +1,140 @@
+/**
+ * Copyright Matthew Oliver
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "XSBenchConfig.h"
+#include "XSCompiler.h"
+
+#include <benchmark/benchmark.h>
+
+#define BENCHMARKT(n) BENCHMARK(n)
+
+constexpr int64_t queueStartRange = 1 << 6;
+constexpr int64_t queueEndRange = 1 << 14;
+constexpr int64_t queueBatch = 32;
+
+#define ENABLE_RINGBUFFER_TEST XS_BENCH_RINGBUFFER
+#ifndef XSBENCHMAIN
+#    if ENABLE_RINGBUFFER_TEST
+#        include "../tests/XSCompilerOptions.h"
+
+#        define XS_OVERRIDE_SHIFT_NS TESTISA(RingBufferTest)
+
+namespace XS_OVERRIDE_SHIFT_NS {
+#        include "Memory/XSDArray.hpp"
+#        include "Memory/XSRingBuffer.hpp"
+}
+
+using namespace XS_OVERRIDE_SHIFT_NS;
+using namespace XS_OVERRIDE_SHIFT_NS::Shift;
+
+#        define BENCH_DARRAY_NAME TESTISA(DArrayQueue)
+#        define BENCH_RING_NAME TESTISA(RingBufferQueue)
+#        define BENCH_RING_BULK_NAME TESTISA(RingBufferQueueBulk)
+
+void TESTISA(DArrayQueue)(benchmark::State& state)
+{
+    // Queue emulated by removing from the start of an array
+    const auto number = static_cast<uint32_t>(state.range(0));
+    DArray<uint32_t> array(number);
+    for (uint32_t i = 0; i < number; ++i) {
+        array.add(i);
+    }
+    for (auto _ : state) {
+        uint64_t sum = 0;
+        for (uint32_t i = 0; i < number; ++i) {
+            sum += array.at(0);
+            array.remove(0_ui32);
+            array.add(i);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(int64_t(state.iterations()) * state.range(0));
+}
+
+void TESTISA(RingBufferQueue)(benchmark::State& state)
+{
+    const auto number = static_cast<uint32_t>(state.range(0));
+    RingBuffer<uint32_t> ring(number);
+    for (uint32_t i = 0; i < number; ++i) {
+        ring.pushBack(i);
+    }
+    for (auto _ : state) {
+        uint64_t sum = 0;
+        for (uint32_t i = 0; i < number; ++i) {
+            uint32_t value;
+            ring.popFront(value);
+            sum += value;
+            ring.pushBack(i);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(int64_t(state.iterations()) * state.range(0));
+}
+
+void TESTISA(RingBufferQueueBulk)(benchmark::State& state)
+{
+    const auto number = static_cast<uint32_t>(state.range(0));
+    RingBuffer<uint32_t> ring(number);
+    for (uint32_t i = 0; i < number; ++i) {
+        ring.pushBack(i);
+    }
+    uint32_t values[queueBatch]; // NOLINT(modernize-avoid-c-arrays)
+    for (auto _ : state) {
+        uint64_t sum = 0;
+        for (uint32_t i = 0; i < number; i += queueBatch) {
+            ring.popFront(values, queueBatch);
+            sum += values[0];
+            ring.pushBack(values, queueBatch);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(int64_t(state.iterations()) * state.range(0));
+}
+#    endif
+#else
+#    if XS_BENCH_RINGBUFFER_STD
+#        include <deque>
+
+#        define BENCH_RING_NAME RingBufferQueue_std
+
+void RingBufferQueue_std(benchmark::State& state)
+{
+    const auto number = static_cast<uint32_t>(state.range(0));
+    std::deque<uint32_t> ring;
+    for (uint32_t i = 0; i < number; ++i) {
+        ring.push_back(i);
+    }
+    for (auto _ : state) {
+        uint64_t sum = 0;
+        for (uint32_t i = 0; i < number; ++i) {
+            sum += ring.front();
+            ring.pop_front();
+            ring.push_back(i);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(int64_t(state.iterations()) * state.range(0));
+}
+#    endif
+#endif
+
+#if ENABLE_RINGBUFFER_TEST && !defined(XSBENCHMAIN)
+BENCHMARKT(BENCH_DARRAY_NAME)->RangeMultiplier(4)->Range(queueStartRange, queueEndRange);
+BENCHMARKT(BENCH_RING_NAME)->RangeMultiplier(4)->Range(queueStartRange, queueEndRange);
+BENCHMARKT(BENCH_RING_BULK_NAME)->RangeMultiplier(4)->Range(queueStartRange, queueEndRange);
+#elif XS_BENCH_RINGBUFFER_STD && defined(XSBENCHMAIN)
+BENCHMARKT(BENCH_RING_NAME)->RangeMultiplier(4)->Range(queueStartRange, queueEndRange);
+#endif
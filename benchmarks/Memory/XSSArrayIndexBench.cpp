@@ -0,0 +1,156 @@
+/**
+ * Copyright Matthew Oliver
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "XSBenchConfig.h"
+#include "XSCompiler.h"
+
+#include <benchmark/benchmark.h>
+
+#define BENCHMARKT(n) BENCHMARK(n)
+
+constexpr int64_t searchStartRange = 1 << 10;
+constexpr int64_t searchEndRange = 1 << 24;
+constexpr int64_t searchQueries = 1 << 12;
+
+/**
+ * Generate a sequence of pseudo random search values.
+ * @param state The current random state.
+ * @returns The next value.
+ */
+inline uint32_t searchBenchValue(uint64_t& state) noexcept
+{
+    // splitmix64
+    state += 0x9E3779B97F4A7C15ULL;
+    uint64_t ret = state;
+    ret = (ret ^ (ret >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    ret = (ret ^ (ret >> 27)) * 0x94D049BB133111EBULL;
+    return static_cast<uint32_t>(ret ^ (ret >> 31));
+}
+
+#define ENABLE_SARRAYINDEX_TEST XS_BENCH_SARRAYINDEX
+#ifndef XSBENCHMAIN
+#    if ENABLE_SARRAYINDEX_TEST
+#        include "../tests/XSCompilerOptions.h"
+
+#        define XS_OVERRIDE_SHIFT_NS TESTISA(SArrayIndexTest)
+
+namespace XS_OVERRIDE_SHIFT_NS {
+#        include "Memory/XSSArrayIndex.hpp"
+}
+
+using namespace XS_OVERRIDE_SHIFT_NS;
+using namespace XS_OVERRIDE_SHIFT_NS::Shift;
+
+#        define BENCH_BINARY_NAME TESTISA(SArrayFindClosest)
+#        define BENCH_INDEX_NAME TESTISA(SArrayIndexFindClosest)
+#        define BENCH_BATCH_NAME TESTISA(SArrayIndexFindClosestBatch)
+
+/**
+ * Create a sorted array for benchmarking.
+ * @param number The number of elements.
+ * @returns The new array.
+ */
+inline SArray<uint32_t> searchBenchArray(const int64_t number) noexcept
+{
+    SArray<uint32_t> array(static_cast<uint0>(number));
+    const uint32_t step = static_cast<uint32_t>(0xFFFFFFFFULL / static_cast<uint64_t>(number));
+    for (int64_t i = 0; i < number; ++i) {
+        array.add(static_cast<uint32_t>(i) * step);
+    }
+    return array;
+}
+
+void TESTISA(SArrayFindClosest)(benchmark::State& state)
+{
+    auto array = searchBenchArray(state.range(0));
+    for (auto _ : state) {
+        uint64_t seed = 0;
+        uint64_t sum = 0;
+        for (int64_t i = 0; i < searchQueries; ++i) {
+            sum += static_cast<uint64_t>(array.findClosest(searchBenchValue(seed)) - array.begin());
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(int64_t(state.iterations()) * searchQueries);
+}
+
+void TESTISA(SArrayIndexFindClosest)(benchmark::State& state)
+{
+    auto array = searchBenchArray(state.range(0));
+    SArrayIndex<uint32_t> index(array);
+    for (auto _ : state) {
+        uint64_t seed = 0;
+        uint64_t sum = 0;
+        for (int64_t i = 0; i < searchQueries; ++i) {
+            sum += index.findClosest(searchBenchValue(seed));
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(int64_t(state.iterations()) * searchQueries);
+}
+
+void TESTISA(SArrayIndexFindClosestBatch)(benchmark::State& state)
+{
+    auto array = searchBenchArray(state.range(0));
+    SArrayIndex<uint32_t> index(array);
+    uint32_t values[searchQueries]; // NOLINT(modernize-avoid-c-arrays)
+    uint0 results[searchQueries];   // NOLINT(modernize-avoid-c-arrays)
+    uint64_t seed = 0;
+    for (auto& i : values) {
+        i = searchBenchValue(seed);
+    }
+    for (auto _ : state) {
+        index.findClosest(values, searchQueries, results);
+        benchmark::DoNotOptimize(results[searchQueries - 1]);
+    }
+    state.SetItemsProcessed(int64_t(state.iterations()) * searchQueries);
+}
+#    endif
+#else
+#    if XS_BENCH_SARRAYINDEX_STD
+#        include <algorithm>
+#        include <vector>
+
+#        define BENCH_BINARY_NAME SArrayFindClosest_std
+
+void SArrayFindClosest_std(benchmark::State& state)
+{
+    std::vector<uint32_t> array(static_cast<size_t>(state.range(0)));
+    const uint32_t step = static_cast<uint32_t>(0xFFFFFFFFULL / static_cast<uint64_t>(state.range(0)));
+    for (size_t i = 0; i < array.size(); ++i) {
+        array[i] = static_cast<uint32_t>(i) * step;
+    }
+    for (auto _ : state) {
+        uint64_t seed = 0;
+        uint64_t sum = 0;
+        for (int64_t i = 0; i < searchQueries; ++i) {
+            sum += static_cast<uint64_t>(
+                std::lower_bound(array.begin(), array.end(), searchBenchValue(seed)) - array.begin());
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(int64_t(state.iterations()) * searchQueries);
+}
+#    endif
+#endif
+
+#if ENABLE_SARRAYINDEX_TEST && !defined(XSBENCHMAIN)
+BENCHMARKT(BENCH_BINARY_NAME)->RangeMultiplier(8)->Range(searchStartRange, searchEndRange);
+BENCHMARKT(BENCH_INDEX_NAME)->RangeMultiplier(8)->Range(searchStartRange, searchEndRange);
+BENCHMARKT(BENCH_BATCH_NAME)->RangeMultiplier(8)->Range(searchStartRange, searchEndRange);
+#elif XS_BENCH_SARRAYINDEX_STD && defined(XSBENCHMAIN)
+BENCHMARKT(BENCH_BINARY_NAME)->RangeMultiplier(8)->Range(searchStartRange, searchEndRange);
+#endif
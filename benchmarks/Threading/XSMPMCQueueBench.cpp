@@ -0,0 +1,207 @@
+/**
+ * Copyright Matthew Oliver
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "XSBenchConfig.h"
+#include "XSCompiler.h"
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#define BENCHMARKT(n) BENCHMARK(n)
+
+constexpr int64_t queueMaxThreads = 4;
+constexpr uint32_t queueItems = 1 << 15;
+constexpr uint32_t queueSize = 1024;
+constexpr uint32_t queueStop = UINT32_MAX;
+
+/**
+ * Measure the throughput of a queue with a number of producer and consumer threads.
+ * @note The number of producers and consumers is taken from the benchmark state.
+ * @tparam Push Type of the function used to push a value, waiting while the queue is full.
+ * @tparam Pop  Type of the function used to pop a value, waiting while the queue is empty.
+ * @param state The benchmark state.
+ * @param push  Function used to push a value.
+ * @param pop   Function used to pop a value.
+ */
+template<typename Push, typename Pop>
+void queueContention(benchmark::State& state, Push push, Pop pop)
+{
+    const auto producers = static_cast<uint32_t>(state.range(0));
+    const auto consumers = static_cast<uint32_t>(state.range(1));
+    std::atomic<bool> stop = false;
+    std::atomic<uint64_t> consumed = 0;
+    std::vector<std::thread> producerThreads;
+    std::vector<std::thread> consumerThreads;
+    for (uint32_t i = 0; i < producers; ++i) {
+        producerThreads.emplace_back([&push, &stop]() {
+            for (uint32_t value = 0; !stop.load(std::memory_order_relaxed); value = (value + 1) & 0xFFFF) {
+                push(value);
+            }
+        });
+    }
+    for (uint32_t i = 0; i < consumers; ++i) {
+        consumerThreads.emplace_back([&pop, &consumed]() {
+            uint64_t count = 0;
+            while (pop() != queueStop) {
+                if (++count == 64) {
+                    consumed.fetch_add(count, std::memory_order_relaxed);
+                    count = 0;
+                }
+            }
+        });
+    }
+    uint64_t target = 0;
+    for (auto _ : state) {
+        target += queueItems;
+        while (consumed.load(std::memory_order_relaxed) < target) {
+            std::this_thread::yield();
+        }
+    }
+    stop.store(true, std::memory_order_relaxed);
+    for (auto& i : producerThreads) {
+        i.join();
+    }
+    for (uint32_t i = 0; i < consumers; ++i) {
+        push(queueStop);
+    }
+    for (auto& i : consumerThreads) {
+        i.join();
+    }
+    state.SetItemsProcessed(int64_t(state.iterations()) * queueItems);
+}
+
+#define ENABLE_MPMCQUEUE_TEST XS_BENCH_MPMCQUEUE
+#ifndef XSBENCHMAIN
+#    if ENABLE_MPMCQUEUE_TEST
+#        include "../tests/XSCompilerOptions.h"
+
+#        define XS_OVERRIDE_SHIFT_NS TESTISA(MPMCQueueTest)
+
+namespace XS_OVERRIDE_SHIFT_NS {
+#        include "Threading/XSMPMCQueue.hpp"
+}
+
+using namespace XS_OVERRIDE_SHIFT_NS;
+using namespace XS_OVERRIDE_SHIFT_NS::Shift;
+
+#        define BENCH_SPIN_NAME TESTISA(MPMCQueueSpin)
+#        define BENCH_BLOCKING_NAME TESTISA(MPMCQueueBlocking)
+
+/**
+ * Wait for another thread to make progress.
+ * @note Spins for a short time before yielding so that results remain valid when threads share a core.
+ * @param [in,out] spins The number of times waited since progress was last made.
+ */
+inline void queueBenchWait(uint32_t& spins) noexcept
+{
+    if (++spins < 64) {
+        cpuPause();
+    } else {
+        spins = 0;
+        std::this_thread::yield();
+    }
+}
+
+void TESTISA(MPMCQueueSpin)(benchmark::State& state)
+{
+    MPMCQueue<uint32_t> queue(queueSize);
+    queueContention(
+        state,
+        [&queue](const uint32_t value) {
+            uint32_t spins = 0;
+            while (!queue.tryPush(value)) {
+                queueBenchWait(spins);
+            }
+        },
+        [&queue]() {
+            uint32_t value;
+            uint32_t spins = 0;
+            while (!queue.tryPop(value)) {
+                queueBenchWait(spins);
+            }
+            return value;
+        });
+}
+
+void TESTISA(MPMCQueueBlocking)(benchmark::State& state)
+{
+    MPMCQueue<uint32_t, true> queue(queueSize);
+    queueContention(
+        state, [&queue](const uint32_t value) { queue.push(value); },
+        [&queue]() {
+            uint32_t value;
+            queue.pop(value);
+            return value;
+        });
+}
+#    endif
+#else
+#    if XS_BENCH_MPMCQUEUE_STD
+#        include <condition_variable>
+#        include <deque>
+#        include <mutex>
+
+#        define BENCH_BLOCKING_NAME MPMCQueueBlocking_std
+
+void MPMCQueueBlocking_std(benchmark::State& state)
+{
+    std::deque<uint32_t> queue;
+    std::mutex lock;
+    std::condition_variable notFull;
+    std::condition_variable notEmpty;
+    queueContention(
+        state,
+        [&](const uint32_t value) {
+            {
+                std::unique_lock<std::mutex> guard(lock);
+                notFull.wait(guard, [&queue]() { return queue.size() < queueSize; });
+                queue.push_back(value);
+            }
+            notEmpty.notify_one();
+        },
+        [&]() {
+            uint32_t value;
+            {
+                std::unique_lock<std::mutex> guard(lock);
+                notEmpty.wait(guard, [&queue]() { return !queue.empty(); });
+                value = queue.front();
+                queue.pop_front();
+            }
+            notFull.notify_one();
+            return value;
+        });
+}
+#    endif
+#endif
+
+#if ENABLE_MPMCQUEUE_TEST && !defined(XSBENCHMAIN)
+BENCHMARKT(BENCH_SPIN_NAME)
+    ->RangeMultiplier(2)
+    ->Ranges({{1, queueMaxThreads}, {1, queueMaxThreads}})
+    ->UseRealTime();
+BENCHMARKT(BENCH_BLOCKING_NAME)
+    ->RangeMultiplier(2)
+    ->Ranges({{1, queueMaxThreads}, {1, queueMaxThreads}})
+    ->UseRealTime();
+#elif XS_BENCH_MPMCQUEUE_STD && defined(XSBENCHMAIN)
+BENCHMARKT(BENCH_BLOCKING_NAME)
+    ->RangeMultiplier(2)
+    ->Ranges({{1, queueMaxThreads}, {1, queueMaxThreads}})
+    ->UseRealTime();
+#endif
@@ -0,0 +1,140 @@
+/**
+ * Copyright Matthew Oliver
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "XSBenchConfig.h"
+#include "XSCompiler.h"
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#define BENCHMARKT(n) BENCHMARK(n)
+
+constexpr int64_t parallelMaxThreads = 8;
+constexpr uint32_t parallelItems = 1 << 22;
+
+/**
+ * Sum a range of values.
+ * @param elements The values.
+ * @param number   The number of values.
+ * @returns The sum.
+ */
+inline uint64_t parallelBenchSum(const uint32_t* elements, const uint64_t number) noexcept
+{
+    uint64_t ret = 0;
+    for (uint64_t i = 0; i < number; ++i) {
+        ret += elements[i];
+    }
+    return ret;
+}
+
+/**
+ * Scale and offset a range of values.
+ * @param input  The input values.
+ * @param output The output values.
+ * @param number The number of values.
+ */
+inline void parallelBenchScale(const float* input, float* output, const uint64_t number) noexcept
+{
+    for (uint64_t i = 0; i < number; ++i) {
+        output[i] = input[i] * 3.0f + 1.0f;
+    }
+}
+
+#define ENABLE_PARALLEL_TEST XS_BENCH_PARALLEL
+#ifndef XSBENCHMAIN
+#    if ENABLE_PARALLEL_TEST
+#        include "../tests/XSCompilerOptions.h"
+
+#        define XS_OVERRIDE_SHIFT_NS TESTISA(ParallelTest)
+
+namespace XS_OVERRIDE_SHIFT_NS {
+#        include "Threading/XSParallel.hpp"
+}
+
+using namespace XS_OVERRIDE_SHIFT_NS;
+using namespace XS_OVERRIDE_SHIFT_NS::Shift;
+
+#        define BENCH_REDUCE_NAME TESTISA(ParallelReduce)
+#        define BENCH_TRANSFORM_NAME TESTISA(ParallelTransform)
+
+void TESTISA(ParallelReduce)(benchmark::State& state)
+{
+    ThreadPool pool(static_cast<uint32_t>(state.range(0)));
+    std::vector<uint32_t> values(parallelItems);
+    for (uint32_t i = 0; i < parallelItems; ++i) {
+        values[i] = i;
+    }
+    for (auto _ : state) {
+        uint64_t result = parallelReduce(values.data(), parallelItems, uint64_t{0}, parallelBenchSum,
+            [](const uint64_t first, const uint64_t second) { return first + second; }, pool);
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetBytesProcessed(int64_t(state.iterations()) * parallelItems * sizeof(uint32_t));
+}
+
+void TESTISA(ParallelTransform)(benchmark::State& state)
+{
+    ThreadPool pool(static_cast<uint32_t>(state.range(0)));
+    std::vector<float> input(parallelItems, 1.0f);
+    std::vector<float> output(parallelItems, 0.0f);
+    for (auto _ : state) {
+        parallelTransform(input.data(), output.data(), parallelItems, parallelBenchScale, pool);
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(int64_t(state.iterations()) * parallelItems * sizeof(float) * 2);
+}
+#    endif
+#else
+#    if XS_BENCH_PARALLEL_STD
+#        define BENCH_REDUCE_NAME ParallelReduce_std
+#        define BENCH_TRANSFORM_NAME ParallelTransform_std
+
+void ParallelReduce_std(benchmark::State& state)
+{
+    std::vector<uint32_t> values(parallelItems);
+    for (uint32_t i = 0; i < parallelItems; ++i) {
+        values[i] = i;
+    }
+    for (auto _ : state) {
+        uint64_t result = parallelBenchSum(values.data(), parallelItems);
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetBytesProcessed(int64_t(state.iterations()) * parallelItems * sizeof(uint32_t));
+}
+
+void ParallelTransform_std(benchmark::State& state)
+{
+    std::vector<float> input(parallelItems, 1.0f);
+    std::vector<float> output(parallelItems, 0.0f);
+    for (auto _ : state) {
+        parallelBenchScale(input.data(), output.data(), parallelItems);
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(int64_t(state.iterations()) * parallelItems * sizeof(float) * 2);
+}
+#    endif
+#endif
+
+#if ENABLE_PARALLEL_TEST && !defined(XSBENCHMAIN)
+BENCHMARKT(BENCH_REDUCE_NAME)->RangeMultiplier(2)->Range(1, parallelMaxThreads)->UseRealTime();
+BENCHMARKT(BENCH_TRANSFORM_NAME)->RangeMultiplier(2)->Range(1, parallelMaxThreads)->UseRealTime();
+#elif XS_BENCH_PARALLEL_STD && defined(XSBENCHMAIN)
+BENCHMARKT(BENCH_REDUCE_NAME)->UseRealTime();
+BENCHMARKT(BENCH_TRANSFORM_NAME)->UseRealTime();
+#endif
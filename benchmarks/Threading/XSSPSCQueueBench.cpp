@@ -0,0 +1,192 @@
+/**
+ * Copyright Matthew Oliver
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "XSBenchConfig.h"
+#include "XSCompiler.h"
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <thread>
+
+#define BENCHMARKT(n) BENCHMARK(n)
+
+constexpr int64_t queueBatchStart = 1;
+constexpr int64_t queueBatchEnd = 256;
+constexpr uint32_t queueItems = 1 << 16;
+constexpr uint32_t queueSize = 1024;
+
+#define ENABLE_SPSCQUEUE_TEST XS_BENCH_SPSCQUEUE
+#ifndef XSBENCHMAIN
+#    if ENABLE_SPSCQUEUE_TEST
+#        include "../tests/XSCompilerOptions.h"
+
+#        define XS_OVERRIDE_SHIFT_NS TESTISA(SPSCQueueTest)
+
+namespace XS_OVERRIDE_SHIFT_NS {
+#        include "Threading/XSSPSCQueue.hpp"
+}
+
+using namespace XS_OVERRIDE_SHIFT_NS;
+using namespace XS_OVERRIDE_SHIFT_NS::Shift;
+
+#        define BENCH_THROUGHPUT_NAME TESTISA(SPSCQueueThroughput)
+#        define BENCH_LATENCY_NAME TESTISA(SPSCQueueLatency)
+
+/**
+ * Wait for the other thread to make progress.
+ * @note Spins for a short time before yielding so that results remain valid when threads share a core.
+ * @param [in,out] spins The number of times waited since progress was last made.
+ */
+inline void queueBenchWait(uint32_t& spins) noexcept
+{
+    if (++spins < 64) {
+        cpuPause();
+    } else {
+        spins = 0;
+        std::this_thread::yield();
+    }
+}
+
+void TESTISA(SPSCQueueThroughput)(benchmark::State& state)
+{
+    // Producer continuously pushes batches while the benchmark thread pops them
+    const auto batch = static_cast<uint32_t>(state.range(0));
+    SPSCQueue<uint32_t> queue(queueSize);
+    std::atomic<bool> stop = false;
+    std::thread producer([&queue, &stop, batch]() {
+        uint32_t values[queueBatchEnd]; // NOLINT(modernize-avoid-c-arrays)
+        for (uint32_t i = 0; i < batch; ++i) {
+            values[i] = i;
+        }
+        uint32_t spins = 0;
+        while (!stop.load(std::memory_order_relaxed)) {
+            if (queue.tryPush(values, batch) == 0) {
+                queueBenchWait(spins);
+            }
+        }
+    });
+    uint32_t values[queueBatchEnd]; // NOLINT(modernize-avoid-c-arrays)
+    uint32_t spins = 0;
+    for (auto _ : state) {
+        uint64_t sum = 0;
+        for (uint32_t received = 0; received < queueItems;) {
+            const auto count = static_cast<uint32_t>(queue.tryPop(values, batch));
+            if (count == 0) {
+                queueBenchWait(spins);
+                continue;
+            }
+            sum += values[0];
+            received += count;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    stop.store(true, std::memory_order_relaxed);
+    producer.join();
+    state.SetItemsProcessed(int64_t(state.iterations()) * queueItems);
+}
+
+void TESTISA(SPSCQueueLatency)(benchmark::State& state)
+{
+    // Round trip time of a single element sent to another thread and back
+    SPSCQueue<uint32_t> request(queueSize);
+    SPSCQueue<uint32_t> response(queueSize);
+    std::thread echo([&request, &response]() {
+        uint32_t value = 0;
+        uint32_t spins = 0;
+        while (value != UINT32_MAX) {
+            if (request.tryPop(value)) {
+                response.tryPush(value);
+            } else {
+                queueBenchWait(spins);
+            }
+        }
+    });
+    uint32_t value = 0;
+    uint32_t spins = 0;
+    for (auto _ : state) {
+        request.tryPush(value);
+        while (!response.tryPop(value)) {
+            queueBenchWait(spins);
+        }
+        ++value;
+    }
+    request.tryPush(UINT32_MAX);
+    echo.join();
+}
+#    endif
+#else
+#    if XS_BENCH_SPSCQUEUE_STD
+#        include <deque>
+#        include <mutex>
+
+#        define BENCH_THROUGHPUT_NAME SPSCQueueThroughput_std
+
+void SPSCQueueThroughput_std(benchmark::State& state)
+{
+    const auto batch = static_cast<uint32_t>(state.range(0));
+    std::deque<uint32_t> queue;
+    std::mutex lock;
+    std::atomic<bool> stop = false;
+    std::thread producer([&queue, &lock, &stop, batch]() {
+        while (!stop.load(std::memory_order_relaxed)) {
+            bool pushed = false;
+            {
+                std::lock_guard<std::mutex> guard(lock);
+                if (queue.size() + batch <= queueSize) {
+                    for (uint32_t i = 0; i < batch; ++i) {
+                        queue.push_back(i);
+                    }
+                    pushed = true;
+                }
+            }
+            if (!pushed) {
+                std::this_thread::yield();
+            }
+        }
+    });
+    for (auto _ : state) {
+        uint64_t sum = 0;
+        for (uint32_t received = 0; received < queueItems;) {
+            uint32_t count;
+            {
+                std::lock_guard<std::mutex> guard(lock);
+                count = static_cast<uint32_t>(std::min<size_t>(batch, queue.size()));
+                for (uint32_t i = 0; i < count; ++i) {
+                    sum += queue.front();
+                    queue.pop_front();
+                }
+            }
+            if (count == 0) {
+                std::this_thread::yield();
+            }
+            received += count;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    stop.store(true, std::memory_order_relaxed);
+    producer.join();
+    state.SetItemsProcessed(int64_t(state.iterations()) * queueItems);
+}
+#    endif
+#endif
+
+#if ENABLE_SPSCQUEUE_TEST && !defined(XSBENCHMAIN)
+BENCHMARKT(BENCH_THROUGHPUT_NAME)->RangeMultiplier(4)->Range(queueBatchStart, queueBatchEnd)->UseRealTime();
+BENCHMARKT(BENCH_LATENCY_NAME)->UseRealTime();
+#elif XS_BENCH_SPSCQUEUE_STD && defined(XSBENCHMAIN)
+BENCHMARKT(BENCH_THROUGHPUT_NAME)->RangeMultiplier(4)->Range(queueBatchStart, queueBatchEnd)->UseRealTime();
+#endif
@@ -47,3 +47,39 @@
 
 /** A macro that defines whether the memMoveBackwards function should be benched in AVX512 configuration. */
 #define XS_BENCH_MEMMOVEBACK_AVX512 1
+
+/** A macro that defines whether the std::unordered_map container should be benched. */
+#define XS_BENCH_HASHMAP_STD 1
+
+/** A macro that defines whether the HashMap container should be benched. */
+#define XS_BENCH_HASHMAP 1
+
+/** A macro that defines whether the std::lower_bound search should be benched. */
+#define XS_BENCH_SARRAYINDEX_STD 1
+
+/** A macro that defines whether the SArrayIndex search should be benched. */
+#define XS_BENCH_SARRAYINDEX 1
+
+/** A macro that defines whether the std::deque container should be benched. */
+#define XS_BENCH_RINGBUFFER_STD 1
+
+/** A macro that defines whether the RingBuffer container should be benched. */
+#define XS_BENCH_RINGBUFFER 1
+
+/** A macro that defines whether a mutex protected std::deque should be benched. */
+#define XS_BENCH_SPSCQUEUE_STD 1
+
+/** A macro that defines whether the SPSCQueue container should be benched. */
+#define XS_BENCH_SPSCQUEUE 1
+
+/** A macro that defines whether a mutex and condition variable protected std::deque should be benched. */
+#define XS_BENCH_MPMCQUEUE_STD 1
+
+/** A macro that defines whether the MPMCQueue container should be benched. */
+#define XS_BENCH_MPMCQUEUE 1
+
+/** A macro that defines whether single threaded std loops should be benched. */
+#define XS_BENCH_PARALLEL_STD 1
+
+/** A macro that defines whether the parallel algorithms should be benched. */
+#define XS_BENCH_PARALLEL 1
@@ -0,0 +1,569 @@
+#pragma once
+/**
+ * Copyright Matthew Oliver
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Memory/XSAllocatorHeap.hpp"
+#include "Memory/XSArray.hpp"
+#include "SIMD/XSSIMD12.hpp"
+#include "SIMD/XSSIMD3x4.hpp"
+
+namespace Shift {
+namespace NoExport {
+/**
+ * Dynamic array of 3D elements stored as packed blocks of 4 elements.
+ * @note Each block stores the X, Y and Z values of 4 consecutive elements in separate lanes (XXXX YYYY ZZZZ) so that
+ * blocks can be directly loaded as packed 4-wide geometry types without any repacking. Conversion to and from arrays
+ * of single elements uses the SIMD3x4 transpose. Any unused lanes in the last block contain a copy of the last
+ * element so that operations such as bounding box calculations can operate on full blocks.
+ * @tparam T4    Packed 4-wide type used to access each block.
+ * @tparam T1    Single element type.
+ * @tparam Alloc Type of allocator used to allocate blocks.
+ */
+template<typename T4, typename T1, class Alloc>
+class Stream3D
+{
+public:
+    using Type = typename T1::Type;
+    using Block = T4;
+    using BlockData = typename T4::Data;
+    using Element = T1;
+    using ElementData = typename T1::Data;
+    using Handle = typename Alloc::Handle;
+    using Allocator = Alloc;
+
+    /**< Number of elements stored in each block */
+    static constexpr uint0 blockLength = 4;
+
+    static_assert(T4::packed, "Stream3D requires a packed block type");
+    static_assert(sizeof(ElementData) == sizeof(Type) * 3, "Stream3D requires an unpadded element data type");
+
+    Handle handle;      /**< The handle used to store blocks */
+    uint0 length = 0;   /**< Number of elements currently stored */
+    uint0 capacity = 0; /**< Number of elements that can be stored in the allocated blocks */
+
+    /** Default constructor. */
+    XS_INLINE Stream3D() noexcept = default;
+
+    /**
+     * Constructor that reserves space for a number of elements.
+     * @note The reserved space is rounded up to a multiple of blockLength.
+     * @param number The number of elements to reserve space for.
+     */
+    explicit XS_INLINE Stream3D(const uint0 number) noexcept
+        : handle(capacityFor(number) / blockLength)
+    {
+        if (handle.pointer != nullptr) [[likely]] {
+            capacity = capacityFor(number);
+        }
+    }
+
+    /**
+     * Copy constructor.
+     * @param other The other stream.
+     */
+    XS_INLINE Stream3D(const Stream3D& other) noexcept
+        : handle(other.capacity / blockLength)
+    {
+        if (handle.pointer != nullptr) [[likely]] {
+            capacity = other.capacity;
+            length = other.length;
+            memMove<BlockData>(handle.pointer, other.handle.pointer, getBlockCount() * sizeof(BlockData));
+        }
+    }
+
+    /**
+     * Move constructor.
+     * @param other The other stream.
+     */
+    XS_INLINE Stream3D(Stream3D&& other) noexcept
+        : handle(move(other.handle))
+        , length(other.length)
+        , capacity(other.capacity)
+    {
+        other.length = 0;
+        other.capacity = 0;
+    }
+
+    /** Destructor. */
+    XS_INLINE ~Stream3D() noexcept = default;
+
+    /**
+     * Assignment operator.
+     * @param other The other stream.
+     * @returns A deep copy of this object.
+     */
+    XS_INLINE Stream3D& operator=(const Stream3D& other) noexcept
+    {
+        if (this != &other) [[likely]] {
+            Stream3D temp(other);
+            swap(temp);
+        }
+        return *this;
+    }
+
+    /**
+     * Move assignment operator.
+     * @param other The other stream.
+     * @returns A shallow copy of this object.
+     */
+    XS_INLINE Stream3D& operator=(Stream3D&& other) noexcept
+    {
+        swap(other);
+        return *this;
+    }
+
+    /**
+     * Swap the contents of two streams around.
+     * @param [in,out] other The stream to swap with this one.
+     */
+    XS_INLINE void swap(Stream3D& other) noexcept
+    {
+        Shift::swap(handle, other.handle);
+        Shift::swap(length, other.length);
+        Shift::swap(capacity, other.capacity);
+    }
+
+    /**
+     * Checks whether the stream has any allocated memory.
+     * @returns True if valid, false if not.
+     */
+    XS_INLINE bool isValid() const noexcept
+    {
+        return capacity != 0;
+    }
+
+    /**
+     * Check if the stream is empty or not.
+     * @returns Boolean signaling if stream is empty.
+     */
+    XS_INLINE bool isEmpty() const noexcept
+    {
+        return length == 0;
+    }
+
+    /**
+     * Get the number of elements in the stream.
+     * @returns The number of elements currently stored within the stream.
+     */
+    XS_INLINE uint0 getLength() const noexcept
+    {
+        return length;
+    }
+
+    /**
+     * Get the number of elements currently reserved for.
+     * @returns The number of elements that can be stored before the stream must be reallocated.
+     */
+    XS_INLINE uint0 getReservedLength() const noexcept
+    {
+        return capacity;
+    }
+
+    /**
+     * Manually set the number of elements to reserve for.
+     * @note This will not reduce the reserved size below what is needed to hold the current elements. The reserved
+     * size is rounded up to a multiple of blockLength.
+     * @param number The number of elements to reserve space for.
+     * @returns Boolean signaling if new memory could be reserved.
+     */
+    XS_INLINE bool setReservedLength(const uint0 number) noexcept
+    {
+        const uint0 newCapacity = capacityFor(number > length ? number : length);
+        if (newCapacity == capacity) {
+            return true;
+        }
+        return relocate(newCapacity);
+    }
+
+    /**
+     * Manually check reserved space and increase only if necessary.
+     * @param number The number of elements to check if reserved.
+     * @returns Boolean signaling if the required amount of memory could be reserved.
+     */
+    XS_INLINE bool checkReservedLength(const uint0 number) noexcept
+    {
+        if (number <= capacity) [[likely]] {
+            return true;
+        }
+        // Use the same 1/4 growth algorithm as DArray to reduce the need to constantly reallocate
+        const uint0 grown = capacity + (capacity >> 2);
+        return relocate(capacityFor(grown > number ? grown : number));
+    }
+
+    /**
+     * Add an element to the end of the stream.
+     * @param element The new element.
+     * @returns Boolean representing if element could be added to stream. (will be false if memory could not be
+     *          allocated).
+     */
+    XS_INLINE bool add(const Element& element) noexcept
+    {
+        if (!checkReservedLength(length + 1)) [[unlikely]] {
+            return false;
+        }
+        const ElementData data(element);
+        // Fill all remaining lanes so that the last block is always full
+        Type* values = getBlockValues(length / blockLength);
+        for (uint0 i = length % blockLength; i < blockLength; ++i) {
+            setLane(values, i, data);
+        }
+        ++length;
+        return true;
+    }
+
+    /**
+     * Add 4 elements to the end of the stream.
+     * @param block The new elements.
+     * @returns Boolean representing if elements could be added to stream. (will be false if memory could not be
+     *          allocated).
+     */
+    XS_INLINE bool add(const Block& block) noexcept
+    {
+        if (!checkReservedLength(length + blockLength)) [[unlikely]] {
+            return false;
+        }
+        if (length % blockLength == 0) [[likely]] {
+            handle.pointer[length / blockLength].store(block);
+            length += blockLength;
+            return true;
+        }
+        const BlockData data(block);
+        const Type* source = reinterpret_cast<const Type*>(&data.values);
+        for (uint0 i = 0; i < blockLength; ++i) {
+            setLane(getBlockValues(length / blockLength), length % blockLength, source[i], source[i + 4],
+                source[i + 8]);
+            ++length;
+        }
+        fillTail();
+        return true;
+    }
+
+    /**
+     * Add a list of unpacked elements to the end of the stream.
+     * @note Groups of 4 elements are converted using a SIMD3x4 transpose directly into the packed blocks.
+     * @param elements Pointer to list of elements to add.
+     * @param number   The number of elements in the input list.
+     * @returns Boolean representing if elements could be added to stream. (will be false if memory could not be
+     *          allocated).
+     */
+    XS_INLINE bool add(const ElementData* const XS_RESTRICT elements, const uint0 number) noexcept
+    {
+        if (!checkReservedLength(length + number)) [[unlikely]] {
+            return false;
+        }
+        uint0 i = 0;
+        // Add single elements until the next element starts a new block
+        for (; i < number && length % blockLength != 0; ++i) {
+            setLane(getBlockValues(length / blockLength), length % blockLength, elements[i]);
+            ++length;
+        }
+        // The SIMD3x4 load may read a single value past the end of the group so the last group is added separately
+        if (isAligned(&elements[i])) [[likely]] {
+            for (; i + blockLength < number; i += blockLength) {
+                const auto values = reinterpret_cast<const SIMD3x4Data<Type>*>(&elements[i])
+                                        ->template load<Block::SIMD3x4Def::width>();
+                handle.pointer[length / blockLength].values.store(values.transpose());
+                length += blockLength;
+            }
+        }
+        for (; i < number; ++i) {
+            setLane(getBlockValues(length / blockLength), length % blockLength, elements[i]);
+            ++length;
+        }
+        fillTail();
+        return true;
+    }
+
+    /**
+     * Add an array of unpacked elements to the end of the stream.
+     * @tparam Alloc2 Type of allocator used by the array.
+     * @param array The elements to add.
+     * @returns Boolean representing if elements could be added to stream. (will be false if memory could not be
+     *          allocated).
+     */
+    template<typename Alloc2>
+    XS_INLINE bool add(const Array<ElementData, Alloc2>& array) noexcept
+    {
+        return add(array.getData(), array.getLength());
+    }
+
+    /**
+     * Copy a range of elements out of the stream into a list of unpacked elements.
+     * @note Groups of 4 elements are converted using a SIMD3x4 transpose directly from the packed blocks.
+     * @param [out] elements Pointer to list to store the elements into.
+     * @param       start    The position of the first element to copy.
+     * @param       number   The number of elements to copy.
+     */
+    XS_INLINE void get(ElementData* const XS_RESTRICT elements, const uint0 start, const uint0 number) const noexcept
+    {
+        XS_ASSERT(start + number <= length);
+        uint0 i = 0;
+        // Get single elements until the next element starts a new block
+        for (; i < number && (start + i) % blockLength != 0; ++i) {
+            getLane(start + i, elements[i]);
+        }
+        // The SIMD3x4 store may write a single value past the end of the group so the last group is copied separately
+        if (isAligned(&elements[i])) [[likely]] {
+            for (; i + blockLength < number; i += blockLength) {
+                const auto values = handle.pointer[(start + i) / blockLength]
+                                        .values.template load<Block::SIMD3x4Def::SIMD12Def::width>();
+                reinterpret_cast<SIMD3x4Data<Type>*>(&elements[i])->store(typename Block::SIMD3x4Def(values));
+            }
+        }
+        for (; i < number; ++i) {
+            getLane(start + i, elements[i]);
+        }
+    }
+
+    /**
+     * Copy all elements out of the stream into an array of unpacked elements.
+     * @tparam Alloc2 Type of allocator used by the array.
+     * @param [out] array The array to store the elements into.
+     * @returns False if the array is shorter than the stream.
+     */
+    template<typename Alloc2>
+    XS_INLINE bool get(Array<ElementData, Alloc2>& array) const noexcept
+    {
+        if (array.getLength() < length) [[unlikely]] {
+            return false;
+        }
+        get(array.getData(), 0, length);
+        return true;
+    }
+
+    /**
+     * Get an element.
+     * @param position The location of the element.
+     * @returns The requested element.
+     */
+    XS_INLINE Element at(const uint0 position) const noexcept
+    {
+        XS_ASSERT(position < length);
+        const Type* values = getBlockValues(position / blockLength);
+        const uint0 lane = position % blockLength;
+        return Element(values[lane], values[lane + 4], values[lane + 8]);
+    }
+
+    /**
+     * Set an existing element.
+     * @param position The location of the element.
+     * @param element  The new element.
+     */
+    XS_INLINE void set(const uint0 position, const Element& element) noexcept
+    {
+        XS_ASSERT(position < length);
+        setLane(getBlockValues(position / blockLength), position % blockLength, ElementData(element));
+        if (position == length - 1) {
+            fillTail();
+        }
+    }
+
+    /**
+     * Remove an element from the stream at a specific location.
+     * @note This moves all elements after position down 1.
+     * @param position The location the element should be removed from.
+     */
+    XS_INLINE void remove(const uint0 position) noexcept
+    {
+        XS_ASSERT(position < length);
+        for (uint0 i = position + 1; i < length; ++i) {
+            const Type* values = getBlockValues(i / blockLength);
+            const uint0 lane = i % blockLength;
+            setLane(getBlockValues((i - 1) / blockLength), (i - 1) % blockLength, values[lane], values[lane + 4],
+                values[lane + 8]);
+        }
+        --length;
+        fillTail();
+    }
+
+    /**
+     * Remove a number of elements from the end of the stream.
+     * @param number (Optional) The number of elements to remove.
+     */
+    XS_INLINE void removeBack(const uint0 number = 1) noexcept
+    {
+        XS_ASSERT(number <= length);
+        length -= number;
+        fillTail();
+    }
+
+    /** Remove all elements from the stream. */
+    XS_INLINE void removeAll() noexcept
+    {
+        length = 0;
+    }
+
+    /**
+     * Get the number of blocks needed to store all elements.
+     * @returns The number of blocks (the last block may be partially filled).
+     */
+    XS_INLINE uint0 getBlockCount() const noexcept
+    {
+        return (length + (blockLength - 1)) / blockLength;
+    }
+
+    /**
+     * Get the number of valid elements within a block.
+     * @param block The index of the block.
+     * @returns The number of valid elements, this is only less than blockLength for the last block.
+     */
+    XS_INLINE uint32 getBlockLength(const uint0 block) const noexcept
+    {
+        XS_ASSERT(block < getBlockCount());
+        const uint0 remaining = length - block * blockLength;
+        return static_cast<uint32>(remaining >= blockLength ? blockLength : remaining);
+    }
+
+    /**
+     * Get a block of 4 elements.
+     * @note Any unused lanes in the last block contain a copy of the last element.
+     * @param block The index of the block.
+     * @returns The loaded block.
+     */
+    XS_INLINE Block getBlock(const uint0 block) const noexcept
+    {
+        XS_ASSERT(block < getBlockCount());
+        return handle.pointer[block].template load<Block::width>();
+    }
+
+    /**
+     * Set a block of 4 elements.
+     * @note Writing to unused lanes of the last block has no effect on the number of elements in the stream.
+     * @param block  The index of the block.
+     * @param values The new elements.
+     */
+    XS_INLINE void setBlock(const uint0 block, const Block& values) noexcept
+    {
+        XS_ASSERT(block < getBlockCount());
+        handle.pointer[block].store(values);
+        if (block == getBlockCount() - 1) {
+            fillTail();
+        }
+    }
+
+    /**
+     * Get the number of elements that will be reserved in order to store a number of elements.
+     * @param number The number of elements.
+     * @returns The required capacity (multiple of blockLength).
+     */
+    XS_INLINE static uint0 capacityFor(const uint0 number) noexcept
+    {
+        return (number + (blockLength - 1)) & ~(blockLength - 1);
+    }
+
+    /**
+     * Move all blocks into newly allocated memory.
+     * @param newCapacity The new number of elements (must be a multiple of blockLength and large enough to store
+     *                    existing elements).
+     * @returns Boolean signaling if new memory could be allocated.
+     */
+    XS_INLINE bool relocate(const uint0 newCapacity) noexcept
+    {
+        XS_ASSERT(newCapacity % blockLength == 0);
+        XS_ASSERT(newCapacity >= length);
+        Handle newHandle(newCapacity / blockLength);
+        if (newHandle.pointer == nullptr) [[unlikely]] {
+            return false;
+        }
+        memMove<BlockData>(newHandle.pointer, handle.pointer, getBlockCount() * sizeof(BlockData));
+        Shift::swap(handle, newHandle);
+        capacity = newCapacity;
+        return true;
+    }
+
+private:
+    /**
+     * Get the values of a block.
+     * @param block The index of the block.
+     * @returns Pointer to the X values of the block followed by the Y and Z values.
+     */
+    XS_INLINE Type* getBlockValues(const uint0 block) noexcept
+    {
+        return reinterpret_cast<Type*>(&handle.pointer[block].values);
+    }
+
+    /**
+     * Get the values of a block.
+     * @param block The index of the block.
+     * @returns Pointer to the X values of the block followed by the Y and Z values.
+     */
+    XS_INLINE const Type* getBlockValues(const uint0 block) const noexcept
+    {
+        return reinterpret_cast<const Type*>(&handle.pointer[block].values);
+    }
+
+    /**
+     * Set a single lane of a block.
+     * @param values Pointer to the values of the block.
+     * @param lane   The lane to set.
+     * @param x      The X value.
+     * @param y      The Y value.
+     * @param z      The Z value.
+     */
+    XS_INLINE static void setLane(
+        Type* const XS_RESTRICT values, const uint0 lane, const Type x, const Type y, const Type z) noexcept
+    {
+        values[lane] = x;
+        values[lane + 4] = y;
+        values[lane + 8] = z;
+    }
+
+    /**
+     * Set a single lane of a block.
+     * @param values  Pointer to the values of the block.
+     * @param lane    The lane to set.
+     * @param element The new element.
+     */
+    XS_INLINE static void setLane(Type* const XS_RESTRICT values, const uint0 lane, const ElementData& element) noexcept
+    {
+        setLane(values, lane, element.values.value0, element.values.value1, element.values.value2);
+    }
+
+    /**
+     * Get a single element as unpacked data.
+     * @param       position The location of the element.
+     * @param [out] element  The element data to store into.
+     */
+    XS_INLINE void getLane(const uint0 position, ElementData& element) const noexcept
+    {
+        const Type* values = getBlockValues(position / blockLength);
+        const uint0 lane = position % blockLength;
+        element.values.setData(values[lane], values[lane + 4], values[lane + 8]);
+    }
+
+    /** Copy the last element into any unused lanes of the last block. */
+    XS_INLINE void fillTail() noexcept
+    {
+        if (const uint0 lane = length % blockLength; lane != 0) {
+            Type* values = getBlockValues(length / blockLength);
+            for (uint0 i = lane; i < blockLength; ++i) {
+                setLane(values, i, values[lane - 1], values[lane + 3], values[lane + 7]);
+            }
+        }
+    }
+
+    /**
+     * Check if an unpacked element can be accessed as a SIMD3x4.
+     * @param element The element to check.
+     * @returns True if the element is suitably aligned.
+     */
+    XS_INLINE static bool isAligned(const ElementData* const element) noexcept
+    {
+        return reinterpret_cast<uint0>(element) % alignof(SIMD3x4Data<Type>) == 0;
+    }
+};
+} // namespace NoExport
+} // namespace Shift
@@ -0,0 +1,30 @@
+#pragma once
+/**
+ * Copyright Matthew Oliver
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License") noexcept;
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Geometry/XSStream3D.hpp"
+#include "Geometry/XSVector3D4.hpp"
+
+namespace Shift {
+/**
+ * Dynamic array of vectors stored as packed blocks of 4 that can be directly loaded as Vector3D4.
+ * @note See NoExport::Stream3D for details.
+ * @tparam T     Generic type parameter.
+ * @tparam Alloc Type of allocator used to allocate blocks.
+ */
+template<typename T, class Alloc = AllocRegionHeap<Vector3D4Data<T, true>>>
+using Vector3DStream = NoExport::Stream3D<Vector3D4<T, true>, Vector3D<T>, Alloc>;
+} // namespace Shift
@@ -0,0 +1,270 @@
+#pragma once
+/**
+ * Copyright Matthew Oliver
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Memory/XSAllocatorHeap.hpp"
+
+namespace Shift {
+template<typename T, uint0 Number, uint0 TAlign>
+class AllocRegionSmallHandle;
+
+/**
+ * Allocator that stores small allocations inline and only falls back to the heap for larger ones.
+ * @note Memory is stored within the handle itself so any object using this allocator contains pointers to itself. Such
+ * objects must not be relocated using a raw memory copy (e.g. stored as elements of a container that grows using
+ * realloc).
+ * @tparam T      Type of object being allocated.
+ * @tparam Number The number of elements that can be stored inline.
+ * @tparam TAlign Alignment used for heap allocations.
+ */
+template<typename T, uint0 Number, uint0 TAlign = 0>
+class AllocRegionSmall
+{
+public:
+    using Handle = AllocRegionSmallHandle<T, Number, TAlign>;
+    using HeapAllocator = AllocRegionHeap<T, TAlign>;
+
+    template<typename T2, uint0 Number2 = Number, uint0 T2Align = 0>
+    using Allocator = AllocRegionSmall<T2, Number2, T2Align>;
+};
+
+template<typename T, uint0 Number, uint0 TAlign>
+class AllocRegionSmallHandle
+{
+public:
+    using Allocator = AllocRegionSmall<T, Number, TAlign>;
+    using HeapAllocator = typename Allocator::HeapAllocator;
+
+    static constexpr uint0 isResizable = true;
+    /**< Max possible allocated size */
+    static constexpr uint0 maxSize = Limits<uint0>::Max();
+    /**< Size of the inline memory (In Bytes) */
+    static constexpr uint0 inlineSize = Number * sizeof(T);
+
+    T* pointer = nullptr;                 /**< Pointer to allocated memory (inline or heap) */
+    alignas(T) uint8 storage[inlineSize]; /**< Inline memory */ // NOLINT(modernize-avoid-c-arrays)
+
+    /** Default constructor. */
+    XS_INLINE AllocRegionSmallHandle() noexcept = default;
+
+    /**
+     * Copy constructor.
+     * @param handle Reference to Handle object to copy.
+     */
+    XS_INLINE AllocRegionSmallHandle(const AllocRegionSmallHandle& handle) noexcept = delete;
+
+    /**
+     * Constructor to build from member variables.
+     * @param number The number of elements to reserve space for.
+     * @param alloc  (Optional) the allocator.
+     */
+    explicit XS_INLINE AllocRegionSmallHandle(
+        const uint0 number, [[maybe_unused]] const Allocator& alloc = Allocator()) noexcept
+        : pointer(number <= Number ? getStorage() : HeapAllocator::Allocate(number * sizeof(T)))
+    {}
+
+    /**
+     * Move constructor.
+     * @note If the other handle is using inline memory then its contents are copied.
+     * @param other The other.
+     */
+    XS_INLINE AllocRegionSmallHandle(AllocRegionSmallHandle&& other) noexcept
+    {
+        take(other);
+    }
+
+    /** Destructor. */
+    XS_INLINE ~AllocRegionSmallHandle() noexcept
+    {
+        unallocate();
+    }
+
+    /**
+     * Defaulted assignment operator.
+     * @param other The other handle.
+     * @returns A shallow copy of this object.
+     */
+    AllocRegionSmallHandle& operator=(const AllocRegionSmallHandle& other) noexcept = delete;
+
+    /**
+     * Move assignment operator.
+     * @note Swaps the memory of both handles.
+     * @param other The other handle.
+     * @returns A shallow copy of this object.
+     */
+    XS_INLINE AllocRegionSmallHandle& operator=(AllocRegionSmallHandle&& other) noexcept
+    {
+        AllocRegionSmallHandle temp;
+        temp.take(*this);
+        take(other);
+        other.take(temp);
+        return *this;
+    }
+
+    /**
+     * Allocate the specified amount of memory.
+     * @param size The amount of memory to allocate (In Bytes).
+     * @return Boolean value specifying if memory could be allocated or not.
+     */
+    XS_INLINE bool allocate(const uint0 size) noexcept
+    {
+        XS_ASSERT(pointer == nullptr);
+        pointer = size <= inlineSize ? getStorage() : HeapAllocator::Allocate(size);
+        return (pointer != nullptr);
+    }
+
+    /** Unallocate previously allocated memory. */
+    XS_INLINE void unallocate() noexcept
+    {
+        if (isHeap()) {
+            HeapAllocator::Unallocate(pointer);
+        }
+        pointer = nullptr;
+    }
+
+    /**
+     * Reallocate the specified amount of memory.
+     * @param size The amount of memory to allocate (In Bytes).
+     * @return Boolean value specifying if memory could be reallocated or not.
+     */
+    XS_INLINE bool reallocate(const uint0 size) noexcept
+    {
+        return reallocate(size, isHeap() ? min(size, HeapAllocator::AllocatedSize(pointer)) : min(size, inlineSize));
+    }
+
+    /**
+     * Reallocate the specified amount of memory.
+     * @note Memory moves between the inline storage and the heap as required. In this case copySize Bytes of the
+     * existing memory contents will be copied to the new memory location. If no new memory could be allocated then
+     * FALSE is returned and the internal memory pointer will be unmodified (i.e. no data will be lost).
+     * @param size     The amount of memory to allocate (In Bytes).
+     * @param copySize The amount of memory to copy should a new allocation be required (In Bytes).
+     * @return Boolean value specifying if memory could be reallocated or not.
+     */
+    XS_INLINE bool reallocate(const uint0 size, const uint0 copySize) noexcept
+    {
+        XS_ASSERT(copySize <= size);
+        T* XS_RESTRICT newPointer;
+        if (size <= inlineSize) {
+            if (pointer == getStorage()) {
+                return true;
+            }
+            newPointer = getStorage();
+        } else {
+            if (isHeap() && size <= HeapAllocator::AllocatedSize(pointer)) {
+                return true;
+            }
+            newPointer = HeapAllocator::Allocate(size);
+            if (newPointer == nullptr) [[unlikely]] {
+                return false;
+            }
+        }
+        if (pointer != nullptr && copySize > 0) {
+            memMove<T>(newPointer, pointer, copySize);
+        }
+        unallocate();
+        pointer = newPointer;
+        return true;
+    }
+
+    /**
+     * Reallocate the specified amount of memory while also having a fallback amount.
+     * @note If the desired size could not be allocated then the minimum size is tried instead.
+     * @param size     The amount of memory to allocate (In Bytes).
+     * @param copySize The amount of memory to copy should a new allocation be required (In Bytes).
+     * @param minSize  A fallback amount of memory to allocate if the desired value could not be (In Bytes).
+     * @return Boolean value specifying if memory could be reallocated or not.
+     */
+    XS_INLINE bool reallocate(const uint0 size, const uint0 copySize, const uint0 minSize) noexcept
+    {
+        return reallocate(size, copySize) || reallocate(minSize, copySize);
+    }
+
+    /**
+     * Check if the handle points to correctly allocated memory.
+     * @return Boolean signaling if pointing to correctly allocated memory.
+     */
+    XS_INLINE bool isValid() const noexcept
+    {
+        return (pointer != nullptr);
+    }
+
+    /**
+     * Check if the handle is using heap memory.
+     * @return Boolean signaling if the memory is stored on the heap instead of inline.
+     */
+    XS_INLINE bool isHeap() const noexcept
+    {
+        return (pointer != nullptr) & (pointer != getStorage());
+    }
+
+    /**
+     * Get the size of the allocated memory.
+     * @return The size of the allocated memory in Bytes.
+     */
+    XS_INLINE uint0 getAllocatedSize() const noexcept
+    {
+        XS_ASSERT(pointer != nullptr);
+        return isHeap() ? HeapAllocator::AllocatedSize(pointer) : inlineSize;
+    }
+
+    /**
+     * Get the number of elements currently allocated for.
+     * @return The number of elements that can fit within the allocated memory.
+     */
+    XS_INLINE uint0 getAllocatedElements() const noexcept
+    {
+        return getAllocatedSize() / sizeof(T);
+    }
+
+private:
+    /**
+     * Get the inline memory.
+     * @return Pointer to the start of the inline memory.
+     */
+    XS_INLINE T* getStorage() noexcept
+    {
+        return reinterpret_cast<T*>(storage);
+    }
+
+    /**
+     * Get the inline memory.
+     * @return Pointer to the start of the inline memory.
+     */
+    XS_INLINE const T* getStorage() const noexcept
+    {
+        return reinterpret_cast<const T*>(storage);
+    }
+
+    /**
+     * Take the memory from another handle.
+     * @note This handle must not have any allocated memory. Inline contents are copied while heap memory is just
+     * transferred.
+     * @param [in,out] other The handle to take memory from (will be left without allocated memory).
+     */
+    XS_INLINE void take(AllocRegionSmallHandle& other) noexcept
+    {
+        XS_ASSERT(pointer == nullptr);
+        if (other.isHeap()) {
+            pointer = other.pointer;
+        } else if (other.pointer != nullptr) {
+            pointer = getStorage();
+            memMove<uint8>(storage, other.storage, inlineSize);
+        }
+        other.pointer = nullptr;
+    }
+};
+} // namespace Shift
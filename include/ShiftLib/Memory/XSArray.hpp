@@ -98,10 +98,9 @@ public:
      * @param array The other array.
      */
     XS_INLINE Array(Array&& array) noexcept
-        : handle(forward<Handle>(array.handle))
-        , nextElement(forward<Type*>(array.nextElement))
+        : Array()
     {
-        array.nextElement = nullptr;
+        swap(array);
     }
 
     /**
@@ -292,8 +291,7 @@ public:
     XS_INLINE Array& operator=(Array&& array) noexcept
     {
         XS_ASSERT(handle.pointer != array.handle.pointer);
-        handle = forward<Handle>(array.handle);
-        Shift::swap(nextElement, array.nextElement);
+        swap(array);
         return *this;
     }
 
@@ -312,8 +310,14 @@ public:
      */
     XS_INLINE void swap(Array& array) noexcept
     {
+        // Pointers are rebuilt from offsets as some handles store memory internally and copy it when moved
+        const uint0 size = static_cast<uint0>(
+            reinterpret_cast<uint8*>(nextElement) - reinterpret_cast<uint8*>(handle.pointer));
+        const uint0 size2 = static_cast<uint0>(
+            reinterpret_cast<uint8*>(array.nextElement) - reinterpret_cast<uint8*>(array.handle.pointer));
         Shift::swap(handle, array.handle);
-        Shift::swap(nextElement, array.nextElement);
+        nextElement = reinterpret_cast<Type*>(reinterpret_cast<uint8*>(handle.pointer) + size2);
+        array.nextElement = reinterpret_cast<Type*>(reinterpret_cast<uint8*>(array.handle.pointer) + size);
     }
 
     /**
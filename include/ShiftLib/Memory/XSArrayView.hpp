@@ -35,7 +35,7 @@ public:
     using Allocator = AllocRegionHeap<T>;
     static constexpr uint0 isResizable = false;
 
-    const T* pointer = nullptr; /**< Pointer to associated memory */
+    T* pointer = nullptr; /**< Pointer to associated memory (never modified through the handle) */
 
     /** Default constructor. */
     XS_INLINE AllocNullHandle() noexcept = default;
@@ -50,8 +50,8 @@ public:
      * Constructor.
      * @param [in] pointer If non-null, the pointer.
      */
-    XS_INLINE explicit AllocNullHandle(const T* const pointer)
-        : pointer(pointer)
+    XS_INLINE explicit AllocNullHandle(const T* const pointer) noexcept
+        : pointer(const_cast<T*>(pointer))
     {}
 
     /**
@@ -60,6 +60,20 @@ public:
      */
     XS_INLINE AllocNullHandle(AllocNullHandle&& other) noexcept = default;
 
+    /**
+     * Defaulted assignment operator.
+     * @param other The other.
+     * @returns A shallow copy of this object.
+     */
+    XS_INLINE AllocNullHandle& operator=(const AllocNullHandle& other) noexcept = default;
+
+    /**
+     * Defaulted move assignment operator.
+     * @param other The other.
+     * @returns A shallow copy of this object.
+     */
+    XS_INLINE AllocNullHandle& operator=(AllocNullHandle&& other) noexcept = default;
+
     /**
      * Check if the handle points to correctly allocated memory.
      * @return Boolean signaling if pointing to correctly allocated memory.
@@ -69,10 +83,21 @@ public:
         // Check if pointer points to anything
         return (pointer != nullptr);
     }
+
+    /** Release the associated memory, this does nothing as the memory is not owned by the handle. */
+    XS_INLINE void unallocate() noexcept
+    {
+        pointer = nullptr;
+    }
 };
 
+template<class T>
+class StridedArrayView;
+
 /**
  * Array View template class used to access sections of memory.
+ * @note The viewed elements are not owned by the view so they must remain valid for the lifetime of the view. Sub
+ * views, strided views and field projections can all be created without copying any elements.
  * @tparam T Type of element stored within array.
  */
 template<class T>
@@ -80,50 +105,92 @@ class ArrayView : protected Array<T, AllocNull<T>>
 {
 public:
     using IArray = Array<T, AllocNull<T>>;
+    using Type = T;
     using TypeConstIterator = typename IArray::TypeConstIterator;
     using TypeConstIteratorOffset = typename IArray::TypeConstIteratorOffset;
 
-    using IArray::Array;
+    /** Default constructor. */
+    XS_INLINE ArrayView() noexcept = default;
 
     /**
      * Constructor.
      * @param elements The pointer to viewed elements.
      * @param number   Number of elements pointed to.
      */
-    XS_INLINE ArrayView(const T* const elements, const uint32 number) noexcept
+    XS_INLINE ArrayView(const T* const elements, const uint0 number) noexcept
     {
-        this->handle.pointer(elements);
-        this->nextElement(this->handle.pointer + number);
+        this->handle.pointer = const_cast<T*>(elements);
+        this->nextElement = this->handle.pointer + number;
     }
 
     /**
-     * Defaulted copy constructor.
+     * Construct a view of all the elements in an array.
+     * @tparam Alloc Type of allocator used by the array.
+     * @param array The array to view.
+     */
+    template<class Alloc>
+    XS_INLINE ArrayView(const Array<T, Alloc>& array) noexcept // NOLINT(google-explicit-constructor)
+        : ArrayView(array.getData(), array.getLength())
+    {}
+
+    /**
+     * Construct a view of a sub section of an array.
+     * @tparam Alloc Type of allocator used by the array.
+     * @param array The array to view.
+     * @param start The location the view should start from.
+     * @param end   The location where the view should end (non inclusive).
+     */
+    template<class Alloc>
+    XS_INLINE ArrayView(const Array<T, Alloc>& array, const uint0 start, const uint0 end) noexcept
+        : ArrayView(array.getData() + start, end - start)
+    {
+        XS_ASSERT(start <= end && end <= array.getLength());
+    }
+
+    /**
+     * Copy constructor.
      * @param other The other.
      */
-    XS_INLINE ArrayView(const ArrayView& other) noexcept = default;
+    XS_INLINE ArrayView(const ArrayView& other) noexcept
+        : ArrayView(other.getData(), other.getLength())
+    {}
 
     /**
-     * Defaulted move constructor.
+     * Move constructor.
      * @param other The other.
      */
-    XS_INLINE ArrayView(ArrayView&& other) noexcept = default;
+    XS_INLINE ArrayView(ArrayView&& other) noexcept
+        : ArrayView(other.getData(), other.getLength())
+    {}
 
     /**
-     * Defaulted assignment operator.
+     * Assignment operator.
      * @param other The other.
      * @returns A shallow copy of this object.
      */
-    XS_INLINE ArrayView& operator=(const ArrayView& other) noexcept = default;
+    XS_INLINE ArrayView& operator=(const ArrayView& other) noexcept
+    {
+        this->handle.pointer = other.handle.pointer;
+        this->nextElement = other.nextElement;
+        return *this;
+    }
 
     /**
-     * Defaulted move assignment operator.
+     * Move assignment operator.
      * @param other The other.
      * @returns A shallow copy of this object.
      */
-    XS_INLINE ArrayView& operator=(ArrayView&& other) noexcept = default;
+    XS_INLINE ArrayView& operator=(ArrayView&& other) noexcept
+    {
+        return *this = other;
+    }
 
-    /** Defaulted destructor. */
-    XS_INLINE ~ArrayView() noexcept = default;
+    /** Destructor. */
+    XS_INLINE ~ArrayView() noexcept
+    {
+        // The viewed elements are not owned so the base array must not destruct them
+        this->nextElement = this->handle.pointer;
+    }
 
     using IArray::cbegin;
     using IArray::cend;
@@ -136,7 +203,33 @@ public:
     using IArray::isEmpty;
     using IArray::isValid;
     using IArray::positionAt;
-    using IArray::swap;
+
+    /**
+     * Swap the contents of two views around.
+     * @param [in,out] view View object to swap with this one.
+     */
+    XS_INLINE void swap(ArrayView& view) noexcept
+    {
+        IArray::swap(view);
+    }
+
+    /**
+     * Get the constant iterator to the start of the view.
+     * @return The iterator.
+     */
+    XS_INLINE TypeConstIterator begin() const noexcept
+    {
+        return this->IArray::cbegin();
+    }
+
+    /**
+     * Get the constant iterator to the end of the view.
+     * @return The iterator.
+     */
+    XS_INLINE TypeConstIterator end() const noexcept
+    {
+        return this->IArray::cend();
+    }
 
     /**
      * Get the constant iterator to a specific element in the array.
@@ -216,5 +309,350 @@ public:
     {
         return this->IArray::getData();
     }
+
+    /**
+     * Get a view of a sub section of the view.
+     * @param start The location the new view should start from.
+     * @param end   The location where the new view should end (non inclusive).
+     * @return The new view.
+     */
+    XS_INLINE ArrayView subview(const uint0 start, const uint0 end) const noexcept
+    {
+        XS_ASSERT(start <= end && end <= getLength());
+        return ArrayView(getData() + start, end - start);
+    }
+
+    /**
+     * Get a view of every k-th element.
+     * @param step  The number of elements between each viewed element (must be non-zero).
+     * @param start (Optional) The location of the first viewed element.
+     * @return The strided view.
+     */
+    XS_INLINE StridedArrayView<T> stride(const uint0 step, const uint0 start = 0) const noexcept
+    {
+        return StridedArrayView<T>(getData(), getLength(), sizeof(T)).stride(step, start);
+    }
+
+    /**
+     * Get a view of a single member of every element.
+     * @note This can be used to access one field of an array of structures as if it was a separate array.
+     * @tparam T2    Type of the member.
+     * @tparam Class Type of the class containing the member (must be the same as the element type).
+     * @param member The member to view.
+     * @return The strided view of each elements member.
+     */
+    template<typename T2, typename Class>
+    requires(isSame<Class, T>)
+    XS_INLINE StridedArrayView<T2> field(T2 Class::*member) const noexcept
+    {
+        return StridedArrayView<T>(getData(), getLength(), sizeof(T)).field(member);
+    }
+};
+
+/**
+ * Strided Array View template class used to access elements separated by a fixed number of bytes.
+ * @note The viewed elements are not owned by the view so they must remain valid for the lifetime of the view. The
+ * stride may be any multiple of the elements alignment which allows viewing every k-th element of an array or a single
+ * member of an array of structures.
+ * @tparam T Type of element stored within array.
+ */
+template<class T>
+class StridedArrayView
+{
+public:
+    using Type = T;
+    using TypeConstIterator = ConstStrideIterator<T>;
+
+    const T* pointer = nullptr;   /**< Pointer to the first viewed element */
+    uint0 length = 0;             /**< Number of viewed elements */
+    uint0 strideSize = sizeof(T); /**< Number of bytes between each element */
+
+    /** Default constructor. */
+    XS_INLINE StridedArrayView() noexcept = default;
+
+    /**
+     * Constructor.
+     * @param elements The pointer to the first viewed element.
+     * @param number   Number of elements viewed.
+     * @param stride   The number of bytes between each element (must be a multiple of the elements alignment).
+     */
+    XS_INLINE StridedArrayView(const T* const elements, const uint0 number, const uint0 stride) noexcept
+        : pointer(elements)
+        , length(number)
+        , strideSize(stride)
+    {
+        XS_ASSERT(stride % alignof(T) == 0);
+    }
+
+    /**
+     * Construct a view of all the elements in a view.
+     * @param view The view to view.
+     */
+    XS_INLINE StridedArrayView(const ArrayView<T>& view) noexcept // NOLINT(google-explicit-constructor)
+        : StridedArrayView(view.getData(), view.getLength(), sizeof(T))
+    {}
+
+    /**
+     * Construct a view of all the elements in an array.
+     * @tparam Alloc Type of allocator used by the array.
+     * @param array The array to view.
+     */
+    template<class Alloc>
+    XS_INLINE StridedArrayView(const Array<T, Alloc>& array) noexcept // NOLINT(google-explicit-constructor)
+        : StridedArrayView(array.getData(), array.getLength(), sizeof(T))
+    {}
+
+    /**
+     * Defaulted copy constructor.
+     * @param other The other.
+     */
+    XS_INLINE StridedArrayView(const StridedArrayView& other) noexcept = default;
+
+    /**
+     * Defaulted move constructor.
+     * @param other The other.
+     */
+    XS_INLINE StridedArrayView(StridedArrayView&& other) noexcept = default;
+
+    /**
+     * Defaulted assignment operator.
+     * @param other The other.
+     * @returns A shallow copy of this object.
+     */
+    XS_INLINE StridedArrayView& operator=(const StridedArrayView& other) noexcept = default;
+
+    /**
+     * Defaulted move assignment operator.
+     * @param other The other.
+     * @returns A shallow copy of this object.
+     */
+    XS_INLINE StridedArrayView& operator=(StridedArrayView&& other) noexcept = default;
+
+    /** Defaulted destructor. */
+    XS_INLINE ~StridedArrayView() noexcept = default;
+
+    /**
+     * Get the number of elements in the view.
+     * @return The length.
+     */
+    XS_INLINE uint0 getLength() const noexcept
+    {
+        return length;
+    }
+
+    /**
+     * Get the number of bytes between each element.
+     * @return The stride.
+     */
+    XS_INLINE uint0 getStride() const noexcept
+    {
+        return strideSize;
+    }
+
+    /**
+     * Query if the view is empty.
+     * @return True if empty, false if not.
+     */
+    XS_INLINE bool isEmpty() const noexcept
+    {
+        return length == 0;
+    }
+
+    /**
+     * Query if the elements are contiguous in memory.
+     * @return True if contiguous, false if not.
+     */
+    XS_INLINE bool isContiguous() const noexcept
+    {
+        return strideSize == sizeof(T);
+    }
+
+    /**
+     * Get the constant iterator to the start of the view.
+     * @return The iterator.
+     */
+    XS_INLINE TypeConstIterator begin() const noexcept
+    {
+        return TypeConstIterator(pointer, strideSize);
+    }
+
+    /**
+     * Get the constant iterator to the start of the view.
+     * @return The iterator.
+     */
+    XS_INLINE TypeConstIterator cbegin() const noexcept
+    {
+        return begin();
+    }
+
+    /**
+     * Get the constant iterator to the end of the view.
+     * @return The iterator.
+     */
+    XS_INLINE TypeConstIterator end() const noexcept
+    {
+        return begin() + length;
+    }
+
+    /**
+     * Get the constant iterator to the end of the view.
+     * @return The iterator.
+     */
+    XS_INLINE TypeConstIterator cend() const noexcept
+    {
+        return end();
+    }
+
+    /**
+     * Get the constant iterator to a specific element in the view.
+     * @param position The number of the element in the view to create iterator for.
+     * @return An iterator pointing to desired element of the view.
+     */
+    XS_INLINE TypeConstIterator iteratorAt(const uint0 position) const noexcept
+    {
+        return begin() + position;
+    }
+
+    /**
+     * Get the position of an iterator in the view.
+     * @param iterator The iterator of the element.
+     * @return The position.
+     */
+    XS_INLINE uint0 positionAt(const TypeConstIterator& iterator) const noexcept
+    {
+        return iterator - begin();
+    }
+
+    /**
+     * At function to get an constant element.
+     * @param position The element to get (return is undefined if the input position is invalid).
+     * @return Constant reference to desired element.
+     */
+    XS_INLINE const T& at(const uint0 position) const noexcept
+    {
+        XS_ASSERT(position < length);
+        return *reinterpret_cast<const T*>(reinterpret_cast<const uint8*>(pointer) + position * strideSize);
+    }
+
+    /**
+     * At function to get an constant element.
+     * @param iterator The iterator of the element to get (return is undefined if the input iterator is invalid).
+     * @return Constant reference to desired element.
+     */
+    XS_INLINE const T& at(const TypeConstIterator& iterator) const noexcept
+    {
+        return *iterator;
+    }
+
+    /**
+     * Get a view of a sub section of the view.
+     * @param start The location the new view should start from.
+     * @param end   The location where the new view should end (non inclusive).
+     * @return The new view.
+     */
+    XS_INLINE StridedArrayView subview(const uint0 start, const uint0 end) const noexcept
+    {
+        XS_ASSERT(start <= end && end <= length);
+        return StridedArrayView(&at(start), end - start, strideSize);
+    }
+
+    /**
+     * Get a view of every k-th element.
+     * @param step  The number of elements between each viewed element (must be non-zero).
+     * @param start (Optional) The location of the first viewed element.
+     * @return The strided view.
+     */
+    XS_INLINE StridedArrayView stride(const uint0 step, const uint0 start = 0) const noexcept
+    {
+        XS_ASSERT(step > 0);
+        if (start >= length) {
+            return StridedArrayView(pointer, 0, strideSize * step);
+        }
+        return StridedArrayView(&at(start), (length - start + step - 1) / step, strideSize * step);
+    }
+
+    /**
+     * Get a view of a single member of every element.
+     * @tparam T2    Type of the member.
+     * @tparam Class Type of the class containing the member (must be the same as the element type).
+     * @param member The member to view.
+     * @return The strided view of each elements member.
+     */
+    template<typename T2, typename Class>
+    requires(isSame<Class, T>)
+    XS_INLINE StridedArrayView<T2> field(T2 Class::*member) const noexcept
+    {
+        if (length == 0) {
+            return StridedArrayView<T2>(nullptr, 0, strideSize);
+        }
+        return StridedArrayView<T2>(&(pointer->*member), length, strideSize);
+    }
+
+    /**
+     * Copy a range of elements into contiguous memory.
+     * @note 32 and 64 bit elements are loaded using SIMD gather instructions when available.
+     * @param          position The first element to copy.
+     * @param          number   The number of elements to copy.
+     * @param [in,out] output   Pointer to memory that the elements are copied into (must have space for number
+     *                          elements).
+     */
+    XS_INLINE void gather(const uint0 position, const uint0 number, T* const XS_RESTRICT output) const noexcept
+    {
+        XS_ASSERT(position + number <= length);
+        const auto* XS_RESTRICT source = reinterpret_cast<const uint8*>(pointer) + position * strideSize;
+        uint0 i = 0;
+        if constexpr (isTriviallyCopyable<T> && (sizeof(T) == 4 || sizeof(T) == 8)) {
+#if XS_ISA == XS_X86
+            // Gather offsets are signed 32bit so they are made relative to the start of each group of elements
+            constexpr uint0 width = 16 / sizeof(T);
+            [[maybe_unused]] const bool useGather = strideSize <= static_cast<uint0>(INT32_MAX) / 16;
+            if constexpr (hasISAFeature<ISAFeature::AVX512F>) {
+                if (useGather) {
+                    const auto step = static_cast<int32>(strideSize);
+                    if constexpr (sizeof(T) == 4) {
+                        const __m512i offsets = _mm512_mullo_epi32(
+                            _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15),
+                            _mm512_set1_epi32(step));
+                        for (; i + width * 4 <= number; i += width * 4) {
+                            _mm512_storeu_si512(
+                                output + i, _mm512_i32gather_epi32(offsets, source + i * strideSize, 1));
+                        }
+                    } else {
+                        const __m256i offsets =
+                            _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32(step));
+                        for (; i + width * 4 <= number; i += width * 4) {
+                            _mm512_storeu_si512(
+                                output + i, _mm512_i32gather_epi64(offsets, source + i * strideSize, 1));
+                        }
+                    }
+                }
+            }
+            if constexpr (hasISAFeature<ISAFeature::AVX2>) {
+                if (useGather) {
+                    const auto step = static_cast<int32>(strideSize);
+                    if constexpr (sizeof(T) == 4) {
+                        const __m256i offsets =
+                            _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32(step));
+                        for (; i + width * 2 <= number; i += width * 2) {
+                            _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + i),
+                                _mm256_i32gather_epi32(
+                                    reinterpret_cast<const int32*>(source + i * strideSize), offsets, 1));
+                        }
+                    } else {
+                        const __m128i offsets = _mm_mullo_epi32(_mm_setr_epi32(0, 1, 2, 3), _mm_set1_epi32(step));
+                        for (; i + width * 2 <= number; i += width * 2) {
+                            _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + i),
+                                _mm256_i32gather_epi64(
+                                    reinterpret_cast<const long long*>(source + i * strideSize), offsets, 1));
+                        }
+                    }
+                }
+            }
+#endif
+        }
+        for (; i < number; ++i) {
+            output[i] = *reinterpret_cast<const T*>(source + i * strideSize);
+        }
+    }
 };
 } // namespace Shift
@@ -0,0 +1,512 @@
+#pragma once
+/**
+ * Copyright Matthew Oliver
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Memory/XSAllocatorHeap.hpp"
+#include "Memory/XSDArray.hpp"
+#include "Memory/XSString.hpp"
+#include "Memory/XSStringView.hpp"
+#include "Threading/XSAtomic.hpp"
+#include "XSBit.hpp"
+#include "XSHash.hpp"
+
+namespace Shift {
+/**
+ * Compact reference to a string stored within an AtomTable.
+ * @note Atoms from the same table are equal only if they reference the same string so comparison and hashing only
+ * operate on the 32bit identifier. Atoms from different tables must not be mixed.
+ */
+class Atom
+{
+public:
+    /**< Identifier used by atoms that do not reference a string */
+    static constexpr uint32 invalidID = Limits<uint32>::Max();
+
+    uint32 id = invalidID; /**< Identifier of the string within its table */
+
+    /** Default constructor. */
+    XS_INLINE Atom() noexcept = default;
+
+    /**
+     * Constructor to build from an identifier.
+     * @param idIn The identifier of the string.
+     */
+    explicit XS_INLINE Atom(const uint32 idIn) noexcept
+        : id(idIn)
+    {}
+
+    /**
+     * Query if the atom references a string.
+     * @returns True if valid, false if not.
+     */
+    XS_INLINE bool isValid() const noexcept
+    {
+        return id != invalidID;
+    }
+
+    /**
+     * Equality operator.
+     * @param other The atom to compare to this object.
+     * @returns True if both atoms reference the same string.
+     */
+    XS_INLINE bool operator==(const Atom other) const noexcept
+    {
+        return id == other.id;
+    }
+
+    /**
+     * Inequality operator.
+     * @param other The atom to compare to this object.
+     * @returns True if the atoms reference different strings.
+     */
+    XS_INLINE bool operator!=(const Atom other) const noexcept
+    {
+        return id != other.id;
+    }
+};
+
+/** Hash functor for atoms. */
+template<>
+class Hash<Atom>
+{
+public:
+    /**
+     * Hash a value.
+     * @param value The value to hash.
+     * @returns The 64bit hash value.
+     */
+    XS_INLINE uint64 operator()(const Atom value) const noexcept
+    {
+        return hashInteger(value.id);
+    }
+};
+
+namespace NoExport {
+/**< Number of bits of an atom identifier used to select the shard (the remaining bits index into the shard) */
+inline constexpr uint32 atomTableShardBits = 4;
+
+/**
+ * String stored within an AtomTable.
+ * @tparam CharType Type of character used by the string.
+ */
+template<typename CharType>
+class AtomTableEntry
+{
+public:
+    const CharType* pointer; /**< The null terminated characters of the string */
+    uint0 length;            /**< Number of characters in the string */
+    uint64 hash;             /**< The hash of the strings characters */
+};
+
+/**
+ * Independently locked section of an AtomTable.
+ * @note Entries are stored in a list of blocks where each block is twice the size of the previous one. Blocks are
+ * never reallocated so entries (and the characters they point to) can be read without taking the lock.
+ * @tparam CharType Type of character used by the strings.
+ * @tparam Alloc    Type of allocator used to allocate memory.
+ */
+template<typename CharType, class Alloc>
+class alignas(cacheLineSize) AtomTableShard
+{
+public:
+    using View = StringView<CharType>;
+    using Entry = AtomTableEntry<CharType>;
+    using Handle = typename Alloc::Handle;
+    using EntryHandle = typename Alloc::template Allocator<Entry>::Handle;
+    using IndexHandle = typename Alloc::template Allocator<uint32>::Handle;
+    using ChunkArray = DArray<Handle, typename Alloc::template Allocator<Handle>>;
+
+    /**< Number of bits used for the number of entries in the first block */
+    static constexpr uint32 firstBlockBits = 6;
+    /**< Maximum number of entries that can be stored */
+    static constexpr uint32 maxLength = (1_ui32 << (32 - atomTableShardBits)) - 1;
+    /**< Number of blocks required to store the maximum number of entries */
+    static constexpr uint32 blockCount = 32 - atomTableShardBits - firstBlockBits + 1;
+    /**< The minimum number of characters allocated for a chunk */
+    static constexpr uint0 chunkLength = 4096;
+
+    mutable std::atomic<bool> locked = false; /**< Lock used to serialise access to the index */
+    std::atomic<uint32> length = 0;           /**< Number of entries currently stored */
+    EntryHandle blocks[blockCount];           /**< The blocks used to store entries */ // NOLINT(modernize-avoid-c-arrays)
+    IndexHandle index;                        /**< Open addressed table of entry index + 1 (0 if unused) */
+    uint0 capacity = 0;                       /**< Number of slots in the index (power of 2) */
+    ChunkArray chunks;                        /**< The chunks used to store characters */
+    CharType* next = nullptr;                 /**< Next free character in the current chunk */
+    uint0 remaining = 0;                      /**< Number of unused characters in the current chunk */
+
+    /** Acquire the lock. */
+    XS_INLINE void lock() const noexcept
+    {
+        while (locked.exchange(true, std::memory_order_acquire)) [[unlikely]] {
+            while (locked.load(std::memory_order_relaxed)) {
+                cpuPause();
+            }
+        }
+    }
+
+    /** Release the lock. */
+    XS_INLINE void unlock() const noexcept
+    {
+        locked.store(false, std::memory_order_release);
+    }
+
+    /**
+     * Get an entry.
+     * @note Does not require the lock to be held.
+     * @param element The index of the entry to retrieve.
+     * @returns The requested entry.
+     */
+    XS_INLINE const Entry& getEntry(const uint32 element) const noexcept
+    {
+        XS_ASSERT(element < length.load(std::memory_order_relaxed));
+        const uint32 block = bsr((element >> firstBlockBits) + 1_ui32);
+        return blocks[block].pointer[element - (((1_ui32 << block) - 1_ui32) << firstBlockBits)];
+    }
+
+    /**
+     * Find an existing string.
+     * @note Requires the lock to be held.
+     * @param string The string to search for.
+     * @param hash   The hash of the string.
+     * @returns The index of the strings entry if found, maxLength otherwise.
+     */
+    XS_INLINE uint32 find(const View& string, const uint64 hash) const noexcept
+    {
+        if (capacity == 0) [[unlikely]] {
+            return maxLength;
+        }
+        const uint0 mask = capacity - 1;
+        for (uint0 i = static_cast<uint0>(hash) & mask;; i = (i + 1) & mask) {
+            const uint32 slot = index.pointer[i];
+            if (slot == 0) {
+                return maxLength;
+            }
+            const Entry& entry = getEntry(slot - 1);
+            if (entry.hash == hash && View(entry.pointer, entry.length) == string) {
+                return slot - 1;
+            }
+        }
+    }
+
+    /**
+     * Add a new string.
+     * @note Requires the lock to be held and the string to not already be stored.
+     * @param string The string to add.
+     * @param hash   The hash of the string.
+     * @returns The index of the new entry, maxLength if memory could not be allocated.
+     */
+    XS_INLINE uint32 add(const View& string, const uint64 hash) noexcept
+    {
+        const uint32 element = length.load(std::memory_order_relaxed);
+        if (element >= maxLength) [[unlikely]] {
+            return maxLength;
+        }
+        // Keep the index at most half full so probe sequences remain short
+        if ((element + 1) * 2 > capacity && !rehash(max<uint0>(capacity * 2, 64))) [[unlikely]] {
+            return maxLength;
+        }
+        const uint32 block = bsr((element >> firstBlockBits) + 1_ui32);
+        if (!blocks[block].isValid()) {
+            EntryHandle newBlock((1_ui32 << block) << firstBlockBits);
+            if (!newBlock.isValid()) [[unlikely]] {
+                return maxLength;
+            }
+            blocks[block] = move(newBlock);
+        }
+        CharType* characters = addCharacters(string.length() + 1);
+        if (characters == nullptr) [[unlikely]] {
+            return maxLength;
+        }
+        memMove(characters, string.data(), string.length() * sizeof(CharType));
+        characters[string.length()] = CharType{0};
+
+        memConstruct<Entry>(&blocks[block].pointer[element - (((1_ui32 << block) - 1_ui32) << firstBlockBits)],
+            Entry{characters, string.length(), hash});
+        insert(element, hash);
+        length.store(element + 1, std::memory_order_release);
+        return element;
+    }
+
+private:
+    /**
+     * Add an entry to the index.
+     * @param element The index of the entry.
+     * @param hash    The hash of the entries string.
+     */
+    XS_INLINE void insert(const uint32 element, const uint64 hash) noexcept
+    {
+        const uint0 mask = capacity - 1;
+        uint0 i = static_cast<uint0>(hash) & mask;
+        while (index.pointer[i] != 0) {
+            i = (i + 1) & mask;
+        }
+        index.pointer[i] = element + 1;
+    }
+
+    /**
+     * Resize the index and re-add all existing entries.
+     * @param newCapacity The new number of slots (must be a power of 2).
+     * @returns Whether operation could be performed (will be false if memory could not be allocated).
+     */
+    XS_INLINE bool rehash(const uint0 newCapacity) noexcept
+    {
+        IndexHandle newIndex(newCapacity);
+        if (!newIndex.isValid()) [[unlikely]] {
+            return false;
+        }
+        for (uint0 i = 0; i < newCapacity; ++i) {
+            newIndex.pointer[i] = 0;
+        }
+        index = move(newIndex);
+        capacity = newCapacity;
+        const uint32 end = length.load(std::memory_order_relaxed);
+        for (uint32 i = 0; i < end; ++i) {
+            insert(i, getEntry(i).hash);
+        }
+        return true;
+    }
+
+    /**
+     * Reserve space for a number of characters.
+     * @param number The number of characters required.
+     * @returns Pointer to the reserved characters (nullptr if memory could not be allocated).
+     */
+    XS_INLINE CharType* addCharacters(const uint0 number) noexcept
+    {
+        if (number > remaining) {
+            // Chunks are never reallocated so that existing strings keep the same address
+            const uint0 newLength = max(number, chunkLength);
+            if (!chunks.add(newLength)) [[unlikely]] {
+                return nullptr;
+            }
+            if (!chunks.at(chunks.getLength() - 1).isValid()) [[unlikely]] {
+                chunks.remove();
+                return nullptr;
+            }
+            next = chunks.at(chunks.getLength() - 1).pointer;
+            remaining = newLength;
+        }
+        CharType* ret = next;
+        next += number;
+        remaining -= number;
+        return ret;
+    }
+};
+} // namespace NoExport
+
+/**
+ * Concurrent table of unique strings that can be referenced using compact atoms.
+ * @note Each distinct string is stored once and is given a 32bit identifier so that comparing and hashing strings
+ * becomes an integer operation. Characters are stored in chunks that are never reallocated or freed until the table
+ * is destroyed so views to a string remain valid for the lifetime of the table. The table is split into shards that
+ * are selected using the strings hash, adding a string only locks a single shard while converting an atom back to a
+ * string does not take any lock.
+ * @tparam CharType Type of character used by the strings.
+ * @tparam Alloc    Type of allocator used to allocate memory.
+ */
+template<typename CharType = char, class Alloc = AllocRegionHeap<CharType>>
+class AtomTable
+{
+    static_assert(isSameAny<CharType, char, char8, char16, char32>,
+        "Invalid character type: Template parameter must be a valid char type");
+
+public:
+    using StringType = String<CharType>;
+    using View = StringView<CharType>;
+    using Shard = NoExport::AtomTableShard<CharType, Alloc>;
+
+    /**< Number of independently locked shards */
+    static constexpr uint32 shardCount = 1_ui32 << NoExport::atomTableShardBits;
+
+    Shard shards[shardCount]; /**< The shards used to store strings */ // NOLINT(modernize-avoid-c-arrays)
+
+    /** Default constructor. */
+    XS_INLINE AtomTable() noexcept = default;
+
+    XS_INLINE AtomTable(const AtomTable& other) noexcept = delete;
+
+    XS_INLINE AtomTable(AtomTable&& other) noexcept = delete;
+
+    /** Destructor. */
+    XS_INLINE ~AtomTable() noexcept = default;
+
+    XS_INLINE AtomTable& operator=(const AtomTable& other) noexcept = delete;
+
+    XS_INLINE AtomTable& operator=(AtomTable&& other) noexcept = delete;
+
+    /**
+     * Get the number of unique strings stored in the table.
+     * @note As other threads may be adding strings the result may already be out of date.
+     * @returns The number of strings.
+     */
+    XS_INLINE uint0 getLength() const noexcept
+    {
+        uint0 ret = 0;
+        for (const auto& shard : shards) {
+            ret += shard.length.load(std::memory_order_relaxed);
+        }
+        return ret;
+    }
+
+    /**
+     * Get the atom for a string, adding the string to the table if it is not already stored.
+     * @param string The string to find.
+     * @returns The atom for the string (will be invalid if memory could not be allocated).
+     */
+    XS_INLINE Atom findOrAdd(const View& string) noexcept
+    {
+        const uint64 hash = Hash<StringType>()(string);
+        const uint32 shardIndex = getShard(hash);
+        Shard& shard = shards[shardIndex];
+        shard.lock();
+        uint32 element = shard.find(string, hash);
+        if (element == Shard::maxLength) {
+            element = shard.add(string, hash);
+        }
+        shard.unlock();
+        return makeAtom(shardIndex, element);
+    }
+
+    /**
+     * Get the atom for a string, adding the string to the table if it is not already stored.
+     * @param string The null terminated string to find.
+     * @returns The atom for the string (will be invalid if memory could not be allocated).
+     */
+    XS_INLINE Atom findOrAdd(const CharType* const XS_RESTRICT string) noexcept
+    {
+        return findOrAdd(View(string, StringType::CharLength(string)));
+    }
+
+    /**
+     * Get the atom for a string, adding the string to the table if it is not already stored.
+     * @tparam Alloc2 Type of allocator used by the string.
+     * @param string The string to find.
+     * @returns The atom for the string (will be invalid if memory could not be allocated).
+     */
+    template<class Alloc2>
+    XS_INLINE Atom findOrAdd(const String<CharType, Alloc2>& string) noexcept
+    {
+        return findOrAdd(View(string.getData(), string.getLength()));
+    }
+
+    /**
+     * Get the atom for a string without adding it to the table.
+     * @param string The string to find.
+     * @returns The atom for the string (will be invalid if the string is not stored).
+     */
+    XS_INLINE Atom find(const View& string) const noexcept
+    {
+        const uint64 hash = Hash<StringType>()(string);
+        const uint32 shardIndex = getShard(hash);
+        const Shard& shard = shards[shardIndex];
+        shard.lock();
+        const uint32 element = shard.find(string, hash);
+        shard.unlock();
+        return makeAtom(shardIndex, element);
+    }
+
+    /**
+     * Query if a string is stored in the table.
+     * @param string The string to find.
+     * @returns True if the string is stored.
+     */
+    XS_INLINE bool contains(const View& string) const noexcept
+    {
+        return find(string).isValid();
+    }
+
+    /**
+     * Get the characters of a string.
+     * @note The returned characters are null terminated and remain valid for the lifetime of the table.
+     * @param atom The atom of the string (must be valid and created by this table).
+     * @returns Pointer to the strings characters.
+     */
+    XS_INLINE const CharType* getData(const Atom atom) const noexcept
+    {
+        return getEntry(atom).pointer;
+    }
+
+    /**
+     * Get the number of characters in a string.
+     * @param atom The atom of the string (must be valid and created by this table).
+     * @returns The strings length.
+     */
+    XS_INLINE uint0 getLength(const Atom atom) const noexcept
+    {
+        return getEntry(atom).length;
+    }
+
+    /**
+     * Get a view of a string.
+     * @note The view remains valid for the lifetime of the table.
+     * @param atom The atom of the string (must be valid and created by this table).
+     * @returns The strings view.
+     */
+    XS_INLINE View getView(const Atom atom) const noexcept
+    {
+        const auto& entry = getEntry(atom);
+        return View(entry.pointer, entry.length);
+    }
+
+    /**
+     * Create a copy of a string.
+     * @param atom The atom of the string (must be valid and created by this table).
+     * @returns The new string.
+     */
+    XS_INLINE StringType getString(const Atom atom) const noexcept
+    {
+        const auto& entry = getEntry(atom);
+        return StringType(entry.pointer, entry.length);
+    }
+
+private:
+    /**
+     * Get the shard used to store a string.
+     * @param hash The hash of the string.
+     * @returns The index of the shard.
+     */
+    XS_INLINE static uint32 getShard(const uint64 hash) noexcept
+    {
+        // The low bits are used by the shards index so the shard is selected using the high bits
+        return static_cast<uint32>(hash >> (64 - NoExport::atomTableShardBits));
+    }
+
+    /**
+     * Create an atom from its shard and entry.
+     * @param shardIndex The index of the shard.
+     * @param element    The index of the entry within the shard (maxLength if not valid).
+     * @returns The new atom.
+     */
+    XS_INLINE static Atom makeAtom(const uint32 shardIndex, const uint32 element) noexcept
+    {
+        if (element == Shard::maxLength) [[unlikely]] {
+            return Atom();
+        }
+        return Atom((element << NoExport::atomTableShardBits) | shardIndex);
+    }
+
+    /**
+     * Get the entry referenced by an atom.
+     * @param atom The atom of the string (must be valid and created by this table).
+     * @returns The strings entry.
+     */
+    XS_INLINE const typename Shard::Entry& getEntry(const Atom atom) const noexcept
+    {
+        XS_ASSERT(atom.isValid());
+        return shards[atom.id & (shardCount - 1)].getEntry(atom.id >> NoExport::atomTableShardBits);
+    }
+};
+} // namespace Shift
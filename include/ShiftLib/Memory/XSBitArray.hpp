@@ -0,0 +1,778 @@
+#pragma once
+/**
+ * Copyright Matthew Oliver
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Memory/XSAllocatorHeap.hpp"
+#include "SIMD/XSSIMDBool.hpp"
+#include "XSBit.hpp"
+
+namespace Shift {
+/**
+ * Dynamic array of booleans that stores each element as a single bit.
+ * @note Bits are packed into 32bit words that are stored in cache line sized blocks (512 bits). The reserved length is
+ * always padded to a whole number of blocks so that bulk operations can always operate on full SIMD blocks. All bits
+ * past the current length are always kept as false so that counting and searching never need to mask the last word.
+ * @tparam Alloc Type of allocator used to allocate words.
+ */
+template<class Alloc = AllocRegionHeap<uint32>>
+class BitArray
+{
+public:
+    using Word = uint32;
+
+    /**< Alignment of the word buffer */
+    static constexpr uint0 alignment = 64;
+    /**< Number of bits stored in each word */
+    static constexpr uint0 wordBits = sizeof(Word) * 8;
+    /**< Number of words in each SIMD block */
+    static constexpr uint0 blockWords = alignment / sizeof(Word);
+    /**< Number of bits stored in each SIMD block */
+    static constexpr uint0 blockBits = blockWords * wordBits;
+
+    using Allocator = typename Alloc::template Allocator<Word, alignment>;
+    using Handle = typename Allocator::Handle;
+
+    static_assert(Handle::isResizable, "BitArray requires a resizable allocator");
+
+    Handle handle;      /**< The handle used to store words */
+    uint0 length = 0;   /**< Number of bits currently stored */
+    uint0 capacity = 0; /**< Number of bits that can be stored (multiple of blockBits) */
+
+    /** Default constructor. */
+    XS_INLINE BitArray() noexcept = default;
+
+    /**
+     * Constructor that reserves space for a number of bits.
+     * @note The reserved space is rounded up to a multiple of blockBits.
+     * @param number The number of bits to reserve space for.
+     */
+    explicit XS_INLINE BitArray(const uint0 number) noexcept
+        : handle(capacityFor(number) / wordBits)
+    {
+        if (handle.pointer != nullptr) [[likely]] {
+            capacity = capacityFor(number);
+            clearWords(handle.pointer, 0, capacity / wordBits);
+        }
+    }
+
+    /**
+     * Constructor that sets an initial number of bits.
+     * @param number The number of bits to add.
+     * @param value  The value to set each bit to.
+     */
+    XS_INLINE BitArray(const uint0 number, const bool value) noexcept
+        : BitArray(number)
+    {
+        if (handle.pointer != nullptr) [[likely]] {
+            length = number;
+            if (value) {
+                setAllTrue();
+            }
+        }
+    }
+
+    /**
+     * Copy constructor.
+     * @param other The other array.
+     */
+    XS_INLINE BitArray(const BitArray& other) noexcept
+        : handle(other.capacity / wordBits)
+    {
+        if (handle.pointer != nullptr) [[likely]] {
+            capacity = other.capacity;
+            length = other.length;
+            other.relocateWords(handle.pointer, capacity);
+        }
+    }
+
+    /**
+     * Move constructor.
+     * @param other The other array.
+     */
+    XS_INLINE BitArray(BitArray&& other) noexcept
+        : handle(move(other.handle))
+        , length(other.length)
+        , capacity(other.capacity)
+    {
+        other.length = 0;
+        other.capacity = 0;
+    }
+
+    /** Destructor. */
+    XS_INLINE ~BitArray() noexcept = default;
+
+    /**
+     * Assignment operator.
+     * @param other The other array.
+     * @returns A deep copy of this object.
+     */
+    XS_INLINE BitArray& operator=(const BitArray& other) noexcept
+    {
+        if (this != &other) [[likely]] {
+            BitArray temp(other);
+            swap(temp);
+        }
+        return *this;
+    }
+
+    /**
+     * Move assignment operator.
+     * @param other The other array.
+     * @returns A shallow copy of this object.
+     */
+    XS_INLINE BitArray& operator=(BitArray&& other) noexcept
+    {
+        swap(other);
+        return *this;
+    }
+
+    /**
+     * Swap the contents of two arrays around.
+     * @param [in,out] other The array to swap with this one.
+     */
+    XS_INLINE void swap(BitArray& other) noexcept
+    {
+        Shift::swap(handle, other.handle);
+        Shift::swap(length, other.length);
+        Shift::swap(capacity, other.capacity);
+    }
+
+    /**
+     * Checks whether the array has any allocated memory.
+     * @returns True if valid, false if not.
+     */
+    XS_INLINE bool isValid() const noexcept
+    {
+        return capacity != 0;
+    }
+
+    /**
+     * Check if the array is empty or not.
+     * @returns Boolean signaling if array is empty.
+     */
+    XS_INLINE bool isEmpty() const noexcept
+    {
+        return length == 0;
+    }
+
+    /**
+     * Get the number of bits in the array.
+     * @returns The number of bits currently stored within the array.
+     */
+    XS_INLINE uint0 getLength() const noexcept
+    {
+        return length;
+    }
+
+    /**
+     * Get the number of bits currently reserved for.
+     * @returns The number of bits that can be stored before the array must be reallocated.
+     */
+    XS_INLINE uint0 getReservedLength() const noexcept
+    {
+        return capacity;
+    }
+
+    /**
+     * Manually set the number of bits to reserve for.
+     * @note This will not reduce the reserved size below what is needed to hold the current bits. The reserved size
+     * is rounded up to a multiple of blockBits.
+     * @param number The number of bits to reserve space for.
+     * @returns Boolean signaling if new memory could be reserved.
+     */
+    XS_INLINE bool setReservedLength(const uint0 number) noexcept
+    {
+        const uint0 newCapacity = capacityFor(number > length ? number : length);
+        if (newCapacity == capacity) {
+            return true;
+        }
+        return relocate(newCapacity);
+    }
+
+    /**
+     * Manually check reserved space and increase only if necessary.
+     * @param number The number of bits to check if reserved.
+     * @returns Boolean signaling if the required amount of memory could be reserved.
+     */
+    XS_INLINE bool checkReservedLength(const uint0 number) noexcept
+    {
+        if (number <= capacity) [[likely]] {
+            return true;
+        }
+        // Use the same 1/4 growth algorithm as DArray to reduce the need to constantly reallocate
+        const uint0 grown = capacity + (capacity >> 2);
+        return relocate(capacityFor(grown > number ? grown : number));
+    }
+
+    /**
+     * Get the internal word buffer.
+     * @returns Pointer to the first word (aligned to alignment).
+     */
+    XS_INLINE Word* getData() noexcept
+    {
+        return handle.pointer;
+    }
+
+    /**
+     * Get the internal word buffer.
+     * @returns Pointer to the first word (aligned to alignment).
+     */
+    XS_INLINE const Word* getData() const noexcept
+    {
+        return handle.pointer;
+    }
+
+    /**
+     * Add a bit to the end of the array.
+     * @param value The value of the new bit.
+     * @returns Boolean representing if bit could be added to array. (will be false if memory could not be allocated).
+     */
+    XS_INLINE bool add(const bool value) noexcept
+    {
+        if (!checkReservedLength(length + 1)) [[unlikely]] {
+            return false;
+        }
+        addUnChecked(value);
+        return true;
+    }
+
+    /**
+     * Add a bit to the end of the array.
+     * @note This variant does not check if there is enough space in the array. Only use if you have manually assured
+     * adequate space before hand.
+     * @param value The value of the new bit.
+     */
+    XS_INLINE void addUnChecked(const bool value) noexcept
+    {
+        XS_ASSERT(length < capacity);
+        // Bits past the end are always false so only need to set
+        handle.pointer[length / wordBits] |= static_cast<Word>(value) << (length % wordBits);
+        ++length;
+    }
+
+    /**
+     * Add the 4 booleans of a bool4 to the end of the array.
+     * @tparam IsSIMD Internal bool4 storage type.
+     * @param values The booleans to add.
+     * @returns Boolean representing if bits could be added to array. (will be false if memory could not be
+     *          allocated).
+     */
+    template<bool IsSIMD>
+    XS_INLINE bool add(const Bool4<IsSIMD>& values) noexcept
+    {
+        if (!checkReservedLength(length + 4)) [[unlikely]] {
+            return false;
+        }
+        length += 4;
+        setBits(length - 4, 4, values.getAsInteger());
+        return true;
+    }
+
+    /**
+     * Add the 8 booleans of a bool8 to the end of the array.
+     * @tparam IsSIMD Internal bool8 storage type.
+     * @param values The booleans to add.
+     * @returns Boolean representing if bits could be added to array. (will be false if memory could not be
+     *          allocated).
+     */
+    template<bool IsSIMD>
+    XS_INLINE bool add(const Bool8<IsSIMD>& values) noexcept
+    {
+        if (!checkReservedLength(length + 8)) [[unlikely]] {
+            return false;
+        }
+        length += 8;
+        setBits(length - 8, 8, values.getAsInteger());
+        return true;
+    }
+
+    /**
+     * Get the value of a bit.
+     * @param position The location of the bit.
+     * @returns The value of the bit.
+     */
+    XS_INLINE bool getBool(const uint0 position) const noexcept
+    {
+        XS_ASSERT(position < length);
+        return ((handle.pointer[position / wordBits] >> (position % wordBits)) & 1) != 0;
+    }
+
+    /**
+     * Set the value of a bit.
+     * @param position The location of the bit.
+     * @param value    The new value.
+     */
+    XS_INLINE void setBool(const uint0 position, const bool value) noexcept
+    {
+        if (value) {
+            setBoolTrue(position);
+        } else {
+            setBoolFalse(position);
+        }
+    }
+
+    /**
+     * Set a bit to true.
+     * @param position The location of the bit.
+     */
+    XS_INLINE void setBoolTrue(const uint0 position) noexcept
+    {
+        XS_ASSERT(position < length);
+        handle.pointer[position / wordBits] |= 1_ui32 << (position % wordBits);
+    }
+
+    /**
+     * Set a bit to false.
+     * @param position The location of the bit.
+     */
+    XS_INLINE void setBoolFalse(const uint0 position) noexcept
+    {
+        XS_ASSERT(position < length);
+        handle.pointer[position / wordBits] &= ~(1_ui32 << (position % wordBits));
+    }
+
+    /**
+     * Get 4 consecutive bits as a bool4.
+     * @note The position does not need to be aligned in any way.
+     * @param position The location of the first bit.
+     * @returns The bool4 containing the bits starting at position.
+     */
+    XS_INLINE Bool4<> getBool4(const uint0 position) const noexcept
+    {
+        return Bool4<>(static_cast<uint8>(getBits(position, 4)));
+    }
+
+    /**
+     * Set 4 consecutive bits from a bool4.
+     * @tparam IsSIMD Internal bool4 storage type.
+     * @param position The location of the first bit.
+     * @param values   The booleans to set.
+     */
+    template<bool IsSIMD>
+    XS_INLINE void setBool4(const uint0 position, const Bool4<IsSIMD>& values) noexcept
+    {
+        setBits(position, 4, values.getAsInteger());
+    }
+
+    /**
+     * Get 8 consecutive bits as a bool8.
+     * @note The position does not need to be aligned in any way.
+     * @param position The location of the first bit.
+     * @returns The bool8 containing the bits starting at position.
+     */
+    XS_INLINE Bool8<> getBool8(const uint0 position) const noexcept
+    {
+        return Bool8<>(static_cast<uint8>(getBits(position, 8)));
+    }
+
+    /**
+     * Set 8 consecutive bits from a bool8.
+     * @tparam IsSIMD Internal bool8 storage type.
+     * @param position The location of the first bit.
+     * @param values   The booleans to set.
+     */
+    template<bool IsSIMD>
+    XS_INLINE void setBool8(const uint0 position, const Bool8<IsSIMD>& values) noexcept
+    {
+        setBits(position, 8, values.getAsInteger());
+    }
+
+    /** Set all bits to true. */
+    XS_INLINE void setAllTrue() noexcept
+    {
+        const uint0 words = getBlockCount() * blockWords;
+        for (uint0 i = 0; i < words; ++i) {
+            handle.pointer[i] = ~0_ui32;
+        }
+        clearTail();
+    }
+
+    /** Set all bits to false. */
+    XS_INLINE void setAllFalse() noexcept
+    {
+        clearWords(handle.pointer, 0, getBlockCount() * blockWords);
+    }
+
+    /**
+     * Remove a number of bits from the end of the array.
+     * @param number (Optional) The number of bits to remove.
+     */
+    XS_INLINE void removeBack(const uint0 number = 1) noexcept
+    {
+        XS_ASSERT(number <= length);
+        const uint0 blocks = getBlockCount();
+        length -= number;
+        // Removed bits must be cleared to maintain that all bits past the end are false
+        clearWords(handle.pointer, getBlockCount() * blockWords, blocks * blockWords);
+        clearTail();
+    }
+
+    /** Remove all bits from the array. */
+    XS_INLINE void removeAll() noexcept
+    {
+        setAllFalse();
+        length = 0;
+    }
+
+    /**
+     * Get the number of bits set to true.
+     * @returns The number of true bits.
+     */
+    XS_INLINE uint0 getCount() const noexcept
+    {
+        const uint0 blocks = getBlockCount();
+#if XS_ISA == XS_X86
+        if constexpr (hasISAFeature<ISAFeature::AVX512VPOPCNTDQ>) {
+            __m512i count = _mm512_setzero_si512();
+            const uint0 words = blocks * blockWords;
+            for (uint0 i = 0; i < words; i += 16) {
+                count = _mm512_add_epi32(count, _mm512_popcnt_epi32(_mm512_load_si512(handle.pointer + i)));
+            }
+            return static_cast<uint0>(_mm512_reduce_add_epi32(count));
+        } else
+#endif
+        {
+            uint0 count = 0;
+            const uint0 words = blocks * blockWords;
+            for (uint0 i = 0; i < words; ++i) {
+                count += popcnt(handle.pointer[i]);
+            }
+            return count;
+        }
+    }
+
+    /**
+     * Check if any bit is set to true.
+     * @returns True if at least 1 bit is true.
+     */
+    XS_INLINE bool getAny() const noexcept
+    {
+        return indexOfNextValid(0) != length;
+    }
+
+    /**
+     * Check if all bits are set to true.
+     * @returns True if every bit is true (also true if the array is empty).
+     */
+    XS_INLINE bool getAll() const noexcept
+    {
+        return getCount() == length;
+    }
+
+    /**
+     * Check if no bits are set to true.
+     * @returns True if every bit is false (also true if the array is empty).
+     */
+    XS_INLINE bool getNone() const noexcept
+    {
+        return !getAny();
+    }
+
+    /**
+     * Gets the index of the first bit set to true.
+     * @returns The zero-based index of the first true bit, getLength() if no bit is true.
+     */
+    XS_INLINE uint0 indexOfFirstValid() const noexcept
+    {
+        return indexOfNextValid(0);
+    }
+
+    /**
+     * Gets the index of the next bit set to true.
+     * @param start The location to start searching from (inclusive).
+     * @returns The zero-based index of the next true bit, getLength() if no further bit is true.
+     */
+    XS_INLINE uint0 indexOfNextValid(const uint0 start) const noexcept
+    {
+        if (start >= length) [[unlikely]] {
+            return length;
+        }
+        const uint0 words = (length + (wordBits - 1)) / wordBits;
+        uint0 word = start / wordBits;
+        Word bits = handle.pointer[word] & (~0_ui32 << (start % wordBits));
+        while (bits == 0) {
+            if (++word == words) {
+                return length;
+            }
+            bits = handle.pointer[word];
+        }
+        // Bits past the end are always false so the result is always valid
+        return word * wordBits + ctz(bits);
+    }
+
+    /**
+     * Call a function for every bit set to true.
+     * @tparam Function Type of function to call.
+     * @param function Function called in order with the index of each true bit (must take a single uint0).
+     */
+    template<typename Function>
+    XS_INLINE void forEachValid(Function function) const noexcept
+    {
+        const uint0 words = (length + (wordBits - 1)) / wordBits;
+        for (uint0 i = 0; i < words; ++i) {
+            Word bits = handle.pointer[i];
+            while (bits != 0) {
+                function(i * wordBits + ctz(bits));
+                // Clear the lowest set bit
+                bits &= bits - 1;
+            }
+        }
+    }
+
+    /**
+     * Get the number of SIMD blocks needed to cover all bits.
+     * @returns The number of blocks (the last block may be partially filled).
+     */
+    XS_INLINE uint0 getBlockCount() const noexcept
+    {
+        return (length + (blockBits - 1)) / blockBits;
+    }
+
+    /**
+     * Bitwise and with another array.
+     * @param other The other array (must be the same length).
+     * @returns The result of the operation.
+     */
+    XS_INLINE BitArray& operator&=(const BitArray& other) noexcept
+    {
+        XS_ASSERT(other.length == length);
+        combine<Operation::And>(other.handle.pointer);
+        return *this;
+    }
+
+    /**
+     * Bitwise or with another array.
+     * @param other The other array (must be the same length).
+     * @returns The result of the operation.
+     */
+    XS_INLINE BitArray& operator|=(const BitArray& other) noexcept
+    {
+        XS_ASSERT(other.length == length);
+        combine<Operation::Or>(other.handle.pointer);
+        return *this;
+    }
+
+    /**
+     * Bitwise xor with another array.
+     * @param other The other array (must be the same length).
+     * @returns The result of the operation.
+     */
+    XS_INLINE BitArray& operator^=(const BitArray& other) noexcept
+    {
+        XS_ASSERT(other.length == length);
+        combine<Operation::Xor>(other.handle.pointer);
+        return *this;
+    }
+
+    /** Bitwise not of every bit. */
+    XS_INLINE void invert() noexcept
+    {
+        combine<Operation::Not>(handle.pointer);
+        clearTail();
+    }
+
+    /**
+     * Get the number of bits that will be reserved in order to store a number of bits.
+     * @param number The number of bits.
+     * @returns The required capacity (multiple of blockBits).
+     */
+    XS_INLINE static uint0 capacityFor(const uint0 number) noexcept
+    {
+        return (number + (blockBits - 1)) & ~(blockBits - 1);
+    }
+
+    /**
+     * Move all bits into newly allocated memory.
+     * @param newCapacity The new number of bits (must be a multiple of blockBits and large enough to store existing
+     *                    bits).
+     * @returns Boolean signaling if new memory could be allocated.
+     */
+    XS_INLINE bool relocate(const uint0 newCapacity) noexcept
+    {
+        XS_ASSERT(newCapacity % blockBits == 0);
+        XS_ASSERT(newCapacity >= length);
+        Handle newHandle(newCapacity / wordBits);
+        if (newHandle.pointer == nullptr) [[unlikely]] {
+            return false;
+        }
+        relocateWords(newHandle.pointer, newCapacity);
+        Shift::swap(handle, newHandle);
+        capacity = newCapacity;
+        return true;
+    }
+
+private:
+    /**< Bitwise operations that can be applied to all words */
+    enum class Operation
+    {
+        And,
+        Or,
+        Xor,
+        Not,
+    };
+
+    /**
+     * Apply a bitwise operation to every SIMD block of words.
+     * @tparam Op Type of operation to perform.
+     * @param other The words to combine with (ignored for Operation::Not).
+     */
+    template<Operation Op>
+    XS_INLINE void combine(const Word* const other) noexcept
+    {
+        const uint0 words = getBlockCount() * blockWords;
+        Word* const data = handle.pointer;
+#if XS_ISA == XS_X86
+        if constexpr (hasISAFeature<ISAFeature::AVX512F>) {
+            for (uint0 i = 0; i < words; i += 16) {
+                const __m512i value = _mm512_load_si512(data + i);
+                __m512i result;
+                if constexpr (Op == Operation::And) {
+                    result = _mm512_and_si512(value, _mm512_load_si512(other + i));
+                } else if constexpr (Op == Operation::Or) {
+                    result = _mm512_or_si512(value, _mm512_load_si512(other + i));
+                } else if constexpr (Op == Operation::Xor) {
+                    result = _mm512_xor_si512(value, _mm512_load_si512(other + i));
+                } else {
+                    result = _mm512_ternarylogic_epi32(value, value, value, 0x55);
+                }
+                _mm512_store_si512(data + i, result);
+            }
+        } else if constexpr (hasISAFeature<ISAFeature::AVX2>) {
+            for (uint0 i = 0; i < words; i += 8) {
+                const __m256i value = _mm256_load_si256(reinterpret_cast<const __m256i*>(data + i));
+                __m256i result;
+                if constexpr (Op == Operation::And) {
+                    result = _mm256_and_si256(value, _mm256_load_si256(reinterpret_cast<const __m256i*>(other + i)));
+                } else if constexpr (Op == Operation::Or) {
+                    result = _mm256_or_si256(value, _mm256_load_si256(reinterpret_cast<const __m256i*>(other + i)));
+                } else if constexpr (Op == Operation::Xor) {
+                    result = _mm256_xor_si256(value, _mm256_load_si256(reinterpret_cast<const __m256i*>(other + i)));
+                } else {
+                    result = _mm256_xor_si256(value, _mm256_set1_epi32(-1));
+                }
+                _mm256_store_si256(reinterpret_cast<__m256i*>(data + i), result);
+            }
+        } else if constexpr (hasISAFeature<ISAFeature::SSE2>) {
+            for (uint0 i = 0; i < words; i += 4) {
+                const __m128i value = _mm_load_si128(reinterpret_cast<const __m128i*>(data + i));
+                __m128i result;
+                if constexpr (Op == Operation::And) {
+                    result = _mm_and_si128(value, _mm_load_si128(reinterpret_cast<const __m128i*>(other + i)));
+                } else if constexpr (Op == Operation::Or) {
+                    result = _mm_or_si128(value, _mm_load_si128(reinterpret_cast<const __m128i*>(other + i)));
+                } else if constexpr (Op == Operation::Xor) {
+                    result = _mm_xor_si128(value, _mm_load_si128(reinterpret_cast<const __m128i*>(other + i)));
+                } else {
+                    result = _mm_xor_si128(value, _mm_set1_epi32(-1));
+                }
+                _mm_store_si128(reinterpret_cast<__m128i*>(data + i), result);
+            }
+        } else
+#endif
+        {
+            for (uint0 i = 0; i < words; ++i) {
+                if constexpr (Op == Operation::And) {
+                    data[i] &= other[i];
+                } else if constexpr (Op == Operation::Or) {
+                    data[i] |= other[i];
+                } else if constexpr (Op == Operation::Xor) {
+                    data[i] ^= other[i];
+                } else {
+                    data[i] = ~data[i];
+                }
+            }
+        }
+    }
+
+    /**
+     * Get a range of consecutive bits.
+     * @param position The location of the first bit.
+     * @param number   The number of bits to get (at most wordBits - 1).
+     * @returns The requested bits stored starting at the lowest bit.
+     */
+    XS_INLINE Word getBits(const uint0 position, const uint32 number) const noexcept
+    {
+        XS_ASSERT(number < wordBits);
+        XS_ASSERT(position + number <= length);
+        const uint0 word = position / wordBits;
+        const uint32 shift = static_cast<uint32>(position % wordBits);
+        Word bits = handle.pointer[word] >> shift;
+        if (shift + number > wordBits) {
+            bits |= handle.pointer[word + 1] << (wordBits - shift);
+        }
+        return bits & ((1_ui32 << number) - 1);
+    }
+
+    /**
+     * Set a range of consecutive bits.
+     * @param position The location of the first bit.
+     * @param number   The number of bits to set (at most wordBits - 1).
+     * @param bits     The new bits stored starting at the lowest bit.
+     */
+    XS_INLINE void setBits(const uint0 position, const uint32 number, const Word bits) noexcept
+    {
+        XS_ASSERT(number < wordBits);
+        XS_ASSERT(position + number <= length);
+        XS_ASSERT((bits >> number) == 0);
+        const uint0 word = position / wordBits;
+        const uint32 shift = static_cast<uint32>(position % wordBits);
+        const Word mask = (1_ui32 << number) - 1;
+        handle.pointer[word] = (handle.pointer[word] & ~(mask << shift)) | (bits << shift);
+        if (shift + number > wordBits) {
+            const uint32 shiftHigh = static_cast<uint32>(wordBits) - shift;
+            handle.pointer[word + 1] = (handle.pointer[word + 1] & ~(mask >> shiftHigh)) | (bits >> shiftHigh);
+        }
+    }
+
+    /**
+     * Clear all bits from the current length up to the end of its SIMD block.
+     */
+    XS_INLINE void clearTail() noexcept
+    {
+        const uint0 words = getBlockCount() * blockWords;
+        const uint0 word = length / wordBits;
+        if (word < words) {
+            handle.pointer[word] &= (1_ui32 << (length % wordBits)) - 1;
+            clearWords(handle.pointer, word + 1, words);
+        }
+    }
+
+    /**
+     * Set a range of words to zero.
+     * @param pointer The word buffer.
+     * @param start   The first word to clear.
+     * @param end     The word after the last to clear.
+     */
+    XS_INLINE static void clearWords(Word* const XS_RESTRICT pointer, const uint0 start, const uint0 end) noexcept
+    {
+        for (uint0 i = start; i < end; ++i) {
+            pointer[i] = 0;
+        }
+    }
+
+    /**
+     * Copy the contents of the word buffer into new memory.
+     * @param pointer     The new allocation.
+     * @param newCapacity The number of bits reserved in the new allocation.
+     */
+    XS_INLINE void relocateWords(Word* const XS_RESTRICT pointer, const uint0 newCapacity) const noexcept
+    {
+        const uint0 words = getBlockCount() * blockWords;
+        memMove<Word>(pointer, handle.pointer, words * sizeof(Word));
+        clearWords(pointer, words, newCapacity / wordBits);
+    }
+};
+} // namespace Shift
@@ -85,7 +85,11 @@ public:
      * Move constructor.
      * @param array The other array.
      */
-    XS_INLINE DArray(DArray&& array) noexcept = default;
+    XS_INLINE DArray(DArray&& array) noexcept
+        : DArray()
+    {
+        swap(array);
+    }
 
     /**
      * Construct from a sequence of elements.
@@ -231,8 +235,7 @@ public:
     XS_INLINE DArray& operator=(DArray&& array) noexcept
     {
         XS_ASSERT(this->handle.pointer != array.handle.pointer);
-        this->IArray::operator=(forward<IArray>(array));
-        Shift::swap(endAllocated, array.endAllocated);
+        swap(array);
         return *this;
     }
 
@@ -259,10 +262,15 @@ public:
      */
     XS_INLINE void swap(DArray& array) noexcept
     {
+        const uint0 size = static_cast<uint0>(
+            reinterpret_cast<uint8*>(endAllocated) - reinterpret_cast<uint8*>(this->handle.pointer));
+        const uint0 size2 = static_cast<uint0>(
+            reinterpret_cast<uint8*>(array.endAllocated) - reinterpret_cast<uint8*>(array.handle.pointer));
         // Call array swap function
         this->IArray::swap(array);
-        // Swap the end allocated element
-        Shift::swap(endAllocated, array.endAllocated);
+        // Swap the end allocated element (rebuilt from the handle in case memory was moved)
+        endAllocated = reinterpret_cast<Type*>(reinterpret_cast<uint8*>(this->handle.pointer) + size2);
+        array.endAllocated = reinterpret_cast<Type*>(reinterpret_cast<uint8*>(array.handle.pointer) + size);
     }
 
     /**
@@ -395,8 +403,7 @@ public:
      */
     XS_INLINE bool add(const Type* const XS_RESTRICT elements, const uint0 number) noexcept
     {
-        if (const Type* XS_RESTRICT requiredReserved =
-                reinterpret_cast<Type*>(reinterpret_cast<uint8*>(this->nextElement) + number);
+        if (const Type* XS_RESTRICT requiredReserved = this->nextElement + number;
             checkWithinReserved(requiredReserved)) [[likely]] {
             this->IArray::add(elements, number);
             return true;
@@ -0,0 +1,186 @@
+#pragma once
+/**
+ * Copyright Matthew Oliver
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Memory/XSRingBuffer.hpp"
+
+namespace Shift {
+/**
+ * Double ended queue that automatically grows as elements are added at either end.
+ * @note Elements are stored in a ring buffer whose capacity is doubled whenever it becomes full. This gives amortised
+ * constant time addition and removal at both ends.
+ * @tparam T     Type of element stored within the deque.
+ * @tparam Alloc Type of allocator used to allocate elements.
+ */
+template<typename T, class Alloc = AllocRegionHeap<T>>
+class Deque : public RingBuffer<T, Alloc>
+{
+public:
+    using IRingBuffer = RingBuffer<T, Alloc>;
+    using Type = typename IRingBuffer::Type;
+    using Handle = typename IRingBuffer::Handle;
+    using Allocator = typename IRingBuffer::Allocator;
+    using Span = typename IRingBuffer::Span;
+    using ConstSpan = typename IRingBuffer::ConstSpan;
+
+    static_assert(Handle::isResizable, "Deque requires a resizable allocator");
+
+    /** Default constructor. */
+    XS_INLINE Deque() noexcept = default;
+
+    /**
+     * Constructor that reserves space for a number of elements.
+     * @param number The number of elements to reserve space for.
+     */
+    explicit XS_INLINE Deque(const uint0 number) noexcept
+        : IRingBuffer(number)
+    {}
+
+    /**
+     * Copy constructor.
+     * @param other The other deque.
+     */
+    XS_INLINE Deque(const Deque& other) noexcept = default;
+
+    /**
+     * Move constructor.
+     * @param other The other deque.
+     */
+    XS_INLINE Deque(Deque&& other) noexcept = default;
+
+    /** Destructor. */
+    XS_INLINE ~Deque() noexcept = default;
+
+    /**
+     * Assignment operator.
+     * @param other The other deque.
+     * @returns A deep copy of this object.
+     */
+    XS_INLINE Deque& operator=(const Deque& other) noexcept = default;
+
+    /**
+     * Move assignment operator.
+     * @param other The other deque.
+     * @returns A shallow copy of this object.
+     */
+    XS_INLINE Deque& operator=(Deque&& other) noexcept = default;
+
+    /**
+     * Add an element to the end of the deque.
+     * @param element The new element.
+     * @returns False if memory allocation failed.
+     */
+    XS_INLINE bool pushBack(const Type& element) noexcept
+    {
+        if (!checkReservedLength(this->length + 1)) [[unlikely]] {
+            return false;
+        }
+        this->pushBackUnChecked(element);
+        return true;
+    }
+
+    /**
+     * Add an element to the end of the deque using direct construction.
+     * @tparam Args Type of the arguments.
+     * @param values The values used to construct the new element.
+     * @returns False if memory allocation failed.
+     */
+    template<typename... Args>
+    requires(isNothrowConstructible<Type, Args...>)
+    XS_INLINE bool pushBack(Args&&... values) noexcept
+    {
+        if (!checkReservedLength(this->length + 1)) [[unlikely]] {
+            return false;
+        }
+        this->pushBackUnChecked(forward<Args>(values)...);
+        return true;
+    }
+
+    /**
+     * Add multiple elements to the end of the deque.
+     * @param elements Pointer to list of elements to add.
+     * @param number   The number of elements in the input list.
+     * @returns False if memory allocation failed.
+     */
+    XS_INLINE bool pushBack(const Type* const XS_RESTRICT elements, const uint0 number) noexcept
+    {
+        if (!checkReservedLength(this->length + number)) [[unlikely]] {
+            return false;
+        }
+        return IRingBuffer::pushBack(elements, number);
+    }
+
+    /**
+     * Add an element to the start of the deque.
+     * @param element The new element.
+     * @returns False if memory allocation failed.
+     */
+    XS_INLINE bool pushFront(const Type& element) noexcept
+    {
+        if (!checkReservedLength(this->length + 1)) [[unlikely]] {
+            return false;
+        }
+        this->pushFrontUnChecked(element);
+        return true;
+    }
+
+    /**
+     * Add an element to the start of the deque using direct construction.
+     * @tparam Args Type of the arguments.
+     * @param values The values used to construct the new element.
+     * @returns False if memory allocation failed.
+     */
+    template<typename... Args>
+    requires(isNothrowConstructible<Type, Args...>)
+    XS_INLINE bool pushFront(Args&&... values) noexcept
+    {
+        if (!checkReservedLength(this->length + 1)) [[unlikely]] {
+            return false;
+        }
+        this->pushFrontUnChecked(forward<Args>(values)...);
+        return true;
+    }
+
+    /**
+     * Add multiple elements to the start of the deque.
+     * @note The input elements keep their order so that the first input element becomes the new first element.
+     * @param elements Pointer to list of elements to add.
+     * @param number   The number of elements in the input list.
+     * @returns False if memory allocation failed.
+     */
+    XS_INLINE bool pushFront(const Type* const XS_RESTRICT elements, const uint0 number) noexcept
+    {
+        if (!checkReservedLength(this->length + number)) [[unlikely]] {
+            return false;
+        }
+        return IRingBuffer::pushFront(elements, number);
+    }
+
+    /**
+     * Ensure that there is enough space reserved for a number of elements.
+     * @note As the reserved size is always a power of 2, any required growth at least doubles it.
+     * @param number The number of elements to reserve space for.
+     * @returns Boolean signaling if new memory could be reserved.
+     */
+    XS_INLINE bool checkReservedLength(const uint0 number) noexcept
+    {
+        if (number > this->capacity) [[unlikely]] {
+            return this->relocate(NoExport::ringCapacityFor(number));
+        }
+        return true;
+    }
+};
+} // namespace Shift
@@ -0,0 +1,787 @@
+#pragma once
+/**
+ * Copyright Matthew Oliver
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Memory/XSAllocatorHeap.hpp"
+#include "XSBit.hpp"
+#include "XSHash.hpp"
+#include "XSUtility.hpp"
+
+namespace Shift {
+namespace NoExport {
+/**< Number of control bytes that are checked at the same time */
+inline constexpr uint0 hashGroupWidth = 16;
+/**< Control byte used to mark a slot that has never been used */
+inline constexpr int8 hashControlEmpty = -128;
+/**< Control byte used to mark a slot whose element has been removed */
+inline constexpr int8 hashControlDeleted = -2;
+
+/**
+ * Get a bitmask of control bytes in a group that match a value.
+ * @param group The control bytes for the group.
+ * @param value The control value to look for.
+ * @returns Bitmask with a bit set for each matching control byte.
+ */
+XS_INLINE uint32 hashGroupMatch(const int8* const XS_RESTRICT group, const int8 value) noexcept
+{
+#if XS_ISA == XS_X86
+    if constexpr (hasISAFeature<ISAFeature::SSE2>) {
+        const __m128i control = _mm_load_si128(reinterpret_cast<const __m128i*>(group));
+        return static_cast<uint32>(_mm_movemask_epi8(_mm_cmpeq_epi8(control, _mm_set1_epi8(value))));
+    } else
+#endif
+    {
+        uint32 ret = 0;
+        for (uint32 i = 0; i < hashGroupWidth; ++i) {
+            ret |= static_cast<uint32>(group[i] == value) << i;
+        }
+        return ret;
+    }
+}
+
+/**
+ * Get a bitmask of control bytes in a group that are empty.
+ * @param group The control bytes for the group.
+ * @returns Bitmask with a bit set for each empty control byte.
+ */
+XS_INLINE uint32 hashGroupMatchEmpty(const int8* const XS_RESTRICT group) noexcept
+{
+    return hashGroupMatch(group, hashControlEmpty);
+}
+
+/**
+ * Get a bitmask of control bytes in a group that are either empty or deleted.
+ * @param group The control bytes for the group.
+ * @returns Bitmask with a bit set for each available control byte.
+ */
+XS_INLINE uint32 hashGroupMatchFree(const int8* const XS_RESTRICT group) noexcept
+{
+#if XS_ISA == XS_X86
+    if constexpr (hasISAFeature<ISAFeature::SSE2>) {
+        // Both empty and deleted have the sign bit set
+        return static_cast<uint32>(_mm_movemask_epi8(_mm_load_si128(reinterpret_cast<const __m128i*>(group))));
+    } else
+#endif
+    {
+        uint32 ret = 0;
+        for (uint32 i = 0; i < hashGroupWidth; ++i) {
+            ret |= static_cast<uint32>(group[i] < 0) << i;
+        }
+        return ret;
+    }
+}
+} // namespace NoExport
+
+/**
+ * Iterator used to traverse the elements stored within a HashMap.
+ * @tparam T Type of element being iterated over.
+ */
+template<typename T>
+class HashMapIterator
+{
+public:
+    using Type = T;
+
+    const int8* XS_RESTRICT control = nullptr;    /**< Pointer to the control byte of the current element */
+    const int8* XS_RESTRICT controlEnd = nullptr; /**< Pointer to end of the control bytes */
+    Type* XS_RESTRICT pointer = nullptr;          /**< Pointer to the current element */
+
+    /** Default constructor. */
+    XS_INLINE HashMapIterator() noexcept = default;
+
+    /**
+     * Constructor from member variables.
+     * @note Advances to the first used slot at or after the input position.
+     * @param controlIn    The control byte of the starting slot.
+     * @param controlEndIn The end of the control bytes.
+     * @param pointerIn    The starting slot.
+     */
+    XS_INLINE HashMapIterator(const int8* const controlIn, const int8* const controlEndIn, Type* const pointerIn) noexcept
+        : control(controlIn)
+        , controlEnd(controlEndIn)
+        , pointer(pointerIn)
+    {
+        skipFree();
+    }
+
+    /**
+     * Dereference operator.
+     * @returns The current element.
+     */
+    XS_INLINE Type& operator*() const noexcept
+    {
+        return *pointer;
+    }
+
+    /**
+     * Member dereference operator.
+     * @returns Pointer to the current element.
+     */
+    XS_INLINE Type* operator->() const noexcept
+    {
+        return pointer;
+    }
+
+    /**
+     * Pre-increment operator.
+     * @returns The result of the operation.
+     */
+    XS_INLINE HashMapIterator& operator++() noexcept
+    {
+        ++control;
+        ++pointer;
+        skipFree();
+        return *this;
+    }
+
+    /**
+     * Equality operator.
+     * @param other The other iterator.
+     * @returns The result of the operation.
+     */
+    XS_INLINE bool operator==(const HashMapIterator& other) const noexcept
+    {
+        return control == other.control;
+    }
+
+    /**
+     * Inequality operator.
+     * @param other The other iterator.
+     * @returns The result of the operation.
+     */
+    XS_INLINE bool operator!=(const HashMapIterator& other) const noexcept
+    {
+        return control != other.control;
+    }
+
+private:
+    /** Move forward until a used slot or the end is reached. */
+    XS_INLINE void skipFree() noexcept
+    {
+        while (control < controlEnd && *control < 0) {
+            ++control;
+            ++pointer;
+        }
+    }
+};
+
+/**
+ * Open addressing hash map using groups of control bytes that are probed in parallel.
+ * @note Each slot has a matching control byte that stores either 7bits of the keys hash or a marker for an
+ * empty/deleted slot. Lookups check a whole group of control bytes at once so that key comparisons are only
+ * performed on likely candidates.
+ * @tparam K     Type of the key used to lookup elements.
+ * @tparam V     Type of the value stored for each key.
+ * @tparam H     Type of functor used to hash keys.
+ * @tparam Alloc Type of allocator used to allocate elements.
+ */
+template<typename K, typename V, typename H = Hash<K>, typename Alloc = AllocRegionHeap<Pair<K, V>>>
+requires(isComparable<K, K>)
+class HashMap
+{
+public:
+    using Key = K;
+    using Value = V;
+    using Type = Pair<K, V>;
+    using TypeIterator = HashMapIterator<Type>;
+    using TypeConstIterator = HashMapIterator<const Type>;
+    using Allocator = typename Alloc::template Allocator<Type>;
+    using Handle = typename Allocator::Handle;
+    using ControlHandle = typename Alloc::template Allocator<int8, NoExport::hashGroupWidth>::Handle;
+
+    static_assert(Handle::isResizable, "HashMap requires a resizable allocator");
+
+    Handle handle;               /**< The handle used to store elements */
+    ControlHandle controlHandle; /**< The handle used to store control bytes for each element */
+    uint0 length = 0;            /**< Number of elements currently stored */
+    uint0 capacity = 0;          /**< Number of allocated slots (power of 2) */
+    uint0 growthLeft = 0;        /**< Number of elements that can be added before a rehash is required */
+
+    /** Default constructor. */
+    XS_INLINE HashMap() noexcept = default;
+
+    /**
+     * Constructor that reserves space for a number of elements.
+     * @param number The number of elements to reserve space for.
+     */
+    explicit XS_INLINE HashMap(const uint0 number) noexcept
+    {
+        rehash(capacityFor(number));
+    }
+
+    /**
+     * Copy constructor.
+     * @param other The other hash map.
+     */
+    XS_INLINE HashMap(const HashMap& other) noexcept
+    {
+        if (other.length > 0 && rehash(capacityFor(other.length))) [[likely]] {
+            for (const auto& i : other) {
+                insertUnique(H()(i.first), i);
+            }
+        }
+    }
+
+    /**
+     * Move constructor.
+     * @param other The other hash map.
+     */
+    XS_INLINE HashMap(HashMap&& other) noexcept
+        : handle(move(other.handle))
+        , controlHandle(move(other.controlHandle))
+        , length(other.length)
+        , capacity(other.capacity)
+        , growthLeft(other.growthLeft)
+    {
+        other.length = 0;
+        other.capacity = 0;
+        other.growthLeft = 0;
+    }
+
+    /** Destructor. */
+    XS_INLINE ~HashMap() noexcept
+    {
+        destructAll();
+    }
+
+    /**
+     * Assignment operator.
+     * @param other The other hash map.
+     * @returns A deep copy of this object.
+     */
+    XS_INLINE HashMap& operator=(const HashMap& other) noexcept
+    {
+        if (this != &other) [[likely]] {
+            HashMap temp(other);
+            swap(temp);
+        }
+        return *this;
+    }
+
+    /**
+     * Move assignment operator.
+     * @param other The other hash map.
+     * @returns A shallow copy of this object.
+     */
+    XS_INLINE HashMap& operator=(HashMap&& other) noexcept
+    {
+        swap(other);
+        return *this;
+    }
+
+    /**
+     * Swap the contents of two hash maps around.
+     * @param [in,out] other The hash map to swap with this one.
+     */
+    XS_INLINE void swap(HashMap& other) noexcept
+    {
+        Shift::swap(handle, other.handle);
+        Shift::swap(controlHandle, other.controlHandle);
+        Shift::swap(length, other.length);
+        Shift::swap(capacity, other.capacity);
+        Shift::swap(growthLeft, other.growthLeft);
+    }
+
+    /**
+     * Checks whether the hash map has any allocated memory.
+     * @returns True if valid, false if not.
+     */
+    XS_INLINE bool isValid() const noexcept
+    {
+        return capacity != 0;
+    }
+
+    /**
+     * Check if the hash map is empty or not.
+     * @returns Boolean signaling if hash map is empty.
+     */
+    XS_INLINE bool isEmpty() const noexcept
+    {
+        return length == 0;
+    }
+
+    /**
+     * Get the number of elements in the hash map.
+     * @returns The number of elements currently stored within the hash map.
+     */
+    XS_INLINE uint0 getLength() const noexcept
+    {
+        return length;
+    }
+
+    /**
+     * Get the number of elements currently reserved for.
+     * @returns The number of elements that can be stored before the hash map must grow.
+     */
+    XS_INLINE uint0 getReservedLength() const noexcept
+    {
+        return maxLength(capacity);
+    }
+
+    /**
+     * Manually set the number of elements to reserve for.
+     * @note This will not reduce the reserved size below what is needed to hold the current elements.
+     * @param number The number of elements to reserve space for.
+     * @returns Boolean signaling if new memory could be reserved.
+     */
+    XS_INLINE bool setReservedLength(const uint0 number) noexcept
+    {
+        const uint0 newCapacity = capacityFor(number > length ? number : length);
+        if (newCapacity == capacity) {
+            return true;
+        }
+        return rehash(newCapacity);
+    }
+
+    /**
+     * Add an element to the hash map.
+     * @note If the key already exists then the existing value is replaced.
+     * @tparam K2 Type of the key being added.
+     * @tparam V2 Type of the value being added.
+     * @param key   The key to add.
+     * @param value The value to store for the key.
+     * @returns False if memory allocation failed.
+     */
+    template<typename K2, typename V2>
+    requires(isNothrowConstructible<Key, K2> && isNothrowConstructible<Value, V2>)
+    XS_INLINE bool add(K2&& key, V2&& value) noexcept
+    {
+        const uint64 hash = H()(key);
+        if (const uint0 index = findIndex(key, hash); index != invalidIndex) {
+            handle.pointer[index].second = forward<V2>(value);
+            return true;
+        }
+        const uint0 index = prepareInsert(hash);
+        if (index == invalidIndex) [[unlikely]] {
+            return false;
+        }
+        memConstruct<Type>(&handle.pointer[index], Key(forward<K2>(key)), Value(forward<V2>(value)));
+        return true;
+    }
+
+    /**
+     * Find the value associated with a key, adding a default constructed value if the key does not exist.
+     * @tparam K2 Type of the key being searched for.
+     * @param key The key to search for.
+     * @returns Pointer to the value (return is nullptr if memory allocation failed).
+     */
+    template<typename K2>
+    requires(isNothrowConstructible<Key, K2> && isNothrowDefaultConstructible<Value>)
+    XS_INLINE Value* findOrAdd(K2&& key) noexcept
+    {
+        const uint64 hash = H()(key);
+        if (const uint0 index = findIndex(key, hash); index != invalidIndex) {
+            return &handle.pointer[index].second;
+        }
+        const uint0 index = prepareInsert(hash);
+        if (index == invalidIndex) [[unlikely]] {
+            return nullptr;
+        }
+        memConstruct<Type>(&handle.pointer[index], Key(forward<K2>(key)), Value());
+        return &handle.pointer[index].second;
+    }
+
+    /**
+     * Remove an element from the hash map.
+     * @tparam K2 Type of the key being removed.
+     * @param key The key of the element to remove.
+     * @returns True if the element was found and removed.
+     */
+    template<typename K2>
+    requires(isComparable<Key, K2>)
+    XS_INLINE bool remove(const K2& key) noexcept
+    {
+        const uint0 index = findIndex(key, H()(key));
+        if (index == invalidIndex) {
+            return false;
+        }
+        memDestruct<Type>(&handle.pointer[index]);
+        // If the group still has an empty slot then no probe sequence can have passed through it, so the slot can be
+        // marked as empty instead of leaving a tombstone behind.
+        const int8* group = controlHandle.pointer + (index & ~(NoExport::hashGroupWidth - 1));
+        if (NoExport::hashGroupMatchEmpty(group) != 0) {
+            controlHandle.pointer[index] = NoExport::hashControlEmpty;
+            ++growthLeft;
+        } else {
+            controlHandle.pointer[index] = NoExport::hashControlDeleted;
+        }
+        --length;
+        return true;
+    }
+
+    /**
+     * Remove all elements from the hash map.
+     * @note Unlike clear this does not de-allocate the hash maps memory.
+     */
+    XS_INLINE void removeAll() noexcept
+    {
+        destructAll();
+        resetControl();
+    }
+
+    /**
+     * Remove all elements from the hash map and clear.
+     * @note This removes all elements from the hash map and de-allocates the hash maps memory.
+     */
+    XS_INLINE void clear() noexcept
+    {
+        destructAll();
+        handle.unallocate();
+        controlHandle.unallocate();
+        length = 0;
+        capacity = 0;
+        growthLeft = 0;
+    }
+
+    /**
+     * Find the value associated with a key.
+     * @tparam K2 Type of the key being searched for.
+     * @param key The key to search for.
+     * @returns Pointer to the value (return is nullptr if the key could not be found).
+     */
+    template<typename K2>
+    requires(isComparable<Key, K2>)
+    XS_INLINE Value* find(const K2& key) noexcept
+    {
+        const uint0 index = findIndex(key, H()(key));
+        return index != invalidIndex ? &handle.pointer[index].second : nullptr;
+    }
+
+    /**
+     * Find the value associated with a key.
+     * @tparam K2 Type of the key being searched for.
+     * @param key The key to search for.
+     * @returns Pointer to the value (return is nullptr if the key could not be found).
+     */
+    template<typename K2>
+    requires(isComparable<Key, K2>)
+    XS_INLINE const Value* find(const K2& key) const noexcept
+    {
+        const uint0 index = findIndex(key, H()(key));
+        return index != invalidIndex ? &handle.pointer[index].second : nullptr;
+    }
+
+    /**
+     * Check if a key exists within the hash map.
+     * @tparam K2 Type of the key being searched for.
+     * @param key The key to search for.
+     * @returns True if the key was found.
+     */
+    template<typename K2>
+    requires(isComparable<Key, K2>)
+    XS_INLINE bool contains(const K2& key) const noexcept
+    {
+        return findIndex(key, H()(key)) != invalidIndex;
+    }
+
+    /**
+     * Get the value associated with a key.
+     * @note The key must exist within the hash map.
+     * @tparam K2 Type of the key being searched for.
+     * @param key The key to search for.
+     * @returns The value associated with the key.
+     */
+    template<typename K2>
+    requires(isComparable<Key, K2>)
+    XS_INLINE Value& at(const K2& key) noexcept
+    {
+        const uint0 index = findIndex(key, H()(key));
+        XS_ASSERT(index != invalidIndex);
+        return handle.pointer[index].second;
+    }
+
+    /**
+     * Get the value associated with a key.
+     * @note The key must exist within the hash map.
+     * @tparam K2 Type of the key being searched for.
+     * @param key The key to search for.
+     * @returns The value associated with the key.
+     */
+    template<typename K2>
+    requires(isComparable<Key, K2>)
+    XS_INLINE const Value& at(const K2& key) const noexcept
+    {
+        const uint0 index = findIndex(key, H()(key));
+        XS_ASSERT(index != invalidIndex);
+        return handle.pointer[index].second;
+    }
+
+    /**
+     * Gets an iterator to the first element in the hash map.
+     * @returns The iterator.
+     */
+    XS_INLINE TypeIterator begin() noexcept
+    {
+        return TypeIterator(controlHandle.pointer, controlHandle.pointer + capacity, handle.pointer);
+    }
+
+    /**
+     * Gets an iterator to the first element in the hash map.
+     * @returns The iterator.
+     */
+    XS_INLINE TypeConstIterator begin() const noexcept
+    {
+        return cbegin();
+    }
+
+    /**
+     * Gets a constant iterator to the first element in the hash map.
+     * @returns The iterator.
+     */
+    XS_INLINE TypeConstIterator cbegin() const noexcept
+    {
+        return TypeConstIterator(controlHandle.pointer, controlHandle.pointer + capacity, handle.pointer);
+    }
+
+    /**
+     * Gets an iterator to the end of the hash map.
+     * @returns The iterator.
+     */
+    XS_INLINE TypeIterator end() noexcept
+    {
+        return TypeIterator(controlHandle.pointer + capacity, controlHandle.pointer + capacity, handle.pointer + capacity);
+    }
+
+    /**
+     * Gets an iterator to the end of the hash map.
+     * @returns The iterator.
+     */
+    XS_INLINE TypeConstIterator end() const noexcept
+    {
+        return cend();
+    }
+
+    /**
+     * Gets a constant iterator to the end of the hash map.
+     * @returns The iterator.
+     */
+    XS_INLINE TypeConstIterator cend() const noexcept
+    {
+        return TypeConstIterator(
+            controlHandle.pointer + capacity, controlHandle.pointer + capacity, handle.pointer + capacity);
+    }
+
+private:
+    static constexpr uint0 invalidIndex = Limits<uint0>::Max();
+
+    /**
+     * Get the maximum number of elements that can be stored for a given capacity.
+     * @param slots The number of slots.
+     * @returns The maximum number of elements (7/8 load factor).
+     */
+    XS_INLINE static constexpr uint0 maxLength(const uint0 slots) noexcept
+    {
+        return slots - (slots >> 3);
+    }
+
+    /**
+     * Get the number of slots required to store a number of elements.
+     * @param number The number of elements.
+     * @returns The required capacity (power of 2 and at least a single group).
+     */
+    XS_INLINE static uint0 capacityFor(const uint0 number) noexcept
+    {
+        uint0 ret = NoExport::hashGroupWidth;
+        while (maxLength(ret) < number) {
+            ret <<= 1;
+        }
+        return ret;
+    }
+
+    /**
+     * Get the 7bit fragment of a hash that is stored in the control bytes.
+     * @param hash The hash.
+     * @returns The control value.
+     */
+    XS_INLINE static int8 hashControl(const uint64 hash) noexcept
+    {
+        return static_cast<int8>(hash & 0x7F);
+    }
+
+    /**
+     * Get the first group that should be probed for a hash.
+     * @param hash The hash.
+     * @returns The group index.
+     */
+    XS_INLINE uint0 hashGroup(const uint64 hash) const noexcept
+    {
+        return static_cast<uint0>(hash >> 7) & groupMask();
+    }
+
+    /**
+     * Get the mask used to wrap group indexes.
+     * @returns The group mask.
+     */
+    XS_INLINE uint0 groupMask() const noexcept
+    {
+        return (capacity / NoExport::hashGroupWidth) - 1;
+    }
+
+    /**
+     * Find the slot containing a key.
+     * @tparam K2 Type of the key being searched for.
+     * @param key  The key to search for.
+     * @param hash The hash of the key.
+     * @returns The slot index (return is invalidIndex if the key could not be found).
+     */
+    template<typename K2>
+    XS_INLINE uint0 findIndex(const K2& key, const uint64 hash) const noexcept
+    {
+        if (capacity == 0) [[unlikely]] {
+            return invalidIndex;
+        }
+        const int8 control = hashControl(hash);
+        const uint0 mask = groupMask();
+        uint0 group = hashGroup(hash);
+        // Triangular probing visits every group when the number of groups is a power of 2
+        for (uint0 step = 1;; ++step) {
+            const uint0 base = group * NoExport::hashGroupWidth;
+            const int8* groupControl = controlHandle.pointer + base;
+            for (uint32 match = NoExport::hashGroupMatch(groupControl, control); match != 0; match &= match - 1) {
+                const uint0 index = base + ctz(match);
+                if (handle.pointer[index].first == key) [[likely]] {
+                    return index;
+                }
+            }
+            if (NoExport::hashGroupMatchEmpty(groupControl) != 0) [[likely]] {
+                return invalidIndex;
+            }
+            group = (group + step) & mask;
+        }
+    }
+
+    /**
+     * Find the first available slot in the probe sequence for a hash.
+     * @param hash The hash.
+     * @returns The slot index.
+     */
+    XS_INLINE uint0 findFree(const uint64 hash) const noexcept
+    {
+        const uint0 mask = groupMask();
+        uint0 group = hashGroup(hash);
+        for (uint0 step = 1;; ++step) {
+            const uint0 base = group * NoExport::hashGroupWidth;
+            if (const uint32 match = NoExport::hashGroupMatchFree(controlHandle.pointer + base); match != 0)
+                [[likely]] {
+                return base + ctz(match);
+            }
+            group = (group + step) & mask;
+        }
+    }
+
+    /**
+     * Reserve a slot for a new element, rehashing if required.
+     * @note The returned slot is marked as used but the element is not constructed.
+     * @param hash The hash of the new elements key.
+     * @returns The slot index (return is invalidIndex if memory allocation failed).
+     */
+    XS_INLINE uint0 prepareInsert(const uint64 hash) noexcept
+    {
+        uint0 index = invalidIndex;
+        if (capacity != 0) [[likely]] {
+            index = findFree(hash);
+        }
+        // Reusing a deleted slot does not reduce growth as it was already accounted for when added
+        if (index == invalidIndex || (growthLeft == 0 && controlHandle.pointer[index] == NoExport::hashControlEmpty))
+            [[unlikely]] {
+            // Grow if more than half full, otherwise just flush the deleted slots
+            const uint0 newCapacity =
+                (capacity == 0) ? NoExport::hashGroupWidth : ((length + 1 > (capacity >> 1)) ? capacity << 1 : capacity);
+            if (!rehash(newCapacity)) [[unlikely]] {
+                return invalidIndex;
+            }
+            index = findFree(hash);
+        }
+        if (controlHandle.pointer[index] == NoExport::hashControlEmpty) {
+            --growthLeft;
+        }
+        controlHandle.pointer[index] = hashControl(hash);
+        ++length;
+        return index;
+    }
+
+    /**
+     * Add an element that is known to not already exist without checking for available space.
+     * @param hash  The hash of the elements key.
+     * @param value The element to add.
+     */
+    XS_INLINE void insertUnique(const uint64 hash, const Type& value) noexcept
+    {
+        const uint0 index = findFree(hash);
+        controlHandle.pointer[index] = hashControl(hash);
+        memConstruct<Type>(&handle.pointer[index], value);
+        --growthLeft;
+        ++length;
+    }
+
+    /**
+     * Move all elements into newly allocated memory.
+     * @param newCapacity The new number of slots (must be a power of 2 and large enough to store existing elements).
+     * @returns Boolean signaling if new memory could be allocated.
+     */
+    XS_INLINE bool rehash(const uint0 newCapacity) noexcept
+    {
+        XS_ASSERT(newCapacity % NoExport::hashGroupWidth == 0);
+        XS_ASSERT(maxLength(newCapacity) >= length);
+        Handle newHandle(newCapacity);
+        ControlHandle newControlHandle(newCapacity);
+        if (newHandle.pointer == nullptr || newControlHandle.pointer == nullptr) [[unlikely]] {
+            return false;
+        }
+        Shift::swap(handle, newHandle);
+        Shift::swap(controlHandle, newControlHandle);
+        const uint0 oldCapacity = capacity;
+        capacity = newCapacity;
+        resetControl();
+        // Move each existing element into its new location
+        for (uint0 i = 0; i < oldCapacity; ++i) {
+            if (newControlHandle.pointer[i] >= 0) {
+                Type* oldElement = &newHandle.pointer[i];
+                const uint64 hash = H()(oldElement->first);
+                const uint0 index = findFree(hash);
+                controlHandle.pointer[index] = hashControl(hash);
+                memConstruct<Type>(&handle.pointer[index], move(*oldElement));
+                memDestruct<Type>(oldElement);
+                --growthLeft;
+                ++length;
+            }
+        }
+        return true;
+    }
+
+    /** Mark all slots as empty. */
+    XS_INLINE void resetControl() noexcept
+    {
+        for (uint0 i = 0; i < capacity; ++i) {
+            controlHandle.pointer[i] = NoExport::hashControlEmpty;
+        }
+        length = 0;
+        growthLeft = maxLength(capacity);
+    }
+
+    /** Destruct all currently stored elements. */
+    XS_INLINE void destructAll() noexcept
+    {
+        if constexpr (!isTriviallyDestructible<Type>) {
+            for (uint0 i = 0; i < capacity; ++i) {
+                if (controlHandle.pointer[i] >= 0) {
+                    memDestruct<Type>(&handle.pointer[i]);
+                }
+            }
+        }
+    }
+};
+} // namespace Shift
@@ -475,4 +475,246 @@ public:
         return (pointer != iterator2.pointer);
     }
 };
+
+/**
+ * Non editable iterator over elements separated by a fixed number of bytes.
+ * @tparam T Type iterator refers to.
+ */
+template<typename T>
+class ConstStrideIterator
+{
+public:
+    const T* pointer = nullptr;
+    uint0 stride = sizeof(T); /**< Number of bytes between each element */
+
+    /** Defaulted constructor. */
+    XS_INLINE ConstStrideIterator() noexcept = default;
+
+    /**
+     * Constructor.
+     * @param pointer The pointer.
+     * @param stride  The number of bytes between each element.
+     */
+    XS_INLINE ConstStrideIterator(const T* const pointer, const uint0 stride) noexcept
+        : pointer(pointer)
+        , stride(stride)
+    {}
+
+    /**
+     * Defaulted copy constructor.
+     * @param other The other.
+     */
+    XS_INLINE ConstStrideIterator(const ConstStrideIterator& other) noexcept = default;
+
+    /**
+     * Defaulted move constructor.
+     * @param other The other.
+     */
+    XS_INLINE ConstStrideIterator(ConstStrideIterator&& other) noexcept = default;
+
+    /**
+     * Defaulted assignment operator.
+     * @param other The other.
+     * @returns A shallow copy of this object.
+     */
+    XS_INLINE ConstStrideIterator& operator=(const ConstStrideIterator& other) noexcept = default;
+
+    /**
+     * Defaulted move assignment operator.
+     * @param other The other.
+     * @returns A shallow copy of this object.
+     */
+    XS_INLINE ConstStrideIterator& operator=(ConstStrideIterator&& other) noexcept = default;
+
+    /**
+     * Return reference to element referenced by iterator.
+     * @return The data referenced by the iterator.
+     */
+    XS_INLINE const T& operator*() const noexcept
+    {
+        return *pointer;
+    }
+
+    XS_INLINE const T& operator->() const noexcept
+    {
+        return *pointer;
+    }
+
+    /**
+     * Increment an iterator.
+     * @return The result of the operation.
+     */
+    XS_INLINE ConstStrideIterator& operator++() noexcept
+    {
+        pointer = after(stride);
+        return *this;
+    }
+
+    /**
+     * Post increment operator.
+     * @return The result of the operation.
+     */
+    XS_INLINE ConstStrideIterator operator++(int32) noexcept
+    {
+        ConstStrideIterator<T> temp(*this);
+        pointer = after(stride);
+        return temp;
+    }
+
+    /**
+     * Decrement an iterator.
+     * @return The result of the operation.
+     */
+    XS_INLINE ConstStrideIterator& operator--() noexcept
+    {
+        pointer = before(stride);
+        return *this;
+    }
+
+    /**
+     * Post decrement operator.
+     * @return The result of the operation.
+     */
+    XS_INLINE ConstStrideIterator operator--(int32) noexcept
+    {
+        ConstStrideIterator<T> temp(*this);
+        pointer = before(stride);
+        return temp;
+    }
+
+    /**
+     * Increment an iterator by a specified amount.
+     * @param index Number of elements to increment the iterator by.
+     * @return The result of the operation.
+     */
+    XS_INLINE ConstStrideIterator operator+(const uint0 index) const noexcept
+    {
+        return ConstStrideIterator<T>(after(index * stride), stride);
+    }
+
+    /**
+     * Perform a compound increment of the iterator by a specified amount.
+     * @param index Number of elements to increment the iterator by.
+     * @return The result of the operation.
+     */
+    XS_INLINE ConstStrideIterator& operator+=(const uint0 index) noexcept
+    {
+        pointer = after(index * stride);
+        return *this;
+    }
+
+    /**
+     * Decrement an iterator by a specified amount.
+     * @param index Number of elements to decrement the iterator by.
+     * @return The result of the operation.
+     */
+    XS_INLINE ConstStrideIterator operator-(const uint0 index) const noexcept
+    {
+        return ConstStrideIterator<T>(before(index * stride), stride);
+    }
+
+    /**
+     * Perform a compound decrement of the iterator by a specified amount.
+     * @param index Number of elements to decrement the iterator by.
+     * @return The result of the operation.
+     */
+    XS_INLINE ConstStrideIterator& operator-=(const uint0 index) noexcept
+    {
+        pointer = before(index * stride);
+        return *this;
+    }
+
+    /**
+     * Determine number of elements between 2 iterators.
+     * @param iterator2 The second iterator.
+     * @return The number of elements between iterator and the current iterator.
+     */
+    XS_INLINE uint0 operator-(const ConstStrideIterator& iterator2) const noexcept
+    {
+        return static_cast<uint0>(reinterpret_cast<const uint8*>(pointer) -
+                   reinterpret_cast<const uint8*>(iterator2.pointer)) /
+            stride;
+    }
+
+    /**
+     * Compare to iterators are equal.
+     * @param iterator2 The second iterator to compare to.
+     * @return True/false.
+     */
+    XS_INLINE bool operator==(const ConstStrideIterator& iterator2) const noexcept
+    {
+        return (pointer == iterator2.pointer);
+    }
+
+    /**
+     * Compare to iterators are less than or equal.
+     * @param iterator2 The second iterator to compare to.
+     * @return True/false.
+     */
+    XS_INLINE bool operator<=(const ConstStrideIterator& iterator2) const noexcept
+    {
+        return (pointer <= iterator2.pointer);
+    }
+
+    /**
+     * Compare to iterators are less than.
+     * @param iterator2 The second iterator to compare to.
+     * @return True/false.
+     */
+    XS_INLINE bool operator<(const ConstStrideIterator& iterator2) const noexcept
+    {
+        return (pointer < iterator2.pointer);
+    }
+
+    /**
+     * Compare to iterators are greater than or equal.
+     * @param iterator2 The second iterator to compare to.
+     * @return True/false.
+     */
+    XS_INLINE bool operator>=(const ConstStrideIterator& iterator2) const noexcept
+    {
+        return (pointer >= iterator2.pointer);
+    }
+
+    /**
+     * Compare to iterators are greater than.
+     * @param iterator2 The second iterator to compare to.
+     * @return True/false.
+     */
+    XS_INLINE bool operator>(const ConstStrideIterator& iterator2) const noexcept
+    {
+        return (pointer > iterator2.pointer);
+    }
+
+    /**
+     * Compare to iterators are not equal.
+     * @param iterator2 The second iterator to compare to.
+     * @return True/false.
+     */
+    XS_INLINE bool operator!=(const ConstStrideIterator& iterator2) const noexcept
+    {
+        return (pointer != iterator2.pointer);
+    }
+
+private:
+    /**
+     * Get a pointer after the current element.
+     * @param bytes The number of bytes to move forwards.
+     * @return The offset pointer.
+     */
+    XS_INLINE const T* after(const uint0 bytes) const noexcept
+    {
+        return reinterpret_cast<const T*>(reinterpret_cast<const uint8*>(pointer) + bytes);
+    }
+
+    /**
+     * Get a pointer before the current element.
+     * @param bytes The number of bytes to move backwards.
+     * @return The offset pointer.
+     */
+    XS_INLINE const T* before(const uint0 bytes) const noexcept
+    {
+        return reinterpret_cast<const T*>(reinterpret_cast<const uint8*>(pointer) - bytes);
+    }
+};
 } // namespace Shift
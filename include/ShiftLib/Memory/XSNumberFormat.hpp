@@ -0,0 +1,714 @@
+#pragma once
+/**
+ * Copyright Matthew Oliver
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Memory/XSNumberParse.hpp"
+#include "XSBit.hpp"
+#include "XSInt128.hpp"
+#include "XSMath.hpp"
+#include "XSUInt128.hpp"
+
+namespace Shift {
+namespace NoExport {
+/**< Smallest decimal exponent found in the formatting power of ten table */
+inline constexpr int32 numberFormatPowerMin = -292;
+
+/**< The decimal digits of every value in [0, 99] stored as pairs of characters */
+inline constexpr char numberDigitPairs[201] =
+    "0001020304050607080910111213141516171819"
+    "2021222324252627282930313233343536373839"
+    "4041424344454647484950515253545556575859"
+    "6061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899"; // NOLINT(modernize-avoid-c-arrays)
+
+// Powers of 10 for each decimal exponent in [-292, 324] rounded up to 128bits. Each value is shifted so that its most
+// significant bit is set and is stored as its high 64bits followed by its low 64bits.
+/**< Table of normalised powers of ten */
+alignas(16) inline constexpr uint64 numberFormatPowerOfTen[1234] = {
+    0xFF77B1FCBEBCDC4F_ui64, 0x25E8E89C13BB0F7B_ui64, 0x9FAACF3DF73609B1_ui64, 0x77B191618C54E9AD_ui64,
+    0xC795830D75038C1D_ui64, 0xD59DF5B9EF6A2418_ui64, 0xF97AE3D0D2446F25_ui64, 0x4B0573286B44AD1E_ui64,
+    0x9BECCE62836AC577_ui64, 0x4EE367F9430AEC33_ui64, 0xC2E801FB244576D5_ui64, 0x229C41F793CDA740_ui64,
+    0xF3A20279ED56D48A_ui64, 0x6B43527578C11110_ui64, 0x9845418C345644D6_ui64, 0x830A13896B78AAAA_ui64,
+    0xBE5691EF416BD60C_ui64, 0x23CC986BC656D554_ui64, 0xEDEC366B11C6CB8F_ui64, 0x2CBFBE86B7EC8AA9_ui64,
+    0x94B3A202EB1C3F39_ui64, 0x7BF7D71432F3D6AA_ui64, 0xB9E08A83A5E34F07_ui64, 0xDAF5CCD93FB0CC54_ui64,
+    0xE858AD248F5C22C9_ui64, 0xD1B3400F8F9CFF69_ui64, 0x91376C36D99995BE_ui64, 0x23100809B9C21FA2_ui64,
+    0xB58547448FFFFB2D_ui64, 0xABD40A0C2832A78B_ui64, 0xE2E69915B3FFF9F9_ui64, 0x16C90C8F323F516D_ui64,
+    0x8DD01FAD907FFC3B_ui64, 0xAE3DA7D97F6792E4_ui64, 0xB1442798F49FFB4A_ui64, 0x99CD11CFDF41779D_ui64,
+    0xDD95317F31C7FA1D_ui64, 0x40405643D711D584_ui64, 0x8A7D3EEF7F1CFC52_ui64, 0x482835EA666B2573_ui64,
+    0xAD1C8EAB5EE43B66_ui64, 0xDA3243650005EED0_ui64, 0xD863B256369D4A40_ui64, 0x90BED43E40076A83_ui64,
+    0x873E4F75E2224E68_ui64, 0x5A7744A6E804A292_ui64, 0xA90DE3535AAAE202_ui64, 0x711515D0A205CB37_ui64,
+    0xD3515C2831559A83_ui64, 0x0D5A5B44CA873E04_ui64, 0x8412D9991ED58091_ui64, 0xE858790AFE9486C3_ui64,
+    0xA5178FFF668AE0B6_ui64, 0x626E974DBE39A873_ui64, 0xCE5D73FF402D98E3_ui64, 0xFB0A3D212DC81290_ui64,
+    0x80FA687F881C7F8E_ui64, 0x7CE66634BC9D0B9A_ui64, 0xA139029F6A239F72_ui64, 0x1C1FFFC1EBC44E81_ui64,
+    0xC987434744AC874E_ui64, 0xA327FFB266B56221_ui64, 0xFBE9141915D7A922_ui64, 0x4BF1FF9F0062BAA9_ui64,
+    0x9D71AC8FADA6C9B5_ui64, 0x6F773FC3603DB4AA_ui64, 0xC4CE17B399107C22_ui64, 0xCB550FB4384D21D4_ui64,
+    0xF6019DA07F549B2B_ui64, 0x7E2A53A146606A49_ui64, 0x99C102844F94E0FB_ui64, 0x2EDA7444CBFC426E_ui64,
+    0xC0314325637A1939_ui64, 0xFA911155FEFB5309_ui64, 0xF03D93EEBC589F88_ui64, 0x793555AB7EBA27CB_ui64,
+    0x96267C7535B763B5_ui64, 0x4BC1558B2F3458DF_ui64, 0xBBB01B9283253CA2_ui64, 0x9EB1AAEDFB016F17_ui64,
+    0xEA9C227723EE8BCB_ui64, 0x465E15A979C1CADD_ui64, 0x92A1958A7675175F_ui64, 0x0BFACD89EC191ECA_ui64,
+    0xB749FAED14125D36_ui64, 0xCEF980EC671F667C_ui64, 0xE51C79A85916F484_ui64, 0x82B7E12780E7401B_ui64,
+    0x8F31CC0937AE58D2_ui64, 0xD1B2ECB8B0908811_ui64, 0xB2FE3F0B8599EF07_ui64, 0x861FA7E6DCB4AA16_ui64,
+    0xDFBDCECE67006AC9_ui64, 0x67A791E093E1D49B_ui64, 0x8BD6A141006042BD_ui64, 0xE0C8BB2C5C6D24E1_ui64,
+    0xAECC49914078536D_ui64, 0x58FAE9F773886E19_ui64, 0xDA7F5BF590966848_ui64, 0xAF39A475506A899F_ui64,
+    0x888F99797A5E012D_ui64, 0x6D8406C952429604_ui64, 0xAAB37FD7D8F58178_ui64, 0xC8E5087BA6D33B84_ui64,
+    0xD5605FCDCF32E1D6_ui64, 0xFB1E4A9A90880A65_ui64, 0x855C3BE0A17FCD26_ui64, 0x5CF2EEA09A550680_ui64,
+    0xA6B34AD8C9DFC06F_ui64, 0xF42FAA48C0EA481F_ui64, 0xD0601D8EFC57B08B_ui64, 0xF13B94DAF124DA27_ui64,
+    0x823C12795DB6CE57_ui64, 0x76C53D08D6B70859_ui64, 0xA2CB1717B52481ED_ui64, 0x54768C4B0C64CA6F_ui64,
+    0xCB7DDCDDA26DA268_ui64, 0xA9942F5DCF7DFD0A_ui64, 0xFE5D54150B090B02_ui64, 0xD3F93B35435D7C4D_ui64,
+    0x9EFA548D26E5A6E1_ui64, 0xC47BC5014A1A6DB0_ui64, 0xC6B8E9B0709F109A_ui64, 0x359AB6419CA1091C_ui64,
+    0xF867241C8CC6D4C0_ui64, 0xC30163D203C94B63_ui64, 0x9B407691D7FC44F8_ui64, 0x79E0DE63425DCF1E_ui64,
+    0xC21094364DFB5636_ui64, 0x985915FC12F542E5_ui64, 0xF294B943E17A2BC4_ui64, 0x3E6F5B7B17B2939E_ui64,
+    0x979CF3CA6CEC5B5A_ui64, 0xA705992CEECF9C43_ui64, 0xBD8430BD08277231_ui64, 0x50C6FF782A838354_ui64,
+    0xECE53CEC4A314EBD_ui64, 0xA4F8BF5635246429_ui64, 0x940F4613AE5ED136_ui64, 0x871B7795E136BE9A_ui64,
+    0xB913179899F68584_ui64, 0x28E2557B59846E40_ui64, 0xE757DD7EC07426E5_ui64, 0x331AEADA2FE589D0_ui64,
+    0x9096EA6F3848984F_ui64, 0x3FF0D2C85DEF7622_ui64, 0xB4BCA50B065ABE63_ui64, 0x0FED077A756B53AA_ui64,
+    0xE1EBCE4DC7F16DFB_ui64, 0xD3E8495912C62895_ui64, 0x8D3360F09CF6E4BD_ui64, 0x64712DD7ABBBD95D_ui64,
+    0xB080392CC4349DEC_ui64, 0xBD8D794D96AACFB4_ui64, 0xDCA04777F541C567_ui64, 0xECF0D7A0FC5583A1_ui64,
+    0x89E42CAAF9491B60_ui64, 0xF41686C49DB57245_ui64, 0xAC5D37D5B79B6239_ui64, 0x311C2875C522CED6_ui64,
+    0xD77485CB25823AC7_ui64, 0x7D633293366B828C_ui64, 0x86A8D39EF77164BC_ui64, 0xAE5DFF9C02033198_ui64,
+    0xA8530886B54DBDEB_ui64, 0xD9F57F830283FDFD_ui64, 0xD267CAA862A12D66_ui64, 0xD072DF63C324FD7C_ui64,
+    0x8380DEA93DA4BC60_ui64, 0x4247CB9E59F71E6E_ui64, 0xA46116538D0DEB78_ui64, 0x52D9BE85F074E609_ui64,
+    0xCD795BE870516656_ui64, 0x67902E276C921F8C_ui64, 0x806BD9714632DFF6_ui64, 0x00BA1CD8A3DB53B7_ui64,
+    0xA086CFCD97BF97F3_ui64, 0x80E8A40ECCD228A5_ui64, 0xC8A883C0FDAF7DF0_ui64, 0x6122CD128006B2CE_ui64,
+    0xFAD2A4B13D1B5D6C_ui64, 0x796B805720085F82_ui64, 0x9CC3A6EEC6311A63_ui64, 0xCBE3303674053BB1_ui64,
+    0xC3F490AA77BD60FC_ui64, 0xBEDBFC4411068A9D_ui64, 0xF4F1B4D515ACB93B_ui64, 0xEE92FB5515482D45_ui64,
+    0x991711052D8BF3C5_ui64, 0x751BDD152D4D1C4B_ui64, 0xBF5CD54678EEF0B6_ui64, 0xD262D45A78A0635E_ui64,
+    0xEF340A98172AACE4_ui64, 0x86FB897116C87C35_ui64, 0x9580869F0E7AAC0E_ui64, 0xD45D35E6AE3D4DA1_ui64,
+    0xBAE0A846D2195712_ui64, 0x8974836059CCA10A_ui64, 0xE998D258869FACD7_ui64, 0x2BD1A438703FC94C_ui64,
+    0x91FF83775423CC06_ui64, 0x7B6306A34627DDD0_ui64, 0xB67F6455292CBF08_ui64, 0x1A3BC84C17B1D543_ui64,
+    0xE41F3D6A7377EECA_ui64, 0x20CABA5F1D9E4A94_ui64, 0x8E938662882AF53E_ui64, 0x547EB47B7282EE9D_ui64,
+    0xB23867FB2A35B28D_ui64, 0xE99E619A4F23AA44_ui64, 0xDEC681F9F4C31F31_ui64, 0x6405FA00E2EC94D5_ui64,
+    0x8B3C113C38F9F37E_ui64, 0xDE83BC408DD3DD05_ui64, 0xAE0B158B4738705E_ui64, 0x9624AB50B148D446_ui64,
+    0xD98DDAEE19068C76_ui64, 0x3BADD624DD9B0958_ui64, 0x87F8A8D4CFA417C9_ui64, 0xE54CA5D70A80E5D7_ui64,
+    0xA9F6D30A038D1DBC_ui64, 0x5E9FCF4CCD211F4D_ui64, 0xD47487CC8470652B_ui64, 0x7647C32000696720_ui64,
+    0x84C8D4DFD2C63F3B_ui64, 0x29ECD9F40041E074_ui64, 0xA5FB0A17C777CF09_ui64, 0xF468107100525891_ui64,
+    0xCF79CC9DB955C2CC_ui64, 0x7182148D4066EEB5_ui64, 0x81AC1FE293D599BF_ui64, 0xC6F14CD848405531_ui64,
+    0xA21727DB38CB002F_ui64, 0xB8ADA00E5A506A7D_ui64, 0xCA9CF1D206FDC03B_ui64, 0xA6D90811F0E4851D_ui64,
+    0xFD442E4688BD304A_ui64, 0x908F4A166D1DA664_ui64, 0x9E4A9CEC15763E2E_ui64, 0x9A598E4E043287FF_ui64,
+    0xC5DD44271AD3CDBA_ui64, 0x40EFF1E1853F29FE_ui64, 0xF7549530E188C128_ui64, 0xD12BEE59E68EF47D_ui64,
+    0x9A94DD3E8CF578B9_ui64, 0x82BB74F8301958CF_ui64, 0xC13A148E3032D6E7_ui64, 0xE36A52363C1FAF02_ui64,
+    0xF18899B1BC3F8CA1_ui64, 0xDC44E6C3CB279AC2_ui64, 0x96F5600F15A7B7E5_ui64, 0x29AB103A5EF8C0BA_ui64,
+    0xBCB2B812DB11A5DE_ui64, 0x7415D448F6B6F0E8_ui64, 0xEBDF661791D60F56_ui64, 0x111B495B3464AD22_ui64,
+    0x936B9FCEBB25C995_ui64, 0xCAB10DD900BEEC35_ui64, 0xB84687C269EF3BFB_ui64, 0x3D5D514F40EEA743_ui64,
+    0xE65829B3046B0AFA_ui64, 0x0CB4A5A3112A5113_ui64, 0x8FF71A0FE2C2E6DC_ui64, 0x47F0E785EABA72AC_ui64,
+    0xB3F4E093DB73A093_ui64, 0x59ED216765690F57_ui64, 0xE0F218B8D25088B8_ui64, 0x306869C13EC3532D_ui64,
+    0x8C974F7383725573_ui64, 0x1E414218C73A13FC_ui64, 0xAFBD2350644EEACF_ui64, 0xE5D1929EF90898FB_ui64,
+    0xDBAC6C247D62A583_ui64, 0xDF45F746B74ABF3A_ui64, 0x894BC396CE5DA772_ui64, 0x6B8BBA8C328EB784_ui64,
+    0xAB9EB47C81F5114F_ui64, 0x066EA92F3F326565_ui64, 0xD686619BA27255A2_ui64, 0xC80A537B0EFEFEBE_ui64,
+    0x8613FD0145877585_ui64, 0xBD06742CE95F5F37_ui64, 0xA798FC4196E952E7_ui64, 0x2C48113823B73705_ui64,
+    0xD17F3B51FCA3A7A0_ui64, 0xF75A15862CA504C6_ui64, 0x82EF85133DE648C4_ui64, 0x9A984D73DBE722FC_ui64,
+    0xA3AB66580D5FDAF5_ui64, 0xC13E60D0D2E0EBBB_ui64, 0xCC963FEE10B7D1B3_ui64, 0x318DF905079926A9_ui64,
+    0xFFBBCFE994E5C61F_ui64, 0xFDF17746497F7053_ui64, 0x9FD561F1FD0F9BD3_ui64, 0xFEB6EA8BEDEFA634_ui64,
+    0xC7CABA6E7C5382C8_ui64, 0xFE64A52EE96B8FC1_ui64, 0xF9BD690A1B68637B_ui64, 0x3DFDCE7AA3C673B1_ui64,
+    0x9C1661A651213E2D_ui64, 0x06BEA10CA65C084F_ui64, 0xC31BFA0FE5698DB8_ui64, 0x486E494FCFF30A63_ui64,
+    0xF3E2F893DEC3F126_ui64, 0x5A89DBA3C3EFCCFB_ui64, 0x986DDB5C6B3A76B7_ui64, 0xF89629465A75E01D_ui64,
+    0xBE89523386091465_ui64, 0xF6BBB397F1135824_ui64, 0xEE2BA6C0678B597F_ui64, 0x746AA07DED582E2D_ui64,
+    0x94DB483840B717EF_ui64, 0xA8C2A44EB4571CDD_ui64, 0xBA121A4650E4DDEB_ui64, 0x92F34D62616CE414_ui64,
+    0xE896A0D7E51E1566_ui64, 0x77B020BAF9C81D18_ui64, 0x915E2486EF32CD60_ui64, 0x0ACE1474DC1D122F_ui64,
+    0xB5B5ADA8AAFF80B8_ui64, 0x0D819992132456BB_ui64, 0xE3231912D5BF60E6_ui64, 0x10E1FFF697ED6C6A_ui64,
+    0x8DF5EFABC5979C8F_ui64, 0xCA8D3FFA1EF463C2_ui64, 0xB1736B96B6FD83B3_ui64, 0xBD308FF8A6B17CB3_ui64,
+    0xDDD0467C64BCE4A0_ui64, 0xAC7CB3F6D05DDBDF_ui64, 0x8AA22C0DBEF60EE4_ui64, 0x6BCDF07A423AA96C_ui64,
+    0xAD4AB7112EB3929D_ui64, 0x86C16C98D2C953C7_ui64, 0xD89D64D57A607744_ui64, 0xE871C7BF077BA8B8_ui64,
+    0x87625F056C7C4A8B_ui64, 0x11471CD764AD4973_ui64, 0xA93AF6C6C79B5D2D_ui64, 0xD598E40D3DD89BD0_ui64,
+    0xD389B47879823479_ui64, 0x4AFF1D108D4EC2C4_ui64, 0x843610CB4BF160CB_ui64, 0xCEDF722A585139BB_ui64,
+    0xA54394FE1EEDB8FE_ui64, 0xC2974EB4EE658829_ui64, 0xCE947A3DA6A9273E_ui64, 0x733D226229FEEA33_ui64,
+    0x811CCC668829B887_ui64, 0x0806357D5A3F5260_ui64, 0xA163FF802A3426A8_ui64, 0xCA07C2DCB0CF26F8_ui64,
+    0xC9BCFF6034C13052_ui64, 0xFC89B393DD02F0B6_ui64, 0xFC2C3F3841F17C67_ui64, 0xBBAC2078D443ACE3_ui64,
+    0x9D9BA7832936EDC0_ui64, 0xD54B944B84AA4C0E_ui64, 0xC5029163F384A931_ui64, 0x0A9E795E65D4DF12_ui64,
+    0xF64335BCF065D37D_ui64, 0x4D4617B5FF4A16D6_ui64, 0x99EA0196163FA42E_ui64, 0x504BCED1BF8E4E46_ui64,
+    0xC06481FB9BCF8D39_ui64, 0xE45EC2862F71E1D7_ui64, 0xF07DA27A82C37088_ui64, 0x5D767327BB4E5A4D_ui64,
+    0x964E858C91BA2655_ui64, 0x3A6A07F8D510F870_ui64, 0xBBE226EFB628AFEA_ui64, 0x890489F70A55368C_ui64,
+    0xEADAB0ABA3B2DBE5_ui64, 0x2B45AC74CCEA842F_ui64, 0x92C8AE6B464FC96F_ui64, 0x3B0B8BC90012929E_ui64,
+    0xB77ADA0617E3BBCB_ui64, 0x09CE6EBB40173745_ui64, 0xE55990879DDCAABD_ui64, 0xCC420A6A101D0516_ui64,
+    0x8F57FA54C2A9EAB6_ui64, 0x9FA946824A12232E_ui64, 0xB32DF8E9F3546564_ui64, 0x47939822DC96ABFA_ui64,
+    0xDFF9772470297EBD_ui64, 0x59787E2B93BC56F8_ui64, 0x8BFBEA76C619EF36_ui64, 0x57EB4EDB3C55B65B_ui64,
+    0xAEFAE51477A06B03_ui64, 0xEDE622920B6B23F2_ui64, 0xDAB99E59958885C4_ui64, 0xE95FAB368E45ECEE_ui64,
+    0x88B402F7FD75539B_ui64, 0x11DBCB0218EBB415_ui64, 0xAAE103B5FCD2A881_ui64, 0xD652BDC29F26A11A_ui64,
+    0xD59944A37C0752A2_ui64, 0x4BE76D3346F04960_ui64, 0x857FCAE62D8493A5_ui64, 0x6F70A4400C562DDC_ui64,
+    0xA6DFBD9FB8E5B88E_ui64, 0xCB4CCD500F6BB953_ui64, 0xD097AD07A71F26B2_ui64, 0x7E2000A41346A7A8_ui64,
+    0x825ECC24C873782F_ui64, 0x8ED400668C0C28C9_ui64, 0xA2F67F2DFA90563B_ui64, 0x728900802F0F32FB_ui64,
+    0xCBB41EF979346BCA_ui64, 0x4F2B40A03AD2FFBA_ui64, 0xFEA126B7D78186BC_ui64, 0xE2F610C84987BFA9_ui64,
+    0x9F24B832E6B0F436_ui64, 0x0DD9CA7D2DF4D7CA_ui64, 0xC6EDE63FA05D3143_ui64, 0x91503D1C79720DBC_ui64,
+    0xF8A95FCF88747D94_ui64, 0x75A44C6397CE912B_ui64, 0x9B69DBE1B548CE7C_ui64, 0xC986AFBE3EE11ABB_ui64,
+    0xC24452DA229B021B_ui64, 0xFBE85BADCE996169_ui64, 0xF2D56790AB41C2A2_ui64, 0xFAE27299423FB9C4_ui64,
+    0x97C560BA6B0919A5_ui64, 0xDCCD879FC967D41B_ui64, 0xBDB6B8E905CB600F_ui64, 0x5400E987BBC1C921_ui64,
+    0xED246723473E3813_ui64, 0x290123E9AAB23B69_ui64, 0x9436C0760C86E30B_ui64, 0xF9A0B6720AAF6522_ui64,
+    0xB94470938FA89BCE_ui64, 0xF808E40E8D5B3E6A_ui64, 0xE7958CB87392C2C2_ui64, 0xB60B1D1230B20E05_ui64,
+    0x90BD77F3483BB9B9_ui64, 0xB1C6F22B5E6F48C3_ui64, 0xB4ECD5F01A4AA828_ui64, 0x1E38AEB6360B1AF4_ui64,
+    0xE2280B6C20DD5232_ui64, 0x25C6DA63C38DE1B1_ui64, 0x8D590723948A535F_ui64, 0x579C487E5A38AD0F_ui64,
+    0xB0AF48EC79ACE837_ui64, 0x2D835A9DF0C6D852_ui64, 0xDCDB1B2798182244_ui64, 0xF8E431456CF88E66_ui64,
+    0x8A08F0F8BF0F156B_ui64, 0x1B8E9ECB641B5900_ui64, 0xAC8B2D36EED2DAC5_ui64, 0xE272467E3D222F40_ui64,
+    0xD7ADF884AA879177_ui64, 0x5B0ED81DCC6ABB10_ui64, 0x86CCBB52EA94BAEA_ui64, 0x98E947129FC2B4EA_ui64,
+    0xA87FEA27A539E9A5_ui64, 0x3F2398D747B36225_ui64, 0xD29FE4B18E88640E_ui64, 0x8EEC7F0D19A03AAE_ui64,
+    0x83A3EEEEF9153E89_ui64, 0x1953CF68300424AD_ui64, 0xA48CEAAAB75A8E2B_ui64, 0x5FA8C3423C052DD8_ui64,
+    0xCDB02555653131B6_ui64, 0x3792F412CB06794E_ui64, 0x808E17555F3EBF11_ui64, 0xE2BBD88BBEE40BD1_ui64,
+    0xA0B19D2AB70E6ED6_ui64, 0x5B6ACEAEAE9D0EC5_ui64, 0xC8DE047564D20A8B_ui64, 0xF245825A5A445276_ui64,
+    0xFB158592BE068D2E_ui64, 0xEED6E2F0F0D56713_ui64, 0x9CED737BB6C4183D_ui64, 0x55464DD69685606C_ui64,
+    0xC428D05AA4751E4C_ui64, 0xAA97E14C3C26B887_ui64, 0xF53304714D9265DF_ui64, 0xD53DD99F4B3066A9_ui64,
+    0x993FE2C6D07B7FAB_ui64, 0xE546A8038EFE402A_ui64, 0xBF8FDB78849A5F96_ui64, 0xDE98520472BDD034_ui64,
+    0xEF73D256A5C0F77C_ui64, 0x963E66858F6D4441_ui64, 0x95A8637627989AAD_ui64, 0xDDE7001379A44AA9_ui64,
+    0xBB127C53B17EC159_ui64, 0x5560C018580D5D53_ui64, 0xE9D71B689DDE71AF_ui64, 0xAAB8F01E6E10B4A7_ui64,
+    0x9226712162AB070D_ui64, 0xCAB3961304CA70E9_ui64, 0xB6B00D69BB55C8D1_ui64, 0x3D607B97C5FD0D23_ui64,
+    0xE45C10C42A2B3B05_ui64, 0x8CB89A7DB77C506B_ui64, 0x8EB98A7A9A5B04E3_ui64, 0x77F3608E92ADB243_ui64,
+    0xB267ED1940F1C61C_ui64, 0x55F038B237591ED4_ui64, 0xDF01E85F912E37A3_ui64, 0x6B6C46DEC52F6689_ui64,
+    0x8B61313BBABCE2C6_ui64, 0x2323AC4B3B3DA016_ui64, 0xAE397D8AA96C1B77_ui64, 0xABEC975E0A0D081B_ui64,
+    0xD9C7DCED53C72255_ui64, 0x96E7BD358C904A22_ui64, 0x881CEA14545C7575_ui64, 0x7E50D64177DA2E55_ui64,
+    0xAA242499697392D2_ui64, 0xDDE50BD1D5D0B9EA_ui64, 0xD4AD2DBFC3D07787_ui64, 0x955E4EC64B44E865_ui64,
+    0x84EC3C97DA624AB4_ui64, 0xBD5AF13BEF0B113F_ui64, 0xA6274BBDD0FADD61_ui64, 0xECB1AD8AEACDD58F_ui64,
+    0xCFB11EAD453994BA_ui64, 0x67DE18EDA5814AF3_ui64, 0x81CEB32C4B43FCF4_ui64, 0x80EACF948770CED8_ui64,
+    0xA2425FF75E14FC31_ui64, 0xA1258379A94D028E_ui64, 0xCAD2F7F5359A3B3E_ui64, 0x096EE45813A04331_ui64,
+    0xFD87B5F28300CA0D_ui64, 0x8BCA9D6E188853FD_ui64, 0x9E74D1B791E07E48_ui64, 0x775EA264CF55347E_ui64,
+    0xC612062576589DDA_ui64, 0x95364AFE032A819E_ui64, 0xF79687AED3EEC551_ui64, 0x3A83DDBD83F52205_ui64,
+    0x9ABE14CD44753B52_ui64, 0xC4926A9672793543_ui64, 0xC16D9A0095928A27_ui64, 0x75B7053C0F178294_ui64,
+    0xF1C90080BAF72CB1_ui64, 0x5324C68B12DD6339_ui64, 0x971DA05074DA7BEE_ui64, 0xD3F6FC16EBCA5E04_ui64,
+    0xBCE5086492111AEA_ui64, 0x88F4BB1CA6BCF585_ui64, 0xEC1E4A7DB69561A5_ui64, 0x2B31E9E3D06C32E6_ui64,
+    0x9392EE8E921D5D07_ui64, 0x3AFF322E62439FD0_ui64, 0xB877AA3236A4B449_ui64, 0x09BEFEB9FAD487C3_ui64,
+    0xE69594BEC44DE15B_ui64, 0x4C2EBE687989A9B4_ui64, 0x901D7CF73AB0ACD9_ui64, 0x0F9D37014BF60A11_ui64,
+    0xB424DC35095CD80F_ui64, 0x538484C19EF38C95_ui64, 0xE12E13424BB40E13_ui64, 0x2865A5F206B06FBA_ui64,
+    0x8CBCCC096F5088CB_ui64, 0xF93F87B7442E45D4_ui64, 0xAFEBFF0BCB24AAFE_ui64, 0xF78F69A51539D749_ui64,
+    0xDBE6FECEBDEDD5BE_ui64, 0xB573440E5A884D1C_ui64, 0x89705F4136B4A597_ui64, 0x31680A88F8953031_ui64,
+    0xABCC77118461CEFC_ui64, 0xFDC20D2B36BA7C3E_ui64, 0xD6BF94D5E57A42BC_ui64, 0x3D32907604691B4D_ui64,
+    0x8637BD05AF6C69B5_ui64, 0xA63F9A49C2C1B110_ui64, 0xA7C5AC471B478423_ui64, 0x0FCF80DC33721D54_ui64,
+    0xD1B71758E219652B_ui64, 0xD3C36113404EA4A9_ui64, 0x83126E978D4FDF3B_ui64, 0x645A1CAC083126EA_ui64,
+    0xA3D70A3D70A3D70A_ui64, 0x3D70A3D70A3D70A4_ui64, 0xCCCCCCCCCCCCCCCC_ui64, 0xCCCCCCCCCCCCCCCD_ui64,
+    0x8000000000000000_ui64, 0x0000000000000001_ui64, 0xA000000000000000_ui64, 0x0000000000000001_ui64,
+    0xC800000000000000_ui64, 0x0000000000000001_ui64, 0xFA00000000000000_ui64, 0x0000000000000001_ui64,
+    0x9C40000000000000_ui64, 0x0000000000000001_ui64, 0xC350000000000000_ui64, 0x0000000000000001_ui64,
+    0xF424000000000000_ui64, 0x0000000000000001_ui64, 0x9896800000000000_ui64, 0x0000000000000001_ui64,
+    0xBEBC200000000000_ui64, 0x0000000000000001_ui64, 0xEE6B280000000000_ui64, 0x0000000000000001_ui64,
+    0x9502F90000000000_ui64, 0x0000000000000001_ui64, 0xBA43B74000000000_ui64, 0x0000000000000001_ui64,
+    0xE8D4A51000000000_ui64, 0x0000000000000001_ui64, 0x9184E72A00000000_ui64, 0x0000000000000001_ui64,
+    0xB5E620F480000000_ui64, 0x0000000000000001_ui64, 0xE35FA931A0000000_ui64, 0x0000000000000001_ui64,
+    0x8E1BC9BF04000000_ui64, 0x0000000000000001_ui64, 0xB1A2BC2EC5000000_ui64, 0x0000000000000001_ui64,
+    0xDE0B6B3A76400000_ui64, 0x0000000000000001_ui64, 0x8AC7230489E80000_ui64, 0x0000000000000001_ui64,
+    0xAD78EBC5AC620000_ui64, 0x0000000000000001_ui64, 0xD8D726B7177A8000_ui64, 0x0000000000000001_ui64,
+    0x878678326EAC9000_ui64, 0x0000000000000001_ui64, 0xA968163F0A57B400_ui64, 0x0000000000000001_ui64,
+    0xD3C21BCECCEDA100_ui64, 0x0000000000000001_ui64, 0x84595161401484A0_ui64, 0x0000000000000001_ui64,
+    0xA56FA5B99019A5C8_ui64, 0x0000000000000001_ui64, 0xCECB8F27F4200F3A_ui64, 0x0000000000000001_ui64,
+    0x813F3978F8940984_ui64, 0x4000000000000001_ui64, 0xA18F07D736B90BE5_ui64, 0x5000000000000001_ui64,
+    0xC9F2C9CD04674EDE_ui64, 0xA400000000000001_ui64, 0xFC6F7C4045812296_ui64, 0x4D00000000000001_ui64,
+    0x9DC5ADA82B70B59D_ui64, 0xF020000000000001_ui64, 0xC5371912364CE305_ui64, 0x6C28000000000001_ui64,
+    0xF684DF56C3E01BC6_ui64, 0xC732000000000001_ui64, 0x9A130B963A6C115C_ui64, 0x3C7F400000000001_ui64,
+    0xC097CE7BC90715B3_ui64, 0x4B9F100000000001_ui64, 0xF0BDC21ABB48DB20_ui64, 0x1E86D40000000001_ui64,
+    0x96769950B50D88F4_ui64, 0x1314448000000001_ui64, 0xBC143FA4E250EB31_ui64, 0x17D955A000000001_ui64,
+    0xEB194F8E1AE525FD_ui64, 0x5DCFAB0800000001_ui64, 0x92EFD1B8D0CF37BE_ui64, 0x5AA1CAE500000001_ui64,
+    0xB7ABC627050305AD_ui64, 0xF14A3D9E40000001_ui64, 0xE596B7B0C643C719_ui64, 0x6D9CCD05D0000001_ui64,
+    0x8F7E32CE7BEA5C6F_ui64, 0xE4820023A2000001_ui64, 0xB35DBF821AE4F38B_ui64, 0xDDA2802C8A800001_ui64,
+    0xE0352F62A19E306E_ui64, 0xD50B2037AD200001_ui64, 0x8C213D9DA502DE45_ui64, 0x4526F422CC340001_ui64,
+    0xAF298D050E4395D6_ui64, 0x9670B12B7F410001_ui64, 0xDAF3F04651D47B4C_ui64, 0x3C0CDD765F114001_ui64,
+    0x88D8762BF324CD0F_ui64, 0xA5880A69FB6AC801_ui64, 0xAB0E93B6EFEE0053_ui64, 0x8EEA0D047A457A01_ui64,
+    0xD5D238A4ABE98068_ui64, 0x72A4904598D6D881_ui64, 0x85A36366EB71F041_ui64, 0x47A6DA2B7F864751_ui64,
+    0xA70C3C40A64E6C51_ui64, 0x999090B65F67D925_ui64, 0xD0CF4B50CFE20765_ui64, 0xFFF4B4E3F741CF6E_ui64,
+    0x82818F1281ED449F_ui64, 0xBFF8F10E7A8921A5_ui64, 0xA321F2D7226895C7_ui64, 0xAFF72D52192B6A0E_ui64,
+    0xCBEA6F8CEB02BB39_ui64, 0x9BF4F8A69F764491_ui64, 0xFEE50B7025C36A08_ui64, 0x02F236D04753D5B5_ui64,
+    0x9F4F2726179A2245_ui64, 0x01D762422C946591_ui64, 0xC722F0EF9D80AAD6_ui64, 0x424D3AD2B7B97EF6_ui64,
+    0xF8EBAD2B84E0D58B_ui64, 0xD2E0898765A7DEB3_ui64, 0x9B934C3B330C8577_ui64, 0x63CC55F49F88EB30_ui64,
+    0xC2781F49FFCFA6D5_ui64, 0x3CBF6B71C76B25FC_ui64, 0xF316271C7FC3908A_ui64, 0x8BEF464E3945EF7B_ui64,
+    0x97EDD871CFDA3A56_ui64, 0x97758BF0E3CBB5AD_ui64, 0xBDE94E8E43D0C8EC_ui64, 0x3D52EEED1CBEA318_ui64,
+    0xED63A231D4C4FB27_ui64, 0x4CA7AAA863EE4BDE_ui64, 0x945E455F24FB1CF8_ui64, 0x8FE8CAA93E74EF6B_ui64,
+    0xB975D6B6EE39E436_ui64, 0xB3E2FD538E122B45_ui64, 0xE7D34C64A9C85D44_ui64, 0x60DBBCA87196B617_ui64,
+    0x90E40FBEEA1D3A4A_ui64, 0xBC8955E946FE31CE_ui64, 0xB51D13AEA4A488DD_ui64, 0x6BABAB6398BDBE42_ui64,
+    0xE264589A4DCDAB14_ui64, 0xC696963C7EED2DD2_ui64, 0x8D7EB76070A08AEC_ui64, 0xFC1E1DE5CF543CA3_ui64,
+    0xB0DE65388CC8ADA8_ui64, 0x3B25A55F43294BCC_ui64, 0xDD15FE86AFFAD912_ui64, 0x49EF0EB713F39EBF_ui64,
+    0x8A2DBF142DFCC7AB_ui64, 0x6E3569326C784338_ui64, 0xACB92ED9397BF996_ui64, 0x49C2C37F07965405_ui64,
+    0xD7E77A8F87DAF7FB_ui64, 0xDC33745EC97BE907_ui64, 0x86F0AC99B4E8DAFD_ui64, 0x69A028BB3DED71A4_ui64,
+    0xA8ACD7C0222311BC_ui64, 0xC40832EA0D68CE0D_ui64, 0xD2D80DB02AABD62B_ui64, 0xF50A3FA490C30191_ui64,
+    0x83C7088E1AAB65DB_ui64, 0x792667C6DA79E0FB_ui64, 0xA4B8CAB1A1563F52_ui64, 0x577001B891185939_ui64,
+    0xCDE6FD5E09ABCF26_ui64, 0xED4C0226B55E6F87_ui64, 0x80B05E5AC60B6178_ui64, 0x544F8158315B05B5_ui64,
+    0xA0DC75F1778E39D6_ui64, 0x696361AE3DB1C722_ui64, 0xC913936DD571C84C_ui64, 0x03BC3A19CD1E38EA_ui64,
+    0xFB5878494ACE3A5F_ui64, 0x04AB48A04065C724_ui64, 0x9D174B2DCEC0E47B_ui64, 0x62EB0D64283F9C77_ui64,
+    0xC45D1DF942711D9A_ui64, 0x3BA5D0BD324F8395_ui64, 0xF5746577930D6500_ui64, 0xCA8F44EC7EE3647A_ui64,
+    0x9968BF6ABBE85F20_ui64, 0x7E998B13CF4E1ECC_ui64, 0xBFC2EF456AE276E8_ui64, 0x9E3FEDD8C321A67F_ui64,
+    0xEFB3AB16C59B14A2_ui64, 0xC5CFE94EF3EA101F_ui64, 0x95D04AEE3B80ECE5_ui64, 0xBBA1F1D158724A13_ui64,
+    0xBB445DA9CA61281F_ui64, 0x2A8A6E45AE8EDC98_ui64, 0xEA1575143CF97226_ui64, 0xF52D09D71A3293BE_ui64,
+    0x924D692CA61BE758_ui64, 0x593C2626705F9C57_ui64, 0xB6E0C377CFA2E12E_ui64, 0x6F8B2FB00C77836D_ui64,
+    0xE498F455C38B997A_ui64, 0x0B6DFB9C0F956448_ui64, 0x8EDF98B59A373FEC_ui64, 0x4724BD4189BD5EAD_ui64,
+    0xB2977EE300C50FE7_ui64, 0x58EDEC91EC2CB658_ui64, 0xDF3D5E9BC0F653E1_ui64, 0x2F2967B66737E3EE_ui64,
+    0x8B865B215899F46C_ui64, 0xBD79E0D20082EE75_ui64, 0xAE67F1E9AEC07187_ui64, 0xECD8590680A3AA12_ui64,
+    0xDA01EE641A708DE9_ui64, 0xE80E6F4820CC9496_ui64, 0x884134FE908658B2_ui64, 0x3109058D147FDCDE_ui64,
+    0xAA51823E34A7EEDE_ui64, 0xBD4B46F0599FD416_ui64, 0xD4E5E2CDC1D1EA96_ui64, 0x6C9E18AC7007C91B_ui64,
+    0x850FADC09923329E_ui64, 0x03E2CF6BC604DDB1_ui64, 0xA6539930BF6BFF45_ui64, 0x84DB8346B786151D_ui64,
+    0xCFE87F7CEF46FF16_ui64, 0xE612641865679A64_ui64, 0x81F14FAE158C5F6E_ui64, 0x4FCB7E8F3F60C07F_ui64,
+    0xA26DA3999AEF7749_ui64, 0xE3BE5E330F38F09E_ui64, 0xCB090C8001AB551C_ui64, 0x5CADF5BFD3072CC6_ui64,
+    0xFDCB4FA002162A63_ui64, 0x73D9732FC7C8F7F7_ui64, 0x9E9F11C4014DDA7E_ui64, 0x2867E7FDDCDD9AFB_ui64,
+    0xC646D63501A1511D_ui64, 0xB281E1FD541501B9_ui64, 0xF7D88BC24209A565_ui64, 0x1F225A7CA91A4227_ui64,
+    0x9AE757596946075F_ui64, 0x3375788DE9B06959_ui64, 0xC1A12D2FC3978937_ui64, 0x0052D6B1641C83AF_ui64,
+    0xF209787BB47D6B84_ui64, 0xC0678C5DBD23A49B_ui64, 0x9745EB4D50CE6332_ui64, 0xF840B7BA963646E1_ui64,
+    0xBD176620A501FBFF_ui64, 0xB650E5A93BC3D899_ui64, 0xEC5D3FA8CE427AFF_ui64, 0xA3E51F138AB4CEBF_ui64,
+    0x93BA47C980E98CDF_ui64, 0xC66F336C36B10138_ui64, 0xB8A8D9BBE123F017_ui64, 0xB80B0047445D4185_ui64,
+    0xE6D3102AD96CEC1D_ui64, 0xA60DC059157491E6_ui64, 0x9043EA1AC7E41392_ui64, 0x87C89837AD68DB30_ui64,
+    0xB454E4A179DD1877_ui64, 0x29BABE4598C311FC_ui64, 0xE16A1DC9D8545E94_ui64, 0xF4296DD6FEF3D67B_ui64,
+    0x8CE2529E2734BB1D_ui64, 0x1899E4A65F58660D_ui64, 0xB01AE745B101E9E4_ui64, 0x5EC05DCFF72E7F90_ui64,
+    0xDC21A1171D42645D_ui64, 0x76707543F4FA1F74_ui64, 0x899504AE72497EBA_ui64, 0x6A06494A791C53A9_ui64,
+    0xABFA45DA0EDBDE69_ui64, 0x0487DB9D17636893_ui64, 0xD6F8D7509292D603_ui64, 0x45A9D2845D3C42B7_ui64,
+    0x865B86925B9BC5C2_ui64, 0x0B8A2392BA45A9B3_ui64, 0xA7F26836F282B732_ui64, 0x8E6CAC7768D7141F_ui64,
+    0xD1EF0244AF2364FF_ui64, 0x3207D795430CD927_ui64, 0x8335616AED761F1F_ui64, 0x7F44E6BD49E807B9_ui64,
+    0xA402B9C5A8D3A6E7_ui64, 0x5F16206C9C6209A7_ui64, 0xCD036837130890A1_ui64, 0x36DBA887C37A8C10_ui64,
+    0x802221226BE55A64_ui64, 0xC2494954DA2C978A_ui64, 0xA02AA96B06DEB0FD_ui64, 0xF2DB9BAA10B7BD6D_ui64,
+    0xC83553C5C8965D3D_ui64, 0x6F92829494E5ACC8_ui64, 0xFA42A8B73ABBF48C_ui64, 0xCB772339BA1F17FA_ui64,
+    0x9C69A97284B578D7_ui64, 0xFF2A760414536EFC_ui64, 0xC38413CF25E2D70D_ui64, 0xFEF5138519684ABB_ui64,
+    0xF46518C2EF5B8CD1_ui64, 0x7EB258665FC25D6A_ui64, 0x98BF2F79D5993802_ui64, 0xEF2F773FFBD97A62_ui64,
+    0xBEEEFB584AFF8603_ui64, 0xAAFB550FFACFD8FB_ui64, 0xEEAABA2E5DBF6784_ui64, 0x95BA2A53F983CF39_ui64,
+    0x952AB45CFA97A0B2_ui64, 0xDD945A747BF26184_ui64, 0xBA756174393D88DF_ui64, 0x94F971119AEEF9E5_ui64,
+    0xE912B9D1478CEB17_ui64, 0x7A37CD5601AAB85E_ui64, 0x91ABB422CCB812EE_ui64, 0xAC62E055C10AB33B_ui64,
+    0xB616A12B7FE617AA_ui64, 0x577B986B314D600A_ui64, 0xE39C49765FDF9D94_ui64, 0xED5A7E85FDA0B80C_ui64,
+    0x8E41ADE9FBEBC27D_ui64, 0x14588F13BE847308_ui64, 0xB1D219647AE6B31C_ui64, 0x596EB2D8AE258FC9_ui64,
+    0xDE469FBD99A05FE3_ui64, 0x6FCA5F8ED9AEF3BC_ui64, 0x8AEC23D680043BEE_ui64, 0x25DE7BB9480D5855_ui64,
+    0xADA72CCC20054AE9_ui64, 0xAF561AA79A10AE6B_ui64, 0xD910F7FF28069DA4_ui64, 0x1B2BA1518094DA05_ui64,
+    0x87AA9AFF79042286_ui64, 0x90FB44D2F05D0843_ui64, 0xA99541BF57452B28_ui64, 0x353A1607AC744A54_ui64,
+    0xD3FA922F2D1675F2_ui64, 0x42889B8997915CE9_ui64, 0x847C9B5D7C2E09B7_ui64, 0x69956135FEBADA12_ui64,
+    0xA59BC234DB398C25_ui64, 0x43FAB9837E699096_ui64, 0xCF02B2C21207EF2E_ui64, 0x94F967E45E03F4BC_ui64,
+    0x8161AFB94B44F57D_ui64, 0x1D1BE0EEBAC278F6_ui64, 0xA1BA1BA79E1632DC_ui64, 0x6462D92A69731733_ui64,
+    0xCA28A291859BBF93_ui64, 0x7D7B8F7503CFDCFF_ui64, 0xFCB2CB35E702AF78_ui64, 0x5CDA735244C3D43F_ui64,
+    0x9DEFBF01B061ADAB_ui64, 0x3A0888136AFA64A8_ui64, 0xC56BAEC21C7A1916_ui64, 0x088AAA1845B8FDD1_ui64,
+    0xF6C69A72A3989F5B_ui64, 0x8AAD549E57273D46_ui64, 0x9A3C2087A63F6399_ui64, 0x36AC54E2F678864C_ui64,
+    0xC0CB28A98FCF3C7F_ui64, 0x84576A1BB416A7DE_ui64, 0xF0FDF2D3F3C30B9F_ui64, 0x656D44A2A11C51D6_ui64,
+    0x969EB7C47859E743_ui64, 0x9F644AE5A4B1B326_ui64, 0xBC4665B596706114_ui64, 0x873D5D9F0DDE1FEF_ui64,
+    0xEB57FF22FC0C7959_ui64, 0xA90CB506D155A7EB_ui64, 0x9316FF75DD87CBD8_ui64, 0x09A7F12442D588F3_ui64,
+    0xB7DCBF5354E9BECE_ui64, 0x0C11ED6D538AEB30_ui64, 0xE5D3EF282A242E81_ui64, 0x8F1668C8A86DA5FB_ui64,
+    0x8FA475791A569D10_ui64, 0xF96E017D694487BD_ui64, 0xB38D92D760EC4455_ui64, 0x37C981DCC395A9AD_ui64,
+    0xE070F78D3927556A_ui64, 0x85BBE253F47B1418_ui64, 0x8C469AB843B89562_ui64, 0x93956D7478CCEC8F_ui64,
+    0xAF58416654A6BABB_ui64, 0x387AC8D1970027B3_ui64, 0xDB2E51BFE9D0696A_ui64, 0x06997B05FCC0319F_ui64,
+    0x88FCF317F22241E2_ui64, 0x441FECE3BDF81F04_ui64, 0xAB3C2FDDEEAAD25A_ui64, 0xD527E81CAD7626C4_ui64,
+    0xD60B3BD56A5586F1_ui64, 0x8A71E223D8D3B075_ui64, 0x85C7056562757456_ui64, 0xF6872D5667844E4A_ui64,
+    0xA738C6BEBB12D16C_ui64, 0xB428F8AC016561DC_ui64, 0xD106F86E69D785C7_ui64, 0xE13336D701BEBA53_ui64,
+    0x82A45B450226B39C_ui64, 0xECC0024661173474_ui64, 0xA34D721642B06084_ui64, 0x27F002D7F95D0191_ui64,
+    0xCC20CE9BD35C78A5_ui64, 0x31EC038DF7B441F5_ui64, 0xFF290242C83396CE_ui64, 0x7E67047175A15272_ui64,
+    0x9F79A169BD203E41_ui64, 0x0F0062C6E984D387_ui64, 0xC75809C42C684DD1_ui64, 0x52C07B78A3E60869_ui64,
+    0xF92E0C3537826145_ui64, 0xA7709A56CCDF8A83_ui64, 0x9BBCC7A142B17CCB_ui64, 0x88A66076400BB692_ui64,
+    0xC2ABF989935DDBFE_ui64, 0x6ACFF893D00EA436_ui64, 0xF356F7EBF83552FE_ui64, 0x0583F6B8C4124D44_ui64,
+    0x98165AF37B2153DE_ui64, 0xC3727A337A8B704B_ui64, 0xBE1BF1B059E9A8D6_ui64, 0x744F18C0592E4C5D_ui64,
+    0xEDA2EE1C7064130C_ui64, 0x1162DEF06F79DF74_ui64, 0x9485D4D1C63E8BE7_ui64, 0x8ADDCB5645AC2BA9_ui64,
+    0xB9A74A0637CE2EE1_ui64, 0x6D953E2BD7173693_ui64, 0xE8111C87C5C1BA99_ui64, 0xC8FA8DB6CCDD0438_ui64,
+    0x910AB1D4DB9914A0_ui64, 0x1D9C9892400A22A3_ui64, 0xB54D5E4A127F59C8_ui64, 0x2503BEB6D00CAB4C_ui64,
+    0xE2A0B5DC971F303A_ui64, 0x2E44AE64840FD61E_ui64, 0x8DA471A9DE737E24_ui64, 0x5CEAECFED289E5D3_ui64,
+    0xB10D8E1456105DAD_ui64, 0x7425A83E872C5F48_ui64, 0xDD50F1996B947518_ui64, 0xD12F124E28F7771A_ui64,
+    0x8A5296FFE33CC92F_ui64, 0x82BD6B70D99AAA70_ui64, 0xACE73CBFDC0BFB7B_ui64, 0x636CC64D1001550C_ui64,
+    0xD8210BEFD30EFA5A_ui64, 0x3C47F7E05401AA4F_ui64, 0x8714A775E3E95C78_ui64, 0x65ACFAEC34810A72_ui64,
+    0xA8D9D1535CE3B396_ui64, 0x7F1839A741A14D0E_ui64, 0xD31045A8341CA07C_ui64, 0x1EDE48111209A051_ui64,
+    0x83EA2B892091E44D_ui64, 0x934AED0AAB460433_ui64, 0xA4E4B66B68B65D60_ui64, 0xF81DA84D56178540_ui64,
+    0xCE1DE40642E3F4B9_ui64, 0x36251260AB9D668F_ui64, 0x80D2AE83E9CE78F3_ui64, 0xC1D72B7C6B42601A_ui64,
+    0xA1075A24E4421730_ui64, 0xB24CF65B8612F820_ui64, 0xC94930AE1D529CFC_ui64, 0xDEE033F26797B628_ui64,
+    0xFB9B7CD9A4A7443C_ui64, 0x169840EF017DA3B2_ui64, 0x9D412E0806E88AA5_ui64, 0x8E1F289560EE864F_ui64,
+    0xC491798A08A2AD4E_ui64, 0xF1A6F2BAB92A27E3_ui64, 0xF5B5D7EC8ACB58A2_ui64, 0xAE10AF696774B1DC_ui64,
+    0x9991A6F3D6BF1765_ui64, 0xACCA6DA1E0A8EF2A_ui64, 0xBFF610B0CC6EDD3F_ui64, 0x17FD090A58D32AF4_ui64,
+    0xEFF394DCFF8A948E_ui64, 0xDDFC4B4CEF07F5B1_ui64, 0x95F83D0A1FB69CD9_ui64, 0x4ABDAF101564F98F_ui64,
+    0xBB764C4CA7A4440F_ui64, 0x9D6D1AD41ABE37F2_ui64, 0xEA53DF5FD18D5513_ui64, 0x84C86189216DC5EE_ui64,
+    0x92746B9BE2F8552C_ui64, 0x32FD3CF5B4E49BB5_ui64, 0xB7118682DBB66A77_ui64, 0x3FBC8C33221DC2A2_ui64,
+    0xE4D5E82392A40515_ui64, 0x0FABAF3FEAA5334B_ui64, 0x8F05B1163BA6832D_ui64, 0x29CB4D87F2A7400F_ui64,
+    0xB2C71D5BCA9023F8_ui64, 0x743E20E9EF511013_ui64, 0xDF78E4B2BD342CF6_ui64, 0x914DA9246B255417_ui64,
+    0x8BAB8EEFB6409C1A_ui64, 0x1AD089B6C2F7548F_ui64, 0xAE9672ABA3D0C320_ui64, 0xA184AC2473B529B2_ui64,
+    0xDA3C0F568CC4F3E8_ui64, 0xC9E5D72D90A2741F_ui64, 0x8865899617FB1871_ui64, 0x7E2FA67C7A658893_ui64,
+    0xAA7EEBFB9DF9DE8D_ui64, 0xDDBB901B98FEEAB8_ui64, 0xD51EA6FA85785631_ui64, 0x552A74227F3EA566_ui64,
+    0x8533285C936B35DE_ui64, 0xD53A88958F872760_ui64, 0xA67FF273B8460356_ui64, 0x8A892ABAF368F138_ui64,
+    0xD01FEF10A657842C_ui64, 0x2D2B7569B0432D86_ui64, 0x8213F56A67F6B29B_ui64, 0x9C3B29620E29FC74_ui64,
+    0xA298F2C501F45F42_ui64, 0x8349F3BA91B47B90_ui64, 0xCB3F2F7642717713_ui64, 0x241C70A936219A74_ui64,
+    0xFE0EFB53D30DD4D7_ui64, 0xED238CD383AA0111_ui64, 0x9EC95D1463E8A506_ui64, 0xF4363804324A40AB_ui64,
+    0xC67BB4597CE2CE48_ui64, 0xB143C6053EDCD0D6_ui64, 0xF81AA16FDC1B81DA_ui64, 0xDD94B7868E94050B_ui64,
+    0x9B10A4E5E9913128_ui64, 0xCA7CF2B4191C8327_ui64, 0xC1D4CE1F63F57D72_ui64, 0xFD1C2F611F63A3F1_ui64,
+    0xF24A01A73CF2DCCF_ui64, 0xBC633B39673C8CED_ui64, 0x976E41088617CA01_ui64, 0xD5BE0503E085D814_ui64,
+    0xBD49D14AA79DBC82_ui64, 0x4B2D8644D8A74E19_ui64, 0xEC9C459D51852BA2_ui64, 0xDDF8E7D60ED1219F_ui64,
+    0x93E1AB8252F33B45_ui64, 0xCABB90E5C942B504_ui64, 0xB8DA1662E7B00A17_ui64, 0x3D6A751F3B936244_ui64,
+    0xE7109BFBA19C0C9D_ui64, 0x0CC512670A783AD5_ui64, 0x906A617D450187E2_ui64, 0x27FB2B80668B24C6_ui64,
+    0xB484F9DC9641E9DA_ui64, 0xB1F9F660802DEDF7_ui64, 0xE1A63853BBD26451_ui64, 0x5E7873F8A0396974_ui64,
+    0x8D07E33455637EB2_ui64, 0xDB0B487B6423E1E9_ui64, 0xB049DC016ABC5E5F_ui64, 0x91CE1A9A3D2CDA63_ui64,
+    0xDC5C5301C56B75F7_ui64, 0x7641A140CC7810FC_ui64, 0x89B9B3E11B6329BA_ui64, 0xA9E904C87FCB0A9E_ui64,
+    0xAC2820D9623BF429_ui64, 0x546345FA9FBDCD45_ui64, 0xD732290FBACAF133_ui64, 0xA97C177947AD4096_ui64,
+    0x867F59A9D4BED6C0_ui64, 0x49ED8EABCCCC485E_ui64, 0xA81F301449EE8C70_ui64, 0x5C68F256BFFF5A75_ui64,
+    0xD226FC195C6A2F8C_ui64, 0x73832EEC6FFF3112_ui64, 0x83585D8FD9C25DB7_ui64, 0xC831FD53C5FF7EAC_ui64,
+    0xA42E74F3D032F525_ui64, 0xBA3E7CA8B77F5E56_ui64, 0xCD3A1230C43FB26F_ui64, 0x28CE1BD2E55F35EC_ui64,
+    0x80444B5E7AA7CF85_ui64, 0x7980D163CF5B81B4_ui64, 0xA0555E361951C366_ui64, 0xD7E105BCC3326220_ui64,
+    0xC86AB5C39FA63440_ui64, 0x8DD9472BF3FEFAA8_ui64, 0xFA856334878FC150_ui64, 0xB14F98F6F0FEB952_ui64,
+    0x9C935E00D4B9D8D2_ui64, 0x6ED1BF9A569F33D4_ui64, 0xC3B8358109E84F07_ui64, 0x0A862F80EC4700C9_ui64,
+    0xF4A642E14C6262C8_ui64, 0xCD27BB612758C0FB_ui64, 0x98E7E9CCCFBD7DBD_ui64, 0x8038D51CB897789D_ui64,
+    0xBF21E44003ACDD2C_ui64, 0xE0470A63E6BD56C4_ui64, 0xEEEA5D5004981478_ui64, 0x1858CCFCE06CAC75_ui64,
+    0x95527A5202DF0CCB_ui64, 0x0F37801E0C43EBC9_ui64, 0xBAA718E68396CFFD_ui64, 0xD30560258F54E6BB_ui64,
+    0xE950DF20247C83FD_ui64, 0x47C6B82EF32A206A_ui64, 0x91D28B7416CDD27E_ui64, 0x4CDC331D57FA5442_ui64,
+    0xB6472E511C81471D_ui64, 0xE0133FE4ADF8E953_ui64, 0xE3D8F9E563A198E5_ui64, 0x58180FDDD97723A7_ui64,
+    0x8E679C2F5E44FF8F_ui64, 0x570F09EAA7EA7649_ui64, 0xB201833B35D63F73_ui64, 0x2CD2CC6551E513DB_ui64,
+    0xDE81E40A034BCF4F_ui64, 0xF8077F7EA65E58D2_ui64, 0x8B112E86420F6191_ui64, 0xFB04AFAF27FAF783_ui64,
+    0xADD57A27D29339F6_ui64, 0x79C5DB9AF1F9B564_ui64, 0xD94AD8B1C7380874_ui64, 0x18375281AE7822BD_ui64,
+    0x87CEC76F1C830548_ui64, 0x8F2293910D0B15B6_ui64, 0xA9C2794AE3A3C69A_ui64, 0xB2EB3875504DDB23_ui64,
+    0xD433179D9C8CB841_ui64, 0x5FA60692A46151EC_ui64, 0x849FEEC281D7F328_ui64, 0xDBC7C41BA6BCD334_ui64,
+    0xA5C7EA73224DEFF3_ui64, 0x12B9B522906C0801_ui64, 0xCF39E50FEAE16BEF_ui64, 0xD768226B34870A01_ui64,
+    0x81842F29F2CCE375_ui64, 0xE6A1158300D46641_ui64, 0xA1E53AF46F801C53_ui64, 0x60495AE3C1097FD1_ui64,
+    0xCA5E89B18B602368_ui64, 0x385BB19CB14BDFC5_ui64, 0xFCF62C1DEE382C42_ui64, 0x46729E03DD9ED7B6_ui64,
+    0x9E19DB92B4E31BA9_ui64, 0x6C07A2C26A8346D2_ui64}; // NOLINT(modernize-avoid-c-arrays)
+
+/**
+ * Decimal representation of a floating point value.
+ */
+class NumberDecimal
+{
+public:
+    uint64 digits;  /**< The significant decimal digits */
+    int32 exponent; /**< The power of 10 that the digits are multiplied by */
+};
+
+/**
+ * Get the number of decimal digits needed to represent an integer.
+ * @param value The value to check.
+ * @returns The number of digits (a value of 0 uses 1 digit).
+ */
+XS_INLINE uint32 numberDigitCount(const uint64 value) noexcept
+{
+    // floor(log10(2^bits)) is approximated using fixed point multiplication and then corrected with a single compare
+    const uint32 approx = ((64 - clz(value | 1)) * 1233) >> 12;
+    return approx + (((value | 1) >= numberPowerOfTen[approx]) ? 1 : 0);
+}
+
+/**
+ * Write the decimal digits of an integer.
+ * @note Exactly length digits are written, any unused leading digits are filled with '0'.
+ * @tparam T        Type of the integer (uint32 or uint64).
+ * @tparam CharType Type of character.
+ * @param      value  The value to write.
+ * @param      length The number of digits to write.
+ * @param [out] buffer The location to write the digits to.
+ */
+template<typename T, typename CharType>
+XS_INLINE void numberWriteDigits(T value, uint32 length, CharType* const XS_RESTRICT buffer) noexcept
+{
+    // Digits are written backwards 2 at a time using the digit pair table
+    CharType* current = buffer + length;
+    while (length >= 2) {
+        const T next = value / 100;
+        const auto pair = static_cast<uint32>(value - next * 100) * 2;
+        current -= 2;
+        current[0] = static_cast<CharType>(numberDigitPairs[pair]);
+        current[1] = static_cast<CharType>(numberDigitPairs[pair + 1]);
+        value = next;
+        length -= 2;
+    }
+    if (length != 0) {
+        current[-1] = static_cast<CharType>('0' + static_cast<uint32>(value));
+    }
+}
+
+/**
+ * Write the decimal digits of an unsigned integer without any leading zeros.
+ * @tparam CharType Type of character.
+ * @param      value  The value to write.
+ * @param [out] buffer The location to write the digits to.
+ * @returns The number of characters written.
+ */
+template<typename CharType>
+XS_INLINE uint32 numberWriteInteger(const uint64 value, CharType* const XS_RESTRICT buffer) noexcept
+{
+    const uint32 length = numberDigitCount(value);
+    // 32bit division is significantly cheaper so use it whenever the value allows
+    if (value <= 0xFFFFFFFF_ui64) [[likely]] {
+        numberWriteDigits(static_cast<uint32>(value), length, buffer);
+    } else {
+        numberWriteDigits(value, length, buffer);
+    }
+    return length;
+}
+
+/**
+ * Format an integer as a string.
+ * @tparam T        Type of the integer.
+ * @tparam CharType Type of character.
+ * @param      number The number to format.
+ * @param [out] buffer The location to write the characters to.
+ * @returns The number of characters written.
+ */
+template<typename T, typename CharType>
+XS_INLINE uint0 numberFormatInteger(const T number, CharType* XS_RESTRICT buffer) noexcept
+{
+    CharType* const start = buffer;
+    uint64 high = 0;
+    uint64 low;
+    bool negative = false;
+    if constexpr (isSame<T, Int128>) {
+        negative = number.high < 0;
+        high = static_cast<uint64>(number.high);
+        low = number.low;
+    } else if constexpr (isSame<T, UInt128>) {
+        high = number.high;
+        low = number.low;
+    } else if constexpr (isSigned<T>) {
+        negative = number < 0;
+        low = static_cast<uint64>(static_cast<int64>(number));
+    } else {
+        low = static_cast<uint64>(number);
+    }
+    if (negative) {
+        *buffer++ = static_cast<CharType>('-');
+        high = ~high + ((low == 0) ? 1 : 0);
+        low = 0 - low;
+    }
+    if constexpr (sizeof(T) > 8) {
+        if (high != 0) [[unlikely]] {
+            // Split off blocks of 9 digits using 32bit long division until the remainder fits in 64bits
+            constexpr uint64 blockSize = 1000000000_ui64;
+            uint32 blocks[3]; // NOLINT(modernize-avoid-c-arrays)
+            uint32 count = 0;
+            do {
+                uint32 words[4] = {static_cast<uint32>(high >> 32_ui8), static_cast<uint32>(high),
+                    static_cast<uint32>(low >> 32_ui8), static_cast<uint32>(low)}; // NOLINT(modernize-avoid-c-arrays)
+                uint64 remainder = 0;
+                for (auto& word : words) {
+                    const uint64 current = (remainder << 32_ui8) | word;
+                    word = static_cast<uint32>(current / blockSize);
+                    remainder = current - word * blockSize;
+                }
+                high = (static_cast<uint64>(words[0]) << 32_ui8) | words[1];
+                low = (static_cast<uint64>(words[2]) << 32_ui8) | words[3];
+                blocks[count++] = static_cast<uint32>(remainder);
+            } while (high != 0);
+            buffer += numberWriteInteger(low, buffer);
+            while (count > 0) {
+                numberWriteDigits(blocks[--count], 9, buffer);
+                buffer += 9;
+            }
+            return static_cast<uint0>(buffer - start);
+        }
+    }
+    buffer += numberWriteInteger(low, buffer);
+    return static_cast<uint0>(buffer - start);
+}
+
+/**
+ * Multiply by a power of 10 from the formatting table and round the result to odd.
+ * @tparam T Type of floating point value.
+ * @param index The index of the power in the table.
+ * @param value The value to multiply.
+ * @returns The integer part of the product with its lowest bit set if the fractional part is non-zero.
+ */
+template<typename T>
+XS_INLINE uint64 numberRoundToOdd(const uint0 index, const uint64 value) noexcept
+{
+    const uint64 high = numberFormatPowerOfTen[index];
+    const uint64 low = numberFormatPowerOfTen[index + 1];
+    if constexpr (isSame<T, float32>) {
+        // Only the upper 64bits of the power are needed (which must still be rounded up)
+        const UInt128 product = mul<uint64>(high + ((low != 0) ? 1 : 0), value);
+        return product.high | (((product.low >> 32_ui8) > 1) ? 1 : 0);
+    } else {
+        const UInt128 lowProduct = mul<uint64>(low, value);
+        const UInt128 highProduct = mul<uint64>(high, value);
+        const uint64 middle = highProduct.low + lowProduct.high;
+        return (highProduct.high + ((middle < highProduct.low) ? 1 : 0)) | ((middle > 1) ? 1 : 0);
+    }
+}
+
+/**
+ * Find the shortest decimal representation that rounds back to the same floating point value.
+ * @note Uses the Schubfach algorithm. Each boundary of the rounding interval is scaled by a single power of 10 so that
+ * the candidate decimals can be checked against the interval using only integer comparisons.
+ * @tparam T Type of floating point value.
+ * @param bits The bits of a positive, finite and non-zero floating point value.
+ * @returns The decimal representation (which may contain trailing zeros).
+ */
+template<typename T>
+XS_INLINE NumberDecimal numberShortest(const uint64 bits) noexcept
+{
+    using Format = NumberFloatFormat<T>;
+    /**< The implicit leading bit of a normal value */
+    constexpr uint64 hidden = 1_ui64 << Format::mantissaBits;
+
+    const auto biased = static_cast<int32>(bits >> Format::mantissaBits);
+    uint64 mantissa = bits & (hidden - 1);
+    int32 power;
+    if (biased != 0) [[likely]] {
+        mantissa |= hidden;
+        power = biased - Format::exponentBias - Format::mantissaBits;
+        // Small integers are exactly representable and so can be used directly
+        if (power < 0 && power >= -Format::mantissaBits) {
+            const uint64 integer = mantissa >> -power;
+            if ((integer << -power) == mantissa) {
+                return {integer, 0};
+            }
+        }
+    } else {
+        power = 1 - Format::exponentBias - Format::mantissaBits;
+    }
+
+    // The rounding interval is [lower, upper] scaled by 4, it is closed when the mantissa is even (due to round to
+    // even). The lower boundary is closer if the value is a power of 2 with a smaller exponent below it.
+    const uint64 odd = mantissa & 1;
+    const uint64 center = mantissa << 2_ui8;
+    const uint64 upper = center + 2;
+    uint64 lower;
+    int32 exponent;
+    // floor(log10(2^power)) and floor(log10(3/4 * 2^power)) are approximated using fixed point multiplication
+    if (mantissa != hidden || biased <= 1) [[likely]] {
+        lower = center - 2;
+        exponent = static_cast<int32>((static_cast<int64>(power) * 661971961083_i64) >> 41);
+    } else {
+        lower = center - 1;
+        exponent = static_cast<int32>((static_cast<int64>(power) * 661971961083_i64 - 274743187321_i64) >> 41);
+    }
+    // floor(log2(10^-exponent)) is approximated using fixed point multiplication
+    const auto shift =
+        static_cast<uint32>(power + static_cast<int32>((static_cast<int64>(-exponent) * 913124641741_i64) >> 38) + 1);
+    const auto index = static_cast<uint0>(-exponent - numberFormatPowerMin) * 2;
+    const uint64 scaled = numberRoundToOdd<T>(index, center << shift);
+    const uint64 scaledLower = numberRoundToOdd<T>(index, lower << shift);
+    const uint64 scaledUpper = numberRoundToOdd<T>(index, upper << shift);
+
+    // Check if a decimal with 1 less digit is inside the interval
+    const uint64 digits = scaled >> 2_ui8;
+    if (digits >= 10) {
+        const uint64 down = (digits / 10) * 10;
+        const uint64 up = down + 10;
+        const bool downInside = scaledLower + odd <= (down << 2_ui8);
+        const bool upInside = (up << 2_ui8) + odd <= scaledUpper;
+        if (downInside != upInside) {
+            return {downInside ? down : up, exponent};
+        }
+    }
+
+    // Otherwise use whichever of the 2 nearest decimals is inside the interval or the closest if both are
+    const uint64 next = digits + 1;
+    const bool downInside = scaledLower + odd <= (digits << 2_ui8);
+    const bool upInside = (next << 2_ui8) + odd <= scaledUpper;
+    if (downInside != upInside) {
+        return {downInside ? digits : next, exponent};
+    }
+    const auto compare = static_cast<int64>(scaled - ((digits + next) << 1_ui8));
+    return {(compare < 0 || (compare == 0 && (digits & 1) == 0)) ? digits : next, exponent};
+}
+
+/**
+ * Format a floating point value as the shortest string that parses back to the same value.
+ * @note Values with a decimal exponent in [0, 9) for float32 (or [0, 17) for float64) are written in fixed notation
+ * (e.g. 451258.03) all other values are written in scientific notation with at least 2 (or 3 for float64) exponent
+ * digits (e.g. 3.2312408e-01). There is always at least 1 digit after the decimal point.
+ * @tparam T        Type of floating point value.
+ * @tparam CharType Type of character.
+ * @param      number The number to format.
+ * @param [out] buffer The location to write the characters to.
+ * @returns The number of characters written.
+ */
+template<typename T, typename CharType>
+XS_INLINE uint0 numberFormatFloat(const T number, CharType* XS_RESTRICT buffer) noexcept
+{
+    using Format = NumberFloatFormat<T>;
+    /**< Largest decimal exponent written using fixed notation */
+    constexpr int32 maxFixed = isSame<T, float32> ? 8 : 16;
+    /**< Minimum number of digits used for the exponent in scientific notation */
+    constexpr uint32 exponentDigits = isSame<T, float32> ? 2 : 3;
+
+    CharType* const start = buffer;
+    const auto bits = static_cast<uint64>(bitCast<typename Format::Bits>(number));
+    constexpr uint64 signBit = 1_ui64 << (sizeof(T) * 8 - 1);
+    const uint64 magnitude = bits & (signBit - 1);
+    if (magnitude >= Format::infinity) [[unlikely]] {
+        if (magnitude != Format::infinity) {
+            buffer[0] = static_cast<CharType>('n');
+            buffer[1] = static_cast<CharType>('a');
+            buffer[2] = static_cast<CharType>('n');
+            return 3;
+        }
+        if (bits & signBit) {
+            *buffer++ = static_cast<CharType>('-');
+        }
+        buffer[0] = static_cast<CharType>('i');
+        buffer[1] = static_cast<CharType>('n');
+        buffer[2] = static_cast<CharType>('f');
+        return static_cast<uint0>(buffer - start) + 3;
+    }
+    if (bits & signBit) {
+        *buffer++ = static_cast<CharType>('-');
+    }
+    if (magnitude == 0) {
+        buffer[0] = static_cast<CharType>('0');
+        buffer[1] = static_cast<CharType>('.');
+        buffer[2] = static_cast<CharType>('0');
+        return static_cast<uint0>(buffer - start) + 3;
+    }
+
+    NumberDecimal decimal = numberShortest<T>(magnitude);
+    while (decimal.digits % 10 == 0) {
+        decimal.digits /= 10;
+        ++decimal.exponent;
+    }
+    const uint32 count = numberDigitCount(decimal.digits);
+    int32 exponent = decimal.exponent + static_cast<int32>(count) - 1;
+    if (exponent >= 0 && exponent <= maxFixed) {
+        const auto whole = static_cast<uint32>(exponent) + 1;
+        if (count <= whole) {
+            numberWriteDigits(decimal.digits, count, buffer);
+            buffer += count;
+            for (uint32 i = count; i < whole; ++i) {
+                *buffer++ = static_cast<CharType>('0');
+            }
+            buffer[0] = static_cast<CharType>('.');
+            buffer[1] = static_cast<CharType>('0');
+            buffer += 2;
+        } else {
+            const uint32 fraction = count - whole;
+            const uint64 integer = decimal.digits / numberPowerOfTen[fraction];
+            numberWriteDigits(integer, whole, buffer);
+            buffer += whole;
+            *buffer++ = static_cast<CharType>('.');
+            numberWriteDigits(decimal.digits - integer * numberPowerOfTen[fraction], fraction, buffer);
+            buffer += fraction;
+        }
+        return static_cast<uint0>(buffer - start);
+    }
+
+    const uint64 leading = decimal.digits / numberPowerOfTen[count - 1];
+    buffer[0] = static_cast<CharType>('0' + static_cast<uint32>(leading));
+    buffer[1] = static_cast<CharType>('.');
+    buffer += 2;
+    if (count > 1) {
+        numberWriteDigits(decimal.digits - leading * numberPowerOfTen[count - 1], count - 1, buffer);
+        buffer += count - 1;
+    } else {
+        *buffer++ = static_cast<CharType>('0');
+    }
+    *buffer++ = static_cast<CharType>('e');
+    if (exponent < 0) {
+        *buffer++ = static_cast<CharType>('-');
+        exponent = -exponent;
+    }
+    numberWriteDigits(static_cast<uint32>(exponent), exponentDigits, buffer);
+    return static_cast<uint0>(buffer - start) + exponentDigits;
+}
+} // namespace NoExport
+
+/**< Maximum number of characters that can be written when formatting a number of the specified type */
+template<typename T>
+inline constexpr uint0 numberFormatLength =
+    isSame<T, float32> ? 16 : (isSame<T, float64> ? 24 : ((sizeof(T) * 8 * 1233) >> 12) + 1 + (isSigned<T> ? 1 : 0));
+
+/**
+ * Format a number as a string.
+ * @note Integers are written in decimal with a leading '-' if negative. Floating point values are written using the
+ * shortest representation that parses back to exactly the same value (e.g. 0.3 instead of 0.299999999999999988898),
+ * using fixed notation for values in [1, 10^9) for float32 or [1, 10^17) for float64 (e.g. 451258.03) and scientific
+ * notation otherwise (e.g. 3.2312408e-01). Special values are written as "inf", "-inf" and "nan".
+ * @tparam T        Type of number to format.
+ * @tparam CharType Type of character.
+ * @param      number The number to format.
+ * @param [out] buffer The location to write the characters to, must have space for at least numberFormatLength<T>
+ *  characters.
+ * @returns The number of characters written.
+ */
+template<typename T, typename CharType>
+requires((isInteger<T> || isSameAny<T, float32, float64>) && isSameAny<CharType, char, char8, char16, char32>)
+XS_INLINE uint0 formatNumber(const T number, CharType* const XS_RESTRICT buffer) noexcept
+{
+    if constexpr (isInteger<T>) {
+        return NoExport::numberFormatInteger(number, buffer);
+    } else {
+        return NoExport::numberFormatFloat(number, buffer);
+    }
+}
+} // namespace Shift
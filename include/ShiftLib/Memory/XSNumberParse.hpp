@@ -0,0 +1,1123 @@
+#pragma once
+/**
+ * Copyright Matthew Oliver
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "XSBit.hpp"
+#include "XSInt128.hpp"
+#include "XSMath.hpp"
+#include "XSUInt128.hpp"
+
+#include <cstring>
+
+namespace Shift {
+/** Reasons that a number could not be parsed from a string. */
+enum class ParseError : uint8
+{
+    None,    /**< The number was parsed successfully. */
+    Invalid, /**< The string does not start with a valid number. */
+    Range,   /**< The number is outside the range that can be represented by the requested type. */
+};
+
+/**
+ * Result of parsing a number from a string.
+ * @tparam T Type of the parsed number.
+ */
+template<typename T>
+class NumberParse
+{
+public:
+    T value{};                              /**< The parsed value (clamped to the types range if out of range) */
+    uint0 length = 0;                       /**< Number of characters used by the number (0 if invalid) */
+    ParseError error = ParseError::Invalid; /**< The error found while parsing */
+
+    /**
+     * Query if a number was parsed without any errors.
+     * @returns True if valid, false if not.
+     */
+    XS_INLINE constexpr bool isValid() const noexcept
+    {
+        return error == ParseError::None;
+    }
+
+    /**
+     * Query if a number was parsed without any errors.
+     * @returns True if valid, false if not.
+     */
+    XS_INLINE constexpr explicit operator bool() const noexcept
+    {
+        return isValid();
+    }
+
+    /**
+     * Get the parsed value.
+     * @returns The value.
+     */
+    XS_INLINE constexpr const T& getValue() const noexcept
+    {
+        return value;
+    }
+
+    /**
+     * Get the parsed value.
+     * @returns The value.
+     */
+    XS_INLINE constexpr const T& operator*() const noexcept
+    {
+        return value;
+    }
+};
+
+namespace NoExport {
+/**< Maximum number of decimal digits that always fit in a 64bit integer */
+inline constexpr uint0 numberMaxDigits64 = 19;
+/**< Maximum number of significant decimal digits needed to correctly round any float64 */
+inline constexpr uint0 numberMaxDigits = 769;
+/**< Smallest decimal exponent found in the power of five table */
+inline constexpr int32 numberPowerOfFiveMin = -342;
+
+/**< Powers of 10 that fit in a 64bit integer */
+inline constexpr uint64 numberPowerOfTen[20] = {1_ui64, 10_ui64, 100_ui64, 1000_ui64, 10000_ui64, 100000_ui64,
+    1000000_ui64, 10000000_ui64, 100000000_ui64, 1000000000_ui64, 10000000000_ui64, 100000000000_ui64,
+    1000000000000_ui64, 10000000000000_ui64, 100000000000000_ui64, 1000000000000000_ui64, 10000000000000000_ui64,
+    100000000000000000_ui64, 1000000000000000000_ui64, 10000000000000000000_ui64}; // NOLINT(modernize-avoid-c-arrays)
+/**< Powers of 10 that are exactly representable by a float64 */
+inline constexpr float64 numberPowerOfTenFloat[23] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22}; // NOLINT(modernize-avoid-c-arrays)
+
+// Powers of 5 for each decimal exponent in [-342, 308] truncated to 128bits. Each value is shifted so that its most
+// significant bit is set and is stored as its high 64bits followed by its low 64bits.
+/**< Table of normalised powers of five */
+alignas(16) inline constexpr uint64 numberPowerOfFive[1302] = {
+    0xEEF453D6923BD65A_ui64, 0x113FAA2906A13B3F_ui64, 0x9558B4661B6565F8_ui64, 0x4AC7CA59A424C507_ui64,
+    0xBAAEE17FA23EBF76_ui64, 0x5D79BCF00D2DF649_ui64, 0xE95A99DF8ACE6F53_ui64, 0xF4D82C2C107973DC_ui64,
+    0x91D8A02BB6C10594_ui64, 0x79071B9B8A4BE869_ui64, 0xB64EC836A47146F9_ui64, 0x9748E2826CDEE284_ui64,
+    0xE3E27A444D8D98B7_ui64, 0xFD1B1B2308169B25_ui64, 0x8E6D8C6AB0787F72_ui64, 0xFE30F0F5E50E20F7_ui64,
+    0xB208EF855C969F4F_ui64, 0xBDBD2D335E51A935_ui64, 0xDE8B2B66B3BC4723_ui64, 0xAD2C788035E61382_ui64,
+    0x8B16FB203055AC76_ui64, 0x4C3BCB5021AFCC31_ui64, 0xADDCB9E83C6B1793_ui64, 0xDF4ABE242A1BBF3D_ui64,
+    0xD953E8624B85DD78_ui64, 0xD71D6DAD34A2AF0D_ui64, 0x87D4713D6F33AA6B_ui64, 0x8672648C40E5AD68_ui64,
+    0xA9C98D8CCB009506_ui64, 0x680EFDAF511F18C2_ui64, 0xD43BF0EFFDC0BA48_ui64, 0x0212BD1B2566DEF2_ui64,
+    0x84A57695FE98746D_ui64, 0x014BB630F7604B57_ui64, 0xA5CED43B7E3E9188_ui64, 0x419EA3BD35385E2D_ui64,
+    0xCF42894A5DCE35EA_ui64, 0x52064CAC828675B9_ui64, 0x818995CE7AA0E1B2_ui64, 0x7343EFEBD1940993_ui64,
+    0xA1EBFB4219491A1F_ui64, 0x1014EBE6C5F90BF8_ui64, 0xCA66FA129F9B60A6_ui64, 0xD41A26E077774EF6_ui64,
+    0xFD00B897478238D0_ui64, 0x8920B098955522B4_ui64, 0x9E20735E8CB16382_ui64, 0x55B46E5F5D5535B0_ui64,
+    0xC5A890362FDDBC62_ui64, 0xEB2189F734AA831D_ui64, 0xF712B443BBD52B7B_ui64, 0xA5E9EC7501D523E4_ui64,
+    0x9A6BB0AA55653B2D_ui64, 0x47B233C92125366E_ui64, 0xC1069CD4EABE89F8_ui64, 0x999EC0BB696E840A_ui64,
+    0xF148440A256E2C76_ui64, 0xC00670EA43CA250D_ui64, 0x96CD2A865764DBCA_ui64, 0x380406926A5E5728_ui64,
+    0xBC807527ED3E12BC_ui64, 0xC605083704F5ECF2_ui64, 0xEBA09271E88D976B_ui64, 0xF7864A44C633682E_ui64,
+    0x93445B8731587EA3_ui64, 0x7AB3EE6AFBE0211D_ui64, 0xB8157268FDAE9E4C_ui64, 0x5960EA05BAD82964_ui64,
+    0xE61ACF033D1A45DF_ui64, 0x6FB92487298E33BD_ui64, 0x8FD0C16206306BAB_ui64, 0xA5D3B6D479F8E056_ui64,
+    0xB3C4F1BA87BC8696_ui64, 0x8F48A4899877186C_ui64, 0xE0B62E2929ABA83C_ui64, 0x331ACDABFE94DE87_ui64,
+    0x8C71DCD9BA0B4925_ui64, 0x9FF0C08B7F1D0B14_ui64, 0xAF8E5410288E1B6F_ui64, 0x07ECF0AE5EE44DD9_ui64,
+    0xDB71E91432B1A24A_ui64, 0xC9E82CD9F69D6150_ui64, 0x892731AC9FAF056E_ui64, 0xBE311C083A225CD2_ui64,
+    0xAB70FE17C79AC6CA_ui64, 0x6DBD630A48AAF406_ui64, 0xD64D3D9DB981787D_ui64, 0x092CBBCCDAD5B108_ui64,
+    0x85F0468293F0EB4E_ui64, 0x25BBF56008C58EA5_ui64, 0xA76C582338ED2621_ui64, 0xAF2AF2B80AF6F24E_ui64,
+    0xD1476E2C07286FAA_ui64, 0x1AF5AF660DB4AEE1_ui64, 0x82CCA4DB847945CA_ui64, 0x50D98D9FC890ED4D_ui64,
+    0xA37FCE126597973C_ui64, 0xE50FF107BAB528A0_ui64, 0xCC5FC196FEFD7D0C_ui64, 0x1E53ED49A96272C8_ui64,
+    0xFF77B1FCBEBCDC4F_ui64, 0x25E8E89C13BB0F7A_ui64, 0x9FAACF3DF73609B1_ui64, 0x77B191618C54E9AC_ui64,
+    0xC795830D75038C1D_ui64, 0xD59DF5B9EF6A2417_ui64, 0xF97AE3D0D2446F25_ui64, 0x4B0573286B44AD1D_ui64,
+    0x9BECCE62836AC577_ui64, 0x4EE367F9430AEC32_ui64, 0xC2E801FB244576D5_ui64, 0x229C41F793CDA73F_ui64,
+    0xF3A20279ED56D48A_ui64, 0x6B43527578C1110F_ui64, 0x9845418C345644D6_ui64, 0x830A13896B78AAA9_ui64,
+    0xBE5691EF416BD60C_ui64, 0x23CC986BC656D553_ui64, 0xEDEC366B11C6CB8F_ui64, 0x2CBFBE86B7EC8AA8_ui64,
+    0x94B3A202EB1C3F39_ui64, 0x7BF7D71432F3D6A9_ui64, 0xB9E08A83A5E34F07_ui64, 0xDAF5CCD93FB0CC53_ui64,
+    0xE858AD248F5C22C9_ui64, 0xD1B3400F8F9CFF68_ui64, 0x91376C36D99995BE_ui64, 0x23100809B9C21FA1_ui64,
+    0xB58547448FFFFB2D_ui64, 0xABD40A0C2832A78A_ui64, 0xE2E69915B3FFF9F9_ui64, 0x16C90C8F323F516C_ui64,
+    0x8DD01FAD907FFC3B_ui64, 0xAE3DA7D97F6792E3_ui64, 0xB1442798F49FFB4A_ui64, 0x99CD11CFDF41779C_ui64,
+    0xDD95317F31C7FA1D_ui64, 0x40405643D711D583_ui64, 0x8A7D3EEF7F1CFC52_ui64, 0x482835EA666B2572_ui64,
+    0xAD1C8EAB5EE43B66_ui64, 0xDA3243650005EECF_ui64, 0xD863B256369D4A40_ui64, 0x90BED43E40076A82_ui64,
+    0x873E4F75E2224E68_ui64, 0x5A7744A6E804A291_ui64, 0xA90DE3535AAAE202_ui64, 0x711515D0A205CB36_ui64,
+    0xD3515C2831559A83_ui64, 0x0D5A5B44CA873E03_ui64, 0x8412D9991ED58091_ui64, 0xE858790AFE9486C2_ui64,
+    0xA5178FFF668AE0B6_ui64, 0x626E974DBE39A872_ui64, 0xCE5D73FF402D98E3_ui64, 0xFB0A3D212DC8128F_ui64,
+    0x80FA687F881C7F8E_ui64, 0x7CE66634BC9D0B99_ui64, 0xA139029F6A239F72_ui64, 0x1C1FFFC1EBC44E80_ui64,
+    0xC987434744AC874E_ui64, 0xA327FFB266B56220_ui64, 0xFBE9141915D7A922_ui64, 0x4BF1FF9F0062BAA8_ui64,
+    0x9D71AC8FADA6C9B5_ui64, 0x6F773FC3603DB4A9_ui64, 0xC4CE17B399107C22_ui64, 0xCB550FB4384D21D3_ui64,
+    0xF6019DA07F549B2B_ui64, 0x7E2A53A146606A48_ui64, 0x99C102844F94E0FB_ui64, 0x2EDA7444CBFC426D_ui64,
+    0xC0314325637A1939_ui64, 0xFA911155FEFB5308_ui64, 0xF03D93EEBC589F88_ui64, 0x793555AB7EBA27CA_ui64,
+    0x96267C7535B763B5_ui64, 0x4BC1558B2F3458DE_ui64, 0xBBB01B9283253CA2_ui64, 0x9EB1AAEDFB016F16_ui64,
+    0xEA9C227723EE8BCB_ui64, 0x465E15A979C1CADC_ui64, 0x92A1958A7675175F_ui64, 0x0BFACD89EC191EC9_ui64,
+    0xB749FAED14125D36_ui64, 0xCEF980EC671F667B_ui64, 0xE51C79A85916F484_ui64, 0x82B7E12780E7401A_ui64,
+    0x8F31CC0937AE58D2_ui64, 0xD1B2ECB8B0908810_ui64, 0xB2FE3F0B8599EF07_ui64, 0x861FA7E6DCB4AA15_ui64,
+    0xDFBDCECE67006AC9_ui64, 0x67A791E093E1D49A_ui64, 0x8BD6A141006042BD_ui64, 0xE0C8BB2C5C6D24E0_ui64,
+    0xAECC49914078536D_ui64, 0x58FAE9F773886E18_ui64, 0xDA7F5BF590966848_ui64, 0xAF39A475506A899E_ui64,
+    0x888F99797A5E012D_ui64, 0x6D8406C952429603_ui64, 0xAAB37FD7D8F58178_ui64, 0xC8E5087BA6D33B83_ui64,
+    0xD5605FCDCF32E1D6_ui64, 0xFB1E4A9A90880A64_ui64, 0x855C3BE0A17FCD26_ui64, 0x5CF2EEA09A55067F_ui64,
+    0xA6B34AD8C9DFC06F_ui64, 0xF42FAA48C0EA481E_ui64, 0xD0601D8EFC57B08B_ui64, 0xF13B94DAF124DA26_ui64,
+    0x823C12795DB6CE57_ui64, 0x76C53D08D6B70858_ui64, 0xA2CB1717B52481ED_ui64, 0x54768C4B0C64CA6E_ui64,
+    0xCB7DDCDDA26DA268_ui64, 0xA9942F5DCF7DFD09_ui64, 0xFE5D54150B090B02_ui64, 0xD3F93B35435D7C4C_ui64,
+    0x9EFA548D26E5A6E1_ui64, 0xC47BC5014A1A6DAF_ui64, 0xC6B8E9B0709F109A_ui64, 0x359AB6419CA1091B_ui64,
+    0xF867241C8CC6D4C0_ui64, 0xC30163D203C94B62_ui64, 0x9B407691D7FC44F8_ui64, 0x79E0DE63425DCF1D_ui64,
+    0xC21094364DFB5636_ui64, 0x985915FC12F542E4_ui64, 0xF294B943E17A2BC4_ui64, 0x3E6F5B7B17B2939D_ui64,
+    0x979CF3CA6CEC5B5A_ui64, 0xA705992CEECF9C42_ui64, 0xBD8430BD08277231_ui64, 0x50C6FF782A838353_ui64,
+    0xECE53CEC4A314EBD_ui64, 0xA4F8BF5635246428_ui64, 0x940F4613AE5ED136_ui64, 0x871B7795E136BE99_ui64,
+    0xB913179899F68584_ui64, 0x28E2557B59846E3F_ui64, 0xE757DD7EC07426E5_ui64, 0x331AEADA2FE589CF_ui64,
+    0x9096EA6F3848984F_ui64, 0x3FF0D2C85DEF7621_ui64, 0xB4BCA50B065ABE63_ui64, 0x0FED077A756B53A9_ui64,
+    0xE1EBCE4DC7F16DFB_ui64, 0xD3E8495912C62894_ui64, 0x8D3360F09CF6E4BD_ui64, 0x64712DD7ABBBD95C_ui64,
+    0xB080392CC4349DEC_ui64, 0xBD8D794D96AACFB3_ui64, 0xDCA04777F541C567_ui64, 0xECF0D7A0FC5583A0_ui64,
+    0x89E42CAAF9491B60_ui64, 0xF41686C49DB57244_ui64, 0xAC5D37D5B79B6239_ui64, 0x311C2875C522CED5_ui64,
+    0xD77485CB25823AC7_ui64, 0x7D633293366B828B_ui64, 0x86A8D39EF77164BC_ui64, 0xAE5DFF9C02033197_ui64,
+    0xA8530886B54DBDEB_ui64, 0xD9F57F830283FDFC_ui64, 0xD267CAA862A12D66_ui64, 0xD072DF63C324FD7B_ui64,
+    0x8380DEA93DA4BC60_ui64, 0x4247CB9E59F71E6D_ui64, 0xA46116538D0DEB78_ui64, 0x52D9BE85F074E608_ui64,
+    0xCD795BE870516656_ui64, 0x67902E276C921F8B_ui64, 0x806BD9714632DFF6_ui64, 0x00BA1CD8A3DB53B6_ui64,
+    0xA086CFCD97BF97F3_ui64, 0x80E8A40ECCD228A4_ui64, 0xC8A883C0FDAF7DF0_ui64, 0x6122CD128006B2CD_ui64,
+    0xFAD2A4B13D1B5D6C_ui64, 0x796B805720085F81_ui64, 0x9CC3A6EEC6311A63_ui64, 0xCBE3303674053BB0_ui64,
+    0xC3F490AA77BD60FC_ui64, 0xBEDBFC4411068A9C_ui64, 0xF4F1B4D515ACB93B_ui64, 0xEE92FB5515482D44_ui64,
+    0x991711052D8BF3C5_ui64, 0x751BDD152D4D1C4A_ui64, 0xBF5CD54678EEF0B6_ui64, 0xD262D45A78A0635D_ui64,
+    0xEF340A98172AACE4_ui64, 0x86FB897116C87C34_ui64, 0x9580869F0E7AAC0E_ui64, 0xD45D35E6AE3D4DA0_ui64,
+    0xBAE0A846D2195712_ui64, 0x8974836059CCA109_ui64, 0xE998D258869FACD7_ui64, 0x2BD1A438703FC94B_ui64,
+    0x91FF83775423CC06_ui64, 0x7B6306A34627DDCF_ui64, 0xB67F6455292CBF08_ui64, 0x1A3BC84C17B1D542_ui64,
+    0xE41F3D6A7377EECA_ui64, 0x20CABA5F1D9E4A93_ui64, 0x8E938662882AF53E_ui64, 0x547EB47B7282EE9C_ui64,
+    0xB23867FB2A35B28D_ui64, 0xE99E619A4F23AA43_ui64, 0xDEC681F9F4C31F31_ui64, 0x6405FA00E2EC94D4_ui64,
+    0x8B3C113C38F9F37E_ui64, 0xDE83BC408DD3DD04_ui64, 0xAE0B158B4738705E_ui64, 0x9624AB50B148D445_ui64,
+    0xD98DDAEE19068C76_ui64, 0x3BADD624DD9B0957_ui64, 0x87F8A8D4CFA417C9_ui64, 0xE54CA5D70A80E5D6_ui64,
+    0xA9F6D30A038D1DBC_ui64, 0x5E9FCF4CCD211F4C_ui64, 0xD47487CC8470652B_ui64, 0x7647C3200069671F_ui64,
+    0x84C8D4DFD2C63F3B_ui64, 0x29ECD9F40041E073_ui64, 0xA5FB0A17C777CF09_ui64, 0xF468107100525890_ui64,
+    0xCF79CC9DB955C2CC_ui64, 0x7182148D4066EEB4_ui64, 0x81AC1FE293D599BF_ui64, 0xC6F14CD848405530_ui64,
+    0xA21727DB38CB002F_ui64, 0xB8ADA00E5A506A7C_ui64, 0xCA9CF1D206FDC03B_ui64, 0xA6D90811F0E4851C_ui64,
+    0xFD442E4688BD304A_ui64, 0x908F4A166D1DA663_ui64, 0x9E4A9CEC15763E2E_ui64, 0x9A598E4E043287FE_ui64,
+    0xC5DD44271AD3CDBA_ui64, 0x40EFF1E1853F29FD_ui64, 0xF7549530E188C128_ui64, 0xD12BEE59E68EF47C_ui64,
+    0x9A94DD3E8CF578B9_ui64, 0x82BB74F8301958CE_ui64, 0xC13A148E3032D6E7_ui64, 0xE36A52363C1FAF01_ui64,
+    0xF18899B1BC3F8CA1_ui64, 0xDC44E6C3CB279AC1_ui64, 0x96F5600F15A7B7E5_ui64, 0x29AB103A5EF8C0B9_ui64,
+    0xBCB2B812DB11A5DE_ui64, 0x7415D448F6B6F0E7_ui64, 0xEBDF661791D60F56_ui64, 0x111B495B3464AD21_ui64,
+    0x936B9FCEBB25C995_ui64, 0xCAB10DD900BEEC34_ui64, 0xB84687C269EF3BFB_ui64, 0x3D5D514F40EEA742_ui64,
+    0xE65829B3046B0AFA_ui64, 0x0CB4A5A3112A5112_ui64, 0x8FF71A0FE2C2E6DC_ui64, 0x47F0E785EABA72AB_ui64,
+    0xB3F4E093DB73A093_ui64, 0x59ED216765690F56_ui64, 0xE0F218B8D25088B8_ui64, 0x306869C13EC3532C_ui64,
+    0x8C974F7383725573_ui64, 0x1E414218C73A13FB_ui64, 0xAFBD2350644EEACF_ui64, 0xE5D1929EF90898FA_ui64,
+    0xDBAC6C247D62A583_ui64, 0xDF45F746B74ABF39_ui64, 0x894BC396CE5DA772_ui64, 0x6B8BBA8C328EB783_ui64,
+    0xAB9EB47C81F5114F_ui64, 0x066EA92F3F326564_ui64, 0xD686619BA27255A2_ui64, 0xC80A537B0EFEFEBD_ui64,
+    0x8613FD0145877585_ui64, 0xBD06742CE95F5F36_ui64, 0xA798FC4196E952E7_ui64, 0x2C48113823B73704_ui64,
+    0xD17F3B51FCA3A7A0_ui64, 0xF75A15862CA504C5_ui64, 0x82EF85133DE648C4_ui64, 0x9A984D73DBE722FB_ui64,
+    0xA3AB66580D5FDAF5_ui64, 0xC13E60D0D2E0EBBA_ui64, 0xCC963FEE10B7D1B3_ui64, 0x318DF905079926A8_ui64,
+    0xFFBBCFE994E5C61F_ui64, 0xFDF17746497F7052_ui64, 0x9FD561F1FD0F9BD3_ui64, 0xFEB6EA8BEDEFA633_ui64,
+    0xC7CABA6E7C5382C8_ui64, 0xFE64A52EE96B8FC0_ui64, 0xF9BD690A1B68637B_ui64, 0x3DFDCE7AA3C673B0_ui64,
+    0x9C1661A651213E2D_ui64, 0x06BEA10CA65C084E_ui64, 0xC31BFA0FE5698DB8_ui64, 0x486E494FCFF30A62_ui64,
+    0xF3E2F893DEC3F126_ui64, 0x5A89DBA3C3EFCCFA_ui64, 0x986DDB5C6B3A76B7_ui64, 0xF89629465A75E01C_ui64,
+    0xBE89523386091465_ui64, 0xF6BBB397F1135823_ui64, 0xEE2BA6C0678B597F_ui64, 0x746AA07DED582E2C_ui64,
+    0x94DB483840B717EF_ui64, 0xA8C2A44EB4571CDC_ui64, 0xBA121A4650E4DDEB_ui64, 0x92F34D62616CE413_ui64,
+    0xE896A0D7E51E1566_ui64, 0x77B020BAF9C81D17_ui64, 0x915E2486EF32CD60_ui64, 0x0ACE1474DC1D122E_ui64,
+    0xB5B5ADA8AAFF80B8_ui64, 0x0D819992132456BA_ui64, 0xE3231912D5BF60E6_ui64, 0x10E1FFF697ED6C69_ui64,
+    0x8DF5EFABC5979C8F_ui64, 0xCA8D3FFA1EF463C1_ui64, 0xB1736B96B6FD83B3_ui64, 0xBD308FF8A6B17CB2_ui64,
+    0xDDD0467C64BCE4A0_ui64, 0xAC7CB3F6D05DDBDE_ui64, 0x8AA22C0DBEF60EE4_ui64, 0x6BCDF07A423AA96B_ui64,
+    0xAD4AB7112EB3929D_ui64, 0x86C16C98D2C953C6_ui64, 0xD89D64D57A607744_ui64, 0xE871C7BF077BA8B7_ui64,
+    0x87625F056C7C4A8B_ui64, 0x11471CD764AD4972_ui64, 0xA93AF6C6C79B5D2D_ui64, 0xD598E40D3DD89BCF_ui64,
+    0xD389B47879823479_ui64, 0x4AFF1D108D4EC2C3_ui64, 0x843610CB4BF160CB_ui64, 0xCEDF722A585139BA_ui64,
+    0xA54394FE1EEDB8FE_ui64, 0xC2974EB4EE658828_ui64, 0xCE947A3DA6A9273E_ui64, 0x733D226229FEEA32_ui64,
+    0x811CCC668829B887_ui64, 0x0806357D5A3F525F_ui64, 0xA163FF802A3426A8_ui64, 0xCA07C2DCB0CF26F7_ui64,
+    0xC9BCFF6034C13052_ui64, 0xFC89B393DD02F0B5_ui64, 0xFC2C3F3841F17C67_ui64, 0xBBAC2078D443ACE2_ui64,
+    0x9D9BA7832936EDC0_ui64, 0xD54B944B84AA4C0D_ui64, 0xC5029163F384A931_ui64, 0x0A9E795E65D4DF11_ui64,
+    0xF64335BCF065D37D_ui64, 0x4D4617B5FF4A16D5_ui64, 0x99EA0196163FA42E_ui64, 0x504BCED1BF8E4E45_ui64,
+    0xC06481FB9BCF8D39_ui64, 0xE45EC2862F71E1D6_ui64, 0xF07DA27A82C37088_ui64, 0x5D767327BB4E5A4C_ui64,
+    0x964E858C91BA2655_ui64, 0x3A6A07F8D510F86F_ui64, 0xBBE226EFB628AFEA_ui64, 0x890489F70A55368B_ui64,
+    0xEADAB0ABA3B2DBE5_ui64, 0x2B45AC74CCEA842E_ui64, 0x92C8AE6B464FC96F_ui64, 0x3B0B8BC90012929D_ui64,
+    0xB77ADA0617E3BBCB_ui64, 0x09CE6EBB40173744_ui64, 0xE55990879DDCAABD_ui64, 0xCC420A6A101D0515_ui64,
+    0x8F57FA54C2A9EAB6_ui64, 0x9FA946824A12232D_ui64, 0xB32DF8E9F3546564_ui64, 0x47939822DC96ABF9_ui64,
+    0xDFF9772470297EBD_ui64, 0x59787E2B93BC56F7_ui64, 0x8BFBEA76C619EF36_ui64, 0x57EB4EDB3C55B65A_ui64,
+    0xAEFAE51477A06B03_ui64, 0xEDE622920B6B23F1_ui64, 0xDAB99E59958885C4_ui64, 0xE95FAB368E45ECED_ui64,
+    0x88B402F7FD75539B_ui64, 0x11DBCB0218EBB414_ui64, 0xAAE103B5FCD2A881_ui64, 0xD652BDC29F26A119_ui64,
+    0xD59944A37C0752A2_ui64, 0x4BE76D3346F0495F_ui64, 0x857FCAE62D8493A5_ui64, 0x6F70A4400C562DDB_ui64,
+    0xA6DFBD9FB8E5B88E_ui64, 0xCB4CCD500F6BB952_ui64, 0xD097AD07A71F26B2_ui64, 0x7E2000A41346A7A7_ui64,
+    0x825ECC24C873782F_ui64, 0x8ED400668C0C28C8_ui64, 0xA2F67F2DFA90563B_ui64, 0x728900802F0F32FA_ui64,
+    0xCBB41EF979346BCA_ui64, 0x4F2B40A03AD2FFB9_ui64, 0xFEA126B7D78186BC_ui64, 0xE2F610C84987BFA8_ui64,
+    0x9F24B832E6B0F436_ui64, 0x0DD9CA7D2DF4D7C9_ui64, 0xC6EDE63FA05D3143_ui64, 0x91503D1C79720DBB_ui64,
+    0xF8A95FCF88747D94_ui64, 0x75A44C6397CE912A_ui64, 0x9B69DBE1B548CE7C_ui64, 0xC986AFBE3EE11ABA_ui64,
+    0xC24452DA229B021B_ui64, 0xFBE85BADCE996168_ui64, 0xF2D56790AB41C2A2_ui64, 0xFAE27299423FB9C3_ui64,
+    0x97C560BA6B0919A5_ui64, 0xDCCD879FC967D41A_ui64, 0xBDB6B8E905CB600F_ui64, 0x5400E987BBC1C920_ui64,
+    0xED246723473E3813_ui64, 0x290123E9AAB23B68_ui64, 0x9436C0760C86E30B_ui64, 0xF9A0B6720AAF6521_ui64,
+    0xB94470938FA89BCE_ui64, 0xF808E40E8D5B3E69_ui64, 0xE7958CB87392C2C2_ui64, 0xB60B1D1230B20E04_ui64,
+    0x90BD77F3483BB9B9_ui64, 0xB1C6F22B5E6F48C2_ui64, 0xB4ECD5F01A4AA828_ui64, 0x1E38AEB6360B1AF3_ui64,
+    0xE2280B6C20DD5232_ui64, 0x25C6DA63C38DE1B0_ui64, 0x8D590723948A535F_ui64, 0x579C487E5A38AD0E_ui64,
+    0xB0AF48EC79ACE837_ui64, 0x2D835A9DF0C6D851_ui64, 0xDCDB1B2798182244_ui64, 0xF8E431456CF88E65_ui64,
+    0x8A08F0F8BF0F156B_ui64, 0x1B8E9ECB641B58FF_ui64, 0xAC8B2D36EED2DAC5_ui64, 0xE272467E3D222F3F_ui64,
+    0xD7ADF884AA879177_ui64, 0x5B0ED81DCC6ABB0F_ui64, 0x86CCBB52EA94BAEA_ui64, 0x98E947129FC2B4E9_ui64,
+    0xA87FEA27A539E9A5_ui64, 0x3F2398D747B36224_ui64, 0xD29FE4B18E88640E_ui64, 0x8EEC7F0D19A03AAD_ui64,
+    0x83A3EEEEF9153E89_ui64, 0x1953CF68300424AC_ui64, 0xA48CEAAAB75A8E2B_ui64, 0x5FA8C3423C052DD7_ui64,
+    0xCDB02555653131B6_ui64, 0x3792F412CB06794D_ui64, 0x808E17555F3EBF11_ui64, 0xE2BBD88BBEE40BD0_ui64,
+    0xA0B19D2AB70E6ED6_ui64, 0x5B6ACEAEAE9D0EC4_ui64, 0xC8DE047564D20A8B_ui64, 0xF245825A5A445275_ui64,
+    0xFB158592BE068D2E_ui64, 0xEED6E2F0F0D56712_ui64, 0x9CED737BB6C4183D_ui64, 0x55464DD69685606B_ui64,
+    0xC428D05AA4751E4C_ui64, 0xAA97E14C3C26B886_ui64, 0xF53304714D9265DF_ui64, 0xD53DD99F4B3066A8_ui64,
+    0x993FE2C6D07B7FAB_ui64, 0xE546A8038EFE4029_ui64, 0xBF8FDB78849A5F96_ui64, 0xDE98520472BDD033_ui64,
+    0xEF73D256A5C0F77C_ui64, 0x963E66858F6D4440_ui64, 0x95A8637627989AAD_ui64, 0xDDE7001379A44AA8_ui64,
+    0xBB127C53B17EC159_ui64, 0x5560C018580D5D52_ui64, 0xE9D71B689DDE71AF_ui64, 0xAAB8F01E6E10B4A6_ui64,
+    0x9226712162AB070D_ui64, 0xCAB3961304CA70E8_ui64, 0xB6B00D69BB55C8D1_ui64, 0x3D607B97C5FD0D22_ui64,
+    0xE45C10C42A2B3B05_ui64, 0x8CB89A7DB77C506A_ui64, 0x8EB98A7A9A5B04E3_ui64, 0x77F3608E92ADB242_ui64,
+    0xB267ED1940F1C61C_ui64, 0x55F038B237591ED3_ui64, 0xDF01E85F912E37A3_ui64, 0x6B6C46DEC52F6688_ui64,
+    0x8B61313BBABCE2C6_ui64, 0x2323AC4B3B3DA015_ui64, 0xAE397D8AA96C1B77_ui64, 0xABEC975E0A0D081A_ui64,
+    0xD9C7DCED53C72255_ui64, 0x96E7BD358C904A21_ui64, 0x881CEA14545C7575_ui64, 0x7E50D64177DA2E54_ui64,
+    0xAA242499697392D2_ui64, 0xDDE50BD1D5D0B9E9_ui64, 0xD4AD2DBFC3D07787_ui64, 0x955E4EC64B44E864_ui64,
+    0x84EC3C97DA624AB4_ui64, 0xBD5AF13BEF0B113E_ui64, 0xA6274BBDD0FADD61_ui64, 0xECB1AD8AEACDD58E_ui64,
+    0xCFB11EAD453994BA_ui64, 0x67DE18EDA5814AF2_ui64, 0x81CEB32C4B43FCF4_ui64, 0x80EACF948770CED7_ui64,
+    0xA2425FF75E14FC31_ui64, 0xA1258379A94D028D_ui64, 0xCAD2F7F5359A3B3E_ui64, 0x096EE45813A04330_ui64,
+    0xFD87B5F28300CA0D_ui64, 0x8BCA9D6E188853FC_ui64, 0x9E74D1B791E07E48_ui64, 0x775EA264CF55347E_ui64,
+    0xC612062576589DDA_ui64, 0x95364AFE032A819E_ui64, 0xF79687AED3EEC551_ui64, 0x3A83DDBD83F52205_ui64,
+    0x9ABE14CD44753B52_ui64, 0xC4926A9672793543_ui64, 0xC16D9A0095928A27_ui64, 0x75B7053C0F178294_ui64,
+    0xF1C90080BAF72CB1_ui64, 0x5324C68B12DD6339_ui64, 0x971DA05074DA7BEE_ui64, 0xD3F6FC16EBCA5E04_ui64,
+    0xBCE5086492111AEA_ui64, 0x88F4BB1CA6BCF585_ui64, 0xEC1E4A7DB69561A5_ui64, 0x2B31E9E3D06C32E6_ui64,
+    0x9392EE8E921D5D07_ui64, 0x3AFF322E62439FD0_ui64, 0xB877AA3236A4B449_ui64, 0x09BEFEB9FAD487C3_ui64,
+    0xE69594BEC44DE15B_ui64, 0x4C2EBE687989A9B4_ui64, 0x901D7CF73AB0ACD9_ui64, 0x0F9D37014BF60A11_ui64,
+    0xB424DC35095CD80F_ui64, 0x538484C19EF38C95_ui64, 0xE12E13424BB40E13_ui64, 0x2865A5F206B06FBA_ui64,
+    0x8CBCCC096F5088CB_ui64, 0xF93F87B7442E45D4_ui64, 0xAFEBFF0BCB24AAFE_ui64, 0xF78F69A51539D749_ui64,
+    0xDBE6FECEBDEDD5BE_ui64, 0xB573440E5A884D1C_ui64, 0x89705F4136B4A597_ui64, 0x31680A88F8953031_ui64,
+    0xABCC77118461CEFC_ui64, 0xFDC20D2B36BA7C3E_ui64, 0xD6BF94D5E57A42BC_ui64, 0x3D32907604691B4D_ui64,
+    0x8637BD05AF6C69B5_ui64, 0xA63F9A49C2C1B110_ui64, 0xA7C5AC471B478423_ui64, 0x0FCF80DC33721D54_ui64,
+    0xD1B71758E219652B_ui64, 0xD3C36113404EA4A9_ui64, 0x83126E978D4FDF3B_ui64, 0x645A1CAC083126EA_ui64,
+    0xA3D70A3D70A3D70A_ui64, 0x3D70A3D70A3D70A4_ui64, 0xCCCCCCCCCCCCCCCC_ui64, 0xCCCCCCCCCCCCCCCD_ui64,
+    0x8000000000000000_ui64, 0x0000000000000000_ui64, 0xA000000000000000_ui64, 0x0000000000000000_ui64,
+    0xC800000000000000_ui64, 0x0000000000000000_ui64, 0xFA00000000000000_ui64, 0x0000000000000000_ui64,
+    0x9C40000000000000_ui64, 0x0000000000000000_ui64, 0xC350000000000000_ui64, 0x0000000000000000_ui64,
+    0xF424000000000000_ui64, 0x0000000000000000_ui64, 0x9896800000000000_ui64, 0x0000000000000000_ui64,
+    0xBEBC200000000000_ui64, 0x0000000000000000_ui64, 0xEE6B280000000000_ui64, 0x0000000000000000_ui64,
+    0x9502F90000000000_ui64, 0x0000000000000000_ui64, 0xBA43B74000000000_ui64, 0x0000000000000000_ui64,
+    0xE8D4A51000000000_ui64, 0x0000000000000000_ui64, 0x9184E72A00000000_ui64, 0x0000000000000000_ui64,
+    0xB5E620F480000000_ui64, 0x0000000000000000_ui64, 0xE35FA931A0000000_ui64, 0x0000000000000000_ui64,
+    0x8E1BC9BF04000000_ui64, 0x0000000000000000_ui64, 0xB1A2BC2EC5000000_ui64, 0x0000000000000000_ui64,
+    0xDE0B6B3A76400000_ui64, 0x0000000000000000_ui64, 0x8AC7230489E80000_ui64, 0x0000000000000000_ui64,
+    0xAD78EBC5AC620000_ui64, 0x0000000000000000_ui64, 0xD8D726B7177A8000_ui64, 0x0000000000000000_ui64,
+    0x878678326EAC9000_ui64, 0x0000000000000000_ui64, 0xA968163F0A57B400_ui64, 0x0000000000000000_ui64,
+    0xD3C21BCECCEDA100_ui64, 0x0000000000000000_ui64, 0x84595161401484A0_ui64, 0x0000000000000000_ui64,
+    0xA56FA5B99019A5C8_ui64, 0x0000000000000000_ui64, 0xCECB8F27F4200F3A_ui64, 0x0000000000000000_ui64,
+    0x813F3978F8940984_ui64, 0x4000000000000000_ui64, 0xA18F07D736B90BE5_ui64, 0x5000000000000000_ui64,
+    0xC9F2C9CD04674EDE_ui64, 0xA400000000000000_ui64, 0xFC6F7C4045812296_ui64, 0x4D00000000000000_ui64,
+    0x9DC5ADA82B70B59D_ui64, 0xF020000000000000_ui64, 0xC5371912364CE305_ui64, 0x6C28000000000000_ui64,
+    0xF684DF56C3E01BC6_ui64, 0xC732000000000000_ui64, 0x9A130B963A6C115C_ui64, 0x3C7F400000000000_ui64,
+    0xC097CE7BC90715B3_ui64, 0x4B9F100000000000_ui64, 0xF0BDC21ABB48DB20_ui64, 0x1E86D40000000000_ui64,
+    0x96769950B50D88F4_ui64, 0x1314448000000000_ui64, 0xBC143FA4E250EB31_ui64, 0x17D955A000000000_ui64,
+    0xEB194F8E1AE525FD_ui64, 0x5DCFAB0800000000_ui64, 0x92EFD1B8D0CF37BE_ui64, 0x5AA1CAE500000000_ui64,
+    0xB7ABC627050305AD_ui64, 0xF14A3D9E40000000_ui64, 0xE596B7B0C643C719_ui64, 0x6D9CCD05D0000000_ui64,
+    0x8F7E32CE7BEA5C6F_ui64, 0xE4820023A2000000_ui64, 0xB35DBF821AE4F38B_ui64, 0xDDA2802C8A800000_ui64,
+    0xE0352F62A19E306E_ui64, 0xD50B2037AD200000_ui64, 0x8C213D9DA502DE45_ui64, 0x4526F422CC340000_ui64,
+    0xAF298D050E4395D6_ui64, 0x9670B12B7F410000_ui64, 0xDAF3F04651D47B4C_ui64, 0x3C0CDD765F114000_ui64,
+    0x88D8762BF324CD0F_ui64, 0xA5880A69FB6AC800_ui64, 0xAB0E93B6EFEE0053_ui64, 0x8EEA0D047A457A00_ui64,
+    0xD5D238A4ABE98068_ui64, 0x72A4904598D6D880_ui64, 0x85A36366EB71F041_ui64, 0x47A6DA2B7F864750_ui64,
+    0xA70C3C40A64E6C51_ui64, 0x999090B65F67D924_ui64, 0xD0CF4B50CFE20765_ui64, 0xFFF4B4E3F741CF6D_ui64,
+    0x82818F1281ED449F_ui64, 0xBFF8F10E7A8921A4_ui64, 0xA321F2D7226895C7_ui64, 0xAFF72D52192B6A0D_ui64,
+    0xCBEA6F8CEB02BB39_ui64, 0x9BF4F8A69F764490_ui64, 0xFEE50B7025C36A08_ui64, 0x02F236D04753D5B4_ui64,
+    0x9F4F2726179A2245_ui64, 0x01D762422C946590_ui64, 0xC722F0EF9D80AAD6_ui64, 0x424D3AD2B7B97EF5_ui64,
+    0xF8EBAD2B84E0D58B_ui64, 0xD2E0898765A7DEB2_ui64, 0x9B934C3B330C8577_ui64, 0x63CC55F49F88EB2F_ui64,
+    0xC2781F49FFCFA6D5_ui64, 0x3CBF6B71C76B25FB_ui64, 0xF316271C7FC3908A_ui64, 0x8BEF464E3945EF7A_ui64,
+    0x97EDD871CFDA3A56_ui64, 0x97758BF0E3CBB5AC_ui64, 0xBDE94E8E43D0C8EC_ui64, 0x3D52EEED1CBEA317_ui64,
+    0xED63A231D4C4FB27_ui64, 0x4CA7AAA863EE4BDD_ui64, 0x945E455F24FB1CF8_ui64, 0x8FE8CAA93E74EF6A_ui64,
+    0xB975D6B6EE39E436_ui64, 0xB3E2FD538E122B44_ui64, 0xE7D34C64A9C85D44_ui64, 0x60DBBCA87196B616_ui64,
+    0x90E40FBEEA1D3A4A_ui64, 0xBC8955E946FE31CD_ui64, 0xB51D13AEA4A488DD_ui64, 0x6BABAB6398BDBE41_ui64,
+    0xE264589A4DCDAB14_ui64, 0xC696963C7EED2DD1_ui64, 0x8D7EB76070A08AEC_ui64, 0xFC1E1DE5CF543CA2_ui64,
+    0xB0DE65388CC8ADA8_ui64, 0x3B25A55F43294BCB_ui64, 0xDD15FE86AFFAD912_ui64, 0x49EF0EB713F39EBE_ui64,
+    0x8A2DBF142DFCC7AB_ui64, 0x6E3569326C784337_ui64, 0xACB92ED9397BF996_ui64, 0x49C2C37F07965404_ui64,
+    0xD7E77A8F87DAF7FB_ui64, 0xDC33745EC97BE906_ui64, 0x86F0AC99B4E8DAFD_ui64, 0x69A028BB3DED71A3_ui64,
+    0xA8ACD7C0222311BC_ui64, 0xC40832EA0D68CE0C_ui64, 0xD2D80DB02AABD62B_ui64, 0xF50A3FA490C30190_ui64,
+    0x83C7088E1AAB65DB_ui64, 0x792667C6DA79E0FA_ui64, 0xA4B8CAB1A1563F52_ui64, 0x577001B891185938_ui64,
+    0xCDE6FD5E09ABCF26_ui64, 0xED4C0226B55E6F86_ui64, 0x80B05E5AC60B6178_ui64, 0x544F8158315B05B4_ui64,
+    0xA0DC75F1778E39D6_ui64, 0x696361AE3DB1C721_ui64, 0xC913936DD571C84C_ui64, 0x03BC3A19CD1E38E9_ui64,
+    0xFB5878494ACE3A5F_ui64, 0x04AB48A04065C723_ui64, 0x9D174B2DCEC0E47B_ui64, 0x62EB0D64283F9C76_ui64,
+    0xC45D1DF942711D9A_ui64, 0x3BA5D0BD324F8394_ui64, 0xF5746577930D6500_ui64, 0xCA8F44EC7EE36479_ui64,
+    0x9968BF6ABBE85F20_ui64, 0x7E998B13CF4E1ECB_ui64, 0xBFC2EF456AE276E8_ui64, 0x9E3FEDD8C321A67E_ui64,
+    0xEFB3AB16C59B14A2_ui64, 0xC5CFE94EF3EA101E_ui64, 0x95D04AEE3B80ECE5_ui64, 0xBBA1F1D158724A12_ui64,
+    0xBB445DA9CA61281F_ui64, 0x2A8A6E45AE8EDC97_ui64, 0xEA1575143CF97226_ui64, 0xF52D09D71A3293BD_ui64,
+    0x924D692CA61BE758_ui64, 0x593C2626705F9C56_ui64, 0xB6E0C377CFA2E12E_ui64, 0x6F8B2FB00C77836C_ui64,
+    0xE498F455C38B997A_ui64, 0x0B6DFB9C0F956447_ui64, 0x8EDF98B59A373FEC_ui64, 0x4724BD4189BD5EAC_ui64,
+    0xB2977EE300C50FE7_ui64, 0x58EDEC91EC2CB657_ui64, 0xDF3D5E9BC0F653E1_ui64, 0x2F2967B66737E3ED_ui64,
+    0x8B865B215899F46C_ui64, 0xBD79E0D20082EE74_ui64, 0xAE67F1E9AEC07187_ui64, 0xECD8590680A3AA11_ui64,
+    0xDA01EE641A708DE9_ui64, 0xE80E6F4820CC9495_ui64, 0x884134FE908658B2_ui64, 0x3109058D147FDCDD_ui64,
+    0xAA51823E34A7EEDE_ui64, 0xBD4B46F0599FD415_ui64, 0xD4E5E2CDC1D1EA96_ui64, 0x6C9E18AC7007C91A_ui64,
+    0x850FADC09923329E_ui64, 0x03E2CF6BC604DDB0_ui64, 0xA6539930BF6BFF45_ui64, 0x84DB8346B786151C_ui64,
+    0xCFE87F7CEF46FF16_ui64, 0xE612641865679A63_ui64, 0x81F14FAE158C5F6E_ui64, 0x4FCB7E8F3F60C07E_ui64,
+    0xA26DA3999AEF7749_ui64, 0xE3BE5E330F38F09D_ui64, 0xCB090C8001AB551C_ui64, 0x5CADF5BFD3072CC5_ui64,
+    0xFDCB4FA002162A63_ui64, 0x73D9732FC7C8F7F6_ui64, 0x9E9F11C4014DDA7E_ui64, 0x2867E7FDDCDD9AFA_ui64,
+    0xC646D63501A1511D_ui64, 0xB281E1FD541501B8_ui64, 0xF7D88BC24209A565_ui64, 0x1F225A7CA91A4226_ui64,
+    0x9AE757596946075F_ui64, 0x3375788DE9B06958_ui64, 0xC1A12D2FC3978937_ui64, 0x0052D6B1641C83AE_ui64,
+    0xF209787BB47D6B84_ui64, 0xC0678C5DBD23A49A_ui64, 0x9745EB4D50CE6332_ui64, 0xF840B7BA963646E0_ui64,
+    0xBD176620A501FBFF_ui64, 0xB650E5A93BC3D898_ui64, 0xEC5D3FA8CE427AFF_ui64, 0xA3E51F138AB4CEBE_ui64,
+    0x93BA47C980E98CDF_ui64, 0xC66F336C36B10137_ui64, 0xB8A8D9BBE123F017_ui64, 0xB80B0047445D4184_ui64,
+    0xE6D3102AD96CEC1D_ui64, 0xA60DC059157491E5_ui64, 0x9043EA1AC7E41392_ui64, 0x87C89837AD68DB2F_ui64,
+    0xB454E4A179DD1877_ui64, 0x29BABE4598C311FB_ui64, 0xE16A1DC9D8545E94_ui64, 0xF4296DD6FEF3D67A_ui64,
+    0x8CE2529E2734BB1D_ui64, 0x1899E4A65F58660C_ui64, 0xB01AE745B101E9E4_ui64, 0x5EC05DCFF72E7F8F_ui64,
+    0xDC21A1171D42645D_ui64, 0x76707543F4FA1F73_ui64, 0x899504AE72497EBA_ui64, 0x6A06494A791C53A8_ui64,
+    0xABFA45DA0EDBDE69_ui64, 0x0487DB9D17636892_ui64, 0xD6F8D7509292D603_ui64, 0x45A9D2845D3C42B6_ui64,
+    0x865B86925B9BC5C2_ui64, 0x0B8A2392BA45A9B2_ui64, 0xA7F26836F282B732_ui64, 0x8E6CAC7768D7141E_ui64,
+    0xD1EF0244AF2364FF_ui64, 0x3207D795430CD926_ui64, 0x8335616AED761F1F_ui64, 0x7F44E6BD49E807B8_ui64,
+    0xA402B9C5A8D3A6E7_ui64, 0x5F16206C9C6209A6_ui64, 0xCD036837130890A1_ui64, 0x36DBA887C37A8C0F_ui64,
+    0x802221226BE55A64_ui64, 0xC2494954DA2C9789_ui64, 0xA02AA96B06DEB0FD_ui64, 0xF2DB9BAA10B7BD6C_ui64,
+    0xC83553C5C8965D3D_ui64, 0x6F92829494E5ACC7_ui64, 0xFA42A8B73ABBF48C_ui64, 0xCB772339BA1F17F9_ui64,
+    0x9C69A97284B578D7_ui64, 0xFF2A760414536EFB_ui64, 0xC38413CF25E2D70D_ui64, 0xFEF5138519684ABA_ui64,
+    0xF46518C2EF5B8CD1_ui64, 0x7EB258665FC25D69_ui64, 0x98BF2F79D5993802_ui64, 0xEF2F773FFBD97A61_ui64,
+    0xBEEEFB584AFF8603_ui64, 0xAAFB550FFACFD8FA_ui64, 0xEEAABA2E5DBF6784_ui64, 0x95BA2A53F983CF38_ui64,
+    0x952AB45CFA97A0B2_ui64, 0xDD945A747BF26183_ui64, 0xBA756174393D88DF_ui64, 0x94F971119AEEF9E4_ui64,
+    0xE912B9D1478CEB17_ui64, 0x7A37CD5601AAB85D_ui64, 0x91ABB422CCB812EE_ui64, 0xAC62E055C10AB33A_ui64,
+    0xB616A12B7FE617AA_ui64, 0x577B986B314D6009_ui64, 0xE39C49765FDF9D94_ui64, 0xED5A7E85FDA0B80B_ui64,
+    0x8E41ADE9FBEBC27D_ui64, 0x14588F13BE847307_ui64, 0xB1D219647AE6B31C_ui64, 0x596EB2D8AE258FC8_ui64,
+    0xDE469FBD99A05FE3_ui64, 0x6FCA5F8ED9AEF3BB_ui64, 0x8AEC23D680043BEE_ui64, 0x25DE7BB9480D5854_ui64,
+    0xADA72CCC20054AE9_ui64, 0xAF561AA79A10AE6A_ui64, 0xD910F7FF28069DA4_ui64, 0x1B2BA1518094DA04_ui64,
+    0x87AA9AFF79042286_ui64, 0x90FB44D2F05D0842_ui64, 0xA99541BF57452B28_ui64, 0x353A1607AC744A53_ui64,
+    0xD3FA922F2D1675F2_ui64, 0x42889B8997915CE8_ui64, 0x847C9B5D7C2E09B7_ui64, 0x69956135FEBADA11_ui64,
+    0xA59BC234DB398C25_ui64, 0x43FAB9837E699095_ui64, 0xCF02B2C21207EF2E_ui64, 0x94F967E45E03F4BB_ui64,
+    0x8161AFB94B44F57D_ui64, 0x1D1BE0EEBAC278F5_ui64, 0xA1BA1BA79E1632DC_ui64, 0x6462D92A69731732_ui64,
+    0xCA28A291859BBF93_ui64, 0x7D7B8F7503CFDCFE_ui64, 0xFCB2CB35E702AF78_ui64, 0x5CDA735244C3D43E_ui64,
+    0x9DEFBF01B061ADAB_ui64, 0x3A0888136AFA64A7_ui64, 0xC56BAEC21C7A1916_ui64, 0x088AAA1845B8FDD0_ui64,
+    0xF6C69A72A3989F5B_ui64, 0x8AAD549E57273D45_ui64, 0x9A3C2087A63F6399_ui64, 0x36AC54E2F678864B_ui64,
+    0xC0CB28A98FCF3C7F_ui64, 0x84576A1BB416A7DD_ui64, 0xF0FDF2D3F3C30B9F_ui64, 0x656D44A2A11C51D5_ui64,
+    0x969EB7C47859E743_ui64, 0x9F644AE5A4B1B325_ui64, 0xBC4665B596706114_ui64, 0x873D5D9F0DDE1FEE_ui64,
+    0xEB57FF22FC0C7959_ui64, 0xA90CB506D155A7EA_ui64, 0x9316FF75DD87CBD8_ui64, 0x09A7F12442D588F2_ui64,
+    0xB7DCBF5354E9BECE_ui64, 0x0C11ED6D538AEB2F_ui64, 0xE5D3EF282A242E81_ui64, 0x8F1668C8A86DA5FA_ui64,
+    0x8FA475791A569D10_ui64, 0xF96E017D694487BC_ui64, 0xB38D92D760EC4455_ui64, 0x37C981DCC395A9AC_ui64,
+    0xE070F78D3927556A_ui64, 0x85BBE253F47B1417_ui64, 0x8C469AB843B89562_ui64, 0x93956D7478CCEC8E_ui64,
+    0xAF58416654A6BABB_ui64, 0x387AC8D1970027B2_ui64, 0xDB2E51BFE9D0696A_ui64, 0x06997B05FCC0319E_ui64,
+    0x88FCF317F22241E2_ui64, 0x441FECE3BDF81F03_ui64, 0xAB3C2FDDEEAAD25A_ui64, 0xD527E81CAD7626C3_ui64,
+    0xD60B3BD56A5586F1_ui64, 0x8A71E223D8D3B074_ui64, 0x85C7056562757456_ui64, 0xF6872D5667844E49_ui64,
+    0xA738C6BEBB12D16C_ui64, 0xB428F8AC016561DB_ui64, 0xD106F86E69D785C7_ui64, 0xE13336D701BEBA52_ui64,
+    0x82A45B450226B39C_ui64, 0xECC0024661173473_ui64, 0xA34D721642B06084_ui64, 0x27F002D7F95D0190_ui64,
+    0xCC20CE9BD35C78A5_ui64, 0x31EC038DF7B441F4_ui64, 0xFF290242C83396CE_ui64, 0x7E67047175A15271_ui64,
+    0x9F79A169BD203E41_ui64, 0x0F0062C6E984D386_ui64, 0xC75809C42C684DD1_ui64, 0x52C07B78A3E60868_ui64,
+    0xF92E0C3537826145_ui64, 0xA7709A56CCDF8A82_ui64, 0x9BBCC7A142B17CCB_ui64, 0x88A66076400BB691_ui64,
+    0xC2ABF989935DDBFE_ui64, 0x6ACFF893D00EA435_ui64, 0xF356F7EBF83552FE_ui64, 0x0583F6B8C4124D43_ui64,
+    0x98165AF37B2153DE_ui64, 0xC3727A337A8B704A_ui64, 0xBE1BF1B059E9A8D6_ui64, 0x744F18C0592E4C5C_ui64,
+    0xEDA2EE1C7064130C_ui64, 0x1162DEF06F79DF73_ui64, 0x9485D4D1C63E8BE7_ui64, 0x8ADDCB5645AC2BA8_ui64,
+    0xB9A74A0637CE2EE1_ui64, 0x6D953E2BD7173692_ui64, 0xE8111C87C5C1BA99_ui64, 0xC8FA8DB6CCDD0437_ui64,
+    0x910AB1D4DB9914A0_ui64, 0x1D9C9892400A22A2_ui64, 0xB54D5E4A127F59C8_ui64, 0x2503BEB6D00CAB4B_ui64,
+    0xE2A0B5DC971F303A_ui64, 0x2E44AE64840FD61D_ui64, 0x8DA471A9DE737E24_ui64, 0x5CEAECFED289E5D2_ui64,
+    0xB10D8E1456105DAD_ui64, 0x7425A83E872C5F47_ui64, 0xDD50F1996B947518_ui64, 0xD12F124E28F77719_ui64,
+    0x8A5296FFE33CC92F_ui64, 0x82BD6B70D99AAA6F_ui64, 0xACE73CBFDC0BFB7B_ui64, 0x636CC64D1001550B_ui64,
+    0xD8210BEFD30EFA5A_ui64, 0x3C47F7E05401AA4E_ui64, 0x8714A775E3E95C78_ui64, 0x65ACFAEC34810A71_ui64,
+    0xA8D9D1535CE3B396_ui64, 0x7F1839A741A14D0D_ui64, 0xD31045A8341CA07C_ui64, 0x1EDE48111209A050_ui64,
+    0x83EA2B892091E44D_ui64, 0x934AED0AAB460432_ui64, 0xA4E4B66B68B65D60_ui64, 0xF81DA84D5617853F_ui64,
+    0xCE1DE40642E3F4B9_ui64, 0x36251260AB9D668E_ui64, 0x80D2AE83E9CE78F3_ui64, 0xC1D72B7C6B426019_ui64,
+    0xA1075A24E4421730_ui64, 0xB24CF65B8612F81F_ui64, 0xC94930AE1D529CFC_ui64, 0xDEE033F26797B627_ui64,
+    0xFB9B7CD9A4A7443C_ui64, 0x169840EF017DA3B1_ui64, 0x9D412E0806E88AA5_ui64, 0x8E1F289560EE864E_ui64,
+    0xC491798A08A2AD4E_ui64, 0xF1A6F2BAB92A27E2_ui64, 0xF5B5D7EC8ACB58A2_ui64, 0xAE10AF696774B1DB_ui64,
+    0x9991A6F3D6BF1765_ui64, 0xACCA6DA1E0A8EF29_ui64, 0xBFF610B0CC6EDD3F_ui64, 0x17FD090A58D32AF3_ui64,
+    0xEFF394DCFF8A948E_ui64, 0xDDFC4B4CEF07F5B0_ui64, 0x95F83D0A1FB69CD9_ui64, 0x4ABDAF101564F98E_ui64,
+    0xBB764C4CA7A4440F_ui64, 0x9D6D1AD41ABE37F1_ui64, 0xEA53DF5FD18D5513_ui64, 0x84C86189216DC5ED_ui64,
+    0x92746B9BE2F8552C_ui64, 0x32FD3CF5B4E49BB4_ui64, 0xB7118682DBB66A77_ui64, 0x3FBC8C33221DC2A1_ui64,
+    0xE4D5E82392A40515_ui64, 0x0FABAF3FEAA5334A_ui64, 0x8F05B1163BA6832D_ui64, 0x29CB4D87F2A7400E_ui64,
+    0xB2C71D5BCA9023F8_ui64, 0x743E20E9EF511012_ui64, 0xDF78E4B2BD342CF6_ui64, 0x914DA9246B255416_ui64,
+    0x8BAB8EEFB6409C1A_ui64, 0x1AD089B6C2F7548E_ui64, 0xAE9672ABA3D0C320_ui64, 0xA184AC2473B529B1_ui64,
+    0xDA3C0F568CC4F3E8_ui64, 0xC9E5D72D90A2741E_ui64, 0x8865899617FB1871_ui64, 0x7E2FA67C7A658892_ui64,
+    0xAA7EEBFB9DF9DE8D_ui64, 0xDDBB901B98FEEAB7_ui64, 0xD51EA6FA85785631_ui64, 0x552A74227F3EA565_ui64,
+    0x8533285C936B35DE_ui64, 0xD53A88958F87275F_ui64, 0xA67FF273B8460356_ui64, 0x8A892ABAF368F137_ui64,
+    0xD01FEF10A657842C_ui64, 0x2D2B7569B0432D85_ui64, 0x8213F56A67F6B29B_ui64, 0x9C3B29620E29FC73_ui64,
+    0xA298F2C501F45F42_ui64, 0x8349F3BA91B47B8F_ui64, 0xCB3F2F7642717713_ui64, 0x241C70A936219A73_ui64,
+    0xFE0EFB53D30DD4D7_ui64, 0xED238CD383AA0110_ui64, 0x9EC95D1463E8A506_ui64, 0xF4363804324A40AA_ui64,
+    0xC67BB4597CE2CE48_ui64, 0xB143C6053EDCD0D5_ui64, 0xF81AA16FDC1B81DA_ui64, 0xDD94B7868E94050A_ui64,
+    0x9B10A4E5E9913128_ui64, 0xCA7CF2B4191C8326_ui64, 0xC1D4CE1F63F57D72_ui64, 0xFD1C2F611F63A3F0_ui64,
+    0xF24A01A73CF2DCCF_ui64, 0xBC633B39673C8CEC_ui64, 0x976E41088617CA01_ui64, 0xD5BE0503E085D813_ui64,
+    0xBD49D14AA79DBC82_ui64, 0x4B2D8644D8A74E18_ui64, 0xEC9C459D51852BA2_ui64, 0xDDF8E7D60ED1219E_ui64,
+    0x93E1AB8252F33B45_ui64, 0xCABB90E5C942B503_ui64, 0xB8DA1662E7B00A17_ui64, 0x3D6A751F3B936243_ui64,
+    0xE7109BFBA19C0C9D_ui64, 0x0CC512670A783AD4_ui64, 0x906A617D450187E2_ui64, 0x27FB2B80668B24C5_ui64,
+    0xB484F9DC9641E9DA_ui64, 0xB1F9F660802DEDF6_ui64, 0xE1A63853BBD26451_ui64, 0x5E7873F8A0396973_ui64,
+    0x8D07E33455637EB2_ui64, 0xDB0B487B6423E1E8_ui64, 0xB049DC016ABC5E5F_ui64, 0x91CE1A9A3D2CDA62_ui64,
+    0xDC5C5301C56B75F7_ui64, 0x7641A140CC7810FB_ui64, 0x89B9B3E11B6329BA_ui64, 0xA9E904C87FCB0A9D_ui64,
+    0xAC2820D9623BF429_ui64, 0x546345FA9FBDCD44_ui64, 0xD732290FBACAF133_ui64, 0xA97C177947AD4095_ui64,
+    0x867F59A9D4BED6C0_ui64, 0x49ED8EABCCCC485D_ui64, 0xA81F301449EE8C70_ui64, 0x5C68F256BFFF5A74_ui64,
+    0xD226FC195C6A2F8C_ui64, 0x73832EEC6FFF3111_ui64, 0x83585D8FD9C25DB7_ui64, 0xC831FD53C5FF7EAB_ui64,
+    0xA42E74F3D032F525_ui64, 0xBA3E7CA8B77F5E55_ui64, 0xCD3A1230C43FB26F_ui64, 0x28CE1BD2E55F35EB_ui64,
+    0x80444B5E7AA7CF85_ui64, 0x7980D163CF5B81B3_ui64, 0xA0555E361951C366_ui64, 0xD7E105BCC332621F_ui64,
+    0xC86AB5C39FA63440_ui64, 0x8DD9472BF3FEFAA7_ui64, 0xFA856334878FC150_ui64, 0xB14F98F6F0FEB951_ui64,
+    0x9C935E00D4B9D8D2_ui64, 0x6ED1BF9A569F33D3_ui64, 0xC3B8358109E84F07_ui64, 0x0A862F80EC4700C8_ui64,
+    0xF4A642E14C6262C8_ui64, 0xCD27BB612758C0FA_ui64, 0x98E7E9CCCFBD7DBD_ui64, 0x8038D51CB897789C_ui64,
+    0xBF21E44003ACDD2C_ui64, 0xE0470A63E6BD56C3_ui64, 0xEEEA5D5004981478_ui64, 0x1858CCFCE06CAC74_ui64,
+    0x95527A5202DF0CCB_ui64, 0x0F37801E0C43EBC8_ui64, 0xBAA718E68396CFFD_ui64, 0xD30560258F54E6BA_ui64,
+    0xE950DF20247C83FD_ui64, 0x47C6B82EF32A2069_ui64, 0x91D28B7416CDD27E_ui64, 0x4CDC331D57FA5441_ui64,
+    0xB6472E511C81471D_ui64, 0xE0133FE4ADF8E952_ui64, 0xE3D8F9E563A198E5_ui64, 0x58180FDDD97723A6_ui64,
+    0x8E679C2F5E44FF8F_ui64, 0x570F09EAA7EA7648_ui64}; // NOLINT(modernize-avoid-c-arrays)
+
+/**
+ * Properties of a binary floating point format.
+ * @tparam T Type of floating point value.
+ */
+template<typename T>
+class NumberFloatFormat
+{
+public:
+    using Bits = conditional<isSame<T, float32>, uint32, uint64>;
+
+    /**< Number of explicitly stored mantissa bits */
+    static constexpr int32 mantissaBits = isSame<T, float32> ? 23 : 52;
+    /**< Bias added to the binary exponent */
+    static constexpr int32 exponentBias = isSame<T, float32> ? 127 : 1023;
+    /**< The biased binary exponent used by infinity */
+    static constexpr int32 infinitePower = isSame<T, float32> ? 0xFF : 0x7FF;
+    /**< Smallest decimal exponent that can result in a non-zero value */
+    static constexpr int32 smallestPower = isSame<T, float32> ? -64 : -342;
+    /**< Largest decimal exponent that can result in a finite value */
+    static constexpr int32 largestPower = isSame<T, float32> ? 38 : 308;
+    /**< Smallest decimal exponent at which a value may be exactly halfway between two floats */
+    static constexpr int32 minRoundToEven = isSame<T, float32> ? -17 : -4;
+    /**< Largest decimal exponent at which a value may be exactly halfway between two floats */
+    static constexpr int32 maxRoundToEven = isSame<T, float32> ? 10 : 23;
+    /**< Largest decimal exponent that is exactly representable */
+    static constexpr int32 maxFastPower = isSame<T, float32> ? 10 : 22;
+    /**< Largest mantissa that is exactly representable */
+    static constexpr uint64 maxFastMantissa = 2_ui64 << mantissaBits;
+    /**< Bit representation of positive infinity */
+    static constexpr uint64 infinity = static_cast<uint64>(infinitePower) << mantissaBits;
+};
+
+/**
+ * Arbitrary precision unsigned integer with fixed storage used for exact decimal conversion.
+ */
+class NumberBigInteger
+{
+public:
+    /**< Maximum number of 32bit words (enough to exactly compare any decimal needed to round a float64) */
+    static constexpr uint0 maxWords = 128;
+
+    uint32 words[maxWords]; /**< The value, least significant word first */ // NOLINT(modernize-avoid-c-arrays)
+    uint0 length = 0;       /**< Number of words used by the value */
+
+    /**
+     * Constructor.
+     * @param value The initial value.
+     */
+    XS_INLINE explicit NumberBigInteger(const uint64 value) noexcept
+    {
+        words[0] = static_cast<uint32>(value);
+        words[1] = static_cast<uint32>(value >> 32_ui8);
+        length = (words[1] != 0) ? 2 : ((words[0] != 0) ? 1 : 0);
+    }
+
+    /**
+     * Multiply the value by a small integer.
+     * @param value The value to multiply by.
+     */
+    XS_INLINE void multiply(const uint32 value) noexcept
+    {
+        uint64 carry = 0;
+        for (uint0 i = 0; i < length; ++i) {
+            carry += static_cast<uint64>(words[i]) * value;
+            words[i] = static_cast<uint32>(carry);
+            carry >>= 32_ui8;
+        }
+        if (carry != 0) {
+            XS_ASSERT(length < maxWords);
+            words[length++] = static_cast<uint32>(carry);
+        }
+    }
+
+    /**
+     * Add a small integer to the value.
+     * @param value The value to add.
+     */
+    XS_INLINE void add(const uint32 value) noexcept
+    {
+        uint64 carry = value;
+        for (uint0 i = 0; i < length && carry != 0; ++i) {
+            carry += words[i];
+            words[i] = static_cast<uint32>(carry);
+            carry >>= 32_ui8;
+        }
+        if (carry != 0) {
+            XS_ASSERT(length < maxWords);
+            words[length++] = static_cast<uint32>(carry);
+        }
+    }
+
+    /**
+     * Multiply the value by a power of 5.
+     * @param power The power to raise 5 to.
+     */
+    XS_INLINE void multiplyPowerOfFive(uint64 power) noexcept
+    {
+        // 5^13 is the largest power of 5 that fits in 32bits
+        for (; power >= 13; power -= 13) {
+            multiply(1220703125_ui32);
+        }
+        uint32 value = 1;
+        for (; power > 0; --power) {
+            value *= 5;
+        }
+        multiply(value);
+    }
+
+    /**
+     * Multiply the value by a power of 2.
+     * @param power The power to raise 2 to.
+     */
+    XS_INLINE void shiftLeft(const uint64 power) noexcept
+    {
+        if (length == 0) {
+            return;
+        }
+        const auto shift = static_cast<uint32>(power % 32);
+        if (shift != 0) {
+            uint32 carry = 0;
+            for (uint0 i = 0; i < length; ++i) {
+                const uint32 word = words[i];
+                words[i] = (word << shift) | carry;
+                carry = word >> (32 - shift);
+            }
+            if (carry != 0) {
+                XS_ASSERT(length < maxWords);
+                words[length++] = carry;
+            }
+        }
+        const auto wordShift = static_cast<uint0>(power / 32);
+        if (wordShift != 0) {
+            XS_ASSERT(length + wordShift <= maxWords);
+            for (uint0 i = length; i-- > 0;) {
+                words[i + wordShift] = words[i];
+            }
+            for (uint0 i = 0; i < wordShift; ++i) {
+                words[i] = 0;
+            }
+            length += wordShift;
+        }
+    }
+
+    /**
+     * Compare the value to another.
+     * @param other The other value.
+     * @returns Integer describing the comparison (0=equal, >0=greater than, <0=less than).
+     */
+    XS_INLINE int32 compare(const NumberBigInteger& other) const noexcept
+    {
+        if (length != other.length) {
+            return (length > other.length) ? 1 : -1;
+        }
+        for (uint0 i = length; i-- > 0;) {
+            if (words[i] != other.words[i]) {
+                return (words[i] > other.words[i]) ? 1 : -1;
+            }
+        }
+        return 0;
+    }
+};
+
+/**
+ * Location of the digits of a decimal number within a string.
+ * @tparam CharType Type of character used by the string.
+ */
+template<typename CharType>
+class NumberDigits
+{
+public:
+    const CharType* integer = nullptr;     /**< Start of the integer digits */
+    const CharType* integerEnd = nullptr;  /**< End of the integer digits */
+    const CharType* fraction = nullptr;    /**< Start of the fractional digits */
+    const CharType* fractionEnd = nullptr; /**< End of the fractional digits */
+    int64 exponent = 0;                    /**< The decimal exponent written after the digits */
+};
+
+/**
+ * Get the value of a decimal digit.
+ * @tparam CharType Type of character.
+ * @param value The character.
+ * @returns The digit value (10 or more if the character is not a digit).
+ */
+template<typename CharType>
+XS_INLINE uint32 numberDigit(const CharType value) noexcept
+{
+    return static_cast<uint32>(value) - 0x30_ui32;
+}
+
+/**
+ * Load 8 characters and check that they are all decimal digits.
+ * @tparam CharType Type of character.
+ * @param       string The characters to load, must contain at least 8 characters.
+ * @param [out] value  The digit values packed into a single byte each (first digit in the lowest byte).
+ * @returns True if all characters were digits.
+ */
+template<typename CharType>
+XS_INLINE bool numberLoadDigits(const CharType* const XS_RESTRICT string, uint64& value) noexcept
+{
+    if constexpr (sizeof(CharType) == 1) {
+        uint64 load;
+        memcpy(&load, string, sizeof(uint64));
+        // A byte is only a digit if neither adding 0x46 nor subtracting 0x30 overflows into its top bit
+        value = load - 0x3030303030303030_ui64;
+        return (((load + 0x4646464646464646_ui64) | value) & 0x8080808080808080_ui64) == 0;
+    } else {
+        // Wide characters are narrowed while checking that no character is outside of the digit range
+        uint32 check = 0;
+        value = 0;
+        for (uint0 i = 0; i < 8; ++i) {
+            const uint32 digit = numberDigit(string[i]);
+            check |= digit | (digit + 6);
+            value |= static_cast<uint64>(digit & 0xFF) << (i * 8);
+        }
+        return (check & ~0xF_ui32) == 0;
+    }
+}
+
+/**
+ * Convert 8 packed decimal digits into an integer.
+ * @param value The digits packed into a single byte each (first digit in the lowest byte).
+ * @returns The converted integer.
+ */
+XS_INLINE uint32 numberEightDigits(uint64 value) noexcept
+{
+    // Combine pairs of digits, then pairs of 2 digit values and finally the pair of 4 digit values
+    value = (value * 10) + (value >> 8_ui8);
+    value = (((value & 0x000000FF000000FF_ui64) * (100 + (1000000_ui64 << 32_ui8))) +
+                (((value >> 16_ui8) & 0x000000FF000000FF_ui64) * (1 + (10000_ui64 << 32_ui8)))) >>
+        32_ui8;
+    return static_cast<uint32>(value);
+}
+
+/**
+ * Parse a sequence of decimal digits.
+ * @note Digits are processed 8 at a time where possible. The value wraps if it does not fit in 64bits.
+ * @tparam CharType Type of character.
+ * @param [in,out] current Pointer to the first character, returns the character after the last digit.
+ * @param          end     The end of the characters that may be parsed.
+ * @param [in,out] value   The existing value that parsed digits are added to.
+ */
+template<typename CharType>
+XS_INLINE void numberParseDigits(
+    const CharType*& XS_RESTRICT current, const CharType* const XS_RESTRICT end, uint64& value) noexcept
+{
+    uint64 digits;
+    while (end - current >= 8 && numberLoadDigits(current, digits)) {
+        value = (value * 100000000_ui64) + numberEightDigits(digits);
+        current += 8;
+    }
+    for (; current < end; ++current) {
+        const uint32 digit = numberDigit(*current);
+        if (digit >= 10) {
+            break;
+        }
+        value = (value * 10) + digit;
+    }
+}
+
+/**
+ * Multiply a 128bit value by a 64bit value and add another 64bit value.
+ * @param [in,out] high       The high 64bits of the value.
+ * @param [in,out] low        The low 64bits of the value.
+ * @param          multiplier The value to multiply by.
+ * @param          addend     The value to add.
+ * @returns False if the result overflowed 128bits.
+ */
+XS_INLINE bool numberMultiplyAdd(uint64& high, uint64& low, const uint64 multiplier, const uint64 addend) noexcept
+{
+    const UInt128 lowProduct = mul<uint64>(low, multiplier);
+    const UInt128 highProduct = mul<uint64>(high, multiplier);
+    low = lowProduct.low + addend;
+    high = highProduct.low + lowProduct.high;
+    bool overflow = (highProduct.high != 0) || (high < lowProduct.high);
+    if (low < addend) {
+        ++high;
+        overflow = overflow || (high == 0);
+    }
+    return !overflow;
+}
+
+/**
+ * Match the start of a string against a lower case ASCII word ignoring case.
+ * @tparam CharType Type of character.
+ * @param string The string to check.
+ * @param end    The end of the string.
+ * @param word   The word to match.
+ * @returns The number of characters that matched.
+ */
+template<typename CharType>
+XS_INLINE uint0 numberMatch(const CharType* string, const CharType* const end, const char* word) noexcept
+{
+    uint0 ret = 0;
+    for (; string < end && *word != 0; ++string, ++word, ++ret) {
+        if ((static_cast<uint32>(*string) | 0x20_ui32) != static_cast<uint32>(*word)) {
+            break;
+        }
+    }
+    return ret;
+}
+
+/**
+ * Pass the significant digits of a decimal number to a function.
+ * @note Leading zeros are skipped and at most a specified number of digits are passed.
+ * @tparam CharType Type of character.
+ * @tparam Func     Type of the function.
+ * @param       digits    The digits of the number.
+ * @param       maxDigits The maximum number of digits to pass to the function.
+ * @param [out] truncated Returns true if any non-zero digits were not passed to the function.
+ * @param       func      The function, called with the value of each digit in order.
+ * @returns The decimal exponent of the last digit passed to the function.
+ */
+template<typename CharType, typename Func>
+XS_INLINE int64 numberSignificant(
+    const NumberDigits<CharType>& digits, const uint0 maxDigits, bool& truncated, Func&& func) noexcept
+{
+    const CharType* current = digits.integer;
+    while (current < digits.integerEnd && *current == '0') {
+        ++current;
+    }
+    int64 exponent = digits.exponent;
+    uint0 taken = 0;
+    if (current < digits.integerEnd) {
+        for (; current < digits.integerEnd && taken < maxDigits; ++current, ++taken) {
+            func(numberDigit(*current));
+        }
+        exponent += digits.integerEnd - current;
+        truncated = false;
+        for (; current < digits.integerEnd; ++current) {
+            truncated = truncated || (*current != '0');
+        }
+        current = digits.fraction;
+        if (taken == maxDigits) {
+            for (; current < digits.fractionEnd; ++current) {
+                truncated = truncated || (*current != '0');
+            }
+            return exponent;
+        }
+    } else {
+        current = digits.fraction;
+        while (current < digits.fractionEnd && *current == '0') {
+            ++current;
+        }
+        truncated = false;
+    }
+    for (; current < digits.fractionEnd && taken < maxDigits; ++current, ++taken) {
+        func(numberDigit(*current));
+    }
+    exponent -= current - digits.fraction;
+    for (; current < digits.fractionEnd; ++current) {
+        truncated = truncated || (*current != '0');
+    }
+    return exponent;
+}
+
+/**
+ * Convert a decimal number to the closest floating point value.
+ * @note Uses the Eisel-Lemire algorithm which is exact for any decimal mantissa that fits within 64bits.
+ * @tparam T Type of floating point value.
+ * @param mantissa The decimal mantissa.
+ * @param exponent The decimal exponent.
+ * @returns The bit representation of the positive floating point value.
+ */
+template<typename T>
+XS_INLINE uint64 numberEiselLemire(uint64 mantissa, const int64 exponent) noexcept
+{
+    using Format = NumberFloatFormat<T>;
+    if (mantissa == 0 || exponent < Format::smallestPower) [[unlikely]] {
+        return 0;
+    }
+    if (exponent > Format::largestPower) [[unlikely]] {
+        return Format::infinity;
+    }
+    const auto power = static_cast<int32>(exponent);
+    const uint32 leading = clz(mantissa);
+    mantissa <<= leading;
+
+    // Multiply by the power of 5, the lower half of the table entry is only needed if the truncated product could
+    // affect the rounding of the result
+    const auto index = static_cast<uint0>(power - numberPowerOfFiveMin) * 2;
+    UInt128 product = mul<uint64>(mantissa, numberPowerOfFive[index]);
+    constexpr uint64 precisionMask = 0xFFFFFFFFFFFFFFFF_ui64 >> (Format::mantissaBits + 3);
+    if ((product.high & precisionMask) == precisionMask) {
+        const UInt128 lowProduct = mul<uint64>(mantissa, numberPowerOfFive[index + 1]);
+        product.low += lowProduct.high;
+        product.high += (lowProduct.high > product.low) ? 1 : 0;
+    }
+    const auto upper = static_cast<int32>(product.high >> 63_ui8);
+    const auto shift = static_cast<uint32>(upper + 64 - Format::mantissaBits - 3);
+    uint64 ret = product.high >> shift;
+    // floor(log2(10^power)) is approximated using fixed point multiplication
+    int32 power2 = (((152170 + 65536) * power) >> 16) + 63 + upper - static_cast<int32>(leading) +
+        Format::exponentBias;
+
+    if (power2 <= 0) [[unlikely]] {
+        // Subnormal values
+        if (-power2 + 1 >= 64) {
+            return 0;
+        }
+        ret >>= static_cast<uint32>(-power2 + 1);
+        ret += ret & 1;
+        // If rounding overflows into the implicit bit then the result is the smallest normal value which has the same
+        // bit representation
+        return ret >> 1;
+    }
+    // Products that are exactly halfway between 2 floats round to even
+    if (product.low <= 1 && power >= Format::minRoundToEven && power <= Format::maxRoundToEven && (ret & 3) == 1 &&
+        (ret << shift) == product.high) {
+        ret &= ~1_ui64;
+    }
+    ret += ret & 1;
+    ret >>= 1;
+    if (ret >= (2_ui64 << Format::mantissaBits)) {
+        ret = 1_ui64 << Format::mantissaBits;
+        ++power2;
+    }
+    ret &= ~(1_ui64 << Format::mantissaBits);
+    if (power2 >= Format::infinitePower) [[unlikely]] {
+        return Format::infinity;
+    }
+    return ret | (static_cast<uint64>(power2) << Format::mantissaBits);
+}
+
+/**
+ * Correctly round a decimal number that has too many digits to be converted exactly.
+ * @note The exact decimal value is compared to the point halfway between the candidate and the next larger float
+ * using arbitrary precision integers.
+ * @tparam T        Type of floating point value.
+ * @tparam CharType Type of character.
+ * @param digits The digits of the number.
+ * @param bits   The bit representation of the candidate value, the result is either this or the next larger value.
+ * @returns The bit representation of the positive floating point value.
+ */
+template<typename T, typename CharType>
+XS_INLINE uint64 numberSlowPath(const NumberDigits<CharType>& digits, const uint64 bits) noexcept
+{
+    using Format = NumberFloatFormat<T>;
+    NumberBigInteger decimal(0);
+    uint32 chunk = 0;
+    uint0 chunkDigits = 0;
+    bool truncated;
+    int64 exponent = numberSignificant(digits, numberMaxDigits, truncated, [&](const uint32 digit) {
+        chunk = (chunk * 10) + digit;
+        if (++chunkDigits == 9) {
+            decimal.multiply(1000000000_ui32);
+            decimal.add(chunk);
+            chunk = 0;
+            chunkDigits = 0;
+        }
+    });
+    if (truncated) {
+        // Any remaining non-zero digits only need to make the value slightly larger than the truncated digits
+        chunk = (chunk * 10) + 1;
+        ++chunkDigits;
+        --exponent;
+    }
+    decimal.multiply(static_cast<uint32>(numberPowerOfTen[chunkDigits]));
+    decimal.add(chunk);
+
+    // The halfway point is (2 * mantissa + 1) * 2^(power2 - 1)
+    const uint64 biased = bits >> Format::mantissaBits;
+    uint64 mantissa = bits & ((1_ui64 << Format::mantissaBits) - 1);
+    int64 power2 = 1;
+    if (biased != 0) {
+        mantissa |= 1_ui64 << Format::mantissaBits;
+        power2 = static_cast<int64>(biased);
+    }
+    power2 -= Format::exponentBias + Format::mantissaBits + 1;
+    NumberBigInteger halfway((mantissa * 2) + 1);
+
+    // Scale both values to integers with the same power of 2
+    if (exponent >= 0) {
+        decimal.multiplyPowerOfFive(static_cast<uint64>(exponent));
+    } else {
+        halfway.multiplyPowerOfFive(static_cast<uint64>(-exponent));
+    }
+    if (exponent > power2) {
+        decimal.shiftLeft(static_cast<uint64>(exponent - power2));
+    } else {
+        halfway.shiftLeft(static_cast<uint64>(power2 - exponent));
+    }
+    const int32 compare = decimal.compare(halfway);
+    return (compare > 0 || (compare == 0 && (bits & 1) != 0)) ? bits + 1 : bits;
+}
+
+/**
+ * Parse an integer from a string.
+ * @tparam T        Type of integer.
+ * @tparam CharType Type of character.
+ * @param string The string to parse.
+ * @param number The number of characters in the string.
+ * @returns The result of the parse.
+ */
+template<typename T, typename CharType>
+XS_INLINE NumberParse<T> numberParseInteger(const CharType* const XS_RESTRICT string, const uint0 number) noexcept
+{
+    NumberParse<T> ret;
+    const CharType* current = string;
+    const CharType* const end = string + number;
+    bool negative = false;
+    if (current < end && (*current == '-' || *current == '+')) {
+        negative = (*current == '-');
+        ++current;
+    }
+    if constexpr (!isSigned<T>) {
+        if (negative) [[unlikely]] {
+            return ret;
+        }
+    }
+    const CharType* const start = current;
+    while (current < end && *current == '0') {
+        ++current;
+    }
+    // The first block of digits always fits in 64bits, any further blocks are combined using 128bit arithmetic
+    uint64 high = 0;
+    uint64 low = 0;
+    bool overflow = false;
+    numberParseDigits(current, current + min<uint0>(end - current, numberMaxDigits64), low);
+    while (current < end && numberDigit(*current) < 10) [[unlikely]] {
+        const CharType* const block = current;
+        uint64 value = 0;
+        numberParseDigits(current, current + min<uint0>(end - current, numberMaxDigits64), value);
+        overflow = overflow || !numberMultiplyAdd(high, low, numberPowerOfTen[current - block], value);
+    }
+    if (current == start) [[unlikely]] {
+        return ret;
+    }
+    ret.length = static_cast<uint0>(current - string);
+    ret.error = ParseError::None;
+
+    // Clamp the magnitude to the largest value the type can represent
+    uint64 maxHigh = 0;
+    uint64 maxLow;
+    constexpr uint32 bits = sizeof(T) * 8;
+    if constexpr (isSigned<T>) {
+        if constexpr (bits > 64) {
+            maxHigh = (1_ui64 << 63_ui8) - (negative ? 0 : 1);
+            maxLow = negative ? 0 : 0xFFFFFFFFFFFFFFFF_ui64;
+        } else {
+            maxLow = (1_ui64 << (bits - 1)) - (negative ? 0 : 1);
+        }
+    } else {
+        maxHigh = (bits > 64) ? 0xFFFFFFFFFFFFFFFF_ui64 : 0;
+        maxLow = 0xFFFFFFFFFFFFFFFF_ui64 >> (bits > 64 ? 0 : 64 - bits);
+    }
+    if (overflow || high > maxHigh || (high == maxHigh && low > maxLow)) [[unlikely]] {
+        ret.error = ParseError::Range;
+        high = maxHigh;
+        low = maxLow;
+    }
+    if (negative) {
+        high = ~high + ((low == 0) ? 1 : 0);
+        low = 0 - low;
+    }
+    if constexpr (isSame<T, Int128>) {
+        ret.value = Int128(static_cast<int64>(high), low);
+    } else if constexpr (isSame<T, UInt128>) {
+        ret.value = UInt128(high, low);
+    } else {
+        ret.value = static_cast<T>(low);
+    }
+    return ret;
+}
+
+/**
+ * Parse a floating point number from a string.
+ * @tparam T        Type of floating point value.
+ * @tparam CharType Type of character.
+ * @param string The string to parse.
+ * @param number The number of characters in the string.
+ * @returns The result of the parse.
+ */
+template<typename T, typename CharType>
+XS_INLINE NumberParse<T> numberParseFloat(const CharType* const XS_RESTRICT string, const uint0 number) noexcept
+{
+    using Format = NumberFloatFormat<T>;
+    using Bits = typename Format::Bits;
+    NumberParse<T> ret;
+    const CharType* current = string;
+    const CharType* const end = string + number;
+    bool negative = false;
+    if (current < end && (*current == '-' || *current == '+')) {
+        negative = (*current == '-');
+        ++current;
+    }
+    NumberDigits<CharType> digits;
+    uint64 mantissa = 0;
+    digits.integer = current;
+    numberParseDigits(current, end, mantissa);
+    digits.integerEnd = current;
+    digits.fraction = current;
+    digits.fractionEnd = current;
+    if (current < end && *current == '.') {
+        digits.fraction = ++current;
+        numberParseDigits(current, end, mantissa);
+        digits.fractionEnd = current;
+    }
+
+    uint64 bits;
+    ret.error = ParseError::None;
+    if (digits.integer == digits.integerEnd && digits.fraction == digits.fractionEnd) [[unlikely]] {
+        // Check for special values
+        current = digits.integer;
+        if (const uint0 length = numberMatch(current, end, "infinity"); length >= 3) {
+            bits = Format::infinity;
+            current += (length == 8) ? 8 : 3;
+        } else if (numberMatch(current, end, "nan") == 3) {
+            bits = Format::infinity | (1_ui64 << (Format::mantissaBits - 1));
+            current += 3;
+        } else {
+            ret.error = ParseError::Invalid;
+            return ret;
+        }
+    } else {
+        if (current < end && (static_cast<uint32>(*current) | 0x20_ui32) == 'e') {
+            const CharType* exponent = current + 1;
+            bool negativeExponent = false;
+            if (exponent < end && (*exponent == '-' || *exponent == '+')) {
+                negativeExponent = (*exponent == '-');
+                ++exponent;
+            }
+            if (exponent < end && numberDigit(*exponent) < 10) {
+                // Large exponents are clamped as they always overflow (or underflow) the result
+                int64 value = 0;
+                for (uint32 digit; exponent < end && (digit = numberDigit(*exponent)) < 10; ++exponent) {
+                    value = (value < 0x10000000) ? (value * 10) + digit : value;
+                }
+                digits.exponent = negativeExponent ? -value : value;
+                current = exponent;
+            }
+        }
+        int64 exponent = digits.exponent - (digits.fractionEnd - digits.fraction);
+        bool truncated = false;
+        if (static_cast<uint0>((digits.integerEnd - digits.integer) + (digits.fractionEnd - digits.fraction)) >
+            numberMaxDigits64) [[unlikely]] {
+            mantissa = 0;
+            exponent = numberSignificant(digits, numberMaxDigits64, truncated,
+                [&mantissa](const uint32 digit) { mantissa = (mantissa * 10) + digit; });
+        }
+        if (!truncated && exponent >= -Format::maxFastPower && exponent <= Format::maxFastPower &&
+            mantissa <= Format::maxFastMantissa) {
+            // Both the mantissa and power of 10 are exact so the result only has a single rounding
+            auto value = static_cast<T>(mantissa);
+            if (exponent < 0) {
+                value /= static_cast<T>(numberPowerOfTenFloat[-exponent]);
+            } else {
+                value *= static_cast<T>(numberPowerOfTenFloat[exponent]);
+            }
+            ret.value = negative ? -value : value;
+            ret.length = static_cast<uint0>(current - string);
+            return ret;
+        }
+        bits = numberEiselLemire<T>(mantissa, exponent);
+        if (truncated && bits != numberEiselLemire<T>(mantissa + 1, exponent)) [[unlikely]] {
+            // The dropped digits affect rounding so the exact value must be used instead
+            bits = numberSlowPath<T>(digits, bits);
+        }
+        if (bits == Format::infinity || (bits == 0 && mantissa != 0)) [[unlikely]] {
+            ret.error = ParseError::Range;
+        }
+    }
+    if (negative) {
+        bits |= 1_ui64 << (sizeof(Bits) * 8 - 1);
+    }
+    ret.value = bitCast<T>(static_cast<Bits>(bits));
+    ret.length = static_cast<uint0>(current - string);
+    return ret;
+}
+} // namespace NoExport
+
+/**
+ * Parse a number from the start of a string.
+ * @note Parsing stops at the first character that is not part of the number. Integers are an optional sign followed by
+ * decimal digits. Floating point numbers may also contain a fractional part and exponent as well as the special values
+ * "inf", "infinity" and "nan" (ignoring case). Floating point values are correctly rounded.
+ * @tparam T        Type of number to parse.
+ * @tparam CharType Type of character.
+ * @param string The string to parse.
+ * @param number The number of characters in the string.
+ * @returns The parsed number along with the number of characters used. If the number is out of range then the
+ * error is set and the value is clamped (integers) or set to infinity/zero (floating point).
+ */
+template<typename T, typename CharType>
+requires((isInteger<T> || isSameAny<T, float32, float64>) && isSameAny<CharType, char, char8, char16, char32>)
+XS_INLINE NumberParse<T> parseNumber(const CharType* const XS_RESTRICT string, const uint0 number) noexcept
+{
+    if constexpr (isInteger<T>) {
+        return NoExport::numberParseInteger<T>(string, number);
+    } else {
+        return NoExport::numberParseFloat<T>(string, number);
+    }
+}
+} // namespace Shift
@@ -0,0 +1,785 @@
+#pragma once
+/**
+ * Copyright Matthew Oliver
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Memory/XSDArray.hpp"
+#include "XSBit.hpp"
+#include "XSUtility.hpp"
+
+namespace Shift {
+namespace NoExport {
+/**
+ * Query if the best child of a heap node can be found using SIMD.
+ * @tparam T       Type of key stored in the heap.
+ * @tparam Compare Type of function object used to compare keys.
+ */
+template<typename T, typename Compare>
+inline constexpr bool priorityQueueHasSIMD =
+    isSameAny<T, uint32, int32, float32> && (isSame<Compare, Less<T>> || isSame<Compare, Greater<T>>);
+
+#if XS_ISA == XS_X86
+/**
+ * Select the best of 2 sets of 4 keys.
+ * @tparam T      Type of key.
+ * @tparam IsLess True if the lowest value is best, false if the highest value is best.
+ * @param first  The first keys.
+ * @param second The second keys.
+ * @returns The best value in each lane.
+ */
+template<typename T, bool IsLess>
+XS_INLINE __m128i priorityQueueSelect128(const __m128i first, const __m128i second) noexcept
+{
+    if constexpr (isSame<T, uint32>) {
+        return IsLess ? _mm_min_epu32(first, second) : _mm_max_epu32(first, second);
+    } else {
+        return IsLess ? _mm_min_epi32(first, second) : _mm_max_epi32(first, second);
+    }
+}
+
+/**
+ * Select the best of 2 sets of 8 keys.
+ * @tparam T      Type of key.
+ * @tparam IsLess True if the lowest value is best, false if the highest value is best.
+ * @param first  The first keys.
+ * @param second The second keys.
+ * @returns The best value in each lane.
+ */
+template<typename T, bool IsLess>
+XS_INLINE __m256i priorityQueueSelect256(const __m256i first, const __m256i second) noexcept
+{
+    if constexpr (isSame<T, uint32>) {
+        return IsLess ? _mm256_min_epu32(first, second) : _mm256_max_epu32(first, second);
+    } else {
+        return IsLess ? _mm256_min_epi32(first, second) : _mm256_max_epi32(first, second);
+    }
+}
+
+/**
+ * Get a bit mask of the lanes of a full group of 4 or 8 keys that hold the best key.
+ * @tparam Arity   The number of keys in the group.
+ * @tparam T       Type of key.
+ * @tparam Compare Type of function object used to compare keys.
+ * @param keys The keys to search.
+ * @returns The mask, 0 if no key could be selected (NaN values).
+ */
+template<uint32 Arity, typename T, typename Compare>
+XS_INLINE uint32 priorityQueueBestMask(const T* const XS_RESTRICT keys) noexcept
+{
+    constexpr bool isLess = isSame<Compare, Less<T>>;
+    if constexpr (Arity == 4 && isSame<T, float32>) {
+        const __m128 values = _mm_loadu_ps(keys);
+        __m128 best = _mm_shuffle_ps(values, values, _MM_SHUFFLE(1, 0, 3, 2));
+        best = isLess ? _mm_min_ps(values, best) : _mm_max_ps(values, best);
+        const __m128 best2 = _mm_shuffle_ps(best, best, _MM_SHUFFLE(2, 3, 0, 1));
+        best = isLess ? _mm_min_ps(best, best2) : _mm_max_ps(best, best2);
+        return static_cast<uint32>(_mm_movemask_ps(_mm_cmpeq_ps(values, best)));
+    } else if constexpr (Arity == 4) {
+        const __m128i values = _mm_loadu_si128(reinterpret_cast<const __m128i*>(keys));
+        __m128i best = priorityQueueSelect128<T, isLess>(values, _mm_shuffle_epi32(values, _MM_SHUFFLE(1, 0, 3, 2)));
+        best = priorityQueueSelect128<T, isLess>(best, _mm_shuffle_epi32(best, _MM_SHUFFLE(2, 3, 0, 1)));
+        return static_cast<uint32>(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(values, best))));
+    } else if constexpr (isSame<T, float32>) {
+        const __m256 values = _mm256_loadu_ps(keys);
+        __m256 best = _mm256_permute2f128_ps(values, values, 1);
+        best = isLess ? _mm256_min_ps(values, best) : _mm256_max_ps(values, best);
+        __m256 best2 = _mm256_shuffle_ps(best, best, _MM_SHUFFLE(1, 0, 3, 2));
+        best = isLess ? _mm256_min_ps(best, best2) : _mm256_max_ps(best, best2);
+        best2 = _mm256_shuffle_ps(best, best, _MM_SHUFFLE(2, 3, 0, 1));
+        best = isLess ? _mm256_min_ps(best, best2) : _mm256_max_ps(best, best2);
+        return static_cast<uint32>(_mm256_movemask_ps(_mm256_cmp_ps(values, best, _CMP_EQ_OQ)));
+    } else {
+        const __m256i values = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(keys));
+        __m256i best = priorityQueueSelect256<T, isLess>(values, _mm256_permute2x128_si256(values, values, 1));
+        best = priorityQueueSelect256<T, isLess>(best, _mm256_shuffle_epi32(best, _MM_SHUFFLE(1, 0, 3, 2)));
+        best = priorityQueueSelect256<T, isLess>(best, _mm256_shuffle_epi32(best, _MM_SHUFFLE(2, 3, 0, 1)));
+        return static_cast<uint32>(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(values, best))));
+    }
+}
+#endif
+
+/**
+ * Get the best key out of the children of a heap node.
+ * @note If multiple keys are equally best then the first is returned.
+ * @tparam Arity   The maximum number of children of each node.
+ * @tparam T       Type of key.
+ * @tparam Compare Type of function object used to compare keys.
+ * @param keys    The first child key.
+ * @param number  The number of children (at most Arity).
+ * @param compare The function object used to compare keys.
+ * @returns The offset of the best child from keys.
+ */
+template<uint32 Arity, typename T, typename Compare>
+XS_INLINE uint0 priorityQueueBestChild(
+    const T* const XS_RESTRICT keys, const uint0 number, const Compare& compare) noexcept
+{
+#if XS_ISA == XS_X86
+    if constexpr (priorityQueueHasSIMD<T, Compare> &&
+        ((Arity == 4 && (isSame<T, float32> || hasISAFeature<ISAFeature::SSE41>)) ||
+            (Arity == 8 && hasISAFeature<ISAFeature::AVX2>))) {
+        if (number == Arity) [[likely]] {
+            if (const uint32 mask = priorityQueueBestMask<Arity, T, Compare>(keys); mask != 0) [[likely]] {
+                return ctz(mask);
+            }
+        }
+    }
+#endif
+    uint0 best = 0;
+    for (uint0 i = 1; i < number; ++i) {
+        if (compare(keys[i], keys[best])) {
+            best = i;
+        }
+    }
+    return best;
+}
+} // namespace NoExport
+
+/**
+ * Priority queue implemented using a d-ary heap.
+ * @note The top element is the one that is ordered first by Compare (i.e. the smallest when using Less). Using more
+ * than 2 children per node reduces the height of the heap and keeps all children of a node within the same cache
+ * line. When storing uint32, int32 or float32 using Less/Greater the best child is found using SIMD.
+ * @tparam T       Type of element stored within the queue.
+ * @tparam Compare Type of function object used to order elements.
+ * @tparam Alloc   Type of allocator used to allocate elements.
+ * @tparam Arity   The number of children of each heap node.
+ */
+template<typename T, typename Compare = Less<T>, class Alloc = AllocRegionHeap<T>, uint32 Arity = 4>
+requires(isInvokable<Compare, const T&, const T&>)
+class PriorityQueue
+{
+public:
+    using Type = T;
+    using HeapArray = DArray<T, Alloc>;
+
+    static_assert(Arity >= 2, "Invalid Arity: Arity must be at least 2");
+
+    HeapArray heap;  /**< Elements stored in heap order */
+    Compare compare; /**< Function object used to order elements */
+
+    /** Default constructor. */
+    XS_INLINE PriorityQueue() noexcept = default;
+
+    /**
+     * Constructor that reserves space for a number of elements.
+     * @param number    The number of elements to reserve space for.
+     * @param compareIn (Optional) The function object used to order elements.
+     */
+    XS_INLINE explicit PriorityQueue(const uint0 number, const Compare& compareIn = Compare()) noexcept
+        : heap(number)
+        , compare(compareIn)
+    {}
+
+    /**
+     * Constructor that adds a list of elements.
+     * @note This builds the heap in O(n) time.
+     * @param elements  The elements to add.
+     * @param number    The number of elements.
+     * @param compareIn (Optional) The function object used to order elements.
+     */
+    XS_INLINE PriorityQueue(
+        const Type* const XS_RESTRICT elements, const uint0 number, const Compare& compareIn = Compare()) noexcept
+        : heap(elements, number)
+        , compare(compareIn)
+    {
+        heapify();
+    }
+
+    /**
+     * Constructor that adds all elements of an array.
+     * @note This builds the heap in O(n) time.
+     * @tparam Alloc2 Type of allocator used by the array.
+     * @param array     The array to add.
+     * @param compareIn (Optional) The function object used to order elements.
+     */
+    template<class Alloc2>
+    XS_INLINE explicit PriorityQueue(const Array<T, Alloc2>& array, const Compare& compareIn = Compare()) noexcept
+        : PriorityQueue(array.getData(), array.getLength(), compareIn)
+    {}
+
+    /**
+     * Copy constructor.
+     * @param other The other queue.
+     */
+    XS_INLINE PriorityQueue(const PriorityQueue& other) noexcept = default;
+
+    /**
+     * Move constructor.
+     * @param other The other queue.
+     */
+    XS_INLINE PriorityQueue(PriorityQueue&& other) noexcept = default;
+
+    /** Destructor. */
+    XS_INLINE ~PriorityQueue() noexcept = default;
+
+    /**
+     * Assignment operator.
+     * @param other The other queue.
+     * @returns A deep copy of this object.
+     */
+    XS_INLINE PriorityQueue& operator=(const PriorityQueue& other) noexcept = default;
+
+    /**
+     * Move assignment operator.
+     * @param other The other queue.
+     * @returns A shallow copy of this object.
+     */
+    XS_INLINE PriorityQueue& operator=(PriorityQueue&& other) noexcept = default;
+
+    /**
+     * Swap the contents of two queues around.
+     * @param [in,out] other The queue to swap with this one.
+     */
+    XS_INLINE void swap(PriorityQueue& other) noexcept
+    {
+        heap.swap(other.heap);
+        Shift::swap(compare, other.compare);
+    }
+
+    /**
+     * Checks whether the queue has any allocated memory.
+     * @returns True if valid, false if not.
+     */
+    XS_INLINE bool isValid() const noexcept
+    {
+        return heap.isValid();
+    }
+
+    /**
+     * Check if the queue is empty or not.
+     * @returns Boolean signaling if queue is empty.
+     */
+    XS_INLINE bool isEmpty() const noexcept
+    {
+        return heap.isEmpty();
+    }
+
+    /**
+     * Get the number of elements in the queue.
+     * @returns The number of elements currently stored within the queue.
+     */
+    XS_INLINE uint0 getLength() const noexcept
+    {
+        return heap.getLength();
+    }
+
+    /**
+     * Get the number of elements currently reserved for.
+     * @returns The number of elements that can be stored before the queue must be reallocated.
+     */
+    XS_INLINE uint0 getReservedLength() const noexcept
+    {
+        return heap.getReservedLength();
+    }
+
+    /**
+     * Manually set the number of elements to reserve for.
+     * @param number The number of elements to reserve space for.
+     * @returns Boolean signaling if new memory could be reserved.
+     */
+    XS_INLINE bool setReservedLength(const uint0 number) noexcept
+    {
+        return heap.setReservedLength(number);
+    }
+
+    /**
+     * Add an element to the queue.
+     * @tparam Args Type of the arguments used to construct the element.
+     * @param values The values used to construct the element.
+     * @returns Boolean representing if element could be added to queue. (will be false if memory could not be
+     *          allocated).
+     */
+    template<typename... Args>
+    requires(isNothrowConstructible<Type, Args...>)
+    XS_INLINE bool add(Args&&... values) noexcept
+    {
+        if (!heap.add(forward<Args>(values)...)) [[unlikely]] {
+            return false;
+        }
+        siftUp(heap.getLength() - 1);
+        return true;
+    }
+
+    /**
+     * Add a list of elements to the queue.
+     * @note If the number of new elements is at least the number of existing elements then the heap is rebuilt in
+     * O(n) time instead of adding each element individually.
+     * @param elements The elements to add.
+     * @param number   The number of elements.
+     * @returns Boolean representing if elements could be added to queue. (will be false if memory could not be
+     *          allocated).
+     */
+    XS_INLINE bool add(const Type* const XS_RESTRICT elements, const uint0 number) noexcept
+    {
+        const uint0 length = heap.getLength();
+        if (!heap.add(elements, number)) [[unlikely]] {
+            return false;
+        }
+        if (number >= length) {
+            heapify();
+        } else {
+            for (uint0 i = length; i < length + number; ++i) {
+                siftUp(i);
+            }
+        }
+        return true;
+    }
+
+    /**
+     * Add all elements of an array to the queue.
+     * @tparam Alloc2 Type of allocator used by the array.
+     * @param array The array to add.
+     * @returns Boolean representing if elements could be added to queue. (will be false if memory could not be
+     *          allocated).
+     */
+    template<class Alloc2>
+    XS_INLINE bool add(const Array<T, Alloc2>& array) noexcept
+    {
+        return add(array.getData(), array.getLength());
+    }
+
+    /**
+     * Get the element at the top of the queue.
+     * @returns The first element in Compare order.
+     */
+    XS_INLINE const Type& getTop() const noexcept
+    {
+        XS_ASSERT(!heap.isEmpty());
+        return heap.getData()[0];
+    }
+
+    /** Remove the element at the top of the queue. */
+    XS_INLINE void removeTop() noexcept
+    {
+        XS_ASSERT(!heap.isEmpty());
+        Type* const XS_RESTRICT data = heap.getData();
+        const uint0 last = heap.getLength() - 1;
+        if (last != 0) [[likely]] {
+            data[0] = move(data[last]);
+        }
+        heap.remove();
+        if (last > 1) [[likely]] {
+            siftDown(0);
+        }
+    }
+
+    /**
+     * Remove and return the element at the top of the queue.
+     * @returns The first element in Compare order.
+     */
+    XS_INLINE Type pop() noexcept
+    {
+        XS_ASSERT(!heap.isEmpty());
+        Type ret(move(heap.getData()[0]));
+        removeTop();
+        return ret;
+    }
+
+    /** Remove all elements from the queue. */
+    XS_INLINE void removeAll() noexcept
+    {
+        heap.removeAll();
+    }
+
+    /**
+     * Get the internal element buffer.
+     * @returns Pointer to the first element (elements are stored in heap order).
+     */
+    XS_INLINE const Type* getData() const noexcept
+    {
+        return heap.getData();
+    }
+
+private:
+    /** Restore heap order of all elements. */
+    XS_INLINE void heapify() noexcept
+    {
+        const uint0 length = heap.getLength();
+        if (length < 2) {
+            return;
+        }
+        // Sift down every node that has children starting from the last one
+        for (uint0 i = (length - 2) / Arity + 1; i-- > 0;) {
+            siftDown(i);
+        }
+    }
+
+    /**
+     * Move an element up the heap until it is in heap order.
+     * @param position The location of the element.
+     */
+    XS_INLINE void siftUp(uint0 position) noexcept
+    {
+        Type* const XS_RESTRICT data = heap.getData();
+        Type value(move(data[position]));
+        while (position > 0) {
+            const uint0 parent = (position - 1) / Arity;
+            if (!compare(value, data[parent])) {
+                break;
+            }
+            data[position] = move(data[parent]);
+            position = parent;
+        }
+        data[position] = move(value);
+    }
+
+    /**
+     * Move an element down the heap until it is in heap order.
+     * @param position The location of the element.
+     */
+    XS_INLINE void siftDown(uint0 position) noexcept
+    {
+        Type* const XS_RESTRICT data = heap.getData();
+        const uint0 length = heap.getLength();
+        Type value(move(data[position]));
+        while (true) {
+            const uint0 child = position * Arity + 1;
+            if (child >= length) {
+                break;
+            }
+            const uint0 remaining = length - child;
+            const uint0 best = child +
+                NoExport::priorityQueueBestChild<Arity>(data + child, remaining < Arity ? remaining : Arity, compare);
+            if (!compare(data[best], value)) {
+                break;
+            }
+            data[position] = move(data[best]);
+            position = best;
+        }
+        data[position] = move(value);
+    }
+};
+
+/**
+ * Priority queue of integer indexes ordered by an associated key that supports changing the key of existing entries.
+ * @note Each index can be in the queue at most once, a lookup table of the heap position of each index is maintained
+ * so that keys can be updated in O(log n) time. This is intended for graph searches where the index is a node.
+ * @tparam T       Type of key used to order indexes.
+ * @tparam Compare Type of function object used to order keys.
+ * @tparam Alloc   Type of allocator used to allocate keys.
+ * @tparam Arity   The number of children of each heap node.
+ */
+template<typename T, typename Compare = Less<T>, class Alloc = AllocRegionHeap<T>, uint32 Arity = 4>
+requires(isInvokable<Compare, const T&, const T&>)
+class IndexedPriorityQueue
+{
+public:
+    using Type = T;
+    using KeyArray = DArray<T, Alloc>;
+    using IndexArray = DArray<uint32, typename Alloc::template Allocator<uint32>>;
+
+    static_assert(Arity >= 2, "Invalid Arity: Arity must be at least 2");
+
+    /**< Position used to mark an index that is not in the queue */
+    static constexpr uint32 invalidPosition = Limits<uint32>::Max();
+
+    KeyArray keys;        /**< Keys stored in heap order */
+    IndexArray indexes;   /**< Index associated with each key */
+    IndexArray positions; /**< Heap position of each index */
+    Compare compare;      /**< Function object used to order keys */
+
+    /** Default constructor. */
+    XS_INLINE IndexedPriorityQueue() noexcept = default;
+
+    /**
+     * Constructor that reserves space for a number of indexes.
+     * @param number    The number of indexes to reserve space for.
+     * @param compareIn (Optional) The function object used to order keys.
+     */
+    XS_INLINE explicit IndexedPriorityQueue(const uint0 number, const Compare& compareIn = Compare()) noexcept
+        : keys(number)
+        , indexes(number)
+        , positions(number)
+        , compare(compareIn)
+    {}
+
+    /**
+     * Copy constructor.
+     * @param other The other queue.
+     */
+    XS_INLINE IndexedPriorityQueue(const IndexedPriorityQueue& other) noexcept = default;
+
+    /**
+     * Move constructor.
+     * @param other The other queue.
+     */
+    XS_INLINE IndexedPriorityQueue(IndexedPriorityQueue&& other) noexcept = default;
+
+    /** Destructor. */
+    XS_INLINE ~IndexedPriorityQueue() noexcept = default;
+
+    /**
+     * Assignment operator.
+     * @param other The other queue.
+     * @returns A deep copy of this object.
+     */
+    XS_INLINE IndexedPriorityQueue& operator=(const IndexedPriorityQueue& other) noexcept = default;
+
+    /**
+     * Move assignment operator.
+     * @param other The other queue.
+     * @returns A shallow copy of this object.
+     */
+    XS_INLINE IndexedPriorityQueue& operator=(IndexedPriorityQueue&& other) noexcept = default;
+
+    /**
+     * Swap the contents of two queues around.
+     * @param [in,out] other The queue to swap with this one.
+     */
+    XS_INLINE void swap(IndexedPriorityQueue& other) noexcept
+    {
+        keys.swap(other.keys);
+        indexes.swap(other.indexes);
+        positions.swap(other.positions);
+        Shift::swap(compare, other.compare);
+    }
+
+    /**
+     * Check if the queue is empty or not.
+     * @returns Boolean signaling if queue is empty.
+     */
+    XS_INLINE bool isEmpty() const noexcept
+    {
+        return keys.isEmpty();
+    }
+
+    /**
+     * Get the number of indexes in the queue.
+     * @returns The number of indexes currently stored within the queue.
+     */
+    XS_INLINE uint0 getLength() const noexcept
+    {
+        return keys.getLength();
+    }
+
+    /**
+     * Check if an index is currently in the queue.
+     * @param index The index to check.
+     * @returns True if the index is in the queue.
+     */
+    XS_INLINE bool contains(const uint32 index) const noexcept
+    {
+        return index < positions.getLength() && positions.at(index) != invalidPosition;
+    }
+
+    /**
+     * Add an index to the queue.
+     * @param index The index to add (must not already be in the queue).
+     * @param key   The key used to order the index.
+     * @returns Boolean representing if index could be added to queue. (will be false if memory could not be
+     *          allocated).
+     */
+    XS_INLINE bool add(const uint32 index, const Type& key) noexcept
+    {
+        XS_ASSERT(!contains(index));
+        if (index >= positions.getLength()) {
+            // Grow the lookup table to cover the new index
+            if (!positions.checkReservedLength(index + 1)) [[unlikely]] {
+                return false;
+            }
+            while (positions.getLength() <= index) {
+                positions.addUnChecked(invalidPosition);
+            }
+        }
+        if (!keys.checkAddReservedLength(1) || !indexes.checkAddReservedLength(1)) [[unlikely]] {
+            return false;
+        }
+        const uint32 position = static_cast<uint32>(keys.getLength());
+        keys.addUnChecked(key);
+        indexes.addUnChecked(index);
+        positions.at(index) = position;
+        siftUp(position);
+        return true;
+    }
+
+    /**
+     * Change the key of an index already in the queue.
+     * @param index The index to update.
+     * @param key   The new key.
+     */
+    XS_INLINE void update(const uint32 index, const Type& key) noexcept
+    {
+        XS_ASSERT(contains(index));
+        const uint32 position = positions.at(index);
+        Type& current = keys.at(position);
+        const bool up = compare(key, current);
+        current = key;
+        if (up) {
+            siftUp(position);
+        } else {
+            siftDown(position);
+        }
+    }
+
+    /**
+     * Change the key of an index already in the queue to one that is ordered before the existing key.
+     * @param index The index to update.
+     * @param key   The new key (must not be ordered after the existing key).
+     */
+    XS_INLINE void decreaseKey(const uint32 index, const Type& key) noexcept
+    {
+        XS_ASSERT(contains(index));
+        const uint32 position = positions.at(index);
+        XS_ASSERT(!compare(keys.at(position), key));
+        keys.at(position) = key;
+        siftUp(position);
+    }
+
+    /**
+     * Get the key associated with an index.
+     * @param index The index (must be in the queue).
+     * @returns The key.
+     */
+    XS_INLINE const Type& getKey(const uint32 index) const noexcept
+    {
+        XS_ASSERT(contains(index));
+        return keys.at(positions.at(index));
+    }
+
+    /**
+     * Get the key at the top of the queue.
+     * @returns The first key in Compare order.
+     */
+    XS_INLINE const Type& getTop() const noexcept
+    {
+        XS_ASSERT(!keys.isEmpty());
+        return keys.getData()[0];
+    }
+
+    /**
+     * Get the index at the top of the queue.
+     * @returns The index associated with the first key in Compare order.
+     */
+    XS_INLINE uint32 getTopIndex() const noexcept
+    {
+        XS_ASSERT(!keys.isEmpty());
+        return indexes.getData()[0];
+    }
+
+    /** Remove the index at the top of the queue. */
+    XS_INLINE void removeTop() noexcept
+    {
+        removeAt(0);
+    }
+
+    /**
+     * Remove an index from the queue.
+     * @param index The index to remove.
+     * @returns True if the index was removed, false if it was not in the queue.
+     */
+    XS_INLINE bool remove(const uint32 index) noexcept
+    {
+        if (!contains(index)) {
+            return false;
+        }
+        removeAt(positions.at(index));
+        return true;
+    }
+
+    /** Remove all indexes from the queue. */
+    XS_INLINE void removeAll() noexcept
+    {
+        for (const auto& i : indexes) {
+            positions.at(i) = invalidPosition;
+        }
+        keys.removeAll();
+        indexes.removeAll();
+    }
+
+private:
+    /**
+     * Remove the key at a heap position.
+     * @param position The location of the key.
+     */
+    XS_INLINE void removeAt(const uint32 position) noexcept
+    {
+        XS_ASSERT(position < keys.getLength());
+        const uint32 last = static_cast<uint32>(keys.getLength() - 1);
+        positions.at(indexes.at(position)) = invalidPosition;
+        if (position != last) {
+            keys.at(position) = move(keys.at(last));
+            indexes.at(position) = indexes.at(last);
+            positions.at(indexes.at(position)) = position;
+        }
+        keys.remove();
+        indexes.remove();
+        if (position != last) {
+            // The moved key may need to go in either direction
+            if (position > 0 && compare(keys.at(position), keys.at((position - 1) / Arity))) {
+                siftUp(position);
+            } else {
+                siftDown(position);
+            }
+        }
+    }
+
+    /**
+     * Move a key up the heap until it is in heap order.
+     * @param position The location of the key.
+     */
+    XS_INLINE void siftUp(uint32 position) noexcept
+    {
+        Type* const XS_RESTRICT data = keys.getData();
+        uint32* const XS_RESTRICT indexData = indexes.getData();
+        Type value(move(data[position]));
+        const uint32 index = indexData[position];
+        while (position > 0) {
+            const uint32 parent = (position - 1) / Arity;
+            if (!compare(value, data[parent])) {
+                break;
+            }
+            data[position] = move(data[parent]);
+            indexData[position] = indexData[parent];
+            positions.at(indexData[position]) = position;
+            position = parent;
+        }
+        data[position] = move(value);
+        indexData[position] = index;
+        positions.at(index) = position;
+    }
+
+    /**
+     * Move a key down the heap until it is in heap order.
+     * @param position The location of the key.
+     */
+    XS_INLINE void siftDown(uint32 position) noexcept
+    {
+        Type* const XS_RESTRICT data = keys.getData();
+        uint32* const XS_RESTRICT indexData = indexes.getData();
+        const uint0 length = keys.getLength();
+        Type value(move(data[position]));
+        const uint32 index = indexData[position];
+        while (true) {
+            const uint0 child = static_cast<uint0>(position) * Arity + 1;
+            if (child >= length) {
+                break;
+            }
+            const uint0 remaining = length - child;
+            const uint32 best = static_cast<uint32>(child +
+                NoExport::priorityQueueBestChild<Arity>(data + child, remaining < Arity ? remaining : Arity, compare));
+            if (!compare(data[best], value)) {
+                break;
+            }
+            data[position] = move(data[best]);
+            indexData[position] = indexData[best];
+            positions.at(indexData[position]) = position;
+            position = best;
+        }
+        data[position] = move(value);
+        indexData[position] = index;
+        positions.at(index) = position;
+    }
+};
+} // namespace Shift
@@ -0,0 +1,672 @@
+#pragma once
+/**
+ * Copyright Matthew Oliver
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Memory/XSAllocatorHeap.hpp"
+#include "Memory/XSRingUtility.hpp"
+#include "XSUtility.hpp"
+
+namespace Shift {
+/**
+ * A contiguous section of elements stored within a ring buffer.
+ * @tparam T Type of element stored within the section.
+ */
+template<typename T>
+class RingBufferSpan
+{
+public:
+    using Type = T;
+
+    Type* pointer = nullptr; /**< Pointer to the first element in the section */
+    uint0 length = 0;        /**< Number of elements in the section */
+
+    /** Default constructor. */
+    XS_INLINE RingBufferSpan() noexcept = default;
+
+    /**
+     * Constructor from member variables.
+     * @param pointerIn Pointer to the first element in the section.
+     * @param lengthIn  Number of elements in the section.
+     */
+    XS_INLINE RingBufferSpan(Type* const pointerIn, const uint0 lengthIn) noexcept
+        : pointer(pointerIn)
+        , length(lengthIn)
+    {}
+};
+
+/**
+ * Fixed capacity circular buffer that supports adding and removing elements at both ends.
+ * @note The capacity is always a power of 2 so that element positions are wrapped using a mask. The stored elements
+ * are always split over at most 2 contiguous sections of memory which allows bulk operations to be performed using at
+ * most 2 memory copies.
+ * @tparam T     Type of element stored within the buffer.
+ * @tparam Alloc Type of allocator used to allocate elements.
+ */
+template<typename T, class Alloc = AllocRegionHeap<T>>
+class RingBuffer
+{
+public:
+    using Type = T;
+    using Handle = typename Alloc::Handle;
+    using Allocator = Alloc;
+    using Span = RingBufferSpan<Type>;
+    using ConstSpan = RingBufferSpan<const Type>;
+
+    /**< Number of slots provided by a fixed size allocator */
+    static constexpr uint0 fixedCapacity = Handle::isResizable ? 0 : Handle::maxSize / sizeof(Type);
+
+    static_assert((fixedCapacity & (fixedCapacity - 1)) == 0,
+        "RingBuffer requires a fixed size allocator to have a power of 2 number of elements");
+
+    Handle handle;                  /**< The handle used to store elements */
+    uint0 head = 0;                 /**< Position of the first element */
+    uint0 length = 0;               /**< Number of elements currently stored */
+    uint0 capacity = fixedCapacity; /**< Number of allocated slots (power of 2) */
+
+    /** Default constructor. */
+    XS_INLINE RingBuffer() noexcept = default;
+
+    /**
+     * Constructor that reserves space for a number of elements.
+     * @note The reserved space is rounded up to the next power of 2.
+     * @param number The number of elements to reserve space for.
+     */
+    explicit XS_INLINE RingBuffer(const uint0 number) noexcept
+        : handle(Handle::isResizable ? NoExport::ringCapacityFor(number) : fixedCapacity)
+    {
+        if constexpr (Handle::isResizable) {
+            if (handle.pointer != nullptr) [[likely]] {
+                capacity = NoExport::ringCapacityFor(number);
+            }
+        }
+    }
+
+    /**
+     * Copy constructor.
+     * @param other The other ring buffer.
+     */
+    XS_INLINE RingBuffer(const RingBuffer& other) noexcept
+        : handle(other.capacity)
+    {
+        if constexpr (Handle::isResizable) {
+            if (handle.pointer == nullptr) [[unlikely]] {
+                return;
+            }
+            capacity = other.capacity;
+        }
+        const auto spans = other.getSpans();
+        memConstructRange<Type, Type, Handle::maxSize>(
+            handle.pointer, spans.first.pointer, spans.first.length * sizeof(Type));
+        memConstructRange<Type, Type, Handle::maxSize>(
+            handle.pointer + spans.first.length, spans.second.pointer, spans.second.length * sizeof(Type));
+        length = other.length;
+    }
+
+    /**
+     * Move constructor.
+     * @param other The other ring buffer.
+     */
+    XS_INLINE RingBuffer(RingBuffer&& other) noexcept
+        : handle(move(other.handle))
+        , head(other.head)
+        , length(other.length)
+        , capacity(other.capacity)
+    {
+        other.head = 0;
+        other.length = 0;
+        if constexpr (Handle::isResizable) {
+            other.capacity = 0;
+        }
+    }
+
+    /** Destructor. */
+    XS_INLINE ~RingBuffer() noexcept
+    {
+        destructAll();
+    }
+
+    /**
+     * Assignment operator.
+     * @param other The other ring buffer.
+     * @returns A deep copy of this object.
+     */
+    XS_INLINE RingBuffer& operator=(const RingBuffer& other) noexcept
+    {
+        if (this != &other) [[likely]] {
+            RingBuffer temp(other);
+            swap(temp);
+        }
+        return *this;
+    }
+
+    /**
+     * Move assignment operator.
+     * @param other The other ring buffer.
+     * @returns A shallow copy of this object.
+     */
+    XS_INLINE RingBuffer& operator=(RingBuffer&& other) noexcept
+    {
+        swap(other);
+        return *this;
+    }
+
+    /**
+     * Swap the contents of two ring buffers around.
+     * @param [in,out] other The ring buffer to swap with this one.
+     */
+    XS_INLINE void swap(RingBuffer& other) noexcept
+    {
+        Shift::swap(handle, other.handle);
+        Shift::swap(head, other.head);
+        Shift::swap(length, other.length);
+        Shift::swap(capacity, other.capacity);
+    }
+
+    /**
+     * Checks whether the ring buffer has any allocated memory.
+     * @returns True if valid, false if not.
+     */
+    XS_INLINE bool isValid() const noexcept
+    {
+        return capacity != 0;
+    }
+
+    /**
+     * Check if the ring buffer is empty or not.
+     * @returns Boolean signaling if ring buffer is empty.
+     */
+    XS_INLINE bool isEmpty() const noexcept
+    {
+        return length == 0;
+    }
+
+    /**
+     * Check if the ring buffer has no remaining space.
+     * @returns Boolean signaling if ring buffer is full.
+     */
+    XS_INLINE bool isFull() const noexcept
+    {
+        return length == capacity;
+    }
+
+    /**
+     * Get the number of elements in the ring buffer.
+     * @returns The number of elements currently stored within the ring buffer.
+     */
+    XS_INLINE uint0 getLength() const noexcept
+    {
+        return length;
+    }
+
+    /**
+     * Get the number of elements currently reserved for.
+     * @returns The number of elements that can be stored before the ring buffer is full.
+     */
+    XS_INLINE uint0 getReservedLength() const noexcept
+    {
+        return capacity;
+    }
+
+    /**
+     * Manually set the number of elements to reserve for.
+     * @note This will not reduce the reserved size below what is needed to hold the current elements. The reserved
+     * size is rounded up to the next power of 2.
+     * @param number The number of elements to reserve space for.
+     * @returns Boolean signaling if new memory could be reserved.
+     */
+    XS_INLINE bool setReservedLength(const uint0 number) noexcept
+    requires(Handle::isResizable)
+    {
+        const uint0 newCapacity = NoExport::ringCapacityFor(number > length ? number : length);
+        if (newCapacity == capacity) {
+            return true;
+        }
+        return relocate(newCapacity);
+    }
+
+    /**
+     * Add an element to the end of the ring buffer.
+     * @param element The new element.
+     * @returns False if the ring buffer is full.
+     */
+    XS_INLINE bool pushBack(const Type& element) noexcept
+    {
+        if (isFull()) [[unlikely]] {
+            return false;
+        }
+        pushBackUnChecked(element);
+        return true;
+    }
+
+    /**
+     * Add an element to the end of the ring buffer using direct construction.
+     * @tparam Args Type of the arguments.
+     * @param values The values used to construct the new element.
+     * @returns False if the ring buffer is full.
+     */
+    template<typename... Args>
+    requires(isNothrowConstructible<Type, Args...>)
+    XS_INLINE bool pushBack(Args&&... values) noexcept
+    {
+        if (isFull()) [[unlikely]] {
+            return false;
+        }
+        pushBackUnChecked(forward<Args>(values)...);
+        return true;
+    }
+
+    /**
+     * Add multiple elements to the end of the ring buffer.
+     * @note Elements are either all added or none are.
+     * @param elements Pointer to list of elements to add.
+     * @param number   The number of elements in the input list.
+     * @returns False if there is not enough space for all the elements.
+     */
+    XS_INLINE bool pushBack(const Type* const XS_RESTRICT elements, const uint0 number) noexcept
+    {
+        if (number > capacity - length) [[unlikely]] {
+            return false;
+        }
+        const uint0 tail = wrap(head + length);
+        const uint0 first = min(number, capacity - tail);
+        memConstructRange<Type, Type, Handle::maxSize>(&handle.pointer[tail], elements, first * sizeof(Type));
+        memConstructRange<Type, Type, Handle::maxSize>(
+            handle.pointer, elements + first, (number - first) * sizeof(Type));
+        length += number;
+        return true;
+    }
+
+    /**
+     * Add an element to the end of the ring buffer.
+     * @note This does not check if there is enough space for the element.
+     * @param element The new element.
+     */
+    XS_INLINE void pushBackUnChecked(const Type& element) noexcept
+    {
+        XS_ASSERT(length < capacity);
+        memConstruct<Type>(&handle.pointer[wrap(head + length)], element);
+        ++length;
+    }
+
+    /**
+     * Add an element to the end of the ring buffer using direct construction.
+     * @note This does not check if there is enough space for the element.
+     * @tparam Args Type of the arguments.
+     * @param values The values used to construct the new element.
+     */
+    template<typename... Args>
+    requires(isNothrowConstructible<Type, Args...>)
+    XS_INLINE void pushBackUnChecked(Args&&... values) noexcept
+    {
+        XS_ASSERT(length < capacity);
+        memConstruct<Type>(&handle.pointer[wrap(head + length)], forward<Args>(values)...);
+        ++length;
+    }
+
+    /**
+     * Add an element to the start of the ring buffer.
+     * @param element The new element.
+     * @returns False if the ring buffer is full.
+     */
+    XS_INLINE bool pushFront(const Type& element) noexcept
+    {
+        if (isFull()) [[unlikely]] {
+            return false;
+        }
+        pushFrontUnChecked(element);
+        return true;
+    }
+
+    /**
+     * Add an element to the start of the ring buffer using direct construction.
+     * @tparam Args Type of the arguments.
+     * @param values The values used to construct the new element.
+     * @returns False if the ring buffer is full.
+     */
+    template<typename... Args>
+    requires(isNothrowConstructible<Type, Args...>)
+    XS_INLINE bool pushFront(Args&&... values) noexcept
+    {
+        if (isFull()) [[unlikely]] {
+            return false;
+        }
+        pushFrontUnChecked(forward<Args>(values)...);
+        return true;
+    }
+
+    /**
+     * Add multiple elements to the start of the ring buffer.
+     * @note Elements are either all added or none are. The input elements keep their order so that the first input
+     * element becomes the new first element of the ring buffer.
+     * @param elements Pointer to list of elements to add.
+     * @param number   The number of elements in the input list.
+     * @returns False if there is not enough space for all the elements.
+     */
+    XS_INLINE bool pushFront(const Type* const XS_RESTRICT elements, const uint0 number) noexcept
+    {
+        if (number > capacity - length) [[unlikely]] {
+            return false;
+        }
+        const uint0 newHead = wrap(head - number);
+        const uint0 first = min(number, capacity - newHead);
+        memConstructRange<Type, Type, Handle::maxSize>(&handle.pointer[newHead], elements, first * sizeof(Type));
+        memConstructRange<Type, Type, Handle::maxSize>(
+            handle.pointer, elements + first, (number - first) * sizeof(Type));
+        head = newHead;
+        length += number;
+        return true;
+    }
+
+    /**
+     * Add an element to the start of the ring buffer.
+     * @note This does not check if there is enough space for the element.
+     * @param element The new element.
+     */
+    XS_INLINE void pushFrontUnChecked(const Type& element) noexcept
+    {
+        XS_ASSERT(length < capacity);
+        head = wrap(head - 1);
+        memConstruct<Type>(&handle.pointer[head], element);
+        ++length;
+    }
+
+    /**
+     * Add an element to the start of the ring buffer using direct construction.
+     * @note This does not check if there is enough space for the element.
+     * @tparam Args Type of the arguments.
+     * @param values The values used to construct the new element.
+     */
+    template<typename... Args>
+    requires(isNothrowConstructible<Type, Args...>)
+    XS_INLINE void pushFrontUnChecked(Args&&... values) noexcept
+    {
+        XS_ASSERT(length < capacity);
+        head = wrap(head - 1);
+        memConstruct<Type>(&handle.pointer[head], forward<Args>(values)...);
+        ++length;
+    }
+
+    /**
+     * Remove the first element from the ring buffer.
+     * @param [out] element Variable to move the removed element into.
+     * @returns False if the ring buffer was empty.
+     */
+    XS_INLINE bool popFront(Type& element) noexcept
+    {
+        if (isEmpty()) [[unlikely]] {
+            return false;
+        }
+        NoExport::ringMoveOut(&element, &handle.pointer[head], 1);
+        head = wrap(head + 1);
+        --length;
+        return true;
+    }
+
+    /**
+     * Remove multiple elements from the start of the ring buffer.
+     * @param [out] elements Pointer to list of elements to move the removed elements into.
+     * @param       number   The maximum number of elements to remove.
+     * @returns The number of elements actually removed.
+     */
+    XS_INLINE uint0 popFront(Type* const XS_RESTRICT elements, const uint0 number) noexcept
+    {
+        const uint0 count = min(number, length);
+        const uint0 first = min(count, capacity - head);
+        NoExport::ringMoveOut(elements, &handle.pointer[head], first);
+        NoExport::ringMoveOut(elements + first, handle.pointer, count - first);
+        head = wrap(head + count);
+        length -= count;
+        return count;
+    }
+
+    /**
+     * Remove the last element from the ring buffer.
+     * @param [out] element Variable to move the removed element into.
+     * @returns False if the ring buffer was empty.
+     */
+    XS_INLINE bool popBack(Type& element) noexcept
+    {
+        if (isEmpty()) [[unlikely]] {
+            return false;
+        }
+        --length;
+        NoExport::ringMoveOut(&element, &handle.pointer[wrap(head + length)], 1);
+        return true;
+    }
+
+    /**
+     * Remove multiple elements from the end of the ring buffer.
+     * @note Removed elements keep their order so the last output element is the previous last element.
+     * @param [out] elements Pointer to list of elements to move the removed elements into.
+     * @param       number   The maximum number of elements to remove.
+     * @returns The number of elements actually removed.
+     */
+    XS_INLINE uint0 popBack(Type* const XS_RESTRICT elements, const uint0 number) noexcept
+    {
+        const uint0 count = min(number, length);
+        const uint0 start = wrap(head + length - count);
+        const uint0 first = min(count, capacity - start);
+        NoExport::ringMoveOut(elements, &handle.pointer[start], first);
+        NoExport::ringMoveOut(elements + first, handle.pointer, count - first);
+        length -= count;
+        return count;
+    }
+
+    /**
+     * Remove elements from the start of the ring buffer.
+     * @param number The number of elements to remove.
+     */
+    XS_INLINE void removeFront(const uint0 number = 1) noexcept
+    {
+        XS_ASSERT(number <= length);
+        const uint0 first = min(number, capacity - head);
+        memDestructRange<Type>(&handle.pointer[head], first * sizeof(Type));
+        memDestructRange<Type>(handle.pointer, (number - first) * sizeof(Type));
+        head = wrap(head + number);
+        length -= number;
+    }
+
+    /**
+     * Remove elements from the end of the ring buffer.
+     * @param number The number of elements to remove.
+     */
+    XS_INLINE void removeBack(const uint0 number = 1) noexcept
+    {
+        XS_ASSERT(number <= length);
+        const uint0 start = wrap(head + length - number);
+        const uint0 first = min(number, capacity - start);
+        memDestructRange<Type>(&handle.pointer[start], first * sizeof(Type));
+        memDestructRange<Type>(handle.pointer, (number - first) * sizeof(Type));
+        length -= number;
+    }
+
+    /**
+     * Remove all elements from the ring buffer.
+     * @note Unlike clear this does not de-allocate the ring buffers memory.
+     */
+    XS_INLINE void removeAll() noexcept
+    {
+        destructAll();
+        head = 0;
+        length = 0;
+    }
+
+    /**
+     * Remove all elements from the ring buffer and clear.
+     * @note This removes all elements from the ring buffer and de-allocates the ring buffers memory.
+     */
+    XS_INLINE void clear() noexcept
+    {
+        removeAll();
+        if constexpr (Handle::isResizable) {
+            handle.unallocate();
+            capacity = 0;
+        }
+    }
+
+    /**
+     * Mark elements constructed directly into the free space as being added to the end of the ring buffer.
+     * @note The elements must have already been constructed within the sections returned by getFreeSpans.
+     * @param number The number of elements to add.
+     */
+    XS_INLINE void commitBack(const uint0 number) noexcept
+    {
+        XS_ASSERT(number <= capacity - length);
+        length += number;
+    }
+
+    /**
+     * Get the sections of memory that contain the stored elements.
+     * @note The first section contains the start of the ring buffer and the second section continues on from it.
+     * The second section is empty if all elements are contiguous.
+     * @returns The 2 sections of stored elements.
+     */
+    XS_INLINE Pair<Span> getSpans() noexcept
+    {
+        const uint0 first = min(length, capacity - head);
+        return Pair<Span>(Span(&handle.pointer[head], first), Span(handle.pointer, length - first));
+    }
+
+    /**
+     * Get the sections of memory that contain the stored elements.
+     * @note The first section contains the start of the ring buffer and the second section continues on from it.
+     * The second section is empty if all elements are contiguous.
+     * @returns The 2 sections of stored elements.
+     */
+    XS_INLINE Pair<ConstSpan> getSpans() const noexcept
+    {
+        const uint0 first = min(length, capacity - head);
+        return Pair<ConstSpan>(ConstSpan(&handle.pointer[head], first), ConstSpan(handle.pointer, length - first));
+    }
+
+    /**
+     * Get the sections of unused memory that follow the end of the ring buffer.
+     * @note Elements can be constructed directly into these sections and then added using commitBack. The second
+     * section is empty if all free space is contiguous.
+     * @returns The 2 sections of unused memory.
+     */
+    XS_INLINE Pair<Span> getFreeSpans() noexcept
+    {
+        const uint0 tail = wrap(head + length);
+        const uint0 free = capacity - length;
+        const uint0 first = min(free, capacity - tail);
+        return Pair<Span>(Span(&handle.pointer[tail], first), Span(handle.pointer, free - first));
+    }
+
+    /**
+     * Get an element in the ring buffer.
+     * @param position The position of the element to get (relative to the start of the ring buffer).
+     * @returns The requested element.
+     */
+    XS_INLINE Type& at(const uint0 position) noexcept
+    {
+        XS_ASSERT(position < length);
+        return handle.pointer[wrap(head + position)];
+    }
+
+    /**
+     * Get an element in the ring buffer.
+     * @param position The position of the element to get (relative to the start of the ring buffer).
+     * @returns The requested element.
+     */
+    XS_INLINE const Type& at(const uint0 position) const noexcept
+    {
+        XS_ASSERT(position < length);
+        return handle.pointer[wrap(head + position)];
+    }
+
+    /**
+     * Get the first element in the ring buffer.
+     * @returns The requested element.
+     */
+    XS_INLINE Type& atBegin() noexcept
+    {
+        return at(0);
+    }
+
+    /**
+     * Get the first element in the ring buffer.
+     * @returns The requested element.
+     */
+    XS_INLINE const Type& atBegin() const noexcept
+    {
+        return at(0);
+    }
+
+    /**
+     * Get the last element in the ring buffer.
+     * @returns The requested element.
+     */
+    XS_INLINE Type& atBack() noexcept
+    {
+        return at(length - 1);
+    }
+
+    /**
+     * Get the last element in the ring buffer.
+     * @returns The requested element.
+     */
+    XS_INLINE const Type& atBack() const noexcept
+    {
+        return at(length - 1);
+    }
+
+    /**
+     * Move all elements into newly allocated memory.
+     * @note After relocation all elements are stored contiguously starting at the beginning of the new memory.
+     * @param newCapacity The new number of slots (must be a power of 2 and large enough to store existing elements).
+     * @returns Boolean signaling if new memory could be allocated.
+     */
+    XS_INLINE bool relocate(const uint0 newCapacity) noexcept
+    requires(Handle::isResizable)
+    {
+        XS_ASSERT((newCapacity & (newCapacity - 1)) == 0);
+        XS_ASSERT(newCapacity >= length);
+        Handle newHandle(newCapacity);
+        if (newHandle.pointer == nullptr) [[unlikely]] {
+            return false;
+        }
+        // Use generic memory move so that we don't unnecessarily call constructors and destructors
+        const auto spans = getSpans();
+        memMove<Type, Handle::maxSize>(newHandle.pointer, spans.first.pointer, spans.first.length * sizeof(Type));
+        memMove<Type, Handle::maxSize>(
+            newHandle.pointer + spans.first.length, spans.second.pointer, spans.second.length * sizeof(Type));
+        Shift::swap(handle, newHandle);
+        head = 0;
+        capacity = newCapacity;
+        return true;
+    }
+
+private:
+    /**
+     * Wrap a position to be within the ring buffers slots.
+     * @param position The position to wrap.
+     * @returns The wrapped position.
+     */
+    XS_INLINE uint0 wrap(const uint0 position) const noexcept
+    {
+        return position & (capacity - 1);
+    }
+
+    /** Destruct all currently stored elements. */
+    XS_INLINE void destructAll() noexcept
+    {
+        const auto spans = getSpans();
+        memDestructRange<Type>(spans.first.pointer, spans.first.length * sizeof(Type));
+        memDestructRange<Type>(spans.second.pointer, spans.second.length * sizeof(Type));
+    }
+};
+} // namespace Shift
@@ -0,0 +1,57 @@
+#pragma once
+/**
+ * Copyright Matthew Oliver
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Memory/XSMemory.hpp"
+#include "XSUtility.hpp"
+
+namespace Shift::NoExport {
+/**
+ * Get the number of slots required for a ring of elements.
+ * @param number The number of elements.
+ * @returns The required capacity (power of 2).
+ */
+XS_INLINE constexpr uint0 ringCapacityFor(const uint0 number) noexcept
+{
+    uint0 ret = 4;
+    while (ret < number) {
+        ret <<= 1;
+    }
+    return ret;
+}
+
+/**
+ * Move elements out of the slots of a ring and destruct the originals.
+ * @tparam T Type of element stored within the ring.
+ * @param dest   The destination elements (must already be constructed).
+ * @param source The elements to move from.
+ * @param number The number of elements to move.
+ */
+template<typename T>
+XS_INLINE void ringMoveOut(T* XS_RESTRICT dest, T* XS_RESTRICT source, const uint0 number) noexcept
+{
+    if constexpr (isTriviallyCopyable<T>) {
+        memMove<T>(dest, source, number * sizeof(T));
+    } else {
+        for (uint0 i = number; i != 0; --i) {
+            *dest = move(*source);
+            memDestruct<T>(source);
+            ++dest;
+            ++source;
+        }
+    }
+}
+} // namespace Shift::NoExport
@@ -16,6 +16,7 @@
  */
 
 #include "Memory/XSArray.hpp"
+#include "Memory/XSSort.hpp"
 
 namespace Shift {
 /**
@@ -38,6 +39,8 @@ public:
     using Handle = typename IArray::Handle;
     using Allocator = typename IArray::Allocator;
 
+    uint0 pending = 0; /**< Number of unsorted elements at the end of the array that were added using addDeferred */
+
     /** Default constructor. */
     XS_INLINE SArray() noexcept
         : IArray()
@@ -59,6 +62,7 @@ public:
      */
     XS_INLINE SArray(const SArray& array) noexcept
         : IArray(array)
+        , pending(array.pending)
     {}
 
     /**
@@ -71,13 +75,19 @@ public:
     requires(isNothrowConstructible<Type, T2>)
     XS_INLINE explicit SArray(const SArray<T2, Alloc2>& array) noexcept
         : IArray(array)
+        , pending(array.pending)
     {}
 
     /**
      * Move constructor.
      * @param array The other array.
      */
-    XS_INLINE SArray(SArray&& array) noexcept = default;
+    XS_INLINE SArray(SArray&& array) noexcept
+        : IArray(forward<IArray>(array))
+        , pending(array.pending)
+    {
+        array.pending = 0;
+    }
 
     /**
      * Constructor to copy from a sub section of another array.
@@ -91,7 +101,9 @@ public:
     requires(isNothrowConstructible<Type, T2>)
     XS_INLINE SArray(const SArray<T2, Alloc2>& array, uint0 start, uint0 end) noexcept
         : IArray(array, start, end)
-    {}
+    {
+        XS_ASSERT(array.pending == 0);
+    }
 
     /**
      * Constructor.
@@ -101,7 +113,9 @@ public:
      */
     XS_INLINE SArray(const SArray& array, const TypeConstIterator& start, const TypeConstIterator& end) noexcept
         : IArray(array, start, end)
-    {}
+    {
+        XS_ASSERT(array.pending == 0);
+    }
 
     /**
      * Constructor to copy from a sub section of another array.
@@ -116,7 +130,9 @@ public:
     XS_INLINE SArray(const SArray<T2, Alloc2>& array, const typename SArray<T2, Alloc2>::TypeConstIterator& start,
         const typename SArray<T2, Alloc2>::TypeConstIterator& end) noexcept
         : IArray(array, start, end)
-    {}
+    {
+        XS_ASSERT(array.pending == 0);
+    }
 
     /** Destructor. */
     XS_INLINE ~SArray() noexcept = default;
@@ -131,6 +147,7 @@ public:
         XS_ASSERT(this->handle.pointer != array.handle.pointer);
         // Array equals operator handles error checking
         this->IArray::operator=(array);
+        pending = array.pending;
         return *this;
     }
 
@@ -147,6 +164,7 @@ public:
     {
         // Array equals operator handles error checking
         this->IArray::operator=(array);
+        pending = array.pending;
         return *this;
     }
 
@@ -159,6 +177,7 @@ public:
     {
         XS_ASSERT(this->handle.pointer != array.handle.pointer);
         this->IArray::operator=(forward<IArray>(array));
+        Shift::swap(pending, array.pending);
         return *this;
     }
 
@@ -175,6 +194,7 @@ public:
     {
         XS_ASSERT(this->handle.pointer != array.handle.pointer);
         this->IArray::operator=(forward<IArray>(array));
+        Shift::swap(pending, array.pending);
         return *this;
     }
 
@@ -192,6 +212,10 @@ public:
             this->IArray::insert(location, element);
         } else {
             this->IArray::add(element);
+            // Keep the element deferred if previously deferred elements could not be merged
+            if (pending > 0) [[unlikely]] {
+                ++pending;
+            }
         }
     }
 
@@ -213,9 +237,149 @@ public:
             this->IArray::insert(location, element);
         } else {
             this->IArray::add(element);
+            // Keep the element deferred if previously deferred elements could not be merged
+            if (pending > 0) [[unlikely]] {
+                ++pending;
+            }
         }
     }
 
+    /**
+     * Add a series of sorted elements to the array.
+     * @note The elements are merged into the array in a single backwards pass so that each existing element is moved
+     * at most once. This does not check if there is enough allocated space for the elements. This should only be used
+     * if you are sure space has been allocated already.
+     * @param elements The sorted elements to add to the array.
+     * @param number   The number of elements.
+     * @returns False if memory for merging previously deferred elements could not be allocated.
+     */
+    XS_INLINE bool addSorted(const Type* const XS_RESTRICT elements, const uint0 number) noexcept
+    {
+        XS_ASSERT(getSize() + number * sizeof(Type) <= getReservedSize());
+        if (!merge()) [[unlikely]] {
+            return false;
+        }
+        mergeSorted(elements, number);
+        return true;
+    }
+
+    /**
+     * Add a series of unsorted elements to the array.
+     * @note The elements are first sorted and then merged into the array in a single backwards pass. This does not
+     * check if there is enough allocated space for the elements. This should only be used if you are sure space has
+     * been allocated already.
+     * @param elements The elements to add to the array.
+     * @param number   The number of elements.
+     * @returns False if temporary memory required for sorting could not be allocated.
+     */
+    XS_INLINE bool addRange(const Type* const XS_RESTRICT elements, const uint0 number) noexcept
+    {
+        XS_ASSERT(getSize() + number * sizeof(Type) <= getReservedSize());
+        if (number == 0) [[unlikely]] {
+            return true;
+        }
+        if (!merge()) [[unlikely]] {
+            return false;
+        }
+        typename AllocRegionHeap<Type>::Handle temp(number);
+        if (temp.pointer == nullptr) [[unlikely]] {
+            return false;
+        }
+        memConstructRange<Type, Type, Handle::maxSize>(temp.pointer, elements, number * sizeof(Type));
+        sort<SortAlgorithm::Quick>(temp.pointer, temp.pointer + number);
+        mergeSorted(temp.pointer, number);
+        memDestructRange<Type>(temp.pointer, number * sizeof(Type));
+        return true;
+    }
+
+    /**
+     * Add an element to the end of the array without sorting it.
+     * @note The element is merged into the sorted elements the next time the array is searched (using add or
+     * findClosest) or merge is called. Any other operation that relies on sorted order (or removes elements) requires
+     * merge to be called first. This does not check if there is enough allocated space for the element. This should
+     * only be used if you are sure space has been allocated already.
+     * @param element The element to add to the array.
+     */
+    XS_INLINE void addDeferred(const Type& element) noexcept
+    {
+        this->IArray::add(element);
+        ++pending;
+    }
+
+    /**
+     * Add an element to the end of the array without sorting it using direct construction.
+     * @note The element is merged into the sorted elements the next time the array is searched (using add or
+     * findClosest) or merge is called. This does not check if there is enough allocated space for the element. This
+     * should only be used if you are sure space has been allocated already.
+     * @tparam Args Type of the arguments.
+     * @param values The values used to construct the new array element.
+     */
+    template<typename... Args>
+    requires(isNothrowConstructible<Type, Args...>)
+    XS_INLINE void addDeferred(Args&&... values) noexcept
+    {
+        this->IArray::add(forward<Args>(values)...);
+        ++pending;
+    }
+
+    /**
+     * Merge any elements added using addDeferred into their sorted positions.
+     * @returns False if temporary memory required for merging could not be allocated.
+     */
+    XS_INLINE bool merge() noexcept
+    {
+        if (pending == 0) [[likely]] {
+            return true;
+        }
+        const uint0 number = pending;
+        Type* XS_RESTRICT const tail = this->nextElement - number;
+        if (number > 1) {
+            sort<SortAlgorithm::Quick>(tail, this->nextElement);
+        }
+        // Nothing needs to be moved if the deferred elements already belong at the end
+        if (tail == this->handle.pointer || !(*tail < *(tail - 1))) {
+            pending = 0;
+            return true;
+        }
+        typename AllocRegionHeap<Type>::Handle temp(number);
+        if (temp.pointer == nullptr) [[unlikely]] {
+            return false;
+        }
+        for (uint0 i = 0; i < number; ++i) {
+            memConstruct<Type>(&temp.pointer[i], move(tail[i]));
+        }
+        memDestructRange<Type>(tail, number * sizeof(Type));
+        this->nextElement = tail;
+        pending = 0;
+        mergeSorted(temp.pointer, number);
+        memDestructRange<Type>(temp.pointer, number * sizeof(Type));
+        return true;
+    }
+
+    /** Removes all elements from the array. */
+    XS_INLINE void removeAll() noexcept
+    {
+        this->IArray::removeAll();
+        pending = 0;
+    }
+
+    /** Removes all elements from the array and deallocates any memory. */
+    XS_INLINE void clear() noexcept
+    {
+        this->IArray::clear();
+        pending = 0;
+    }
+
+    /**
+     * Swap the contents of two arrays around.
+     * @param [in,out] array SArray object to swap with this one.
+     */
+    XS_INLINE void swap(SArray& array) noexcept
+    {
+        this->IArray::swap(array);
+        Shift::swap(pending, array.pending);
+    }
+
     using IArray::at;
     using IArray::atBack;
     using IArray::atBegin;
@@ -223,7 +387,6 @@ public:
     using IArray::begin;
     using IArray::cbegin;
     using IArray::cend;
-    using IArray::clear;
     using IArray::end;
     using IArray::getLength;
     using IArray::getReservedLength;
@@ -238,20 +401,22 @@ public:
     using IArray::pop;
     using IArray::positionAt;
     using IArray::remove;
-    using IArray::removeAll;
     using IArray::setElements;
     using IArray::setReservedSize;
-    using IArray::swap;
 
     /**
      * Search for the position of the closest item greater or equal than a specified value.
      * @param element The element to search with.
-     * @return Iterator to the item larger than search item (or end of array if none found).
+     * @return Iterator to the item larger than search item (or end of array if none found or if deferred elements
+     * could not be merged).
      */
     template<typename T2>
     requires(isComparableOrdered<Type, T2>)
     XS_INLINE TypeIterator findClosest(const T2& element) noexcept
     {
+        if (!merge()) [[unlikely]] {
+            return end();
+        }
         // Search through looking for last element >= value
         TypeIterator first = begin();
         uint0 len = getLength();
@@ -268,5 +433,43 @@ public:
         }
         return first;
     }
+
+private:
+    /**
+     * Merge a series of sorted elements into the array.
+     * @tparam T2 Type of the input elements (a const type results in elements being copied instead of moved).
+     * @param elements The sorted elements to merge.
+     * @param number   The number of elements.
+     */
+    template<typename T2>
+    XS_INLINE void mergeSorted(T2* const XS_RESTRICT elements, const uint0 number) noexcept
+    {
+        // Merge backwards from the new end so that existing elements do not need to be moved out of the way first
+        Type* XS_RESTRICT const start = this->handle.pointer;
+        Type* XS_RESTRICT const oldEnd = this->nextElement;
+        Type* XS_RESTRICT current = oldEnd;
+        Type* XS_RESTRICT dest = oldEnd + number;
+        T2* XS_RESTRICT source = elements + number;
+        this->nextElement = dest;
+        while (source > elements) {
+            --dest;
+            // Equal elements are placed before existing ones to match add
+            if (current > start && !(*(current - 1) < *(source - 1))) {
+                --current;
+                if (dest >= oldEnd) {
+                    memConstruct<Type>(dest, move(*current));
+                } else {
+                    *dest = move(*current);
+                }
+            } else {
+                --source;
+                if (dest >= oldEnd) {
+                    memConstruct<Type>(dest, move(*source));
+                } else {
+                    *dest = move(*source);
+                }
+            }
+        }
+    }
 };
 } // namespace Shift
@@ -0,0 +1,438 @@
+#pragma once
+/**
+ * Copyright Matthew Oliver
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Memory/XSSArray.hpp"
+#include "XSBit.hpp"
+#include "XSLimits.hpp"
+
+namespace Shift {
+namespace NoExport {
+/**< Alignment (and size) of each search tree node, chosen to match a cache line */
+inline constexpr uint0 searchNodeAlign = 64;
+/**< Number of queries that are interleaved when performing a batch search */
+inline constexpr uint0 searchBatchWidth = 16;
+/**< Maximum number of tree layers that can be stored by an index */
+inline constexpr uint0 searchMaxLayers = 32;
+
+/**< Number of keys stored in each search tree node */
+template<typename T>
+inline constexpr uint0 searchNodeWidth = searchNodeAlign / sizeof(T);
+
+/**< Whether a type can be compared using SIMD instructions */
+template<typename T>
+inline constexpr bool searchHasSIMD = isSame<T, float32> || isSame<T, float64> || (!isFloat<T> && sizeof(T) <= 8);
+
+/**
+ * Get the value used to pad unused keys in a search tree node.
+ * @tparam T Generic type parameter.
+ * @returns A value that no search value can be greater than.
+ */
+template<typename T>
+XS_INLINE T searchPadValue() noexcept
+{
+    if constexpr (isFloat<T>) {
+        // Use infinity so that infinite search values are handled correctly
+        return static_cast<T>(bitCast<float64>(0x7FF0000000000000_ui64));
+    } else {
+        return Limits<T>::Max();
+    }
+}
+
+#if XS_ISA == XS_X86
+/**
+ * Broadcast an integer value to all elements of a 256b register.
+ * @tparam T Generic type parameter.
+ * @param value The value to broadcast.
+ * @returns The broadcast register.
+ */
+template<typename T>
+XS_INLINE __m256i searchBroadcast256(const T value) noexcept
+{
+    if constexpr (sizeof(T) == 1) {
+        return _mm256_set1_epi8(static_cast<int8>(value));
+    } else if constexpr (sizeof(T) == 2) {
+        return _mm256_set1_epi16(static_cast<int16>(value));
+    } else if constexpr (sizeof(T) == 4) {
+        return _mm256_set1_epi32(static_cast<int32>(value));
+    } else {
+        return _mm256_set1_epi64x(static_cast<int64>(value));
+    }
+}
+
+/**
+ * Broadcast an integer value to all elements of a 128b register.
+ * @tparam T Generic type parameter.
+ * @param value The value to broadcast.
+ * @returns The broadcast register.
+ */
+template<typename T>
+XS_INLINE __m128i searchBroadcast128(const T value) noexcept
+{
+    if constexpr (sizeof(T) == 1) {
+        return _mm_set1_epi8(static_cast<int8>(value));
+    } else if constexpr (sizeof(T) == 2) {
+        return _mm_set1_epi16(static_cast<int16>(value));
+    } else if constexpr (sizeof(T) == 4) {
+        return _mm_set1_epi32(static_cast<int32>(value));
+    } else {
+        return _mm_set1_epi64x(static_cast<int64>(value));
+    }
+}
+
+/**
+ * Count the number of keys in a 256b block that are less than a value.
+ * @tparam T Generic type parameter.
+ * @param keys  The keys to compare.
+ * @param value The value to compare against.
+ * @returns The number of keys less than value.
+ */
+template<typename T>
+XS_INLINE uint32 searchCountLess256(const T* const XS_RESTRICT keys, const T value) noexcept
+{
+    if constexpr (isSame<T, float32>) {
+        return popcnt(static_cast<uint32>(
+            _mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(keys), _mm256_set1_ps(value), _CMP_LT_OQ))));
+    } else if constexpr (isSame<T, float64>) {
+        return popcnt(static_cast<uint32>(
+            _mm256_movemask_pd(_mm256_cmp_pd(_mm256_loadu_pd(keys), _mm256_set1_pd(value), _CMP_LT_OQ))));
+    } else {
+        __m256i keyValues = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(keys));
+        __m256i compare = searchBroadcast256(value);
+        if constexpr (!isSigned<T>) {
+            // Flip the sign bit so that a signed comparison can be used
+            const __m256i flip = searchBroadcast256(static_cast<T>(static_cast<T>(1) << (sizeof(T) * 8 - 1)));
+            keyValues = _mm256_xor_si256(keyValues, flip);
+            compare = _mm256_xor_si256(compare, flip);
+        }
+        __m256i less;
+        if constexpr (sizeof(T) == 1) {
+            less = _mm256_cmpgt_epi8(compare, keyValues);
+        } else if constexpr (sizeof(T) == 2) {
+            less = _mm256_cmpgt_epi16(compare, keyValues);
+        } else if constexpr (sizeof(T) == 4) {
+            less = _mm256_cmpgt_epi32(compare, keyValues);
+        } else {
+            less = _mm256_cmpgt_epi64(compare, keyValues);
+        }
+        return popcnt(static_cast<uint32>(_mm256_movemask_epi8(less))) / static_cast<uint32>(sizeof(T));
+    }
+}
+
+/**
+ * Count the number of keys in a 128b block that are less than a value.
+ * @tparam T Generic type parameter.
+ * @param keys  The keys to compare.
+ * @param value The value to compare against.
+ * @returns The number of keys less than value.
+ */
+template<typename T>
+XS_INLINE uint32 searchCountLess128(const T* const XS_RESTRICT keys, const T value) noexcept
+{
+    if constexpr (isSame<T, float32>) {
+        return popcnt(static_cast<uint32>(_mm_movemask_ps(_mm_cmplt_ps(_mm_loadu_ps(keys), _mm_set1_ps(value)))));
+    } else if constexpr (isSame<T, float64>) {
+        return popcnt(static_cast<uint32>(_mm_movemask_pd(_mm_cmplt_pd(_mm_loadu_pd(keys), _mm_set1_pd(value)))));
+    } else {
+        __m128i keyValues = _mm_loadu_si128(reinterpret_cast<const __m128i*>(keys));
+        __m128i compare = searchBroadcast128(value);
+        if constexpr (!isSigned<T>) {
+            // Flip the sign bit so that a signed comparison can be used
+            const __m128i flip = searchBroadcast128(static_cast<T>(static_cast<T>(1) << (sizeof(T) * 8 - 1)));
+            keyValues = _mm_xor_si128(keyValues, flip);
+            compare = _mm_xor_si128(compare, flip);
+        }
+        __m128i less;
+        if constexpr (sizeof(T) == 1) {
+            less = _mm_cmpgt_epi8(compare, keyValues);
+        } else if constexpr (sizeof(T) == 2) {
+            less = _mm_cmpgt_epi16(compare, keyValues);
+        } else if constexpr (sizeof(T) == 4) {
+            less = _mm_cmpgt_epi32(compare, keyValues);
+        } else {
+            less = _mm_cmpgt_epi64(compare, keyValues);
+        }
+        return popcnt(static_cast<uint32>(_mm_movemask_epi8(less))) / static_cast<uint32>(sizeof(T));
+    }
+}
+#endif
+
+/**
+ * Count the number of keys in a full search node that are less than a value.
+ * @tparam T Generic type parameter.
+ * @param keys  The keys stored in the node.
+ * @param value The value to compare against.
+ * @returns The number of keys less than value.
+ */
+template<typename T>
+XS_INLINE uint32 searchNodeRank(const T* const XS_RESTRICT keys, const T value) noexcept
+{
+    constexpr uint0 width = searchNodeWidth<T>;
+#if XS_ISA == XS_X86
+    if constexpr (hasISAFeature<ISAFeature::AVX2> && searchHasSIMD<T>) {
+        uint32 ret = 0;
+        for (uint0 i = 0; i < width; i += 32 / sizeof(T)) {
+            ret += searchCountLess256(keys + i, value);
+        }
+        return ret;
+    } else if constexpr (hasISAFeature<ISAFeature::SSE2> && searchHasSIMD<T> &&
+        (sizeof(T) < 8 || isFloat<T> || hasISAFeature<ISAFeature::SSE42>)) {
+        uint32 ret = 0;
+        for (uint0 i = 0; i < width; i += 16 / sizeof(T)) {
+            ret += searchCountLess128(keys + i, value);
+        }
+        return ret;
+    } else
+#endif
+    {
+        uint32 ret = 0;
+        for (uint0 i = 0; i < width; ++i) {
+            ret += static_cast<uint32>(keys[i] < value);
+        }
+        return ret;
+    }
+}
+
+/**
+ * Request that the cache line containing an address be loaded.
+ * @param address The address to prefetch.
+ */
+XS_INLINE void searchPrefetch(const void* const address) noexcept
+{
+#if XS_ISA == XS_X86
+    if constexpr (hasISAFeature<ISAFeature::SSE>) {
+        _mm_prefetch(static_cast<const char*>(address), _MM_HINT_T0);
+    }
+#else
+    (void)address;
+#endif
+}
+} // namespace NoExport
+
+/**
+ * Search index used to accelerate lookups into a large sorted array.
+ * @note The index stores separator keys in a cache line sized static B-tree (each node contains 64B of keys) and uses
+ * the sorted array itself as the leaf layer. A search only touches one cache line per tree layer and each node is
+ * compared using SIMD instructions. The index references the source arrays memory so must be rebuilt whenever the
+ * array is modified.
+ * @tparam T     Type of element stored within the indexed array.
+ * @tparam Alloc Type of allocator used to allocate the index nodes.
+ */
+template<typename T, class Alloc = AllocRegionHeap<T>>
+requires(isArithmetic<T>)
+class SArrayIndex
+{
+public:
+    using Type = T;
+    using Allocator = typename Alloc::template Allocator<Type, NoExport::searchNodeAlign>;
+    using Handle = typename Allocator::Handle;
+
+    static_assert(Handle::isResizable, "SArrayIndex requires a resizable allocator");
+
+    static constexpr uint0 nodeWidth = NoExport::searchNodeWidth<Type>;
+
+    Handle handle;                                 /**< The handle used to store tree nodes */
+    const Type* XS_RESTRICT data = nullptr;        /**< The sorted data used as the leaf layer */
+    uint0 length = 0;                              /**< Number of elements in the sorted data */
+    uint0 layers = 0;                              /**< Number of tree layers above the leaf layer */
+    uint0 offsets[NoExport::searchMaxLayers] = {}; /**< The node offset of each layer (root first) */
+
+    /** Default constructor. */
+    XS_INLINE SArrayIndex() noexcept = default;
+
+    /**
+     * Constructor that builds an index for an existing sorted array.
+     * @tparam Alloc2 Type of allocator used by the array.
+     * @param array The array to index.
+     */
+    template<typename Alloc2>
+    explicit XS_INLINE SArrayIndex(const SArray<Type, Alloc2>& array) noexcept
+    {
+        build(array);
+    }
+
+    /**
+     * Move constructor.
+     * @param other The other index.
+     */
+    XS_INLINE SArrayIndex(SArrayIndex&& other) noexcept = default;
+
+    /** Destructor. */
+    XS_INLINE ~SArrayIndex() noexcept = default;
+
+    /**
+     * Move assignment operator.
+     * @param other The other index.
+     * @returns A shallow copy of this object.
+     */
+    XS_INLINE SArrayIndex& operator=(SArrayIndex&& other) noexcept = default;
+
+    /**
+     * Builds the index for a sorted array.
+     * @note Any previous index contents are replaced.
+     * @tparam Alloc2 Type of allocator used by the array.
+     * @param array The array to index.
+     * @returns False if memory allocation failed.
+     */
+    template<typename Alloc2>
+    XS_INLINE bool build(const SArray<Type, Alloc2>& array) noexcept
+    {
+        return build(array.handle.pointer, array.getLength());
+    }
+
+    /**
+     * Builds the index for a sorted sequence of elements.
+     * @note Any previous index contents are replaced.
+     * @param elements Pointer to the sorted elements.
+     * @param number   The number of elements.
+     * @returns False if memory allocation failed.
+     */
+    XS_INLINE bool build(const Type* const elements, const uint0 number) noexcept
+    {
+        data = elements;
+        length = number;
+        layers = 0;
+
+        // Determine the number of nodes in each layer from the leaves upwards
+        uint0 nodes[NoExport::searchMaxLayers];
+        uint0 count = (number + nodeWidth - 1) / nodeWidth;
+        while (count > 1) {
+            count = (count + nodeWidth) / (nodeWidth + 1);
+            nodes[layers++] = count;
+        }
+        uint0 total = 0;
+        for (uint0 i = 0; i < layers; ++i) {
+            offsets[i] = total;
+            total += nodes[layers - i - 1];
+        }
+        if (total == 0) {
+            handle.unallocate();
+            return true;
+        }
+        if (!handle.reallocate(total * nodeWidth * sizeof(Type), 0)) [[unlikely]] {
+            layers = 0;
+            return false;
+        }
+
+        // Each key is the first element in the subtree to its right
+        const Type pad = NoExport::searchPadValue<Type>();
+        for (uint0 layer = 0; layer < layers; ++layer) {
+            Type* XS_RESTRICT keys = handle.pointer + offsets[layer] * nodeWidth;
+            const uint0 layerNodes = nodes[layers - layer - 1];
+            for (uint0 node = 0; node < layerNodes; ++node) {
+                for (uint0 key = 0; key < nodeWidth; ++key) {
+                    uint0 leaf = node * (nodeWidth + 1) + key + 1;
+                    for (uint0 i = layer + 1; i < layers; ++i) {
+                        leaf *= nodeWidth + 1;
+                    }
+                    const uint0 index = leaf * nodeWidth;
+                    *keys++ = (index < number) ? data[index] : pad;
+                }
+            }
+        }
+        return true;
+    }
+
+    /**
+     * Checks whether the index references any data.
+     * @returns True if valid, false if not.
+     */
+    XS_INLINE bool isValid() const noexcept
+    {
+        return data != nullptr;
+    }
+
+    /**
+     * Gets the number of elements covered by the index.
+     * @returns The length.
+     */
+    XS_INLINE uint0 getLength() const noexcept
+    {
+        return length;
+    }
+
+    /**
+     * Search for the position of the closest item greater or equal than a specified value.
+     * @note This returns the same position as SArray::findClosest.
+     * @param element The element to search with.
+     * @returns Position of the first item not less than the search item (or length if none found).
+     */
+    XS_INLINE uint0 findClosest(const Type& element) const noexcept
+    {
+        uint0 node = 0;
+        for (uint0 layer = 0; layer < layers; ++layer) {
+            const Type* keys = handle.pointer + (offsets[layer] + node) * nodeWidth;
+            node = node * (nodeWidth + 1) + NoExport::searchNodeRank(keys, element);
+        }
+        return leafRank(node, element);
+    }
+
+    /**
+     * Search for the positions of multiple items at once.
+     * @note Searches are interleaved so that memory accesses for each search overlap with one another.
+     * @param       elements The elements to search with.
+     * @param       number   The number of elements.
+     * @param [out] results  The position returned by findClosest for each element.
+     */
+    XS_INLINE void findClosest(
+        const Type* const XS_RESTRICT elements, const uint0 number, uint0* const XS_RESTRICT results) const noexcept
+    {
+        for (uint0 base = 0; base < number; base += NoExport::searchBatchWidth) {
+            const uint0 count = min(NoExport::searchBatchWidth, number - base);
+            uint0 nodes[NoExport::searchBatchWidth] = {};
+            for (uint0 layer = 0; layer < layers; ++layer) {
+                const Type* XS_RESTRICT keys = handle.pointer + offsets[layer] * nodeWidth;
+                for (uint0 i = 0; i < count; ++i) {
+                    nodes[i] = nodes[i] * (nodeWidth + 1) +
+                        NoExport::searchNodeRank(keys + nodes[i] * nodeWidth, elements[base + i]);
+                    // Request the next node while the remaining searches in the batch are processed
+                    if (layer + 1 < layers) {
+                        NoExport::searchPrefetch(handle.pointer + (offsets[layer + 1] + nodes[i]) * nodeWidth);
+                    } else if (nodes[i] * nodeWidth < length) {
+                        NoExport::searchPrefetch(data + nodes[i] * nodeWidth);
+                    }
+                }
+            }
+            for (uint0 i = 0; i < count; ++i) {
+                results[base + i] = leafRank(nodes[i], elements[base + i]);
+            }
+        }
+    }
+
+private:
+    /**
+     * Find the position of a value within a leaf block.
+     * @param node    The leaf block to search.
+     * @param element The element to search with.
+     * @returns Position of the first item not less than the search item.
+     */
+    XS_INLINE uint0 leafRank(const uint0 node, const Type& element) const noexcept
+    {
+        const uint0 start = node * nodeWidth;
+        if (start >= length) [[unlikely]] {
+            return length;
+        }
+        if (start + nodeWidth <= length) [[likely]] {
+            return start + NoExport::searchNodeRank(data + start, element);
+        }
+        uint0 ret = start;
+        while (ret < length && data[ret] < element) {
+            ++ret;
+        }
+        return ret;
+    }
+};
+} // namespace Shift
@@ -0,0 +1,473 @@
+#pragma once
+/**
+ * Copyright Matthew Oliver
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Memory/XSDArray.hpp"
+
+namespace Shift {
+/**
+ * Key used to reference an element stored within a slot map.
+ * @note The key packs a slot index and the generation of the slot at the time the element was added. A 32bit key uses
+ * 20 bits for the index and 12 bits for the generation, a 64bit key uses 32 bits for each.
+ * @tparam T Type of integer used to store the key (uint32 or uint64).
+ */
+template<typename T>
+requires(isSameAny<T, uint32, uint64>)
+class SlotMapKey
+{
+public:
+    using Type = T;
+
+    /**< Number of bits used to store the slot index */
+    static constexpr uint32 indexBits = sizeof(Type) == 4 ? 20 : 32;
+    /**< Mask of the slot index, this is also the maximum number of slots */
+    static constexpr Type indexMask = (static_cast<Type>(1) << indexBits) - 1;
+    /**< Mask of the generation after it has been shifted down */
+    static constexpr Type generationMask = Limits<Type>::Max() >> indexBits;
+
+    Type value = Limits<Type>::Max(); /**< The packed slot index and generation */
+
+    /** Default constructor (creates an invalid key). */
+    XS_INLINE SlotMapKey() noexcept = default;
+
+    /**
+     * Constructor from packed value.
+     * @param valueIn The packed slot index and generation.
+     */
+    XS_INLINE explicit SlotMapKey(const Type valueIn) noexcept
+        : value(valueIn)
+    {}
+
+    /**
+     * Constructor from slot index and generation.
+     * @param index      The slot index.
+     * @param generation The generation of the slot.
+     */
+    XS_INLINE SlotMapKey(const uint32 index, const uint32 generation) noexcept
+        : value(static_cast<Type>(index) | (static_cast<Type>(generation) << indexBits))
+    {
+        XS_ASSERT(index < indexMask);
+        XS_ASSERT(generation <= generationMask);
+    }
+
+    /**
+     * Check if the key could reference an element.
+     * @note This does not check if the referenced element still exists, use SlotMap::isValid for that.
+     * @returns True if valid, false if the key was default constructed.
+     */
+    XS_INLINE bool isValid() const noexcept
+    {
+        return value != Limits<Type>::Max();
+    }
+
+    /**
+     * Get the slot index.
+     * @returns The index.
+     */
+    XS_INLINE uint32 getIndex() const noexcept
+    {
+        return static_cast<uint32>(value & indexMask);
+    }
+
+    /**
+     * Get the slot generation.
+     * @returns The generation.
+     */
+    XS_INLINE uint32 getGeneration() const noexcept
+    {
+        return static_cast<uint32>(value >> indexBits);
+    }
+
+    /**
+     * Equality operator.
+     * @param other The other key.
+     * @returns The result of the operation.
+     */
+    XS_INLINE bool operator==(const SlotMapKey& other) const noexcept
+    {
+        return value == other.value;
+    }
+
+    /**
+     * Inequality operator.
+     * @param other The other key.
+     * @returns The result of the operation.
+     */
+    XS_INLINE bool operator!=(const SlotMapKey& other) const noexcept
+    {
+        return value != other.value;
+    }
+};
+
+namespace NoExport {
+/** Indirection slot used by a slot map. */
+class SlotMapSlot
+{
+public:
+    uint32 index;      /**< Position of the element if alive, otherwise the next free slot */
+    uint32 generation; /**< Incremented every time the element in the slot is removed */
+};
+} // namespace NoExport
+
+/**
+ * Container that provides stable keys to elements while keeping all elements densely packed.
+ * @note Elements are stored contiguously so iteration is identical to iterating a DArray. Keys reference a slot which
+ * stores the current position of the element. When an element is removed the last element is moved into its place and
+ * its slot updated. Removed slots are reused through a free list that is stored within the unused slots themselves and
+ * each slot has a generation counter that is incremented on removal so that keys to removed elements are detected.
+ * @tparam T     Type of element stored within the map.
+ * @tparam Alloc Type of allocator used to allocate elements.
+ * @tparam K     Type of integer used to store keys (uint32 or uint64).
+ */
+template<typename T, class Alloc = AllocRegionHeap<T>, typename K = uint64>
+class SlotMap
+{
+public:
+    using Type = T;
+    using Key = SlotMapKey<K>;
+    using Slot = NoExport::SlotMapSlot;
+    using ElementArray = DArray<Type, Alloc>;
+    using SlotArray = DArray<Slot, typename Alloc::template Allocator<Slot>>;
+    using IndexArray = DArray<uint32, typename Alloc::template Allocator<uint32>>;
+    using TypeIterator = typename ElementArray::TypeIterator;
+    using TypeConstIterator = typename ElementArray::TypeConstIterator;
+
+    /**< Index used to mark the end of the free list */
+    static constexpr uint32 invalidIndex = Limits<uint32>::Max();
+
+    ElementArray elements;          /**< Densely packed elements */
+    IndexArray elementSlots;        /**< Slot used by each element */
+    SlotArray slots;                /**< Indirection slots referenced by keys */
+    uint32 freeHead = invalidIndex; /**< First unused slot */
+
+    /** Default constructor. */
+    XS_INLINE SlotMap() noexcept = default;
+
+    /**
+     * Constructor that reserves space for a number of elements.
+     * @param number The number of elements to reserve space for.
+     */
+    XS_INLINE explicit SlotMap(const uint0 number) noexcept
+        : elements(number)
+        , elementSlots(number)
+        , slots(number)
+    {}
+
+    /**
+     * Copy constructor.
+     * @param other The other map.
+     */
+    XS_INLINE SlotMap(const SlotMap& other) noexcept = default;
+
+    /**
+     * Move constructor.
+     * @param other The other map.
+     */
+    XS_INLINE SlotMap(SlotMap&& other) noexcept
+        : elements(move(other.elements))
+        , elementSlots(move(other.elementSlots))
+        , slots(move(other.slots))
+        , freeHead(other.freeHead)
+    {
+        other.freeHead = invalidIndex;
+    }
+
+    /** Destructor. */
+    XS_INLINE ~SlotMap() noexcept = default;
+
+    /**
+     * Assignment operator.
+     * @param other The other map.
+     * @returns A deep copy of this object.
+     */
+    XS_INLINE SlotMap& operator=(const SlotMap& other) noexcept = default;
+
+    /**
+     * Move assignment operator.
+     * @param other The other map.
+     * @returns A shallow copy of this object.
+     */
+    XS_INLINE SlotMap& operator=(SlotMap&& other) noexcept
+    {
+        swap(other);
+        return *this;
+    }
+
+    /**
+     * Swap the contents of two maps around.
+     * @param [in,out] other The map to swap with this one.
+     */
+    XS_INLINE void swap(SlotMap& other) noexcept
+    {
+        elements.swap(other.elements);
+        elementSlots.swap(other.elementSlots);
+        slots.swap(other.slots);
+        Shift::swap(freeHead, other.freeHead);
+    }
+
+    /**
+     * Checks whether the map has any allocated memory.
+     * @returns True if valid, false if not.
+     */
+    XS_INLINE bool isValid() const noexcept
+    {
+        return elements.isValid();
+    }
+
+    /**
+     * Check if a key references an element that is still stored within the map.
+     * @param key The key to check.
+     * @returns True if valid, false if the element has been removed.
+     */
+    XS_INLINE bool isValid(const Key key) const noexcept
+    {
+        const uint32 index = key.getIndex();
+        return index < slots.getLength() && slots.at(index).generation == key.getGeneration();
+    }
+
+    /**
+     * Check if the map is empty or not.
+     * @returns Boolean signaling if map is empty.
+     */
+    XS_INLINE bool isEmpty() const noexcept
+    {
+        return elements.isEmpty();
+    }
+
+    /**
+     * Get the number of elements in the map.
+     * @returns The number of elements currently stored within the map.
+     */
+    XS_INLINE uint0 getLength() const noexcept
+    {
+        return elements.getLength();
+    }
+
+    /**
+     * Get the number of elements currently reserved for.
+     * @returns The number of elements that can be stored before the map must be reallocated.
+     */
+    XS_INLINE uint0 getReservedLength() const noexcept
+    {
+        return elements.getReservedLength();
+    }
+
+    /**
+     * Manually set the number of elements to reserve for.
+     * @note This will not reduce the reserved size below what is needed to hold the current elements.
+     * @param number The number of elements to reserve space for.
+     * @returns Boolean signaling if new memory could be reserved.
+     */
+    XS_INLINE bool setReservedLength(const uint0 number) noexcept
+    {
+        return elements.setReservedLength(number) && elementSlots.setReservedLength(number) &&
+            slots.setReservedLength(number > slots.getLength() ? number : slots.getLength());
+    }
+
+    /**
+     * Add an element to the map.
+     * @tparam Args Type of the arguments used to construct the element.
+     * @param values The values used to construct the element.
+     * @returns The key used to reference the new element, this is invalid if memory could not be allocated.
+     */
+    template<typename... Args>
+    requires(isNothrowConstructible<Type, Args...>)
+    XS_INLINE Key add(Args&&... values) noexcept
+    {
+        if (freeHead == invalidIndex &&
+            (slots.getLength() >= Key::indexMask || !slots.checkAddReservedLength(1))) [[unlikely]] {
+            return Key();
+        }
+        if (!elements.checkAddReservedLength(1) || !elementSlots.checkAddReservedLength(1)) [[unlikely]] {
+            return Key();
+        }
+
+        // Reuse a free slot if available
+        uint32 index = freeHead;
+        if (index != invalidIndex) {
+            freeHead = slots.at(index).index;
+        } else {
+            index = static_cast<uint32>(slots.getLength());
+            slots.addUnChecked(Slot{0, 0});
+        }
+        Slot& slot = slots.at(index);
+        slot.index = static_cast<uint32>(elements.getLength());
+        elements.addUnChecked(forward<Args>(values)...);
+        elementSlots.addUnChecked(index);
+        return Key(index, slot.generation);
+    }
+
+    /**
+     * Remove an element from the map.
+     * @note The last element is moved into the position of the removed element so any pointers or iterators to the
+     * last element will no longer be valid. Keys remain valid.
+     * @param key The key of the element to remove.
+     * @returns True if the element was removed, false if the key is no longer valid.
+     */
+    XS_INLINE bool remove(const Key key) noexcept
+    {
+        if (!isValid(key)) [[unlikely]] {
+            return false;
+        }
+        const uint32 index = key.getIndex();
+        Slot& slot = slots.at(index);
+        const uint32 position = slot.index;
+        const uint32 last = static_cast<uint32>(elements.getLength() - 1);
+        if (position != last) {
+            // Move the last element into the removed elements position
+            elements.at(position) = move(elements.at(last));
+            const uint32 lastSlot = elementSlots.at(last);
+            elementSlots.at(position) = lastSlot;
+            slots.at(lastSlot).index = position;
+        }
+        elements.remove();
+        elementSlots.remove();
+        freeSlot(index);
+        return true;
+    }
+
+    /** Remove all elements from the map. */
+    XS_INLINE void removeAll() noexcept
+    {
+        for (const auto& i : elementSlots) {
+            freeSlot(i);
+        }
+        elements.removeAll();
+        elementSlots.removeAll();
+    }
+
+    /**
+     * Get an element.
+     * @param key The key of the element.
+     * @returns Pointer to the element, nullptr if the key is no longer valid.
+     */
+    XS_INLINE Type* find(const Key key) noexcept
+    {
+        return isValid(key) ? &elements.at(slots.at(key.getIndex()).index) : nullptr;
+    }
+
+    /**
+     * Get an element.
+     * @param key The key of the element.
+     * @returns Pointer to the element, nullptr if the key is no longer valid.
+     */
+    XS_INLINE const Type* find(const Key key) const noexcept
+    {
+        return isValid(key) ? &elements.at(slots.at(key.getIndex()).index) : nullptr;
+    }
+
+    /**
+     * Get an element.
+     * @param key The key of the element (must be valid).
+     * @returns The requested element.
+     */
+    XS_INLINE Type& at(const Key key) noexcept
+    {
+        XS_ASSERT(isValid(key));
+        return elements.at(slots.at(key.getIndex()).index);
+    }
+
+    /**
+     * Get an element.
+     * @param key The key of the element (must be valid).
+     * @returns The requested element.
+     */
+    XS_INLINE const Type& at(const Key key) const noexcept
+    {
+        XS_ASSERT(isValid(key));
+        return elements.at(slots.at(key.getIndex()).index);
+    }
+
+    /**
+     * Get the key of an element from its position within the densely packed elements.
+     * @param position The location of the element.
+     * @returns The key used to reference the element.
+     */
+    XS_INLINE Key getKey(const uint0 position) const noexcept
+    {
+        const uint32 index = elementSlots.at(position);
+        return Key(index, slots.at(index).generation);
+    }
+
+    /**
+     * Get the densely packed elements.
+     * @returns Pointer to the first element.
+     */
+    XS_INLINE Type* getData() noexcept
+    {
+        return elements.getData();
+    }
+
+    /**
+     * Get the densely packed elements.
+     * @returns Pointer to the first element.
+     */
+    XS_INLINE const Type* getData() const noexcept
+    {
+        return elements.getData();
+    }
+
+    /**
+     * Get an iterator to the first element.
+     * @returns The iterator.
+     */
+    XS_INLINE TypeIterator begin() noexcept
+    {
+        return elements.begin();
+    }
+
+    /**
+     * Get an iterator to the first element.
+     * @returns The iterator.
+     */
+    XS_INLINE TypeConstIterator begin() const noexcept
+    {
+        return elements.begin();
+    }
+
+    /**
+     * Get an iterator to the end of the elements.
+     * @returns The iterator.
+     */
+    XS_INLINE TypeIterator end() noexcept
+    {
+        return elements.end();
+    }
+
+    /**
+     * Get an iterator to the end of the elements.
+     * @returns The iterator.
+     */
+    XS_INLINE TypeConstIterator end() const noexcept
+    {
+        return elements.end();
+    }
+
+private:
+    /**
+     * Invalidate a slot and add it to the free list.
+     * @param index The slot index.
+     */
+    XS_INLINE void freeSlot(const uint32 index) noexcept
+    {
+        Slot& slot = slots.at(index);
+        // Wrap the generation so that it always fits within a key
+        slot.generation = static_cast<uint32>((slot.generation + 1) & Key::generationMask);
+        slot.index = freeHead;
+        freeHead = index;
+    }
+};
+} // namespace Shift
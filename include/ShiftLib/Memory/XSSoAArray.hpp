@@ -0,0 +1,614 @@
+#pragma once
+/**
+ * Copyright Matthew Oliver
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Memory/XSAllocatorHeap.hpp"
+#include "SIMD/XSSIMD16.hpp"
+#include "SIMD/XSSIMD4.hpp"
+#include "SIMD/XSSIMD8.hpp"
+
+namespace Shift {
+namespace NoExport {
+/**
+ * Get the type of a field within a list of fields.
+ * @tparam Index  The index of the field.
+ * @tparam T      Type of the first field.
+ * @tparam Fields Type of the remaining fields.
+ */
+template<uint0 Index, typename T, typename... Fields>
+class SoAArrayField
+{
+public:
+    using Type = typename SoAArrayField<Index - 1, Fields...>::Type;
+};
+
+template<typename T, typename... Fields>
+class SoAArrayField<0, T, Fields...>
+{
+public:
+    using Type = T;
+};
+
+/**
+ * Get the SIMD type used to operate on a block of elements.
+ * @tparam T    Type of element stored within the block.
+ * @tparam Size Number of elements in the block (4, 8 or 16).
+ */
+template<typename T, uint32 Size>
+class SoAArrayBlock
+{
+public:
+    using Type = conditional<Size == 4, SIMD4<T>, conditional<Size == 8, SIMD8<T>, SIMD16<T>>>;
+    using Data = conditional<Size == 4, SIMD4Data<T>, conditional<Size == 8, SIMD8Data<T>, SIMD16Data<T>>>;
+};
+} // namespace NoExport
+
+/**
+ * Dynamic array that stores each field of its elements in a separate buffer (structure of arrays).
+ * @note All field buffers are stored within a single allocation where each buffer starts on its own cache line. The
+ * reserved length is always padded to a multiple of the largest SIMD block so that SIMD4/SIMD8/SIMD16 blocks can
+ * always be loaded and stored in full even for the last partially filled block. The values of any padding elements
+ * are unspecified and should be ignored using the block length or mask.
+ * @tparam Alloc  Type of allocator used to allocate the field buffers.
+ * @tparam Fields Type of each field stored within the array.
+ */
+template<class Alloc, typename... Fields>
+class SoAArrayAlloc
+{
+public:
+    /**< Alignment of each field buffer */
+    static constexpr uint0 alignment = 64;
+    /**< Number of elements the reserved length is padded to a multiple of */
+    static constexpr uint0 blockPadding = 16;
+    /**< Number of fields in each element */
+    static constexpr uint0 fieldCount = sizeof...(Fields);
+
+    static_assert(fieldCount > 0, "SoAArray requires at least 1 field");
+    static_assert((isArithmetic<Fields> && ...), "SoAArray fields must be arithmetic types");
+
+    using Allocator = typename Alloc::template Allocator<uint8, alignment>;
+    using Handle = typename Allocator::Handle;
+
+    static_assert(Handle::isResizable, "SoAArray requires a resizable allocator");
+
+    template<uint0 Field>
+    using FieldType = typename NoExport::SoAArrayField<Field, Fields...>::Type;
+
+    template<uint0 Field, uint32 Size = 4>
+    using Block = typename NoExport::SoAArrayBlock<FieldType<Field>, Size>::Type;
+
+    template<uint0 Field, uint32 Size = 4>
+    using BlockData = typename NoExport::SoAArrayBlock<FieldType<Field>, Size>::Data;
+
+    Handle handle;      /**< The handle used to store all field buffers */
+    uint0 length = 0;   /**< Number of elements currently stored */
+    uint0 capacity = 0; /**< Number of elements that each field buffer can store */
+
+    /** Default constructor. */
+    XS_INLINE SoAArrayAlloc() noexcept = default;
+
+    /**
+     * Constructor that reserves space for a number of elements.
+     * @note The reserved space is rounded up to a multiple of blockPadding.
+     * @param number The number of elements to reserve space for.
+     */
+    explicit XS_INLINE SoAArrayAlloc(const uint0 number) noexcept
+        : handle(getAllocationSize(capacityFor(number)))
+    {
+        if (handle.pointer != nullptr) [[likely]] {
+            capacity = capacityFor(number);
+        }
+    }
+
+    /**
+     * Copy constructor.
+     * @param other The other array.
+     */
+    XS_INLINE SoAArrayAlloc(const SoAArrayAlloc& other) noexcept
+        : handle(getAllocationSize(other.capacity))
+    {
+        if (handle.pointer != nullptr) [[likely]] {
+            capacity = other.capacity;
+            length = other.length;
+            other.relocateFields<0>(handle.pointer, capacity);
+        }
+    }
+
+    /**
+     * Move constructor.
+     * @param other The other array.
+     */
+    XS_INLINE SoAArrayAlloc(SoAArrayAlloc&& other) noexcept
+        : handle(move(other.handle))
+        , length(other.length)
+        , capacity(other.capacity)
+    {
+        other.length = 0;
+        other.capacity = 0;
+    }
+
+    /** Destructor. */
+    XS_INLINE ~SoAArrayAlloc() noexcept = default;
+
+    /**
+     * Assignment operator.
+     * @param other The other array.
+     * @returns A deep copy of this object.
+     */
+    XS_INLINE SoAArrayAlloc& operator=(const SoAArrayAlloc& other) noexcept
+    {
+        if (this != &other) [[likely]] {
+            SoAArrayAlloc temp(other);
+            swap(temp);
+        }
+        return *this;
+    }
+
+    /**
+     * Move assignment operator.
+     * @param other The other array.
+     * @returns A shallow copy of this object.
+     */
+    XS_INLINE SoAArrayAlloc& operator=(SoAArrayAlloc&& other) noexcept
+    {
+        swap(other);
+        return *this;
+    }
+
+    /**
+     * Swap the contents of two arrays around.
+     * @param [in,out] other The array to swap with this one.
+     */
+    XS_INLINE void swap(SoAArrayAlloc& other) noexcept
+    {
+        Shift::swap(handle, other.handle);
+        Shift::swap(length, other.length);
+        Shift::swap(capacity, other.capacity);
+    }
+
+    /**
+     * Checks whether the array has any allocated memory.
+     * @returns True if valid, false if not.
+     */
+    XS_INLINE bool isValid() const noexcept
+    {
+        return capacity != 0;
+    }
+
+    /**
+     * Check if the array is empty or not.
+     * @returns Boolean signaling if array is empty.
+     */
+    XS_INLINE bool isEmpty() const noexcept
+    {
+        return length == 0;
+    }
+
+    /**
+     * Get the number of elements in the array.
+     * @returns The number of elements currently stored within the array.
+     */
+    XS_INLINE uint0 getLength() const noexcept
+    {
+        return length;
+    }
+
+    /**
+     * Get the number of elements currently reserved for.
+     * @returns The number of elements that can be stored before the array must be reallocated.
+     */
+    XS_INLINE uint0 getReservedLength() const noexcept
+    {
+        return capacity;
+    }
+
+    /**
+     * Manually set the number of elements to reserve for.
+     * @note This will not reduce the reserved size below what is needed to hold the current elements. The reserved
+     * size is rounded up to a multiple of blockPadding.
+     * @param number The number of elements to reserve space for.
+     * @returns Boolean signaling if new memory could be reserved.
+     */
+    XS_INLINE bool setReservedLength(const uint0 number) noexcept
+    {
+        const uint0 newCapacity = capacityFor(number > length ? number : length);
+        if (newCapacity == capacity) {
+            return true;
+        }
+        return relocate(newCapacity);
+    }
+
+    /**
+     * Manually check reserved space and increase only if necessary.
+     * @param number The number of elements to check if reserved.
+     * @returns Boolean signaling if the required amount of memory could be reserved.
+     */
+    XS_INLINE bool checkReservedLength(const uint0 number) noexcept
+    {
+        if (number <= capacity) [[likely]] {
+            return true;
+        }
+        // Use the same 1/4 growth algorithm as DArray to reduce the need to constantly reallocate
+        const uint0 grown = capacity + (capacity >> 2);
+        return relocate(capacityFor(grown > number ? grown : number));
+    }
+
+    /**
+     * Add an element to the end of the array.
+     * @param values The value of each field of the new element.
+     * @returns Boolean representing if element could be added to array. (will be false if memory could not be
+     *          allocated).
+     */
+    XS_INLINE bool add(const Fields... values) noexcept
+    {
+        if (!checkReservedLength(length + 1)) [[unlikely]] {
+            return false;
+        }
+        addUnChecked(values...);
+        return true;
+    }
+
+    /**
+     * Add an element to the end of the array.
+     * @note This variant does not check if there is enough space in the array. Only use if you have manually assured
+     * adequate space before hand.
+     * @param values The value of each field of the new element.
+     */
+    XS_INLINE void addUnChecked(const Fields... values) noexcept
+    {
+        XS_ASSERT(length < capacity);
+        set(length, values...);
+        ++length;
+    }
+
+    /**
+     * Set all fields of an existing element.
+     * @param position The location of the element.
+     * @param values   The new value of each field.
+     */
+    XS_INLINE void set(const uint0 position, const Fields... values) noexcept
+    {
+        XS_ASSERT(position < capacity);
+        setFields<0>(position, values...);
+    }
+
+    /**
+     * Remove an element from the array at a specific location.
+     * @note This moves all elements after position down 1 in every field buffer.
+     * @param position The location the element should be removed from.
+     */
+    XS_INLINE void remove(const uint0 position) noexcept
+    {
+        XS_ASSERT(position < length);
+        removeFields<0>(position);
+        --length;
+    }
+
+    /**
+     * Remove a number of elements from the end of the array.
+     * @param number (Optional) The number of elements to remove.
+     */
+    XS_INLINE void removeBack(const uint0 number = 1) noexcept
+    {
+        XS_ASSERT(number <= length);
+        length -= number;
+    }
+
+    /** Remove all elements from the array. */
+    XS_INLINE void removeAll() noexcept
+    {
+        length = 0;
+    }
+
+    /**
+     * Get the buffer that stores a field.
+     * @tparam Field The index of the field.
+     * @returns Pointer to the first element of the field buffer (aligned to alignment).
+     */
+    template<uint0 Field>
+    XS_INLINE FieldType<Field>* getData() noexcept
+    {
+        static_assert(Field < fieldCount, "Invalid Field: Field must be less than the number of fields");
+        return reinterpret_cast<FieldType<Field>*>(handle.pointer + getOffset<Field>(capacity));
+    }
+
+    /**
+     * Get the buffer that stores a field.
+     * @tparam Field The index of the field.
+     * @returns Pointer to the first element of the field buffer (aligned to alignment).
+     */
+    template<uint0 Field>
+    XS_INLINE const FieldType<Field>* getData() const noexcept
+    {
+        static_assert(Field < fieldCount, "Invalid Field: Field must be less than the number of fields");
+        return reinterpret_cast<const FieldType<Field>*>(handle.pointer + getOffset<Field>(capacity));
+    }
+
+    /**
+     * Get a field of an element.
+     * @tparam Field The index of the field.
+     * @param position The location of the element.
+     * @returns The requested field value.
+     */
+    template<uint0 Field>
+    XS_INLINE FieldType<Field>& at(const uint0 position) noexcept
+    {
+        XS_ASSERT(position < length);
+        return getData<Field>()[position];
+    }
+
+    /**
+     * Get a field of an element.
+     * @tparam Field The index of the field.
+     * @param position The location of the element.
+     * @returns The requested field value.
+     */
+    template<uint0 Field>
+    XS_INLINE const FieldType<Field>& at(const uint0 position) const noexcept
+    {
+        XS_ASSERT(position < length);
+        return getData<Field>()[position];
+    }
+
+    /**
+     * Get the number of SIMD blocks needed to cover all elements.
+     * @tparam Size Number of elements in each block (4, 8 or 16).
+     * @returns The number of blocks (the last block may be partially filled).
+     */
+    template<uint32 Size = 4>
+    XS_INLINE uint0 getBlockCount() const noexcept
+    {
+        static_assert(Size == 4 || Size == 8 || Size == 16, "Invalid Size: Size must be 4, 8 or 16");
+        return (length + (Size - 1)) / Size;
+    }
+
+    /**
+     * Get the number of valid elements within a SIMD block.
+     * @tparam Size Number of elements in each block (4, 8 or 16).
+     * @param block The index of the block.
+     * @returns The number of valid elements, this is only less than Size for the last block.
+     */
+    template<uint32 Size = 4>
+    XS_INLINE uint32 getBlockLength(const uint0 block) const noexcept
+    {
+        XS_ASSERT(block < getBlockCount<Size>());
+        const uint0 remaining = length - block * Size;
+        return remaining >= Size ? Size : static_cast<uint32>(remaining);
+    }
+
+    /**
+     * Get a mask of the valid elements within a SIMD block.
+     * @note SIMD16 does not provide a mask type, use getBlockLength or the fill variant of loadBlock instead.
+     * @tparam Field The index of the field the mask will be used with.
+     * @tparam Size  Number of elements in each block (4 or 8).
+     * @param block The index of the block.
+     * @returns The mask with a lane set for every valid element.
+     */
+    template<uint0 Field, uint32 Size = 4>
+    requires(Size == 4 || Size == 8)
+    XS_INLINE typename Block<Field, Size>::Mask getBlockMask(const uint0 block) const noexcept
+    {
+        return typename Block<Field, Size>::Mask((1U << getBlockLength<Size>(block)) - 1U);
+    }
+
+    /**
+     * Load a SIMD block of a field.
+     * @note Any lanes past the end of the array contain unspecified values.
+     * @tparam Field The index of the field.
+     * @tparam Size  Number of elements in each block (4, 8 or 16).
+     * @param block The index of the block.
+     * @returns The loaded block.
+     */
+    template<uint0 Field, uint32 Size = 4>
+    XS_INLINE Block<Field, Size> loadBlock(const uint0 block) const noexcept
+    {
+        XS_ASSERT(block < getBlockCount<Size>());
+        return getBlockData<Field, Size>(block)->template load<Block<Field, Size>::width>();
+    }
+
+    /**
+     * Load a SIMD block of a field with any lanes past the end of the array set to a fill value.
+     * @tparam Field The index of the field.
+     * @tparam Size  Number of elements in each block (4, 8 or 16).
+     * @param block The index of the block.
+     * @param fill  The value used for lanes past the end of the array.
+     * @returns The loaded block.
+     */
+    template<uint0 Field, uint32 Size = 4>
+    XS_INLINE Block<Field, Size> loadBlock(const uint0 block, const FieldType<Field> fill) const noexcept
+    {
+        const uint32 valid = getBlockLength<Size>(block);
+        if (valid == Size) [[likely]] {
+            return loadBlock<Field, Size>(block);
+        }
+        BlockData<Field, Size> data;
+        FieldType<Field>* values = reinterpret_cast<FieldType<Field>*>(&data);
+        const FieldType<Field>* source = getData<Field>() + block * Size;
+        for (uint32 i = 0; i < valid; ++i) {
+            values[i] = source[i];
+        }
+        for (uint32 i = valid; i < Size; ++i) {
+            values[i] = fill;
+        }
+        return data.template load<Block<Field, Size>::width>();
+    }
+
+    /**
+     * Store a SIMD block of a field.
+     * @note The full block is always written, any lanes past the end of the array are written into the padding.
+     * @tparam Field The index of the field.
+     * @tparam Size  Number of elements in each block (4, 8 or 16).
+     * @param block The index of the block.
+     * @param value The block to store.
+     */
+    template<uint0 Field, uint32 Size = 4>
+    XS_INLINE void storeBlock(const uint0 block, const Block<Field, Size>& value) noexcept
+    {
+        XS_ASSERT(block < getBlockCount<Size>());
+        getBlockData<Field, Size>(block)->store(value);
+    }
+
+    /**
+     * Get the number of elements that will be reserved in order to store a number of elements.
+     * @param number The number of elements.
+     * @returns The required capacity (multiple of blockPadding).
+     */
+    XS_INLINE static uint0 capacityFor(const uint0 number) noexcept
+    {
+        return (number + (blockPadding - 1)) & ~(blockPadding - 1);
+    }
+
+    /**
+     * Move all elements into newly allocated memory.
+     * @param newCapacity The new number of elements (must be a multiple of blockPadding and large enough to store
+     *                    existing elements).
+     * @returns Boolean signaling if new memory could be allocated.
+     */
+    XS_INLINE bool relocate(const uint0 newCapacity) noexcept
+    {
+        XS_ASSERT(newCapacity % blockPadding == 0);
+        XS_ASSERT(newCapacity >= length);
+        Handle newHandle(getAllocationSize(newCapacity));
+        if (newHandle.pointer == nullptr) [[unlikely]] {
+            return false;
+        }
+        relocateFields<0>(newHandle.pointer, newCapacity);
+        Shift::swap(handle, newHandle);
+        capacity = newCapacity;
+        return true;
+    }
+
+private:
+    /**
+     * Round a buffer size up to a multiple of alignment.
+     * @param size The size to round (In Bytes).
+     * @returns The rounded size.
+     */
+    XS_INLINE static constexpr uint0 alignSize(const uint0 size) noexcept
+    {
+        return (size + (alignment - 1)) & ~(alignment - 1);
+    }
+
+    /**
+     * Get the offset of a fields buffer from the start of the allocation.
+     * @tparam Field The index of the field (fieldCount gives the total size).
+     * @param number The number of elements reserved in each buffer.
+     * @returns The offset (In Bytes).
+     */
+    template<uint0 Field>
+    XS_INLINE static constexpr uint0 getOffset(const uint0 number) noexcept
+    {
+        uint0 offset = 0;
+        uint0 index = 0;
+        ((offset += (index++ < Field) ? alignSize(number * sizeof(Fields)) : 0), ...);
+        return offset;
+    }
+
+    /**
+     * Get the size of the allocation needed to store a number of elements.
+     * @param number The number of elements reserved in each buffer.
+     * @returns The size (In Bytes).
+     */
+    XS_INLINE static constexpr uint0 getAllocationSize(const uint0 number) noexcept
+    {
+        return getOffset<fieldCount>(number);
+    }
+
+    /**
+     * Get a SIMD block of a field as its aligned data type.
+     * @tparam Field The index of the field.
+     * @tparam Size  Number of elements in each block.
+     * @param block The index of the block.
+     * @returns Pointer to the block data.
+     */
+    template<uint0 Field, uint32 Size>
+    XS_INLINE BlockData<Field, Size>* getBlockData(const uint0 block) noexcept
+    {
+        return reinterpret_cast<BlockData<Field, Size>*>(getData<Field>() + block * Size);
+    }
+
+    /**
+     * Get a SIMD block of a field as its aligned data type.
+     * @tparam Field The index of the field.
+     * @tparam Size  Number of elements in each block.
+     * @param block The index of the block.
+     * @returns Pointer to the block data.
+     */
+    template<uint0 Field, uint32 Size>
+    XS_INLINE const BlockData<Field, Size>* getBlockData(const uint0 block) const noexcept
+    {
+        return reinterpret_cast<const BlockData<Field, Size>*>(getData<Field>() + block * Size);
+    }
+
+    /**
+     * Set the remaining fields of an element.
+     * @tparam Field The index of the first field to set.
+     * @tparam T     Type of the first field to set.
+     * @tparam Ts    Type of the remaining fields.
+     * @param position The location of the element.
+     * @param value    The new value of the first field.
+     * @param values   The new value of the remaining fields.
+     */
+    template<uint0 Field, typename T, typename... Ts>
+    XS_INLINE void setFields(const uint0 position, const T value, const Ts... values) noexcept
+    {
+        getData<Field>()[position] = value;
+        if constexpr (sizeof...(Ts) > 0) {
+            setFields<Field + 1>(position, values...);
+        }
+    }
+
+    /**
+     * Remove an element from a field buffer and all following field buffers.
+     * @tparam Field The index of the first field to remove from.
+     * @param position The location the element should be removed from.
+     */
+    template<uint0 Field>
+    XS_INLINE void removeFields(const uint0 position) noexcept
+    {
+        using Type = FieldType<Field>;
+        Type* XS_RESTRICT data = getData<Field>() + position;
+        memMove<Type>(data, data + 1, (length - position - 1) * sizeof(Type));
+        if constexpr (Field + 1 < fieldCount) {
+            removeFields<Field + 1>(position);
+        }
+    }
+
+    /**
+     * Copy the contents of a field buffer and all following field buffers into new memory.
+     * @tparam Field The index of the first field to copy.
+     * @param pointer     The new allocation.
+     * @param newCapacity The number of elements reserved in each buffer of the new allocation.
+     */
+    template<uint0 Field>
+    XS_INLINE void relocateFields(uint8* const XS_RESTRICT pointer, const uint0 newCapacity) const noexcept
+    {
+        using Type = FieldType<Field>;
+        memMove<Type>(reinterpret_cast<Type*>(pointer + getOffset<Field>(newCapacity)), getData<Field>(),
+            length * sizeof(Type));
+        if constexpr (Field + 1 < fieldCount) {
+            relocateFields<Field + 1>(pointer, newCapacity);
+        }
+    }
+};
+
+/**
+ * Dynamic structure of arrays using the default heap allocator.
+ * @tparam Fields Type of each field stored within the array.
+ */
+template<typename... Fields>
+using SoAArray = SoAArrayAlloc<AllocRegionHeap<uint8>, Fields...>;
+} // namespace Shift
@@ -15,8 +15,9 @@
  * limitations under the License.
  */
 
+#include "Memory/XSAllocatorStack.hpp"
+#include "Memory/XSArray.hpp"
 #include "XSMemory.hpp"
-#include "XSStaticArray.hpp"
 #include "XSUtility.hpp"
 
 namespace Shift {
@@ -52,7 +53,8 @@ XS_INLINE void sort(T* XS_RESTRICT start, T* XS_RESTRICT end, Callable&& compare
         //  that could be T is a utf char (16b) then maximum number of objects is 2^32-1.
         //  The max number of recursions is log2( objects ).
 
-        StaticArray<Pair<T*>, (currentArch == Architecture::Bit64 ? 65 : 33) - NoExport::log2(sizeof(T))> iterateStack;
+        constexpr uint0 stackSize = (currentArch == Architecture::Bit64 ? 65 : 33) - NoExport::log2(sizeof(T));
+        Array<Pair<T*>, AllocRegionStack<Pair<T*>, stackSize>> iterateStack;
 
         // Get the initial start and last positions (TEnd is non-inclusive so the last is at -1
         T* XS_RESTRICT currentStart = start;
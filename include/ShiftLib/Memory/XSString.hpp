@@ -15,34 +15,155 @@
  * limitations under the License.
  */
 
+#include "Memory/XSAllocatorSmall.hpp"
 #include "Memory/XSDArray.hpp"
+#include "Memory/XSNumberFormat.hpp"
+#include "Memory/XSNumberParse.hpp"
+#include "Memory/XSStringSearch.hpp"
+#include "Memory/XSStringSplit.hpp"
+#include "Memory/XSStringView.hpp"
+#include "Memory/XSUnicode.hpp"
+#include "XSBit.hpp"
 
 namespace Shift {
 class UInt128;
 class Int128;
 
-template<typename CharType = char>
-class String : public DArray<CharType>
+template<typename CharType, uint0 Number>
+class StringConcat;
+
+namespace NoExport {
+#if XS_ISA == XS_X86
+/**
+ * Get the bit mask of each null character in an aligned block.
+ * @tparam T Type of character.
+ * @param block The aligned block of 16 bytes to check.
+ * @returns The mask of bytes belonging to null characters.
+ */
+template<typename T>
+XS_INLINE uint32 stringNullBlock(const __m128i* const XS_RESTRICT block) noexcept
+{
+    const __m128i value = _mm_load_si128(block);
+    if constexpr (sizeof(T) == 1) {
+        return static_cast<uint32>(_mm_movemask_epi8(_mm_cmpeq_epi8(value, _mm_setzero_si128())));
+    } else if constexpr (sizeof(T) == 2) {
+        return static_cast<uint32>(_mm_movemask_epi8(_mm_cmpeq_epi16(value, _mm_setzero_si128())));
+    } else {
+        return static_cast<uint32>(_mm_movemask_epi8(_mm_cmpeq_epi32(value, _mm_setzero_si128())));
+    }
+}
+
+/**
+ * Get the bit mask of each null character in an aligned block.
+ * @tparam T Type of character.
+ * @param block The aligned block of 32 bytes to check.
+ * @returns The mask of bytes belonging to null characters.
+ */
+template<typename T>
+XS_INLINE uint32 stringNullBlock(const __m256i* const XS_RESTRICT block) noexcept
+{
+    const __m256i value = _mm256_load_si256(block);
+    if constexpr (sizeof(T) == 1) {
+        return static_cast<uint32>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(value, _mm256_setzero_si256())));
+    } else if constexpr (sizeof(T) == 2) {
+        return static_cast<uint32>(_mm256_movemask_epi8(_mm256_cmpeq_epi16(value, _mm256_setzero_si256())));
+    } else {
+        return static_cast<uint32>(_mm256_movemask_epi8(_mm256_cmpeq_epi32(value, _mm256_setzero_si256())));
+    }
+}
+
+/**
+ * Get the bit mask of each null character in an aligned block.
+ * @tparam T Type of character.
+ * @param block The aligned block of 64 bytes to check.
+ * @returns The mask of null characters (1 bit per character).
+ */
+template<typename T>
+XS_INLINE uint64 stringNullBlock(const __m512i* const XS_RESTRICT block) noexcept
+{
+    const __m512i value = _mm512_load_si512(block);
+    if constexpr (sizeof(T) == 1) {
+        return _mm512_cmpeq_epi8_mask(value, _mm512_setzero_si512());
+    } else if constexpr (sizeof(T) == 2) {
+        return _mm512_cmpeq_epi16_mask(value, _mm512_setzero_si512());
+    } else {
+        return _mm512_cmpeq_epi32_mask(value, _mm512_setzero_si512());
+    }
+}
+
+/**
+ * Find the null character that terminates a string using aligned blocks.
+ * @note Aligned loads never cross a page boundary so reading the bytes before the start of the string or after the
+ * null character can never fault. Any nulls found before the start of the string are masked out of the first block.
+ * @tparam T     Type of character.
+ * @tparam Block Type of SIMD register used to load each block.
+ * @param string The string to check (must be aligned to the size of its characters).
+ * @returns The number of characters before the null character.
+ */
+template<typename T, typename Block>
+XS_INLINE uint0 stringLengthBlocks(const T* const XS_RESTRICT string) noexcept
+{
+    const auto address = reinterpret_cast<uint0>(string);
+    const auto* block = reinterpret_cast<const Block*>(address & ~(sizeof(Block) - 1));
+    const uint0 offset = address & (sizeof(Block) - 1);
+    // AVX512 masks have 1 bit per character while movemask has 1 bit per byte
+    constexpr uint0 bitSize = sizeof(Block) == 64 ? sizeof(T) : 1;
+    auto mask = stringNullBlock<T>(block) >> (offset / bitSize);
+    if (mask != 0) {
+        return ctz(mask) * bitSize / sizeof(T);
+    }
+    do {
+        ++block;
+        mask = stringNullBlock<T>(block);
+    } while (mask == 0);
+    return (reinterpret_cast<uint0>(block) - address + ctz(mask) * bitSize) / sizeof(T);
+}
+#endif
+
+/**
+ * Get the number of characters before the null character that terminates a string.
+ * @tparam T Type of character.
+ * @param string The null terminated string.
+ * @returns The number of characters in the string.
+ */
+template<typename T>
+XS_INLINE uint0 stringLength(const T* const XS_RESTRICT string) noexcept
+{
+#if XS_ISA == XS_X86
+    // Blocks only line up with characters if the string is aligned to the size of its characters
+    if (reinterpret_cast<uint0>(string) % sizeof(T) == 0) [[likely]] {
+        if constexpr (hasISAFeature<ISAFeature::AVX512BW>) {
+            return stringLengthBlocks<T, __m512i>(string);
+        } else if constexpr (hasISAFeature<ISAFeature::AVX2>) {
+            return stringLengthBlocks<T, __m256i>(string);
+        } else if constexpr (hasISAFeature<ISAFeature::SSE2>) {
+            return stringLengthBlocks<T, __m128i>(string);
+        }
+    }
+#endif
+    const T* current = string;
+    while (*current != 0) {
+        ++current;
+    }
+    return static_cast<uint0>(current - string);
+}
+} // namespace NoExport
+
+template<typename CharType = char, class Alloc = AllocRegionHeap<CharType>>
+class String : public DArray<CharType, Alloc>
 {
     static_assert(isSameAny<CharType, char, char8, char16, char32>,
         "Invalid character type: Template parameter must be a valid char type");
 
 public:
-    using IArray = DArray<CharType>;
+    using IArray = DArray<CharType, Alloc>;
     using TypeIterator = typename IArray::TypeIterator;
     using TypeConstIterator = typename IArray::TypeConstIterator;
     using TypeIteratorOffset = typename IArray::TypeIteratorOffset;
     using TypeConstIteratorOffset = typename IArray::TypeConstIteratorOffset;
+    using Search = StringSearch<CharType>;
+    using Split = StringSplit<CharType>;
 
-private:
-    static constexpr uint0 convertBase = 10;
-    static constexpr CharType utfZero = 0x30;
-    static constexpr CharType utfMinus = 0x2D;
-    static constexpr CharType utfPercent = 0x27;
-    static constexpr CharType utfPlus = 0x2B;
-    static constexpr CharType utfDot = 0x2E;
-
-public:
     /**
      * Get the length of a char array.
      * @note Gets the number of char data elements in array.
@@ -54,14 +175,8 @@ public:
     requires(isSameAny<CharType2, char, char8, char16, char32>)
     XS_INLINE static uint0 CharLength(const CharType2* const XS_RESTRICT string) noexcept
     {
-        // Must loop over all chars until we find the null terminating character
-        uint0 retLength = 0;
-        const auto* current = string;
-        while (*current != 0x00000000) {
-            ++current;
-            ++retLength;
-        }
-        return retLength;
+        // Must check all chars until we find the null terminating character, this is done a SIMD block at a time
+        return NoExport::stringLength(string);
     }
 
     /** Defaulted constructor */
@@ -81,11 +196,12 @@ public:
 
     /**
      * Copy constructor.
-     * @tparam T2 Type of object being added to array.
+     * @tparam T2     Type of object being added to array.
+     * @tparam Alloc2 Type of allocator used by the other string.
      * @param string Reference to DArray object to copy.
      */
-    template<typename T2>
-    XS_INLINE explicit String(const String<T2>& string) noexcept
+    template<typename T2, class Alloc2>
+    XS_INLINE explicit String(const String<T2, Alloc2>& string) noexcept
         : String(string.handle.pointer, string.getLength())
     {}
 
@@ -101,16 +217,12 @@ public:
             this->IArray::IArray::add(elements, number);
         } else if constexpr (isSame<CharType, char8>) {
             this->IArray::IArray::add(reinterpret_cast<const CharType* const>(elements), number);
-        } else {
-            uint0 sourceLength = number;
-            const char* sourcePos = elements;
-            while (sourceLength > 0) {
-                // Convert the ASCII input character
-                auto temp = static_cast<CharType>(*sourcePos);
-                ++sourcePos;
-                --sourceLength;
-                reinterpret_cast<typename IArray::IArray*>(this)->add(temp);
+        } else if (this->handle.pointer != nullptr) [[likely]] {
+            // Each ASCII input character maps directly to a single output character
+            for (uint0 i = 0; i < number; ++i) {
+                this->handle.pointer[i] = static_cast<CharType>(elements[i]);
             }
+            this->nextElement = this->handle.pointer + number;
         }
     }
 
@@ -124,15 +236,21 @@ public:
 
     /**
      * Construct from a sequence of elements.
+     * @note Valid UTF8 input is converted using utfConvert, invalid input is decoded one character at a time with
+     * any incomplete sequences being truncated.
      * @param elements Pointer to list of elements to use.
      * @param number   The number of elements in the input list.
      */
     XS_INLINE String(const char8* const XS_RESTRICT elements, const uint0 number) noexcept
-        : IArray(number)
     {
         if constexpr (isSame<CharType, char8>) {
-            this->add(elements, number);
-        } else {
+            if (this->setReservedLength(number)) [[likely]] {
+                this->IArray::IArray::add(elements, number);
+            }
+        } else if (utf8Validate(elements, number)) [[likely]] {
+            addConverted(elements, number);
+        } else if (this->setReservedLength(number)) [[likely]] {
+            // Each input character results in at most 1 output character
             uint0 sourceLength = number;
             const char8* XS_RESTRICT sourcePos = elements;
 
@@ -160,30 +278,13 @@ public:
                 }
                 ++sourcePos;
                 --sourceLength;
-                while (left--) {
+                while (left-- && sourceLength > 0) {
                     temp <<= 6;
                     temp |= *sourcePos & 0x3F;
                     ++sourcePos;
                     --sourceLength;
                 }
-
-                if constexpr (isSame<CharType, char>) {
-                    // Valid ASCII is all chars below 7F
-                    reinterpret_cast<typename IArray::IArray*>(this)->add(static_cast<CharType>(temp & 0x7F));
-                } else if constexpr (isSame<CharType, char16>) {
-                    // Convert to UTF16 character
-                    if (temp < 0x10000) {
-                        reinterpret_cast<typename IArray::IArray*>(this)->add(static_cast<char16>(temp));
-                    } else {
-                        temp = temp - 0x10000;
-                        const char16 w1 = 0xD800 | static_cast<char16>((temp >> 10) & 0x3FF);
-                        const char16 w2 = 0xDC00 | static_cast<char16>(temp & 0x3FF);
-                        reinterpret_cast<typename IArray::IArray*>(this)->add(w1);
-                        reinterpret_cast<typename IArray::IArray*>(this)->add(w2);
-                    }
-                } else if constexpr (isSame<CharType, char32>) {
-                    reinterpret_cast<typename IArray::IArray*>(this)->add(temp);
-                }
+                this->nextElement += NoExport::utfEncode(temp, this->nextElement);
             }
         }
     }
@@ -198,71 +299,13 @@ public:
 
     /**
      * Construct from a sequence of elements.
+     * @note Unpaired surrogates are converted as individual code points.
      * @param elements Pointer to list of elements to use.
      * @param number   The number of elements in the input list.
      */
     XS_INLINE String(const char16* const XS_RESTRICT elements, const uint0 number) noexcept
-        : IArray(number)
     {
-        if constexpr (isSame<CharType, char16>) {
-            this->IArray::IArray::add(elements, number);
-        } else {
-            uint0 sourceLength = number;
-            const char16* XS_RESTRICT sourcePos = elements;
-
-            char32 temp;
-            while (sourceLength > 0) {
-                // Convert the UTF16 input character
-                const char16 w1 = *sourcePos;
-                ++sourcePos;
-                --sourceLength;
-                if (w1 < 0xD800 || w1 > 0xDFFF) {
-                    temp = static_cast<char32>(w1);
-                } else {
-                    const char16 w2 = *sourcePos;
-                    ++sourcePos;
-                    --sourceLength;
-                    temp = ((static_cast<char32>(w1 & 0x3FF) << 10) | static_cast<char32>(w2 & 0x3FF)) + 0x10000;
-                }
-
-                if constexpr (isSame<CharType, char>) {
-                    // Valid ASCII is all chars below 7F
-                    reinterpret_cast<typename IArray::IArray*>(this)->add(static_cast<CharType>(temp & 0x7F));
-                } else if constexpr (isSame<CharType, char8>) {
-                    // Convert to UTF8 character
-                    if (temp <= 0x7F) {
-                        this->IArray::add(static_cast<CharType>(temp));
-                    } else if (temp <= 0x7FF) {
-                        this->IArray::add(static_cast<CharType>(0xC0 | ((temp >> 6) & 0x1F)));
-                        this->IArray::add(static_cast<CharType>(0x80 | (temp & 0x3F)));
-                    } else if (temp <= 0xFFFF) {
-                        this->IArray::add(static_cast<CharType>(0xE0 | ((temp >> 12) & 0x0F)));
-                        this->IArray::add(static_cast<CharType>(0x80 | ((temp >> 6) & 0x3F)));
-                        this->IArray::add(static_cast<CharType>(0x80 | (temp & 0x3F)));
-                    } else if (temp <= 0x1FFFFF) {
-                        this->IArray::add(static_cast<CharType>((0xF0 | ((temp >> 18) & 0x07))));
-                        this->IArray::add(static_cast<CharType>((0x80 | ((temp >> 12) & 0x3F))));
-                        this->IArray::add(static_cast<CharType>((0x80 | ((temp >> 6) & 0x3F))));
-                        this->IArray::add(static_cast<CharType>((0x80 | (temp & 0x3F))));
-                    } else if (temp <= 0x3FFFFFF) {
-                        this->IArray::add(static_cast<CharType>(0xF8 | ((temp >> 24) & 0x03)));
-                        this->IArray::add(static_cast<CharType>(0x80 | ((temp >> 18) & 0x3F)));
-                        this->IArray::add(static_cast<CharType>(0x80 | ((temp >> 12) & 0x3F)));
-                        this->IArray::add(static_cast<CharType>(0x80 | ((temp >> 6) & 0x3F)));
-                        this->IArray::add(static_cast<CharType>(0x80 | (temp & 0x3F)));
-                    } else {
-                        this->IArray::add(static_cast<CharType>(0xFC | ((temp >> 30) & 0x01)));
-                        this->IArray::add(static_cast<CharType>(0x80 | ((temp >> 24) & 0x3F)));
-                        this->IArray::add(static_cast<CharType>(0x80 | ((temp >> 18) & 0x3F)));
-                        this->IArray::add(static_cast<CharType>(0x80 | ((temp >> 12) & 0x3F)));
-                        this->IArray::add(static_cast<CharType>(0x80 | ((temp >> 6) & 0x3F)));
-                        this->IArray::add(static_cast<CharType>(0x80 | (temp & 0x3F)));
-                    }
-                } else if constexpr (isSame<CharType, char32>) {
-                    reinterpret_cast<typename IArray::IArray*>(this)->add(temp);
-                }
-            }
-        }
+        addConverted(elements, number);
     }
 
     /**
@@ -279,67 +322,8 @@ public:
      * @param number   The number of elements in the input list.
      */
     XS_INLINE String(const char32* const XS_RESTRICT elements, const uint0 number) noexcept
-        : IArray(number)
     {
-        if constexpr (isSame<CharType, char32>) {
-            this->IArray::IArray::add(elements, number);
-        } else {
-            uint0 sourceLength = number;
-            const char32* XS_RESTRICT sourcePos = elements;
-
-            while (sourceLength > 0) {
-                // Convert the UTF32 input character
-                char32 temp = *sourcePos;
-                ++sourcePos;
-                --sourceLength;
-
-                if constexpr (isSame<CharType, char>) {
-                    // Valid ASCII is all chars below 7F
-                    reinterpret_cast<typename IArray::IArray*>(this)->add(static_cast<CharType>(temp & 0x7F));
-                } else if constexpr (isSame<CharType, char8>) {
-                    // Convert to UTF8 character
-                    if (temp <= 0x7F) {
-                        this->IArray::add(static_cast<CharType>(temp));
-                    } else if (temp <= 0x7FF) {
-                        this->IArray::add(static_cast<CharType>(0xC0 | ((temp >> 6) & 0x1F)));
-                        this->IArray::add(static_cast<CharType>(0x80 | (temp & 0x3F)));
-                    } else if (temp <= 0xFFFF) {
-                        this->IArray::add(static_cast<CharType>(0xE0 | ((temp >> 12) & 0x0F)));
-                        this->IArray::add(static_cast<CharType>(0x80 | ((temp >> 6) & 0x3F)));
-                        this->IArray::add(static_cast<CharType>(0x80 | (temp & 0x3F)));
-                    } else if (temp <= 0x1FFFFF) {
-                        this->IArray::add(static_cast<CharType>(0xF0 | ((temp >> 18) & 0x07)));
-                        this->IArray::add(static_cast<CharType>(0x80 | ((temp >> 12) & 0x3F)));
-                        this->IArray::add(static_cast<CharType>(0x80 | ((temp >> 6) & 0x3F)));
-                        this->IArray::add(static_cast<CharType>(0x80 | (temp & 0x3F)));
-                    } else if (temp <= 0x3FFFFFF) {
-                        this->IArray::add(static_cast<CharType>(0xF8 | ((temp >> 24) & 0x03)));
-                        this->IArray::add(static_cast<CharType>(0x80 | ((temp >> 18) & 0x3F)));
-                        this->IArray::add(static_cast<CharType>(0x80 | ((temp >> 12) & 0x3F)));
-                        this->IArray::add(static_cast<CharType>(0x80 | ((temp >> 6) & 0x3F)));
-                        this->IArray::add(static_cast<CharType>(0x80 | (temp & 0x3F)));
-                    } else {
-                        this->IArray::add(static_cast<CharType>(0xFC | ((temp >> 30) & 0x01)));
-                        this->IArray::add(static_cast<CharType>(0x80 | ((temp >> 24) & 0x3F)));
-                        this->IArray::add(static_cast<CharType>(0x80 | ((temp >> 18) & 0x3F)));
-                        this->IArray::add(static_cast<CharType>(0x80 | ((temp >> 12) & 0x3F)));
-                        this->IArray::add(static_cast<CharType>(0x80 | ((temp >> 6) & 0x3F)));
-                        this->IArray::add(static_cast<CharType>(0x80 | (temp & 0x3F)));
-                    }
-                } else if constexpr (isSame<CharType, char16>) {
-                    // Convert to UTF16 character
-                    if (temp < 0x10000) {
-                        reinterpret_cast<typename IArray::IArray*>(this)->add(static_cast<char16>(temp));
-                    } else {
-                        temp = temp - 0x10000;
-                        const char16 w1 = 0xD800 | static_cast<char16>((temp >> 10) & 0x3FF);
-                        const char16 w2 = 0xDC00 | static_cast<char16>(temp & 0x3FF);
-                        reinterpret_cast<IArray*>(this)->add(w1);
-                        reinterpret_cast<IArray*>(this)->add(w2);
-                    }
-                }
-            }
-        }
+        addConverted(elements, number);
     }
 
     /**
@@ -377,14 +361,30 @@ public:
      */
     template<typename T>
     requires(isArithmetic<T> && !isSame<CharType, T>)
-    XS_INLINE explicit String(
-        const T number, uint0 reserve = (sizeof(T) * 5) / (isFloat<T> ? 1 : 2) + (isSigned<T> ? 1 : 0)) noexcept
+    XS_INLINE explicit String(const T number, uint0 reserve = numberFormatLength<T>) noexcept
         : IArray(reserve)
     {
         static_assert(isArithmetic<T>, "Invalid Type: Only native arithmetic numbers are supported");
         this->add(number);
     }
 
+    /**
+     * Constructor to build from a concatenation expression.
+     * @note The total length of the expression is known up front so only a single allocation is performed.
+     * @tparam Number The number of strings in the expression.
+     * @param concat The expression to build from.
+     */
+    template<uint0 Number>
+    XS_INLINE String(const StringConcat<CharType, Number>& concat) noexcept // NOLINT(google-explicit-constructor)
+        : IArray(concat.getLength())
+    {
+        if (this->isValid()) [[likely]] {
+            for (const auto& piece : concat.pieces) {
+                this->IArray::IArray::add(piece.data(), piece.size());
+            }
+        }
+    }
+
     /** Destructor. */
     XS_INLINE ~String() noexcept = default;
 
@@ -420,13 +420,26 @@ public:
     template<typename T>
     requires(isArithmetic<T> && !isSame<CharType, T>)
     XS_INLINE bool add(const T number) noexcept
+    {
+        return this->appendNumber(number);
+    }
+
+    /**
+     * Add a string representation of a number to the end of the string.
+     * @note The number is written directly into the strings reserved memory (see formatNumber for the format used).
+     * @param number The number to convert to string and add to current one.
+     * @return Whether operation could be performed.
+     */
+    template<typename T>
+    requires(isArithmetic<T> && !isSame<CharType, T>)
+    XS_INLINE bool appendNumber(const T number) noexcept
     {
         static_assert(isArithmetic<T>, "Invalid Type: Only native arithmetic numbers are supported");
-        // Just use the set function and pass in the start as the iterator
-        // This adds an extra endPosition check within the function that is not required but significantly reduces code
-        // size
-        TypeIterator it(this->end());
-        return this->set(it, number);
+        if (!this->checkAddReservedLength(numberFormatLength<T>)) [[unlikely]] {
+            return false;
+        }
+        this->nextElement += formatNumber(number, this->nextElement);
+        return true;
     }
 
     /**
@@ -454,6 +467,43 @@ public:
         return this->IArray::add(string, CharLength(string));
     }
 
+    /**
+     * Add the result of a concatenation expression to the string.
+     * @note The total length of the expression is known up front so memory is only reserved once.
+     * @tparam Number The number of strings in the expression.
+     * @param concat The expression to add.
+     * @return Whether operation could be performed.
+     */
+    template<uint0 Number>
+    XS_INLINE bool add(const StringConcat<CharType, Number>& concat) noexcept
+    {
+        if (this->nextElement + concat.getLength() > this->endAllocated) {
+            // Pieces that reference this string would be invalidated by reallocation, so build into new memory instead
+            const CharType* const start = this->handle.pointer;
+            for (const auto& piece : concat.pieces) {
+                if (piece.data() >= start && piece.data() < this->nextElement) [[unlikely]] {
+                    String temp;
+                    if (!temp.checkAddReservedLength(this->getLength() + concat.getLength())) [[unlikely]] {
+                        return false;
+                    }
+                    temp.IArray::IArray::add(start, this->getLength());
+                    for (const auto& piece2 : concat.pieces) {
+                        temp.IArray::IArray::add(piece2.data(), piece2.size());
+                    }
+                    swap(temp);
+                    return true;
+                }
+            }
+        }
+        if (!this->checkAddReservedLength(concat.getLength())) [[unlikely]] {
+            return false;
+        }
+        for (const auto& piece : concat.pieces) {
+            this->IArray::IArray::add(piece.data(), piece.size());
+        }
+        return true;
+    }
+
     using IArray::add;
 
     /**
@@ -633,398 +683,20 @@ public:
      */
     template<typename T>
     requires(isArithmetic<T> && !isSame<CharType, T>)
-    XS_INLINE bool set(TypeIterator& iterator, T number) noexcept
+    XS_INLINE bool set(TypeIterator& iterator, const T number) noexcept
     {
         static_assert(isArithmetic<T>, "Invalid Type: Only native arithmetic numbers are supported");
-        if constexpr (!isFloat<T>) {
-            // Check sign
-            bool addSign = false;
-            if constexpr (isSigned<T>) {
-                if (number < 0) {
-                    // Add sign bit
-                    addSign = true;
-                    number *= -1;
-                }
-            }
-            // Determine length of number
-            uint0 length = 1;
-            if constexpr ((currentArch == Architecture::Bit32 && isSameAny<T, uint32, int32>) ||
-                isSameAny<T, uint64, int64, UInt128, Int128>) {
-                T count = 1;
-                constexpr auto maxDigits = (sizeof(T) * 5) / 2;
-                while ((number > count) & (length < maxDigits)) {
-                    count *= convertBase;
-                    ++length;
-                }
-                // Must use less than when checking in case the length bailout was triggered above
-                if ((number < count) & (count > 1)) [[unlikely]] {
-                    --length;
-                }
-            } else {
-                promote<T> count = 1; // Use larger values to avoid needing overflow check
-                while (static_cast<promote<T>>(number) > count) {
-                    count *= convertBase;
-                    ++length;
-                }
-                // Check if number is exactly same as count (i.e. 100 has length 3 while 99 has length 2)
-                // Also check that count is greater than 1 (i.e. to support input values of 0)
-                if ((static_cast<promote<T>>(number) != count) & (count > 1)) [[unlikely]] {
-                    --length;
-                }
-            }
-
-            uint0 numberElements = static_cast<uint0>(iterator - this->begin()) + length;
-            if constexpr (isSigned<T>) {
-                numberElements += static_cast<uint32>(addSign);
-            }
-            // Check if we need to increase number elements
-            if (numberElements > this->getLength()) [[unlikely]] {
-                // Check reserved size
-                if (!this->checkReservedLength(numberElements, iterator)) [[unlikely]] {
-                    return false;
-                }
-                this->nextElement = this->handle.pointer + numberElements;
-            }
-
-            TypeIterator startIterator(iterator);
-            if constexpr (isSigned<T>) {
-                // Add sign bit if required (must be performed after the array has been resized)
-                if (addSign) {
-                    this->at(startIterator) = utfMinus;
-                    ++startIterator;
-                }
-            }
-
-            // Fill array with chars
-            for (TypeIterator inLoopIndex(startIterator + length); startIterator < inLoopIndex;) {
-                --inLoopIndex;
-                const T value = number / static_cast<T>(convertBase);
-                this->at(inLoopIndex) = utfZero + static_cast<CharType>(number - (value * static_cast<T>(convertBase)));
-                number = value;
-            }
-            return true;
-        } else {
-            // Check sign
-            bool addSign = false;
-            if (number < 0) {
-                // Add sign bit
-                addSign = true;
-            }
-
-            using sizeType = conditional<isSame<T, float32>, uint32, uint64>;
-            sizeType mantissa;
-            int32 finalExponent;
-            if constexpr (isSame<T, float32>) {
-                // Exponent is first 8 bits after the sign bit, the mantissa is the last 23 bits
-                class FloatParts
-                {
-                public:
-                    uint32 mantissa : 23;
-                    uint32 exponent : 8;
-                    uint32 sign : 1;
-                };
-                auto parts = bitCast<FloatParts, T>(number);
-                uint32 exponent = parts.exponent;
-                mantissa = parts.mantissa;
-                mantissa += 0x00800000;
-                // Actual floating point number is derived from: (-1)^s x m2^(-23) x 2^(x-127)
-                // where s = sign bit, m = mantissa (with implicit 24th bit adding 0x00800000), x = exponent
-                finalExponent = static_cast<int32>(exponent) -
-                    150; // Subtract the -127 for exponent and combine with -23 for converting mantissa
-            } else {
-                // Exponent is first 11 bits after the sign bit, the mantissa is the last 52 bits
-                class DoubleParts
-                {
-                public:
-                    uint64 mantissa : 52;
-                    uint64 exponent : 11;
-                    uint64 sign : 1;
-                };
-                auto parts = bitCast<DoubleParts, T>(number);
-                uint32 exponent = parts.exponent;
-                mantissa = parts.mantissa;
-                mantissa += 0x0010000000000000;
-                // Actual floating point number is derived from: (-1)^s x m2^(-52) x 2^(x-1023)
-                // where s = sign bit, m = mantissa (with implicit 53rd bit adding 0x0010000000000000), x = exponent
-                finalExponent = static_cast<int32>(exponent) -
-                    1075; // Subtract the -1023 for exponent and combine with -52 for converting mantissa
-            }
-
-            // Using the determined position of the 'point' get the integer values before and after the decimal point
-            // Note: pre-point is essentially just doing a floor(number) but is done manually using bitwise here for
-            // speed
-            sizeType prePoint;
-            sizeType postPoint;
-            int32 pointOffset;
-            if (finalExponent < 0) {
-                finalExponent = -finalExponent;
-                if (finalExponent >= static_cast<int32>(sizeof(T) * 8)) {
-                    // If the exponent is 32/64 or greater then the shift operation will fail so we just force it to 0
-                    prePoint = 0;
-                } else {
-                    prePoint = mantissa >> finalExponent;
-                    mantissa ^= prePoint << finalExponent;
-                }
-
-                // Check for the case when the new mantissa is now 0
-                if (mantissa) {
-                    // Need to scale the fractional part so that it becomes a valid integer
-                    // The fractional number must be multiplied by 2^finalExponent to get the actual fraction value
-                    //   This value is all less than zero so to represent using an integer the whole value must be
-                    //   scaled up. This is done using a base 10 power. i.e. value = postPoint * 10^x where x is the
-                    //   smallest number required to remove all fractional components Combining the 2^ and 10^ gives 5^.
-                    auto precision = static_cast<uint32>(finalExponent);
-                    postPoint = mantissa;
-                    // Try and maximise available precision by always keeping the bits as low in the register as
-                    // possible.
-                    while (((postPoint & 0x0000000000000001) == 0) && (precision > 0)) {
-                        postPoint >>= 1;
-                        --precision;
-                    }
-                    uint32 minPrecision = 0;
-                    for (; precision > 0; --precision, ++minPrecision) {
-                        // 2^29-1 or 2^61-1
-                        if (constexpr sizeType maxPostPoint =
-                                isSame<sizeType, uint32> ? 536870911 : static_cast<sizeType>(2305843009213693951);
-                            postPoint > maxPostPoint) {
-                            // Determine number of overflow bits ( equivalent to -28 + log2(postPoint) )
-                            constexpr sizeType postOverflow =
-                                isSame<sizeType, uint32> ? 1073741823 : static_cast<sizeType>(4611686018427387903);
-                            constexpr sizeType postOverflow2 = postOverflow * 2;
-                            uint32 overflowBits = (postPoint > postOverflow) ? 2 : 1;
-                            overflowBits = (postPoint > postOverflow2) ? 3 : overflowBits;
-                            // Check to see if we moved by more bits than needed for the multiply.
-                            // If this is the case then we can often save ourselves a bit of precision loss.
-                            constexpr sizeType backupMask = isSame<sizeType, uint32> ?
-                                static_cast<sizeType>(0x80000000) :
-                                static_cast<sizeType>(0x8000000000000000);
-                            if (const sizeType backup = postPoint >> overflowBits;
-                                ((backup * (static_cast<sizeType>(convertBase) / 2)) & backupMask) ==
-                                0) // equivalent to 31 - log2( postPoint * (ConvertBase/2) );
-                            {
-                                --overflowBits; // Assumes likely only 1 bit off
-                            }
-                            // Check if we have that many available precision bits
-                            if (precision >= overflowBits) {
-                                // Reduce by number of needed bits
-                                postPoint >>= overflowBits;
-                                precision -= overflowBits;
-                                // Continue trying to maximise precision by keeping as many MSBs available as possible
-                                // We only have to do this after a shift as beforehand any multiple of 5 will always
-                                // have LSB=1
-                                constexpr sizeType postPointMask = 0x0000000000000001;
-                                while (((postPoint & postPointMask) == 0) && (precision > 0)) {
-                                    postPoint >>= 1;
-                                    --precision;
-                                }
-                                // Its possible at this point we have exhausted all the precision operations
-                                if (precision == 0) {
-                                    break;
-                                }
-                            } else {
-                                // can not perform any more scales as they are already all used
-                                postPoint >>= precision; // Add any remaining 2^ scaling that may be required
-                                break;
-                            }
-                        }
-                        postPoint *= (convertBase / 2);
-                    }
-                    pointOffset = -static_cast<int32>(minPrecision);
-                } else {
-                    postPoint = 0;
-                    pointOffset = 0;
-                }
-            } else {
-                const int32 maxExponent = (finalExponent < 8) ? finalExponent : 8;
-                prePoint = mantissa << maxExponent;
-                finalExponent -= maxExponent;
-                postPoint = 0;
-                pointOffset = 0;
-                // For full precision we need to divide until the final exponent equals 0
-                while (finalExponent > 0) {
-                    // Divide the number by required scaling
-                    prePoint /= convertBase / 2;
-                    ++pointOffset;
-                    --finalExponent; // Additional -1 due to div by base/2
-                    // Get the number of bits that were lost due to scaling down
-                    constexpr sizeType underflowMax = isSame<sizeType, uint32> ?
-                        536870911 :
-                        static_cast<sizeType>(2305843009213693951); // Equivalent to 31 - log2( prePoint )
-                    uint32 underflowBits = (prePoint > underflowMax) ? 2 : 3;
-                    // Shift back up so that max bits are in top
-                    underflowBits = (underflowBits < static_cast<uint32>(finalExponent)) ?
-                        underflowBits :
-                        static_cast<uint32>(finalExponent);
-                    prePoint <<= underflowBits;
-                    finalExponent -= static_cast<int32>(underflowBits);
-                }
-            }
-
-            // Determine length of pre-point value
-            uint32 length2 = 1;
-            if constexpr (currentArch == Architecture::Bit64 && isSame<T, float32>) {
-                uint64 count = 1; // Use 64bit values to avoid needing overflow check
-                while (static_cast<uint64>(prePoint) > count) {
-                    count *= convertBase;
-                    ++length2;
-                }
-                // Check if number is exactly same as count (i.e. 100 has length 3 while 99 has length 2)
-                // Also check that count is greater than 1 (i.e. to support input values of 0)
-                if ((static_cast<uint64>(prePoint) != count) && (count > 1)) [[unlikely]] {
-                    --length2;
-                }
-            } else {
-                sizeType count = 1;
-                constexpr auto maxDigits = (sizeof(T) * 5) / 2;
-                while ((prePoint > count) && (length2 < maxDigits)) {
-                    count *= convertBase;
-                    ++length2;
-                }
-                // Must use less than when checking in case the length bailout was triggered above
-                if ((prePoint < count) && (count > 1)) [[unlikely]] {
-                    --length2;
-                }
-            }
-            // Add space in the array for decimal point
-            length2++;
-
-            // Determine length of post-point value
-            uint32 length = 1;
-            if constexpr (currentArch == Architecture::Bit64 && isSame<T, float32>) {
-                uint0 count = 1; // Use 64bit values to avoid needing overflow check
-                while (static_cast<uint64>(postPoint) > count) {
-                    count *= convertBase;
-                    ++length;
-                }
-                // Check if number is exactly same as count (i.e. 100 has length 3 while 99 has length 2)
-                // Also check that count is greater than 1 (i.e. to support input values of 0)
-                if ((static_cast<uint64>(postPoint) != count) && (count > 1)) [[unlikely]] {
-                    --length;
-                }
-            } else {
-                sizeType count = 1;
-                constexpr auto maxDigits = (sizeof(T) * 5) / 2;
-                while ((postPoint > count) && (length < maxDigits)) {
-                    count *= convertBase;
-                    ++length;
-                }
-                // Must use less than when checking in case the length bailout was triggered above
-                if ((postPoint < count) && (count > 1)) [[unlikely]] {
-                    --length;
-                }
-            }
-            // Check the point offset. If there is a valid pre-point value and an offset then this means we need to
-            // print the required zeroes.
-            if ((prePoint != 0) && (pointOffset < 0)) {
-                length -= static_cast<uint32>(static_cast<int32>(length) +
-                    pointOffset); // Add the offset associated with additional '0's from post-point
-                pointOffset = 0;  // Reset the offset so that it doesn't trigger the e^x code later on
-            }
-
-            // Update num elements
-            const uint32 totalLength =
-                static_cast<uint32>(iterator - this->begin()) + length + length2 + static_cast<uint32>(addSign);
-            constexpr int32 doubleFix = isSame<T, float64> ? 1 : 0;
-            uint32 numberElements = pointOffset > 0 ? totalLength + 2 + doubleFix : totalLength;
-            numberElements = pointOffset < 0 ? numberElements + 3 + doubleFix : numberElements;
-            // Check if we need to increase number elements
-            if (numberElements > this->getLength()) [[unlikely]] {
-                // Update num elements
-                if (!this->checkReservedLength(numberElements, iterator)) [[unlikely]] {
-                    return false;
-                }
-                this->nextElement = this->handle.pointer + numberElements;
-            }
-
-            // Add sign bit if required (must be performed after the array has been resized)
-            TypeIterator startIterator(iterator);
-            if (addSign) {
-                this->at(startIterator) = utfMinus;
-                ++startIterator;
-            }
-
-            // Must get iterator here so as to not include potential exponent
-            TypeIterator iterator2(this->begin() + totalLength);
-
-            // If there is a point offset then we need to add the required e^x to signal the correct exponent
-            if (pointOffset) {
-                constexpr sizeType convertBaseMax = isSame<sizeType, uint32> ?
-                    1000000000 :
-                    static_cast<sizeType>(
-                        10000000000000000000ui64); // Max power of base that can fit in 32/64bit integer
-                --iterator2; // One less char should be written (pre/post-point already includes '0' that will just be
-                             // overwritten)
-                // Need to add the base exponent
-                this->at(iterator2) = CharType('e'); // Since we have one less post-point digit so we use one of its
-                TypeIterator iteratorExponent(iterator2 + 1);
-                if (pointOffset > 0) {
-                    // Determine the proper exponent
-                    pointOffset = (static_cast<int32>(length2) + pointOffset) -
-                        2; // Minus 2 as pre-point will still have length 2 afterwards
-
-                    // Need to swap all but the highest digit from the pre-point to the post-point
-                    postPoint = prePoint; // Don't need to subtract anything as the most significant digit wont be
-                                          // printed anyway
-                    prePoint /= convertBaseMax;
-                    if (prePoint == 0) {
-                        prePoint = postPoint / (convertBaseMax / 10);
-                        if (prePoint == 0) [[unlikely]] {
-                            prePoint = postPoint / (convertBaseMax / 100);
-                        }
-                    }
-
-                    // Update the new lengths (simple as the pre-point is now only 1 digit long + '.')
-                    length2 = 2;
-                } else {
-                    // Add the negative sign
-                    this->at(iteratorExponent++) = utfMinus;
-                    pointOffset = 1 - (static_cast<int32>(length) + pointOffset);
-
-                    // Need to swap the highest digit from the post-point to the pre-point
-                    sizeType convertBase2 = convertBaseMax;
-                    prePoint = postPoint / convertBase2;
-                    while (prePoint == 0) {
-                        convertBase2 /= 10;
-                        prePoint = postPoint / convertBase2;
-                    }
-                }
-                // Add the actual exponent value (only currently accepts 2 digits)
-                if constexpr (isSame<T, float64>) {
-                    // Requires 3 digits
-                    const int32 baseExpoBack2 = pointOffset / static_cast<int32>(convertBase * convertBase);
-                    pointOffset -= baseExpoBack2 * static_cast<int32>(convertBase * convertBase);
-                    this->at(iteratorExponent++) = utfZero + static_cast<CharType>(baseExpoBack2);
-                }
-                // Requires 2 digits
-                const int32 baseExpoBack = pointOffset / static_cast<int32>(convertBase);
-                pointOffset -= baseExpoBack * static_cast<int32>(convertBase);
-                this->at(iteratorExponent++) = utfZero + static_cast<CharType>(baseExpoBack);
-                this->at(iteratorExponent) = utfZero + static_cast<CharType>(pointOffset);
-            }
-
-            // Fill array with chars for post-point
-            while (startIterator + length2 < iterator2) {
-                --iterator2;
-                const sizeType value = postPoint / static_cast<sizeType>(convertBase);
-                this->at(iterator2) =
-                    utfZero + static_cast<CharType>(postPoint - (value * static_cast<sizeType>(convertBase)));
-                postPoint = value;
-            }
-
-            // Add the decimal point
-            --iterator2;
-            this->at(iterator2) = utfDot;
-
-            // Fill array with chars for pre-point
-            while (startIterator < iterator2) {
-                --iterator2;
-                const sizeType value = prePoint / static_cast<sizeType>(convertBase);
-                this->at(iterator2) =
-                    utfZero + static_cast<CharType>(prePoint - (value * static_cast<sizeType>(convertBase)));
-                prePoint = value;
-            }
-            return true;
+        // Reserve enough space for the longest possible number so that it can be written directly into the string
+        const auto offset = static_cast<uint0>(iterator - this->begin());
+        if (!this->checkReservedLength(offset + numberFormatLength<T>, iterator)) [[unlikely]] {
+            return false;
+        }
+        const uint0 numberElements = offset + formatNumber(number, this->handle.pointer + offset);
+        // Check if we need to increase number elements
+        if (numberElements > this->getLength()) [[unlikely]] {
+            this->nextElement = this->handle.pointer + numberElements;
         }
+        return true;
     }
 
     using IArray::at;
@@ -1060,7 +732,7 @@ public:
      */
     XS_INLINE const CharType& findFirst(const String& string) const noexcept
     {
-        return this->IArray::findFirst(*reinterpret_cast<const IArray*>(&string));
+        return findFirst(Search(string.getData(), string.getLength()));
     }
 
     /**
@@ -1071,7 +743,7 @@ public:
      */
     XS_INLINE const CharType& findFirst(const String& string, const uint0 position) const noexcept
     {
-        return this->IArray::findFirst(*reinterpret_cast<const IArray*>(&string), position);
+        return findFirst(Search(string.getData(), string.getLength()), position);
     }
 
     /**
@@ -1082,7 +754,18 @@ public:
      */
     XS_INLINE const CharType& findFirst(const String& string, const TypeConstIterator& iterator) const noexcept
     {
-        return this->IArray::findFirst(*reinterpret_cast<const IArray*>(&string), iterator);
+        return findFirst(Search(string.getData(), string.getLength()), this->positionAt(iterator));
+    }
+
+    /**
+     * Find the first occurrence of a precompiled sequence of elements.
+     * @param search   The search to perform.
+     * @param position (Optional) The position to start searching at.
+     * @return The element found within the string (return is nullptr if the input element could not be found).
+     */
+    XS_INLINE const CharType& findFirst(const Search& search, const uint0 position = 0) const noexcept
+    {
+        return getFound(searchFirst(search, position));
     }
 
     using IArray::findFirst;
@@ -1094,7 +777,7 @@ public:
      */
     XS_INLINE const CharType& findLast(const String& string) const noexcept
     {
-        return this->IArray::findLast(*reinterpret_cast<const IArray*>(&string));
+        return findLast(Search(string.getData(), string.getLength()));
     }
 
     /**
@@ -1107,7 +790,7 @@ public:
      */
     XS_INLINE const CharType& findLast(const String& string, const uint0 position) const noexcept
     {
-        return this->IArray::findLast(*reinterpret_cast<const IArray*>(&string), position);
+        return findLast(Search(string.getData(), string.getLength()), position);
     }
 
     /**
@@ -1120,7 +803,20 @@ public:
      */
     XS_INLINE const CharType& findLast(const String& string, const TypeConstIterator& iterator) const noexcept
     {
-        return this->IArray::findLast(*reinterpret_cast<const IArray*>(&string), iterator);
+        return findLast(Search(string.getData(), string.getLength()), this->positionAt(iterator));
+    }
+
+    /**
+     * Find the last occurrence of a precompiled sequence of elements.
+     * @note Search position specifies the last possible position for searching. When finding last the search range
+     * is actually [0->position].
+     * @param search   The search to perform.
+     * @param position (Optional) The position to start searching at (defaults to the end of the string).
+     * @return The element found within the array (return is nullptr if the input element could not be found).
+     */
+    XS_INLINE const CharType& findLast(const Search& search, const uint0 position = UINT_MAX) const noexcept
+    {
+        return getFound(searchLast(search, position));
     }
 
     using IArray::findLast;
@@ -1133,7 +829,19 @@ public:
      */
     XS_INLINE uint0 indexOfFirst(const String& string) const noexcept
     {
-        return this->IArray::indexOfFirst(*reinterpret_cast<const IArray*>(&string));
+        return searchFirst(Search(string.getData(), string.getLength()), 0);
+    }
+
+    /**
+     * Find the index of the first occurrence of a precompiled sequence of elements.
+     * @param search   The search to perform.
+     * @param position (Optional) The position to start searching at.
+     * @return The location of the element within the array (return is UINT_MAX if the input element could not be
+     * found).
+     */
+    XS_INLINE uint0 indexOfFirst(const Search& search, const uint0 position = 0) const noexcept
+    {
+        return searchFirst(search, position);
     }
 
     using IArray::indexOfFirst;
@@ -1146,11 +854,73 @@ public:
      */
     XS_INLINE uint0 indexOfLast(const String& string) const noexcept
     {
-        return this->IArray::indexOfLast(*reinterpret_cast<const IArray*>(&string));
+        return searchLast(Search(string.getData(), string.getLength()), UINT_MAX);
+    }
+
+    /**
+     * Find the index of the last occurrence of a precompiled sequence of elements.
+     * @note Search position specifies the last possible position for searching. When finding last the search range
+     * is actually [0->position].
+     * @param search   The search to perform.
+     * @param position (Optional) The position to start searching at (defaults to the end of the string).
+     * @return The location of the element within the array (return is UINT_MAX if the input element could not be
+     * found).
+     */
+    XS_INLINE uint0 indexOfLast(const Search& search, const uint0 position = UINT_MAX) const noexcept
+    {
+        return searchLast(search, position);
     }
 
     using IArray::indexOfLast;
 
+    /**
+     * Find the index of every occurrence of a sequence of elements.
+     * @note Overlapping occurrences are all found.
+     * @param string The elements to search for.
+     * @return The location of each occurrence within the array (may be incomplete if memory could not be allocated).
+     */
+    XS_INLINE DArray<uint0> indexOfAll(const String& string) const noexcept
+    {
+        return indexOfAll(Search(string.getData(), string.getLength()));
+    }
+
+    /**
+     * Find the index of every occurrence of a precompiled sequence of elements.
+     * @note Overlapping occurrences are all found.
+     * @param search The search to perform.
+     * @return The location of each occurrence within the array (may be incomplete if memory could not be allocated).
+     */
+    XS_INLINE DArray<uint0> indexOfAll(const Search& search) const noexcept
+    {
+        DArray<uint0> ret;
+        search.findAll(this->handle.pointer, this->getLength(), ret);
+        return ret;
+    }
+
+    /**
+     * Split the string into the tokens between each occurrence of a delimiter.
+     * @note Tokens are views into the strings internal data so the string must not be modified while splitting.
+     * @param delimiter The character that separates each token.
+     * @return The splitter used to get each token.
+     */
+    XS_INLINE Split split(const CharType delimiter) const noexcept
+    {
+        return Split(StringView<CharType>(this->handle.pointer, this->getLength()), delimiter);
+    }
+
+    /**
+     * Split the string into the tokens between each occurrence of a delimiter.
+     * @note Tokens are views into the strings internal data so the string must not be modified while splitting.
+     * @param delimiter The delimiter characters (must be non-empty and no longer than Split::maxDelimiterLength).
+     * @param type      (Optional) How the delimiter characters separate each token.
+     * @return The splitter used to get each token.
+     */
+    XS_INLINE Split split(const String& delimiter, const SplitDelimiter type = SplitDelimiter::Sequence) const noexcept
+    {
+        return Split(StringView<CharType>(this->handle.pointer, this->getLength()),
+            StringView<CharType>(delimiter.handle.pointer, delimiter.getLength()), type);
+    }
+
     /**
      * Get a pointer to the arrays internal data.
      * @return Pointer to start of internal memory.
@@ -1176,43 +946,36 @@ public:
     /**
      * Convert all characters in the string to there lower case equivalent.
      * @note Only converts if character has lower case equivalent (or not already in lower case) and is a standard Latin
-     * character. If not then character remains unchanged.
+     * character (ASCII for char strings, ASCII and Latin-1 supplement for all others). If not then character remains
+     * unchanged.
      */
     XS_INLINE void toLower() noexcept
     {
-        for (auto& i : *this) {
-            if (i >= 0x41 && i < 0x5A) {
-                i += 0x20;
-            }
-        }
+        utfToLower(this->handle.pointer, this->getLength());
     }
 
     /**
      * Convert all characters in the string to there upper case equivalent.
      * @note Only converts if character has upper case equivalent (or not already in upper case) and is a standard Latin
-     * character. If not then character remains unchanged.
+     * character (ASCII for char strings, ASCII and Latin-1 supplement for all others). If not then character remains
+     * unchanged.
      */
     XS_INLINE void toUpper() noexcept
     {
-        for (auto& i : *this) {
-            if (i >= 0x61 && i < 0x7A) {
-                i -= 0x20;
-            }
-        }
+        utfToUpper(this->handle.pointer, this->getLength());
     }
 
     /**
      * Convert the string to a number.
      * @note Converts string up till the first non-numeric character.
      * @tparam T Type of the returned number.
-     * @returns The converted numeric value.
+     * @returns The converted numeric value (0 if the string does not start with a number).
      */
     template<typename T>
-    requires(isArithmetic<T>)
+    requires(isInteger<T> || isSameAny<T, float32, float64>)
     XS_INLINE T toNumber() const noexcept
     {
-        static_assert(isArithmetic<T>, "Invalid Type: Only native arithmetic numbers are supported");
-        return toNumber<T>(this->cbegin());
+        return parseNumber<T>().value;
     }
 
     /**
@@ -1220,14 +983,13 @@ public:
      * @note Converts string up till the first non-numeric character.
      * @tparam T Type of the returned number.
      * @param position The position in the string to get the number from.
-     * @returns The converted numeric value.
+     * @returns The converted numeric value (0 if the string does not start with a number).
      */
     template<typename T>
-    requires(isArithmetic<T>)
+    requires(isInteger<T> || isSameAny<T, float32, float64>)
     XS_INLINE T toNumber(const uint0 position) const noexcept
     {
-        static_assert(isArithmetic<T>, "Invalid Type: Only native arithmetic numbers are supported");
-        return toNumber<T>(this->iteratorAt(position));
+        return parseNumber<T>(position).value;
     }
 
     /**
@@ -1235,42 +997,28 @@ public:
      * @note Converts string up till the first non-numeric character.
      * @tparam T Type of the returned number.
      * @param iterator The position in the string to get the number from.
-     * @returns The converted numeric value.
+     * @returns The converted numeric value (0 if the string does not start with a number).
      */
     template<typename T>
-    requires(isArithmetic<T>)
+    requires(isInteger<T> || isSameAny<T, float32, float64>)
     XS_INLINE T toNumber(const TypeConstIterator& iterator) const noexcept
     {
-        static_assert(isArithmetic<T>, "Invalid Type: Only native arithmetic numbers are supported");
-        T ret = 0;
-        if constexpr (isInteger<T>) {
-            bool negative = false;
-            TypeConstIterator tempIt(iterator);
-            while (tempIt < this->cend()) {
-                // Check for valid number
-                const CharType newChar = this->at(tempIt);
-                if ((newChar >= utfZero) && (newChar < utfZero + 10)) [[likely]] {
-                    // Multiply existing number by base (i.e. 10)
-                    ret *= 10;
-                    // Add the new digit
-                    ret += static_cast<T>(newChar - utfZero);
-                } else if (newChar == utfMinus) {
-                    negative = true;
-                } else {
-                    break;
-                }
-                ++tempIt;
-            }
-            if constexpr (isSigned<T>) {
-                if (negative) {
-                    ret = -ret;
-                }
-            }
-            return ret;
-        } else {
-            static_assert(isArithmetic<T>, "Invalid Type: Floating point conversion not currently implemented");
-            return T{0};
-        }
+        return parseNumber<T>(this->positionAt(iterator)).value;
+    }
+
+    /**
+     * Parse a number from the string.
+     * @note Parses up till the first character that is not part of the number.
+     * @tparam T Type of the returned number.
+     * @param position (Optional) The position in the string to get the number from.
+     * @returns The parsed number, the number of characters it used and any error that occurred.
+     */
+    template<typename T>
+    requires(isInteger<T> || isSameAny<T, float32, float64>)
+    XS_INLINE NumberParse<T> parseNumber(const uint0 position = 0) const noexcept
+    {
+        XS_ASSERT(position <= this->getLength());
+        return Shift::parseNumber<T>(this->handle.pointer + position, this->getLength() - position);
     }
 
     /**
@@ -1331,6 +1079,90 @@ public:
         return compare(TypeConstIterator(string), TypeConstIterator(string + CharLength(string)));
     }
 
+    /**
+     * Compare the string to a string sequence ignoring case.
+     * @note Characters are compared as if both were first converted using toLower.
+     * @param string Sequence of characters to compare to.
+     * @param number The number of characters in the input.
+     * @return Integer describing character comparison (0=equal, >0=greater than, <0=less than).
+     */
+    XS_INLINE int32 compareIgnoreCase(const CharType* const XS_RESTRICT string, const uint0 number) const noexcept
+    {
+        return utfCompareIgnoreCase(this->handle.pointer, this->getLength(), string, number);
+    }
+
+    /**
+     * Compare two strings to each other ignoring case.
+     * @param string The string to compare to.
+     * @return Integer describing character comparison (0=equal, >0=greater than, <0=less than).
+     */
+    XS_INLINE int32 compareIgnoreCase(const String& string) const noexcept
+    {
+        return compareIgnoreCase(string.getData(), string.getLength());
+    }
+
+    /**
+     * Compare the string to a string view ignoring case.
+     * @param string The view to compare to.
+     * @return Integer describing character comparison (0=equal, >0=greater than, <0=less than).
+     */
+    XS_INLINE int32 compareIgnoreCase(const StringView<CharType>& string) const noexcept
+    {
+        return compareIgnoreCase(string.data(), string.size());
+    }
+
+    /**
+     * Compare the string to a string sequence ignoring case.
+     * @param string Sequence of characters to compare to.
+     * @return Integer describing character comparison (0=equal, >0=greater than, <0=less than).
+     */
+    XS_INLINE int32 compareIgnoreCase(const CharType* const XS_RESTRICT string) const noexcept
+    {
+        return compareIgnoreCase(string, CharLength(string));
+    }
+
+    /**
+     * Query if the string is equal to a string sequence ignoring case.
+     * @note Case conversion never changes the number of characters so strings of different lengths are never equal.
+     * @param string Sequence of characters to compare to.
+     * @param number The number of characters in the input.
+     * @return True if equal, false if not.
+     */
+    XS_INLINE bool equalsIgnoreCase(const CharType* const XS_RESTRICT string, const uint0 number) const noexcept
+    {
+        return (this->getLength() == number) && (compareIgnoreCase(string, number) == 0);
+    }
+
+    /**
+     * Query if two strings are equal ignoring case.
+     * @param string The string to compare to.
+     * @return True if equal, false if not.
+     */
+    XS_INLINE bool equalsIgnoreCase(const String& string) const noexcept
+    {
+        return equalsIgnoreCase(string.getData(), string.getLength());
+    }
+
+    /**
+     * Query if the string is equal to a string view ignoring case.
+     * @param string The view to compare to.
+     * @return True if equal, false if not.
+     */
+    XS_INLINE bool equalsIgnoreCase(const StringView<CharType>& string) const noexcept
+    {
+        return equalsIgnoreCase(string.data(), string.size());
+    }
+
+    /**
+     * Query if the string is equal to a string sequence ignoring case.
+     * @param string Sequence of characters to compare to.
+     * @return True if equal, false if not.
+     */
+    XS_INLINE bool equalsIgnoreCase(const CharType* const XS_RESTRICT string) const noexcept
+    {
+        return equalsIgnoreCase(string, CharLength(string));
+    }
+
     /**
      * Perform compound addition of 2 string.
      * @param string Second string to add.
@@ -1353,33 +1185,50 @@ public:
         return *this;
     }
 
+    /**
+     * Perform compound addition of a string and a concatenation expression.
+     * @tparam Number The number of strings in the expression.
+     * @param concat The expression to add.
+     * @return The result of the operation.
+     */
+    template<uint0 Number>
+    XS_INLINE String& operator+=(const StringConcat<CharType, Number>& concat) noexcept
+    {
+        this->add(concat);
+        return *this;
+    }
+
     /**
      * Perform addition of 2 string.
+     * @note Use concat to combine more than 2 strings with a single allocation.
      * @param string Second string to add.
      * @return New string made from combination of inputs.
      */
     XS_INLINE String operator+(const String& string) const noexcept
     {
-        String ret;
-        ret.checkReservedSize(this->IArray::getSize() + string.getSize());
-        ret.add(*this);
-        ret.add(string);
-        return ret;
+        return String(StringConcat<CharType, 2>(StringView<CharType>(this->getData(), this->getLength()),
+            StringView<CharType>(string.getData(), string.getLength())));
     }
 
     /**
      * Perform addition of a string and a character sequence.
      * @param string Sequence of characters to add.
-     * @return The result of the operation.
+     * @return New string made from combination of inputs.
      */
     XS_INLINE String operator+(const CharType* const XS_RESTRICT string) const noexcept
     {
-        const auto number = CharLength(string);
-        String ret;
-        ret.checkReservedSize(this->IArray::getSize() + (number * sizeof(CharType)));
-        ret.add(*this);
-        ret.add(string, number);
-        return ret;
+        return String(StringConcat<CharType, 2>(
+            StringView<CharType>(this->getData(), this->getLength()), StringView<CharType>(string, CharLength(string))));
+    }
+
+    /**
+     * Perform addition of a string and a string view.
+     * @param string The view to add.
+     * @return New string made from combination of inputs.
+     */
+    XS_INLINE String operator+(const StringView<CharType>& string) const noexcept
+    {
+        return String(StringConcat<CharType, 2>(StringView<CharType>(this->getData(), this->getLength()), string));
     }
 
     /**
@@ -1501,6 +1350,286 @@ public:
     {
         return this->compare(string, CharLength(string)) >= 0;
     }
+
+private:
+    /**
+     * Find the first occurrence of a search.
+     * @param search   The search to perform.
+     * @param position The position to start searching at.
+     * @return The location of the occurrence within the string (return is UINT_MAX if not found).
+     */
+    XS_INLINE uint0 searchFirst(const Search& search, const uint0 position) const noexcept
+    {
+        XS_ASSERT(position <= this->getLength());
+        const uint0 found = search.findFirst(this->handle.pointer + position, this->getLength() - position);
+        return found != UINT_MAX ? found + position : UINT_MAX;
+    }
+
+    /**
+     * Find the last occurrence of a search.
+     * @param search   The search to perform.
+     * @param position The position that the occurrence must end before.
+     * @return The location of the occurrence within the string (return is UINT_MAX if not found).
+     */
+    XS_INLINE uint0 searchLast(const Search& search, const uint0 position) const noexcept
+    {
+        return search.findLast(this->handle.pointer, min(position, this->getLength()));
+    }
+
+    /**
+     * Get the element found by a search.
+     * @param index The location of the element within the string (UINT_MAX if not found).
+     * @return The element found within the string (return is nullptr if the input element could not be found).
+     */
+    XS_INLINE const CharType& getFound(const uint0 index) const noexcept
+    {
+        if (index != UINT_MAX) [[likely]] {
+            return this->handle.pointer[index];
+        }
+        return *static_cast<const CharType*>(nullptr);
+    }
+
+    /**
+     * Set an empty string to a sequence of characters in a different encoding.
+     * @note The output length is calculated up front so that only a single allocation is required.
+     * @tparam CharType2 Type of character being converted.
+     * @param elements Pointer to list of elements to convert (UTF8 input must be valid).
+     * @param number   The number of elements in the input list.
+     */
+    template<typename CharType2>
+    XS_INLINE void addConverted(const CharType2* const XS_RESTRICT elements, const uint0 number) noexcept
+    {
+        XS_ASSERT(this->isEmpty());
+        const uint0 length = utfConvertLength<CharType>(elements, number);
+        if (this->setReservedLength(length)) [[likely]] {
+            this->nextElement = this->handle.pointer + utfConvert(elements, number, this->handle.pointer);
+            XS_ASSERT(this->getLength() == length);
+        }
+    }
+};
+
+namespace NoExport {
+/**
+ * Get a view of a string used as part of a concatenation expression.
+ * @tparam CharType Type of character used by the string.
+ * @tparam Alloc    Type of allocator used by the string.
+ * @param string The string.
+ * @returns The view.
+ */
+template<typename CharType, class Alloc>
+XS_INLINE StringView<CharType> concatView(const String<CharType, Alloc>& string) noexcept
+{
+    return StringView<CharType>(string.getData(), string.getLength());
+}
+
+/**
+ * Get a view of a string view used as part of a concatenation expression.
+ * @tparam CharType Type of character used by the view.
+ * @param string The view.
+ * @returns The view.
+ */
+template<typename CharType>
+XS_INLINE StringView<CharType> concatView(const StringView<CharType>& string) noexcept
+{
+    return string;
+}
+
+/**
+ * Get a view of a character sequence used as part of a concatenation expression.
+ * @tparam CharType Type of character used by the sequence.
+ * @param string Sequence of characters (must be null terminated).
+ * @returns The view.
+ */
+template<typename CharType>
+XS_INLINE StringView<CharType> concatView(const CharType* const XS_RESTRICT string) noexcept
+{
+    return StringView<CharType>(string, String<CharType>::CharLength(string));
+}
+} // namespace NoExport
+
+/**
+ * Create an expression that lazily concatenates a sequence of strings.
+ * @note The expression only references its inputs and must not outlive them. Converting it to a String (or adding it
+ * to a String/StringBuilder) creates the result with a single allocation. Each input can be a String, StringView or
+ * null terminated character sequence.
+ * @tparam CharType Type of character used by the strings.
+ * @tparam Alloc    Type of allocator used by the first string.
+ * @tparam Strings  Type of the remaining strings.
+ * @param string  The first string.
+ * @param strings The remaining strings.
+ * @returns The expression.
+ */
+template<typename CharType, class Alloc, typename... Strings>
+requires(sizeof...(Strings) > 0)
+XS_INLINE StringConcat<CharType, sizeof...(Strings) + 1> concat(
+    const String<CharType, Alloc>& string, const Strings&... strings) noexcept
+{
+    return StringConcat<CharType, sizeof...(Strings) + 1>(
+        NoExport::concatView(string), NoExport::concatView<CharType>(strings)...);
+}
+
+/**
+ * String that stores short strings inline without requiring any memory allocation.
+ * @note Up to 24 Bytes of characters are stored within the string object itself, longer strings are allocated on the
+ * heap. As the characters may be stored inline these strings must not be stored in containers that relocate elements
+ * using a raw memory copy.
+ * @tparam CharType Type of character used by the string.
+ */
+template<typename CharType = char>
+using SmallString = String<CharType, AllocRegionSmall<CharType, 24 / sizeof(CharType)>>;
+
+/**
+ * Convert a number to a string.
+ * @note Only a single allocation large enough for the longest possible number is performed and the number is written
+ * directly into it (see formatNumber for the format used).
+ * @tparam CharType Type of character used by the string.
+ * @tparam T        Type of number.
+ * @param number The number to convert.
+ * @returns The new string.
+ */
+template<typename CharType = char, typename T>
+requires(isArithmetic<T> && !isSame<CharType, T>)
+XS_INLINE String<CharType> toString(const T number) noexcept
+{
+    return String<CharType>(number, numberFormatLength<T>);
+}
+
+/**
+ * Expression used to lazily concatenate a sequence of strings.
+ * @note Each piece of the expression is only referenced and no memory is allocated until the expression is converted
+ * to a String. At that point the combined length is already known so the result is created with a single allocation
+ * and one copy per piece. As the inputs are only referenced the expression must not outlive the strings used to create
+ * it (i.e. avoid storing the result of concat in an auto variable). Expressions are started using concat.
+ * @tparam CharType Type of character used by the strings.
+ * @tparam Number   The number of strings in the expression.
+ */
+template<typename CharType, uint0 Number>
+class StringConcat
+{
+    static_assert(Number >= 2, "Invalid number: A concatenation requires at least 2 strings");
+
+public:
+    using View = StringView<CharType>;
+    using StringType = String<CharType>;
+
+    /**< The strings in the expression */
+    View pieces[Number]; // NOLINT(modernize-avoid-c-arrays)
+    /**< The combined length of all strings */
+    uint0 length;
+
+    /**
+     * Constructor from a list of strings.
+     * @tparam Views Type of each string (must be View).
+     * @param strings The strings in the expression.
+     */
+    template<typename... Views>
+    requires(sizeof...(Views) == Number && (isSame<Views, View> && ...))
+    XS_INLINE explicit StringConcat(const Views&... strings) noexcept
+        : pieces{strings...}
+        , length((strings.size() + ...))
+    {}
+
+    /**
+     * Constructor to extend an existing expression.
+     * @tparam Number2 The number of strings in the existing expression.
+     * @param concat The existing expression.
+     * @param view   The view to add at the end of the expression.
+     */
+    template<uint0 Number2>
+    requires(Number2 + 1 == Number)
+    XS_INLINE StringConcat(const StringConcat<CharType, Number2>& concat, const View& view) noexcept
+        : length(concat.length + view.size())
+    {
+        for (uint0 i = 0; i < Number2; ++i) {
+            pieces[i] = concat.pieces[i];
+        }
+        pieces[Number - 1] = view;
+    }
+
+    /**
+     * Get the combined length of all strings in the expression.
+     * @returns The length of the string that will be created.
+     */
+    XS_INLINE uint0 getLength() const noexcept
+    {
+        return length;
+    }
+
+    /**
+     * Create the string described by the expression.
+     * @returns The new string.
+     */
+    XS_INLINE StringType toString() const noexcept
+    {
+        return StringType(*this);
+    }
+
+    /**
+     * Perform addition of an expression and a string.
+     * @tparam Alloc Type of allocator used by the string.
+     * @param string The string to add.
+     * @returns The extended expression.
+     */
+    template<class Alloc>
+    XS_INLINE StringConcat<CharType, Number + 1> operator+(const String<CharType, Alloc>& string) const noexcept
+    {
+        return StringConcat<CharType, Number + 1>(*this, View(string.getData(), string.getLength()));
+    }
+
+    /**
+     * Perform addition of an expression and a character sequence.
+     * @param string Sequence of characters to add.
+     * @returns The extended expression.
+     */
+    XS_INLINE StringConcat<CharType, Number + 1> operator+(const CharType* const XS_RESTRICT string) const noexcept
+    {
+        return StringConcat<CharType, Number + 1>(*this, View(string, StringType::CharLength(string)));
+    }
+
+    /**
+     * Perform addition of an expression and a string view.
+     * @param string The view to add.
+     * @returns The extended expression.
+     */
+    XS_INLINE StringConcat<CharType, Number + 1> operator+(const View& string) const noexcept
+    {
+        return StringConcat<CharType, Number + 1>(*this, string);
+    }
+
+    /**
+     * Perform comparison equals operation between the result of the expression and a string.
+     * @note This compares each piece in place without creating the combined string.
+     * @tparam Alloc Type of allocator used by the string.
+     * @param string The string to compare to.
+     * @returns Result of comparison.
+     */
+    template<class Alloc>
+    XS_INLINE bool operator==(const String<CharType, Alloc>& string) const noexcept
+    {
+        if (length != string.getLength()) {
+            return false;
+        }
+        const CharType* current = string.getData();
+        for (const auto& piece : pieces) {
+            if (piece != View(current, piece.size())) {
+                return false;
+            }
+            current += piece.size();
+        }
+        return true;
+    }
+
+    /**
+     * Perform comparison not equals operation between the result of the expression and a string.
+     * @tparam Alloc Type of allocator used by the string.
+     * @param string The string to compare to.
+     * @returns Result of comparison.
+     */
+    template<class Alloc>
+    XS_INLINE bool operator!=(const String<CharType, Alloc>& string) const noexcept
+    {
+        return !(*this == string);
+    }
 };
 
 XS_INLINE String<char> operator"" _s(const char* string, const uint0 length) noexcept
@@ -0,0 +1,400 @@
+#pragma once
+/**
+ * Copyright Matthew Oliver
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Memory/XSAllocatorHeap.hpp"
+#include "Memory/XSDArray.hpp"
+#include "Memory/XSString.hpp"
+#include "Memory/XSStringView.hpp"
+
+namespace Shift {
+namespace NoExport {
+/**
+ * Block of characters used by a string builder.
+ * @tparam Handle Type of handle used to allocate the characters.
+ */
+template<typename Handle>
+class StringBuilderChunk
+{
+public:
+    Handle handle;    /**< The characters stored in the chunk */
+    uint0 length = 0; /**< Number of characters currently stored */
+    uint0 capacity;   /**< Number of characters that can be stored */
+
+    /**
+     * Constructor that allocates space for a number of characters.
+     * @param number The number of characters to allocate space for.
+     */
+    XS_INLINE explicit StringBuilderChunk(const uint0 number) noexcept
+        : handle(number)
+        , capacity(handle.pointer != nullptr ? number : 0)
+    {}
+};
+} // namespace NoExport
+
+/**
+ * Helper used to create a string from many smaller pieces.
+ * @note Added strings are gathered into a list of chunks. Once a chunk is full a new larger one is allocated instead
+ * of reallocating and copying existing contents, the combined length is tracked as pieces are added so the final
+ * string can be created with a single allocation and one copy per chunk. Chunks are kept when the builder is cleared
+ * so that a builder can be reused without any further allocations.
+ * @tparam CharType Type of character used by the strings.
+ * @tparam Alloc    Type of allocator used to allocate chunks.
+ */
+template<typename CharType = char, class Alloc = AllocRegionHeap<CharType>>
+class StringBuilder
+{
+    static_assert(isSameAny<CharType, char, char8, char16, char32>,
+        "Invalid character type: Template parameter must be a valid char type");
+
+public:
+    using StringType = String<CharType>;
+    using View = StringView<CharType>;
+    using Handle = typename Alloc::Handle;
+    using Chunk = NoExport::StringBuilderChunk<Handle>;
+    using ChunkArray = DArray<Chunk, typename Alloc::template Allocator<Chunk>>;
+
+    /**< The minimum number of characters allocated for a chunk */
+    static constexpr uint0 chunkLength = 256;
+
+    ChunkArray chunks; /**< The list of chunks, only those up to current contain characters */
+    uint0 current = 0; /**< The chunk currently being added to */
+    uint0 length = 0;  /**< The combined number of characters in all chunks */
+
+    /** Default constructor. */
+    XS_INLINE StringBuilder() noexcept = default;
+
+    /**
+     * Constructor that reserves space for a number of characters.
+     * @param number The number of characters to reserve space for.
+     */
+    XS_INLINE explicit StringBuilder(const uint0 number) noexcept
+    {
+        addChunk(number);
+    }
+
+    /**
+     * Copy constructor.
+     * @note The copy contains all characters in a single chunk.
+     * @param other The other builder.
+     */
+    XS_INLINE StringBuilder(const StringBuilder& other) noexcept
+    {
+        if (other.length > 0 && addChunk(other.length)) [[likely]] {
+            other.copy(chunks.at(0).handle.pointer);
+            chunks.at(0).length = other.length;
+            length = other.length;
+        }
+    }
+
+    /**
+     * Move constructor.
+     * @param other The other builder.
+     */
+    XS_INLINE StringBuilder(StringBuilder&& other) noexcept
+        : chunks(move(other.chunks))
+        , current(other.current)
+        , length(other.length)
+    {
+        other.current = 0;
+        other.length = 0;
+    }
+
+    /** Destructor. */
+    XS_INLINE ~StringBuilder() noexcept = default;
+
+    /**
+     * Assignment operator.
+     * @param other The other builder.
+     * @returns A deep copy of this object.
+     */
+    XS_INLINE StringBuilder& operator=(const StringBuilder& other) noexcept
+    {
+        StringBuilder temp(other);
+        swap(temp);
+        return *this;
+    }
+
+    /**
+     * Move assignment operator.
+     * @param other The other builder.
+     * @returns A shallow copy of this object.
+     */
+    XS_INLINE StringBuilder& operator=(StringBuilder&& other) noexcept
+    {
+        swap(other);
+        return *this;
+    }
+
+    /**
+     * Swap the contents of two builders around.
+     * @param [in,out] other The builder to swap with this one.
+     */
+    XS_INLINE void swap(StringBuilder& other) noexcept
+    {
+        chunks.swap(other.chunks);
+        Shift::swap(current, other.current);
+        Shift::swap(length, other.length);
+    }
+
+    /**
+     * Query if the builder is empty.
+     * @returns True if no characters have been added.
+     */
+    XS_INLINE bool isEmpty() const noexcept
+    {
+        return length == 0;
+    }
+
+    /**
+     * Get the combined number of characters added to the builder.
+     * @returns The length of the string that will be created.
+     */
+    XS_INLINE uint0 getLength() const noexcept
+    {
+        return length;
+    }
+
+    /**
+     * Get the number of characters that can be added before a new chunk is required.
+     * @returns The number of characters that space has been reserved for.
+     */
+    XS_INLINE uint0 getReservedLength() const noexcept
+    {
+        uint0 ret = length;
+        for (uint0 i = current; i < chunks.getLength(); ++i) {
+            ret += chunks.at(i).capacity - chunks.at(i).length;
+        }
+        return ret;
+    }
+
+    /**
+     * Add a series of characters.
+     * @note If the current chunk is full the remaining characters are added to a new chunk.
+     * @param elements Pointer to list of characters to add.
+     * @param number   The number of characters in the input list.
+     * @returns Whether operation could be performed (will be false if memory could not be allocated).
+     */
+    XS_INLINE bool add(const CharType* XS_RESTRICT elements, uint0 number) noexcept
+    {
+        while (number > 0) {
+            if (current >= chunks.getLength()) [[unlikely]] {
+                // Each new chunk is at least as large as everything added so far so the number of chunks grows
+                // logarithmically
+                if (!addChunk(max(number, length))) [[unlikely]] {
+                    return false;
+                }
+            }
+            Chunk& chunk = chunks.at(current);
+            const uint0 copyLength = min(number, chunk.capacity - chunk.length);
+            if (copyLength > 0) [[likely]] {
+                memMove(chunk.handle.pointer + chunk.length, elements, copyLength * sizeof(CharType));
+                chunk.length += copyLength;
+                length += copyLength;
+                elements += copyLength;
+                number -= copyLength;
+            }
+            if (number > 0) {
+                ++current;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * Add a single character.
+     * @param element The character to add.
+     * @returns Whether operation could be performed (will be false if memory could not be allocated).
+     */
+    XS_INLINE bool add(const CharType element) noexcept
+    {
+        if (current < chunks.getLength()) [[likely]] {
+            if (Chunk& chunk = chunks.at(current); chunk.length < chunk.capacity) [[likely]] {
+                chunk.handle.pointer[chunk.length] = element;
+                ++chunk.length;
+                ++length;
+                return true;
+            }
+        }
+        return add(&element, 1);
+    }
+
+    /**
+     * Add a string.
+     * @tparam Alloc2 Type of allocator used by the string.
+     * @param string The string to add.
+     * @returns Whether operation could be performed (will be false if memory could not be allocated).
+     */
+    template<class Alloc2>
+    XS_INLINE bool add(const String<CharType, Alloc2>& string) noexcept
+    {
+        return add(string.getData(), string.getLength());
+    }
+
+    /**
+     * Add a string view.
+     * @param string The view to add.
+     * @returns Whether operation could be performed (will be false if memory could not be allocated).
+     */
+    XS_INLINE bool add(const View& string) noexcept
+    {
+        return add(string.data(), string.size());
+    }
+
+    /**
+     * Add a series of characters.
+     * @note This is not as efficient as other similar functions as the number of characters must be calculated.
+     * @param string Input characters.
+     * @returns Whether operation could be performed (will be false if memory could not be allocated).
+     */
+    XS_INLINE bool add(const CharType* const XS_RESTRICT string) noexcept
+    {
+        return add(string, StringType::CharLength(string));
+    }
+
+    /**
+     * Add the pieces of a concatenation expression.
+     * @tparam Number The number of strings in the expression.
+     * @param concat The expression to add.
+     * @returns Whether operation could be performed (will be false if memory could not be allocated).
+     */
+    template<uint0 Number>
+    XS_INLINE bool add(const StringConcat<CharType, Number>& concat) noexcept
+    {
+        for (const auto& piece : concat.pieces) {
+            if (!add(piece)) [[unlikely]] {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * Add a string representation of a number.
+     * @note The conversion is identical to that used by String::add.
+     * @tparam T Generic type parameter.
+     * @param number The number to convert to string and add.
+     * @returns Whether operation could be performed (will be false if memory could not be allocated).
+     */
+    template<typename T>
+    requires(isArithmetic<T> && !isSame<CharType, T>)
+    XS_INLINE bool add(const T number) noexcept
+    {
+        // Write directly into the current chunk when it has space for the longest possible number
+        if (current < chunks.getLength()) [[likely]] {
+            if (Chunk& chunk = chunks.at(current); chunk.capacity - chunk.length >= numberFormatLength<T>) [[likely]] {
+                const uint0 written = formatNumber(number, chunk.handle.pointer + chunk.length);
+                chunk.length += written;
+                length += written;
+                return true;
+            }
+        }
+        CharType buffer[numberFormatLength<T>]; // NOLINT(modernize-avoid-c-arrays)
+        return add(buffer, formatNumber(number, buffer));
+    }
+
+    /**
+     * Perform compound addition of a value to the builder.
+     * @tparam T Generic type parameter.
+     * @param value The value to add (any type supported by add).
+     * @returns The result of the operation.
+     */
+    template<typename T>
+    XS_INLINE StringBuilder& operator+=(const T& value) noexcept
+    {
+        add(value);
+        return *this;
+    }
+
+    /**
+     * Remove all characters from the builder.
+     * @note Allocated chunks are kept so that they can be reused.
+     */
+    XS_INLINE void removeAll() noexcept
+    {
+        for (uint0 i = 0; i < chunks.getLength() && i <= current; ++i) {
+            chunks.at(i).length = 0;
+        }
+        current = 0;
+        length = 0;
+    }
+
+    /**
+     * Copy all characters into a contiguous block of memory.
+     * @param [out] elements Location to copy characters to, must have space for at least getLength() characters.
+     */
+    XS_INLINE void copy(CharType* XS_RESTRICT elements) const noexcept
+    {
+        for (uint0 i = 0; i < chunks.getLength() && i <= current; ++i) {
+            const Chunk& chunk = chunks.at(i);
+            if (chunk.length > 0) {
+                memMove(elements, chunk.handle.pointer, chunk.length * sizeof(CharType));
+                elements += chunk.length;
+            }
+        }
+    }
+
+    /**
+     * Create a string from all added characters.
+     * @note The string is allocated to exactly the required length and each chunk is copied once.
+     * @returns The new string (will be empty if memory could not be allocated).
+     */
+    XS_INLINE StringType toString() const noexcept
+    {
+        StringType ret;
+        toString(ret);
+        return ret;
+    }
+
+    /**
+     * Add all added characters to an existing string.
+     * @tparam Alloc2 Type of allocator used by the string.
+     * @param [in,out] string The string to add to.
+     * @returns Whether operation could be performed (will be false if memory could not be allocated).
+     */
+    template<class Alloc2>
+    XS_INLINE bool toString(String<CharType, Alloc2>& string) const noexcept
+    {
+        if (!string.checkAddReservedLength(length)) [[unlikely]] {
+            return false;
+        }
+        for (uint0 i = 0; i < chunks.getLength() && i <= current; ++i) {
+            const Chunk& chunk = chunks.at(i);
+            string.add(chunk.handle.pointer, chunk.length);
+        }
+        return true;
+    }
+
+private:
+    /**
+     * Allocate a new chunk and add it to the end of the chunk list.
+     * @param number The minimum number of characters the chunk must hold.
+     * @returns Whether operation could be performed (will be false if memory could not be allocated).
+     */
+    XS_INLINE bool addChunk(const uint0 number) noexcept
+    {
+        const uint0 capacity = max(number, chunkLength);
+        if (!chunks.add(capacity)) [[unlikely]] {
+            return false;
+        }
+        if (chunks.at(chunks.getLength() - 1).capacity == 0) [[unlikely]] {
+            chunks.remove();
+            return false;
+        }
+        return true;
+    }
+};
+} // namespace Shift
@@ -0,0 +1,407 @@
+#pragma once
+/**
+ * Copyright Matthew Oliver
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Memory/XSDArray.hpp"
+#include "Memory/XSStringView.hpp"
+#include "XSBit.hpp"
+
+namespace Shift {
+namespace NoExport {
+/**
+ * Check if two sequences of characters are equal.
+ * @tparam T Type of character.
+ * @param string1 The first sequence of characters.
+ * @param string2 The second sequence of characters.
+ * @param number  The number of characters to check.
+ * @returns True if equal, false if not.
+ */
+template<typename T>
+XS_INLINE bool stringEqual(
+    const T* const XS_RESTRICT string1, const T* const XS_RESTRICT string2, const uint0 number) noexcept
+{
+    for (uint0 i = 0; i < number; ++i) {
+        if (string1[i] != string2[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+#if XS_ISA == XS_X86
+/**
+ * Get the bit mask of each character in a block that matches both the first and last character of a needle.
+ * @tparam T Type of character.
+ * @param string The start of the block of 16 bytes to check against the first character.
+ * @param last   The offset from string of the block to check against the last character.
+ * @param first  The first character of the needle in every element.
+ * @param final  The last character of the needle in every element.
+ * @returns The mask of matching bytes.
+ */
+template<typename T>
+XS_INLINE uint32 stringFilterBlock(
+    const T* const XS_RESTRICT string, const uint0 last, const __m128i first, const __m128i final) noexcept
+{
+    const __m128i block1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(string));
+    const __m128i block2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(string + last));
+    __m128i check;
+    if constexpr (sizeof(T) == 1) {
+        check = _mm_and_si128(_mm_cmpeq_epi8(block1, first), _mm_cmpeq_epi8(block2, final));
+    } else if constexpr (sizeof(T) == 2) {
+        check = _mm_and_si128(_mm_cmpeq_epi16(block1, first), _mm_cmpeq_epi16(block2, final));
+    } else {
+        check = _mm_and_si128(_mm_cmpeq_epi32(block1, first), _mm_cmpeq_epi32(block2, final));
+    }
+    return static_cast<uint32>(_mm_movemask_epi8(check));
+}
+
+/**
+ * Fill every element of a register with a character.
+ * @tparam T Type of character.
+ * @param value The character.
+ * @returns The filled register.
+ */
+template<typename T>
+XS_INLINE __m128i stringBroadcast(const T value) noexcept
+{
+    if constexpr (sizeof(T) == 1) {
+        return _mm_set1_epi8(static_cast<int8>(value));
+    } else if constexpr (sizeof(T) == 2) {
+        return _mm_set1_epi16(static_cast<int16>(value));
+    } else {
+        return _mm_set1_epi32(static_cast<int32>(value));
+    }
+}
+
+/**
+ * Get the bit mask of each character in a block that matches both the first and last character of a needle.
+ * @tparam T Type of character.
+ * @param string The start of the block of 32 bytes to check against the first character.
+ * @param last   The offset from string of the block to check against the last character.
+ * @param first  The first character of the needle in every element.
+ * @param final  The last character of the needle in every element.
+ * @returns The mask of matching bytes.
+ */
+template<typename T>
+XS_INLINE uint32 stringFilterBlock(
+    const T* const XS_RESTRICT string, const uint0 last, const __m256i first, const __m256i final) noexcept
+{
+    const __m256i block1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(string));
+    const __m256i block2 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(string + last));
+    __m256i check;
+    if constexpr (sizeof(T) == 1) {
+        check = _mm256_and_si256(_mm256_cmpeq_epi8(block1, first), _mm256_cmpeq_epi8(block2, final));
+    } else if constexpr (sizeof(T) == 2) {
+        check = _mm256_and_si256(_mm256_cmpeq_epi16(block1, first), _mm256_cmpeq_epi16(block2, final));
+    } else {
+        check = _mm256_and_si256(_mm256_cmpeq_epi32(block1, first), _mm256_cmpeq_epi32(block2, final));
+    }
+    return static_cast<uint32>(_mm256_movemask_epi8(check));
+}
+#endif
+
+/**
+ * Find the first occurrence of a needle by checking the first and last characters of every possible position.
+ * @note Blocks of positions are checked at the same time and only those where both characters match have the
+ * remaining characters compared. This performs best for short needles.
+ * @tparam T Type of character.
+ * @param string       The characters to search.
+ * @param length       The number of characters to search.
+ * @param needle       The characters to search for.
+ * @param needleLength The number of characters in the needle (must be non-zero and no larger than length).
+ * @returns The position of the first occurrence (UINT_MAX if not found).
+ */
+template<typename T>
+XS_INLINE uint0 stringFilterFirst(const T* const XS_RESTRICT string, const uint0 length,
+    const T* const XS_RESTRICT needle, const uint0 needleLength) noexcept
+{
+    XS_ASSERT(needleLength > 0 && needleLength <= length);
+    const uint0 last = needleLength - 1;
+    // Number of characters between the first and last
+    const uint0 middle = last > 0 ? last - 1 : 0;
+    // Number of positions where the needle could start
+    const uint0 end = length - last;
+    uint0 i = 0;
+    // Every character sets a bit for each of its bytes so the mask of each character is cleared all at once
+    [[maybe_unused]] constexpr uint32 characterMask = (1U << sizeof(T)) - 1;
+#if XS_ISA == XS_X86
+    if constexpr (hasISAFeature<ISAFeature::AVX2>) {
+        const __m256i first = _mm256_broadcastsi128_si256(stringBroadcast(needle[0]));
+        const __m256i final = _mm256_broadcastsi128_si256(stringBroadcast(needle[last]));
+        for (; i + 32 / sizeof(T) <= end; i += 32 / sizeof(T)) {
+            uint32 mask = stringFilterBlock(string + i, last, first, final);
+            while (mask != 0) {
+                const uint32 bit = ctz(mask);
+                const uint0 position = i + bit / sizeof(T);
+                if (stringEqual(string + position + 1, needle + 1, middle)) {
+                    return position;
+                }
+                mask &= ~(characterMask << bit);
+            }
+        }
+    }
+    if constexpr (hasISAFeature<ISAFeature::SSE2>) {
+        const __m128i first = stringBroadcast(needle[0]);
+        const __m128i final = stringBroadcast(needle[last]);
+        for (; i + 16 / sizeof(T) <= end; i += 16 / sizeof(T)) {
+            uint32 mask = stringFilterBlock(string + i, last, first, final);
+            while (mask != 0) {
+                const uint32 bit = ctz(mask);
+                const uint0 position = i + bit / sizeof(T);
+                if (stringEqual(string + position + 1, needle + 1, middle)) {
+                    return position;
+                }
+                mask &= ~(characterMask << bit);
+            }
+        }
+    }
+#endif
+    for (; i < end; ++i) {
+        if (string[i] == needle[0] && string[i + last] == needle[last] &&
+            stringEqual(string + i + 1, needle + 1, middle)) {
+            return i;
+        }
+    }
+    return UINT_MAX;
+}
+
+/**
+ * Find the last occurrence of a needle by checking the first and last characters of every possible position.
+ * @tparam T Type of character.
+ * @param string       The characters to search.
+ * @param length       The number of characters to search.
+ * @param needle       The characters to search for.
+ * @param needleLength The number of characters in the needle (must be non-zero and no larger than length).
+ * @returns The position of the last occurrence (UINT_MAX if not found).
+ */
+template<typename T>
+XS_INLINE uint0 stringFilterLast(const T* const XS_RESTRICT string, const uint0 length,
+    const T* const XS_RESTRICT needle, const uint0 needleLength) noexcept
+{
+    XS_ASSERT(needleLength > 0 && needleLength <= length);
+    const uint0 last = needleLength - 1;
+    const uint0 middle = last > 0 ? last - 1 : 0;
+    // Blocks are checked backwards from the last position where the needle could start
+    uint0 i = length - last;
+#if XS_ISA == XS_X86
+    if constexpr (hasISAFeature<ISAFeature::AVX2>) {
+        const __m256i first = _mm256_broadcastsi128_si256(stringBroadcast(needle[0]));
+        const __m256i final = _mm256_broadcastsi128_si256(stringBroadcast(needle[last]));
+        for (; i >= 32 / sizeof(T); i -= 32 / sizeof(T)) {
+            const uint0 start = i - 32 / sizeof(T);
+            uint32 mask = stringFilterBlock(string + start, last, first, final);
+            while (mask != 0) {
+                // Each character sets all of its bits so the highest bit belongs to the last byte of a character
+                const uint32 bit = bsr(mask);
+                const uint0 position = start + bit / sizeof(T);
+                if (stringEqual(string + position + 1, needle + 1, middle)) {
+                    return position;
+                }
+                mask &= ~(UINT32_MAX << (bit + 1 - sizeof(T)));
+            }
+        }
+    }
+    if constexpr (hasISAFeature<ISAFeature::SSE2>) {
+        const __m128i first = stringBroadcast(needle[0]);
+        const __m128i final = stringBroadcast(needle[last]);
+        for (; i >= 16 / sizeof(T); i -= 16 / sizeof(T)) {
+            const uint0 start = i - 16 / sizeof(T);
+            uint32 mask = stringFilterBlock(string + start, last, first, final);
+            while (mask != 0) {
+                const uint32 bit = bsr(mask);
+                const uint0 position = start + bit / sizeof(T);
+                if (stringEqual(string + position + 1, needle + 1, middle)) {
+                    return position;
+                }
+                mask &= ~(UINT32_MAX << (bit + 1 - sizeof(T)));
+            }
+        }
+    }
+#endif
+    while (i > 0) {
+        --i;
+        if (string[i] == needle[0] && string[i + last] == needle[last] &&
+            stringEqual(string + i + 1, needle + 1, middle)) {
+            return i;
+        }
+    }
+    return UINT_MAX;
+}
+} // namespace NoExport
+
+/**
+ * Precompiled needle used to search for a sequence of characters.
+ * @note Creating a search once and reusing it amortises the setup cost across multiple searches. Short needles are
+ * found by checking the first and last character of blocks of positions at the same time, longer needles use
+ * Boyer-Moore-Horspool skip tables that are built when the search is created. Only a view of the needle is stored so
+ * the needle characters must remain valid for the lifetime of the search.
+ * @tparam CharType Type of character.
+ */
+template<typename CharType = char>
+class StringSearch
+{
+    static_assert(isSameAny<CharType, char, char8, char16, char32>,
+        "Invalid character type: Template parameter must be a valid char type");
+
+public:
+    using View = StringView<CharType>;
+
+    /**< Needles longer than this use skip tables instead of checking every position */
+    static constexpr uint0 longNeedleLength = 32;
+    /**< Number of entries in each skip table, wider characters share entries based on their lowest byte */
+    static constexpr uint0 skipLength = 256;
+
+    View needle;                 /**< The characters being searched for */
+    uint32 skip[skipLength];     /**< Forward shift for each last character */ // NOLINT(modernize-avoid-c-arrays)
+    uint32 skipBack[skipLength]; /**< Backward shift for each first character */ // NOLINT(modernize-avoid-c-arrays)
+
+    /**
+     * Constructor.
+     * @param string The characters to search for.
+     * @param number The number of characters in the input.
+     */
+    XS_INLINE StringSearch(const CharType* const XS_RESTRICT string, const uint0 number) noexcept
+        : needle(string, number)
+    {
+        if (isLong()) {
+            // Later characters overwrite earlier ones so each entry ends up with the smallest possible shift
+            const auto length = static_cast<uint32>(number);
+            for (uint0 i = 0; i < skipLength; ++i) {
+                skip[i] = length;
+                skipBack[i] = length;
+            }
+            for (uint32 i = 0; i < length - 1; ++i) {
+                skip[static_cast<uint8>(string[i])] = length - 1 - i;
+            }
+            for (uint32 i = length - 1; i > 0; --i) {
+                skipBack[static_cast<uint8>(string[i])] = i;
+            }
+        }
+    }
+
+    /**
+     * Constructor.
+     * @param string The characters to search for.
+     */
+    XS_INLINE explicit StringSearch(const View& string) noexcept
+        : StringSearch(string.data(), string.size())
+    {}
+
+    /**
+     * Get the number of characters being searched for.
+     * @returns The length of the needle.
+     */
+    XS_INLINE uint0 getLength() const noexcept
+    {
+        return needle.size();
+    }
+
+    /**
+     * Query if the needle is searched for using the skip tables.
+     * @returns True if long, false if not.
+     */
+    XS_INLINE bool isLong() const noexcept
+    {
+        return needle.size() > longNeedleLength;
+    }
+
+    /**
+     * Find the first occurrence of the needle.
+     * @note An empty needle is never found.
+     * @param string Pointer to the characters to search.
+     * @param number The number of characters to search.
+     * @returns The position of the first occurrence (UINT_MAX if not found).
+     */
+    XS_INLINE uint0 findFirst(const CharType* const XS_RESTRICT string, const uint0 number) const noexcept
+    {
+        const uint0 length = needle.size();
+        if (length == 0 || length > number) [[unlikely]] {
+            return UINT_MAX;
+        }
+        const CharType* const XS_RESTRICT find = needle.data();
+        if (!isLong()) {
+            return NoExport::stringFilterFirst(string, number, find, length);
+        }
+        const uint0 last = length - 1;
+        for (uint0 i = 0; i + last < number;) {
+            const CharType current = string[i + last];
+            if (current == find[last] && NoExport::stringEqual(string + i, find, last)) {
+                return i;
+            }
+            i += skip[static_cast<uint8>(current)];
+        }
+        return UINT_MAX;
+    }
+
+    /**
+     * Find the last occurrence of the needle.
+     * @note An empty needle is never found.
+     * @param string Pointer to the characters to search.
+     * @param number The number of characters to search.
+     * @returns The position of the last occurrence (UINT_MAX if not found).
+     */
+    XS_INLINE uint0 findLast(const CharType* const XS_RESTRICT string, const uint0 number) const noexcept
+    {
+        const uint0 length = needle.size();
+        if (length == 0 || length > number) [[unlikely]] {
+            return UINT_MAX;
+        }
+        const CharType* const XS_RESTRICT find = needle.data();
+        if (!isLong()) {
+            return NoExport::stringFilterLast(string, number, find, length);
+        }
+        uint0 i = number - length;
+        while (true) {
+            const CharType current = string[i];
+            if (current == find[0] && NoExport::stringEqual(string + i + 1, find + 1, length - 1)) {
+                return i;
+            }
+            const uint0 shift = skipBack[static_cast<uint8>(current)];
+            if (shift > i) {
+                return UINT_MAX;
+            }
+            i -= shift;
+        }
+    }
+
+    /**
+     * Find every occurrence of the needle.
+     * @note Overlapping occurrences are all found.
+     * @tparam Alloc Type of allocator used by the output array.
+     * @param          string    Pointer to the characters to search.
+     * @param          number    The number of characters to search.
+     * @param [in,out] positions Array that the position of each occurrence is added to.
+     * @returns Whether operation could be performed (will be false if memory could not be allocated).
+     */
+    template<class Alloc>
+    XS_INLINE bool findAll(
+        const CharType* const XS_RESTRICT string, const uint0 number, DArray<uint0, Alloc>& positions) const noexcept
+    {
+        uint0 position = 0;
+        while (position < number) {
+            const uint0 found = findFirst(string + position, number - position);
+            if (found == UINT_MAX) {
+                break;
+            }
+            if (!positions.add(position + found)) [[unlikely]] {
+                return false;
+            }
+            position += found + 1;
+        }
+        return true;
+    }
+};
+} // namespace Shift
@@ -0,0 +1,402 @@
+#pragma once
+/**
+ * Copyright Matthew Oliver
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Memory/XSDArray.hpp"
+#include "Memory/XSStringSearch.hpp"
+#include "Memory/XSStringView.hpp"
+#include "XSBit.hpp"
+
+namespace Shift {
+enum class SplitDelimiter
+{
+    Sequence, /**< Tokens are separated by the whole sequence of delimiter characters */
+    AnyOf,    /**< Tokens are separated by any single one of the delimiter characters */
+};
+
+namespace NoExport {
+#if XS_ISA == XS_X86
+/**
+ * Get the comparison of each character in a block against a class of characters.
+ * @tparam T Type of character.
+ * @param block      The unaligned block of 16 bytes to check.
+ * @param characters The characters in the class.
+ * @param number     The number of characters in the class.
+ * @returns Register with every bit set in each element that matches any character in the class.
+ */
+template<typename T>
+XS_INLINE __m128i stringClassBlock(
+    const __m128i* const XS_RESTRICT block, const T* const XS_RESTRICT characters, const uint0 number) noexcept
+{
+    const __m128i value = _mm_loadu_si128(block);
+    __m128i check = _mm_setzero_si128();
+    for (uint0 i = 0; i < number; ++i) {
+        const __m128i character = stringBroadcast(characters[i]);
+        if constexpr (sizeof(T) == 1) {
+            check = _mm_or_si128(check, _mm_cmpeq_epi8(value, character));
+        } else if constexpr (sizeof(T) == 2) {
+            check = _mm_or_si128(check, _mm_cmpeq_epi16(value, character));
+        } else {
+            check = _mm_or_si128(check, _mm_cmpeq_epi32(value, character));
+        }
+    }
+    return check;
+}
+
+/**
+ * Get the comparison of each character in a block against a class of characters.
+ * @tparam T Type of character.
+ * @param block      The unaligned block of 32 bytes to check.
+ * @param characters The characters in the class.
+ * @param number     The number of characters in the class.
+ * @returns Register with every bit set in each element that matches any character in the class.
+ */
+template<typename T>
+XS_INLINE __m256i stringClassBlock(
+    const __m256i* const XS_RESTRICT block, const T* const XS_RESTRICT characters, const uint0 number) noexcept
+{
+    const __m256i value = _mm256_loadu_si256(block);
+    __m256i check = _mm256_setzero_si256();
+    for (uint0 i = 0; i < number; ++i) {
+        const __m256i character = _mm256_broadcastsi128_si256(stringBroadcast(characters[i]));
+        if constexpr (sizeof(T) == 1) {
+            check = _mm256_or_si256(check, _mm256_cmpeq_epi8(value, character));
+        } else if constexpr (sizeof(T) == 2) {
+            check = _mm256_or_si256(check, _mm256_cmpeq_epi16(value, character));
+        } else {
+            check = _mm256_or_si256(check, _mm256_cmpeq_epi32(value, character));
+        }
+    }
+    return check;
+}
+
+/**
+ * Get the mask of each character in a block that matches a class of characters.
+ * @tparam T Type of character.
+ * @param block      The unaligned block of 64 bytes to check.
+ * @param characters The characters in the class.
+ * @param number     The number of characters in the class.
+ * @returns The mask of matching characters (1 bit per character).
+ */
+template<typename T>
+XS_INLINE uint64 stringClassBlock(
+    const __m512i* const XS_RESTRICT block, const T* const XS_RESTRICT characters, const uint0 number) noexcept
+{
+    const __m512i value = _mm512_loadu_si512(block);
+    uint64 mask = 0;
+    for (uint0 i = 0; i < number; ++i) {
+        if constexpr (sizeof(T) == 1) {
+            mask |= _mm512_cmpeq_epi8_mask(value, _mm512_set1_epi8(static_cast<int8>(characters[i])));
+        } else if constexpr (sizeof(T) == 2) {
+            mask |= _mm512_cmpeq_epi16_mask(value, _mm512_set1_epi16(static_cast<int16>(characters[i])));
+        } else {
+            mask |= _mm512_cmpeq_epi32_mask(value, _mm512_set1_epi32(static_cast<int32>(characters[i])));
+        }
+    }
+    return mask;
+}
+#endif
+
+/**
+ * Get the mask of each character in a block of 64 bytes that matches a class of characters.
+ * @note The returned mask has 1 bit per character so only the lowest 64/sizeof(T) bits are used.
+ * @tparam T Type of character.
+ * @param string     The start of the block of characters to check (there must be at least 64 bytes).
+ * @param characters The characters in the class.
+ * @param number     The number of characters in the class.
+ * @returns The mask of matching characters.
+ */
+template<typename T>
+XS_INLINE uint64 stringClassMask(
+    const T* const XS_RESTRICT string, const T* const XS_RESTRICT characters, const uint0 number) noexcept
+{
+#if XS_ISA == XS_X86
+    if constexpr (hasISAFeature<ISAFeature::AVX512BW>) {
+        return stringClassBlock(reinterpret_cast<const __m512i*>(string), characters, number);
+    } else if constexpr (hasISAFeature<ISAFeature::AVX2>) {
+        const auto* block = reinterpret_cast<const __m256i*>(string);
+        const __m256i check0 = stringClassBlock(block, characters, number);
+        const __m256i check1 = stringClassBlock(block + 1, characters, number);
+        if constexpr (sizeof(T) == 1) {
+            return static_cast<uint64>(static_cast<uint32>(_mm256_movemask_epi8(check0))) |
+                (static_cast<uint64>(static_cast<uint32>(_mm256_movemask_epi8(check1))) << 32);
+        } else if constexpr (sizeof(T) == 2) {
+            // Packing works within each 128 bit lane so the 64 bit elements must be put back in order
+            const __m256i packed = _mm256_permute4x64_epi64(_mm256_packs_epi16(check0, check1), 0xD8);
+            return static_cast<uint32>(_mm256_movemask_epi8(packed));
+        } else {
+            return static_cast<uint64>(_mm256_movemask_ps(_mm256_castsi256_ps(check0))) |
+                (static_cast<uint64>(_mm256_movemask_ps(_mm256_castsi256_ps(check1))) << 8);
+        }
+    } else if constexpr (hasISAFeature<ISAFeature::SSE2>) {
+        const auto* block = reinterpret_cast<const __m128i*>(string);
+        const __m128i check0 = stringClassBlock(block, characters, number);
+        const __m128i check1 = stringClassBlock(block + 1, characters, number);
+        const __m128i check2 = stringClassBlock(block + 2, characters, number);
+        const __m128i check3 = stringClassBlock(block + 3, characters, number);
+        if constexpr (sizeof(T) == 1) {
+            return static_cast<uint64>(static_cast<uint32>(_mm_movemask_epi8(check0))) |
+                (static_cast<uint64>(static_cast<uint32>(_mm_movemask_epi8(check1))) << 16) |
+                (static_cast<uint64>(static_cast<uint32>(_mm_movemask_epi8(check2))) << 32) |
+                (static_cast<uint64>(static_cast<uint32>(_mm_movemask_epi8(check3))) << 48);
+        } else if constexpr (sizeof(T) == 2) {
+            // Saturated packing keeps each element as either all or none of its bits so there is 1 bit per character
+            return static_cast<uint64>(static_cast<uint32>(_mm_movemask_epi8(_mm_packs_epi16(check0, check1)))) |
+                (static_cast<uint64>(static_cast<uint32>(_mm_movemask_epi8(_mm_packs_epi16(check2, check3)))) << 16);
+        } else {
+            return static_cast<uint64>(_mm_movemask_ps(_mm_castsi128_ps(check0))) |
+                (static_cast<uint64>(_mm_movemask_ps(_mm_castsi128_ps(check1))) << 4) |
+                (static_cast<uint64>(_mm_movemask_ps(_mm_castsi128_ps(check2))) << 8) |
+                (static_cast<uint64>(_mm_movemask_ps(_mm_castsi128_ps(check3))) << 12);
+        }
+    }
+#endif
+    uint64 mask = 0;
+    for (uint0 i = 0; i < 64 / sizeof(T); ++i) {
+        for (uint0 j = 0; j < number; ++j) {
+            if (string[i] == characters[j]) {
+                mask |= 1_ui64 << i;
+                break;
+            }
+        }
+    }
+    return mask;
+}
+} // namespace NoExport
+
+/**
+ * Lazy tokeniser used to split a sequence of characters into the tokens between each delimiter.
+ * @note No characters are copied, each token is returned as a view into the original characters which must remain valid
+ * for the lifetime of the splitter. Delimiters are found a block of 64 bytes at a time by building a bit mask of every
+ * candidate position which is then consumed as tokens are requested. Adjacent delimiters produce empty tokens so a
+ * string containing N delimiters always has N+1 tokens.
+ * @tparam CharType Type of character.
+ */
+template<typename CharType = char>
+class StringSplit
+{
+    static_assert(isSameAny<CharType, char, char8, char16, char32>,
+        "Invalid character type: Template parameter must be a valid char type");
+
+public:
+    using View = StringView<CharType>;
+
+    /**< Maximum number of characters that can be used as delimiters */
+    static constexpr uint0 maxDelimiterLength = 16;
+    /**< Number of characters checked in each block */
+    static constexpr uint0 blockLength = 64 / sizeof(CharType);
+
+    View string;                             /**< The characters being split */
+    CharType delimiters[maxDelimiterLength]; /**< The delimiter characters */ // NOLINT(modernize-avoid-c-arrays)
+    uint32 delimiterLength = 0;              /**< Number of valid characters in delimiters */
+    uint32 matchLength = 0;                  /**< Number of characters removed by each found delimiter */
+    uint32 classLength = 0;                  /**< Number of delimiter characters used to build the block masks */
+    uint0 position = 0;                      /**< Start of the next token */
+    uint0 blockStart = 0;                    /**< Start of the block that the current mask was built from */
+    uint0 blockEnd = 0;                      /**< End of all the characters that have been checked using blocks */
+    uint64 mask = 0;                         /**< Candidate delimiters in the current block not yet consumed */
+    bool finished = false;                   /**< If the last token has been returned */
+
+    /**
+     * Constructor.
+     * @param source    The characters to split.
+     * @param delimiter The character that separates each token.
+     */
+    XS_INLINE StringSplit(const View& source, const CharType delimiter) noexcept
+        : string(source)
+        , delimiterLength(1)
+        , matchLength(1)
+        , classLength(1)
+    {
+        XS_ASSERT(source.size() <= UINT32_MAX);
+        delimiters[0] = delimiter;
+    }
+
+    /**
+     * Constructor.
+     * @param source    The characters to split.
+     * @param delimiter The delimiter characters (must be non-empty and no longer than maxDelimiterLength).
+     * @param type      (Optional) How the delimiter characters separate each token.
+     */
+    XS_INLINE StringSplit(
+        const View& source, const View& delimiter, const SplitDelimiter type = SplitDelimiter::Sequence) noexcept
+        : string(source)
+        , delimiterLength(static_cast<uint32>(delimiter.size()))
+        , matchLength(type == SplitDelimiter::Sequence ? static_cast<uint32>(delimiter.size()) : 1)
+        , classLength(type == SplitDelimiter::Sequence ? 1 : static_cast<uint32>(delimiter.size()))
+    {
+        XS_ASSERT(source.size() <= UINT32_MAX);
+        XS_ASSERT(!delimiter.empty() && delimiter.size() <= maxDelimiterLength);
+        for (uint0 i = 0; i < delimiterLength; ++i) {
+            delimiters[i] = delimiter[i];
+        }
+    }
+
+    /**
+     * Get the next token.
+     * @param [out] token The next token (only set if one exists).
+     * @returns True if a token was returned, false if every token has already been returned.
+     */
+    XS_INLINE bool next(View& token) noexcept
+    {
+        if (finished) [[unlikely]] {
+            return false;
+        }
+        const uint0 found = findNext(position);
+        if (found == UINT_MAX) {
+            token = View(string.data() + position, string.size() - position);
+            finished = true;
+            return true;
+        }
+        token = View(string.data() + position, found - position);
+        position = found + matchLength;
+        return true;
+    }
+
+    /** Restart splitting from the first token. */
+    XS_INLINE void reset() noexcept
+    {
+        position = 0;
+        blockStart = 0;
+        blockEnd = 0;
+        mask = 0;
+        finished = false;
+    }
+
+    /**
+     * Find the position of every delimiter.
+     * @note This is independent of any tokens returned using next. Token i spans from the end of delimiter i-1 to the
+     * start of delimiter i, which can be retrieved using getToken.
+     * @tparam Alloc Type of allocator used by the output array.
+     * @param [in,out] offsets Array that the position of each delimiter is added to.
+     * @returns Whether operation could be performed (will be false if memory could not be allocated).
+     */
+    template<class Alloc>
+    XS_INLINE bool splitAll(DArray<uint32, Alloc>& offsets) const noexcept
+    {
+        const CharType* const XS_RESTRICT data = string.data();
+        const uint0 length = string.size();
+        uint0 tokenStart = 0;
+        uint0 i = 0;
+        for (; i + blockLength <= length; i += blockLength) {
+            uint64 blockMask = NoExport::stringClassMask(data + i, delimiters, classLength);
+            if (blockMask == 0) {
+                continue;
+            }
+            // Each block can add at most 1 offset per character
+            if (!offsets.checkAddReservedLength(blockLength)) [[unlikely]] {
+                return false;
+            }
+            do {
+                const uint0 found = i + ctz(blockMask);
+                blockMask &= blockMask - 1;
+                if (found >= tokenStart && isMatch(found)) {
+                    offsets.addUnChecked(static_cast<uint32>(found));
+                    tokenStart = found + matchLength;
+                }
+            } while (blockMask != 0);
+        }
+        for (i = i > tokenStart ? i : tokenStart; i < length;) {
+            if (isCandidate(data[i]) && isMatch(i)) {
+                if (!offsets.add(static_cast<uint32>(i))) [[unlikely]] {
+                    return false;
+                }
+                i += matchLength;
+            } else {
+                ++i;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * Get a token using the delimiter positions found by splitAll.
+     * @param offsets The positions of every delimiter.
+     * @param index   The index of the token (must be no larger than the number of offsets).
+     * @returns The token.
+     */
+    template<class Alloc>
+    XS_INLINE View getToken(const DArray<uint32, Alloc>& offsets, const uint0 index) const noexcept
+    {
+        XS_ASSERT(index <= offsets.getLength());
+        const uint0 start = index > 0 ? offsets.at(index - 1) + matchLength : 0;
+        const uint0 end = index < offsets.getLength() ? offsets.at(index) : string.size();
+        return View(string.data() + start, end - start);
+    }
+
+private:
+    /**
+     * Query if a character is the start of a delimiter.
+     * @param character The character to check.
+     * @returns True if a candidate, false if not.
+     */
+    XS_INLINE bool isCandidate(const CharType character) const noexcept
+    {
+        for (uint0 i = 0; i < classLength; ++i) {
+            if (character == delimiters[i]) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * Query if a candidate position is the start of a complete delimiter.
+     * @param found The position of a character that is a candidate.
+     * @returns True if a delimiter, false if not.
+     */
+    XS_INLINE bool isMatch(const uint0 found) const noexcept
+    {
+        // Only a sequence has characters after the first one that must also be checked
+        return matchLength == 1 ||
+            (found + matchLength <= string.size() &&
+                NoExport::stringEqual(string.data() + found + 1, delimiters + 1, matchLength - 1));
+    }
+
+    /**
+     * Find the next delimiter.
+     * @param start The position to start searching from.
+     * @returns The position of the delimiter (UINT_MAX if not found).
+     */
+    XS_INLINE uint0 findNext(const uint0 start) noexcept
+    {
+        const CharType* const XS_RESTRICT data = string.data();
+        const uint0 length = string.size();
+        while (true) {
+            while (mask != 0) {
+                const uint0 found = blockStart + ctz(mask);
+                mask &= mask - 1;
+                if (found >= start && isMatch(found)) {
+                    return found;
+                }
+            }
+            if (blockEnd + blockLength > length) {
+                break;
+            }
+            blockStart = blockEnd;
+            blockEnd += blockLength;
+            mask = NoExport::stringClassMask(data + blockStart, delimiters, classLength);
+        }
+        // Any remaining characters are too few to fill a block
+        for (uint0 i = start > blockEnd ? start : blockEnd; i < length; ++i) {
+            if (isCandidate(data[i]) && isMatch(i)) {
+                return i;
+            }
+        }
+        return UINT_MAX;
+    }
+};
+} // namespace Shift
@@ -0,0 +1,1037 @@
+#pragma once
+/**
+ * Copyright Matthew Oliver
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Memory/XSMemory.hpp"
+#include "XSBit.hpp"
+
+namespace Shift {
+namespace NoExport {
+/**< Number of characters processed at the same time by the block operations */
+inline constexpr uint0 utfBlockLength = 16;
+
+// UTF8 validation lookup tables. Each bit represents a different error and a byte pair is only invalid if the same
+// bit is set in the lookups of the high and low nibble of the first byte and the high nibble of the second byte.
+/**< Errors based on the high nibble of the previous byte */
+alignas(16) inline constexpr uint8 utf8ErrorByte1High[16] = {0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x80, 0x80,
+    0x80, 0x80, 0x21, 0x01, 0x15, 0x49}; // NOLINT(modernize-avoid-c-arrays)
+/**< Errors based on the low nibble of the previous byte */
+alignas(16) inline constexpr uint8 utf8ErrorByte1Low[16] = {0xE7, 0xA3, 0x83, 0x83, 0x8B, 0xCB, 0xCB, 0xCB, 0xCB, 0xCB,
+    0xCB, 0xCB, 0xCB, 0xDB, 0xCB, 0xCB}; // NOLINT(modernize-avoid-c-arrays)
+/**< Errors based on the high nibble of the current byte */
+alignas(16) inline constexpr uint8 utf8ErrorByte2High[16] = {0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xE6, 0xAE,
+    0xBA, 0xBA, 0x01, 0x01, 0x01, 0x01}; // NOLINT(modernize-avoid-c-arrays)
+/**< Largest value of each byte at the end of a block that does not start an incomplete sequence */
+alignas(64) inline constexpr uint8 utf8IncompleteMax[64] = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xDF,
+    0xBF}; // NOLINT(modernize-avoid-c-arrays)
+
+#if XS_ISA == XS_X86
+/**
+ * Check a block of UTF8 characters for errors.
+ * @param input    The current block of characters.
+ * @param previous The previous block of characters.
+ * @returns Non-zero bytes for each invalid character.
+ */
+XS_INLINE __m128i utf8CheckBlock(const __m128i input, const __m128i previous) noexcept
+{
+    const __m128i mask = _mm_set1_epi8(0x0F);
+    const __m128i prev1 = _mm_alignr_epi8(input, previous, 15);
+    const __m128i byte1High = _mm_shuffle_epi8(_mm_load_si128(reinterpret_cast<const __m128i*>(utf8ErrorByte1High)),
+        _mm_and_si128(_mm_srli_epi16(prev1, 4), mask));
+    const __m128i byte1Low = _mm_shuffle_epi8(
+        _mm_load_si128(reinterpret_cast<const __m128i*>(utf8ErrorByte1Low)), _mm_and_si128(prev1, mask));
+    const __m128i byte2High = _mm_shuffle_epi8(_mm_load_si128(reinterpret_cast<const __m128i*>(utf8ErrorByte2High)),
+        _mm_and_si128(_mm_srli_epi16(input, 4), mask));
+    const __m128i special = _mm_and_si128(_mm_and_si128(byte1High, byte1Low), byte2High);
+    // The 3rd and 4th bytes of a sequence must be continuations, this isn't covered by the byte pair lookups
+    const __m128i third = _mm_subs_epu8(_mm_alignr_epi8(input, previous, 14), _mm_set1_epi8(0xE0 - 0x80));
+    const __m128i fourth = _mm_subs_epu8(_mm_alignr_epi8(input, previous, 13), _mm_set1_epi8(0xF0 - 0x80));
+    const __m128i must23 = _mm_and_si128(_mm_or_si128(third, fourth), _mm_set1_epi8(static_cast<int8>(0x80)));
+    return _mm_xor_si128(must23, special);
+}
+
+/**
+ * Check a block of UTF8 characters for errors.
+ * @param input    The current block of characters.
+ * @param previous The previous block of characters.
+ * @returns Non-zero bytes for each invalid character.
+ */
+XS_INLINE __m256i utf8CheckBlock(const __m256i input, const __m256i previous) noexcept
+{
+    // Shifting across the 2 lanes requires first combining the high lane of previous and low lane of input
+    const __m256i mask = _mm256_set1_epi8(0x0F);
+    const __m256i shifted = _mm256_permute2x128_si256(previous, input, 0x21);
+    const __m256i prev1 = _mm256_alignr_epi8(input, shifted, 15);
+    const __m256i byte1High = _mm256_shuffle_epi8(
+        _mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i*>(utf8ErrorByte1High))),
+        _mm256_and_si256(_mm256_srli_epi16(prev1, 4), mask));
+    const __m256i byte1Low = _mm256_shuffle_epi8(
+        _mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i*>(utf8ErrorByte1Low))),
+        _mm256_and_si256(prev1, mask));
+    const __m256i byte2High = _mm256_shuffle_epi8(
+        _mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i*>(utf8ErrorByte2High))),
+        _mm256_and_si256(_mm256_srli_epi16(input, 4), mask));
+    const __m256i special = _mm256_and_si256(_mm256_and_si256(byte1High, byte1Low), byte2High);
+    const __m256i third = _mm256_subs_epu8(_mm256_alignr_epi8(input, shifted, 14), _mm256_set1_epi8(0xE0 - 0x80));
+    const __m256i fourth = _mm256_subs_epu8(_mm256_alignr_epi8(input, shifted, 13), _mm256_set1_epi8(0xF0 - 0x80));
+    const __m256i must23 =
+        _mm256_and_si256(_mm256_or_si256(third, fourth), _mm256_set1_epi8(static_cast<int8>(0x80)));
+    return _mm256_xor_si256(must23, special);
+}
+
+/**
+ * Check a block of UTF8 characters for errors.
+ * @param input    The current block of characters.
+ * @param previous The previous block of characters.
+ * @returns Non-zero bytes for each invalid character.
+ */
+XS_INLINE __m512i utf8CheckBlock(const __m512i input, const __m512i previous) noexcept
+{
+    // Each lane is combined with the lane before it (the last lane of previous for the first lane of input)
+    const __m512i mask = _mm512_set1_epi8(0x0F);
+    const __m512i shifted = _mm512_alignr_epi64(input, previous, 6);
+    const __m512i prev1 = _mm512_alignr_epi8(input, shifted, 15);
+    const __m512i byte1High = _mm512_shuffle_epi8(
+        _mm512_broadcast_i32x4(_mm_load_si128(reinterpret_cast<const __m128i*>(utf8ErrorByte1High))),
+        _mm512_and_si512(_mm512_srli_epi16(prev1, 4), mask));
+    const __m512i byte1Low = _mm512_shuffle_epi8(
+        _mm512_broadcast_i32x4(_mm_load_si128(reinterpret_cast<const __m128i*>(utf8ErrorByte1Low))),
+        _mm512_and_si512(prev1, mask));
+    const __m512i byte2High = _mm512_shuffle_epi8(
+        _mm512_broadcast_i32x4(_mm_load_si128(reinterpret_cast<const __m128i*>(utf8ErrorByte2High))),
+        _mm512_and_si512(_mm512_srli_epi16(input, 4), mask));
+    const __m512i special = _mm512_and_si512(_mm512_and_si512(byte1High, byte1Low), byte2High);
+    const __m512i third = _mm512_subs_epu8(_mm512_alignr_epi8(input, shifted, 14), _mm512_set1_epi8(0xE0 - 0x80));
+    const __m512i fourth = _mm512_subs_epu8(_mm512_alignr_epi8(input, shifted, 13), _mm512_set1_epi8(0xF0 - 0x80));
+    const __m512i must23 =
+        _mm512_and_si512(_mm512_or_si512(third, fourth), _mm512_set1_epi8(static_cast<int8>(0x80)));
+    return _mm512_xor_si512(must23, special);
+}
+#endif
+
+/**
+ * Count the number of characters in a block that are greater than or equal to a value.
+ * @tparam Value The value to compare against (must be a power of 2 for multi-byte character types).
+ * @tparam T     Type of character.
+ * @param block The block of utfBlockLength characters.
+ * @returns The number of characters.
+ */
+template<uint32 Value, typename T>
+XS_INLINE uint32 utfCountAtLeast(const T* const XS_RESTRICT block) noexcept
+{
+    static_assert(sizeof(T) == 1 || (Value & (Value - 1)) == 0, "Value must be a power of 2 for multi-byte characters");
+#if XS_ISA == XS_X86
+    if constexpr (sizeof(T) == 1 && hasISAFeature<ISAFeature::SSE2>) {
+        // There is no unsigned compare so check if the value is unchanged by taking the maximum
+        const __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block));
+        const __m128i check = _mm_cmpeq_epi8(_mm_max_epu8(value, _mm_set1_epi8(static_cast<int8>(Value))), value);
+        return popcnt(static_cast<uint32>(_mm_movemask_epi8(check)));
+    } else if constexpr (sizeof(T) == 4 && hasISAFeature<ISAFeature::AVX512F>) {
+        // A block of UTF32 fills a single register
+        const __m512i value = _mm512_loadu_si512(block);
+        return popcnt(
+            static_cast<uint32>(_mm512_cmpge_epu32_mask(value, _mm512_set1_epi32(static_cast<int32>(Value)))));
+    } else if constexpr (hasISAFeature<ISAFeature::AVX2>) {
+        // Values below a power of 2 have all higher bits cleared
+        const __m256i zero = _mm256_setzero_si256();
+        uint32 below = 0;
+        for (uint0 i = 0; i < utfBlockLength * sizeof(T); i += 32) {
+            const __m256i value = _mm256_loadu_si256(
+                reinterpret_cast<const __m256i*>(reinterpret_cast<const uint8*>(block) + i));
+            __m256i check;
+            if constexpr (sizeof(T) == 2) {
+                check = _mm256_cmpeq_epi16(
+                    _mm256_and_si256(value, _mm256_set1_epi16(static_cast<int16>(~(Value - 1)))), zero);
+            } else {
+                check = _mm256_cmpeq_epi32(
+                    _mm256_and_si256(value, _mm256_set1_epi32(static_cast<int32>(~(Value - 1)))), zero);
+            }
+            below += popcnt(static_cast<uint32>(_mm256_movemask_epi8(check)));
+        }
+        return static_cast<uint32>(utfBlockLength) - below / sizeof(T);
+    } else if constexpr (hasISAFeature<ISAFeature::SSE2>) {
+        const __m128i zero = _mm_setzero_si128();
+        uint32 below = 0;
+        for (uint0 i = 0; i < utfBlockLength * sizeof(T); i += 16) {
+            const __m128i value =
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(reinterpret_cast<const uint8*>(block) + i));
+            __m128i check;
+            if constexpr (sizeof(T) == 2) {
+                check = _mm_cmpeq_epi16(_mm_and_si128(value, _mm_set1_epi16(static_cast<int16>(~(Value - 1)))), zero);
+            } else {
+                check = _mm_cmpeq_epi32(_mm_and_si128(value, _mm_set1_epi32(static_cast<int32>(~(Value - 1)))), zero);
+            }
+            below += popcnt(static_cast<uint32>(_mm_movemask_epi8(check)));
+        }
+        return static_cast<uint32>(utfBlockLength) - below / sizeof(T);
+    }
+#endif
+    uint32 ret = 0;
+    for (uint0 i = 0; i < utfBlockLength; ++i) {
+        ret += static_cast<uint32>(block[i]) >= Value ? 1 : 0;
+    }
+    return ret;
+}
+
+/**
+ * Count the number of UTF16 surrogate characters in a block.
+ * @param block The block of utfBlockLength characters.
+ * @returns The number of characters.
+ */
+XS_INLINE uint32 utfCountSurrogates(const char16* const XS_RESTRICT block) noexcept
+{
+#if XS_ISA == XS_X86
+    if constexpr (hasISAFeature<ISAFeature::AVX2>) {
+        const __m256i value = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block));
+        const __m256i check = _mm256_cmpeq_epi16(_mm256_and_si256(value, _mm256_set1_epi16(static_cast<int16>(0xF800))),
+            _mm256_set1_epi16(static_cast<int16>(0xD800)));
+        return popcnt(static_cast<uint32>(_mm256_movemask_epi8(check))) / 2;
+    } else if constexpr (hasISAFeature<ISAFeature::SSE2>) {
+        const __m128i mask = _mm_set1_epi16(static_cast<int16>(0xF800));
+        const __m128i surrogate = _mm_set1_epi16(static_cast<int16>(0xD800));
+        const __m128i check1 = _mm_cmpeq_epi16(
+            _mm_and_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(block)), mask), surrogate);
+        const __m128i check2 = _mm_cmpeq_epi16(
+            _mm_and_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(block + 8)), mask), surrogate);
+        return popcnt(static_cast<uint32>(_mm_movemask_epi8(_mm_packs_epi16(check1, check2))));
+    }
+#endif
+    uint32 ret = 0;
+    for (uint0 i = 0; i < utfBlockLength; ++i) {
+        ret += (block[i] & 0xF800) == 0xD800 ? 1 : 0;
+    }
+    return ret;
+}
+
+/**
+ * Copy a block of characters to a different character type.
+ * @note Every character must be representable by the destination type, characters are zero extended or truncated.
+ * @tparam T  Type of destination character.
+ * @tparam T2 Type of source character.
+ * @param       block The block of utfBlockLength characters.
+ * @param [out] dest  Location to store the converted characters.
+ */
+template<typename T, typename T2>
+XS_INLINE void utfCopyBlock(const T2* const XS_RESTRICT block, T* const XS_RESTRICT dest) noexcept
+{
+#if XS_ISA == XS_X86
+    if constexpr (hasISAFeature<ISAFeature::SSE2>) {
+        const auto load = [block](const uint0 index) {
+            return _mm_loadu_si128(reinterpret_cast<const __m128i*>(block + index));
+        };
+        const auto store = [dest](const uint0 index, const __m128i value) {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dest + index), value);
+        };
+        const __m128i zero = _mm_setzero_si128();
+        if constexpr (sizeof(T) == 4 && sizeof(T2) == 4 && hasISAFeature<ISAFeature::AVX512F>) {
+            _mm512_storeu_si512(dest, _mm512_loadu_si512(block));
+        } else if constexpr (sizeof(T) == sizeof(T2)) {
+            for (uint0 i = 0; i < utfBlockLength; i += 16 / sizeof(T)) {
+                store(i, load(i));
+            }
+        } else if constexpr (sizeof(T2) == 1 && sizeof(T) == 2) {
+            const __m128i value = load(0);
+            if constexpr (hasISAFeature<ISAFeature::AVX2>) {
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(dest), _mm256_cvtepu8_epi16(value));
+            } else {
+                store(0, _mm_unpacklo_epi8(value, zero));
+                store(8, _mm_unpackhi_epi8(value, zero));
+            }
+        } else if constexpr (sizeof(T2) == 1 && sizeof(T) == 4) {
+            const __m128i value = load(0);
+            if constexpr (hasISAFeature<ISAFeature::AVX512F>) {
+                _mm512_storeu_si512(dest, _mm512_cvtepu8_epi32(value));
+            } else if constexpr (hasISAFeature<ISAFeature::AVX2>) {
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(dest), _mm256_cvtepu8_epi32(value));
+                _mm256_storeu_si256(
+                    reinterpret_cast<__m256i*>(dest + 8), _mm256_cvtepu8_epi32(_mm_srli_si128(value, 8)));
+            } else {
+                const __m128i low = _mm_unpacklo_epi8(value, zero);
+                const __m128i high = _mm_unpackhi_epi8(value, zero);
+                store(0, _mm_unpacklo_epi16(low, zero));
+                store(4, _mm_unpackhi_epi16(low, zero));
+                store(8, _mm_unpacklo_epi16(high, zero));
+                store(12, _mm_unpackhi_epi16(high, zero));
+            }
+        } else if constexpr (sizeof(T2) == 2 && sizeof(T) == 1) {
+            store(0, _mm_packus_epi16(load(0), load(8)));
+        } else if constexpr (sizeof(T2) == 2 && sizeof(T) == 4 && hasISAFeature<ISAFeature::AVX512F>) {
+            _mm512_storeu_si512(
+                dest, _mm512_cvtepu16_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(block))));
+        } else if constexpr (sizeof(T2) == 2 && sizeof(T) == 4) {
+            for (uint0 i = 0; i < utfBlockLength; i += 8) {
+                const __m128i value = load(i);
+                if constexpr (hasISAFeature<ISAFeature::AVX2>) {
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dest + i), _mm256_cvtepu16_epi32(value));
+                } else {
+                    store(i, _mm_unpacklo_epi16(value, zero));
+                    store(i + 4, _mm_unpackhi_epi16(value, zero));
+                }
+            }
+        } else if constexpr (sizeof(T2) == 4 && hasISAFeature<ISAFeature::AVX512F>) {
+            // Every value is representable in the destination so truncation can be used
+            if constexpr (sizeof(T) == 1) {
+                store(0, _mm512_cvtepi32_epi8(_mm512_loadu_si512(block)));
+            } else {
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(dest), _mm512_cvtepi32_epi16(_mm512_loadu_si512(block)));
+            }
+        } else if constexpr (sizeof(T2) == 4 && sizeof(T) == 1) {
+            // Values are below 0x80 so signed saturation is safe
+            store(0, _mm_packus_epi16(_mm_packs_epi32(load(0), load(4)), _mm_packs_epi32(load(8), load(12))));
+        } else if constexpr (sizeof(T2) == 4 && sizeof(T) == 2) {
+            for (uint0 i = 0; i < utfBlockLength; i += 8) {
+                if constexpr (hasISAFeature<ISAFeature::SSE41>) {
+                    store(i, _mm_packus_epi32(load(i), load(i + 4)));
+                } else {
+                    // Bias the values into signed range so that signed saturation can be used
+                    const __m128i bias = _mm_set1_epi32(0x8000);
+                    const __m128i packed =
+                        _mm_packs_epi32(_mm_sub_epi32(load(i), bias), _mm_sub_epi32(load(i + 4), bias));
+                    store(i, _mm_add_epi16(packed, _mm_set1_epi16(static_cast<int16>(0x8000))));
+                }
+            }
+        }
+        return;
+    }
+#endif
+    for (uint0 i = 0; i < utfBlockLength; ++i) {
+        dest[i] = static_cast<T>(block[i]);
+    }
+}
+
+/**
+ * Check if a block of characters can be converted using utfCopyBlock.
+ * @tparam T  Type of destination character.
+ * @tparam T2 Type of source character.
+ * @param block The block of utfBlockLength characters.
+ * @returns True if every character is represented by a single character in the destination.
+ */
+template<typename T, typename T2>
+XS_INLINE bool utfIsCopyBlock(const T2* const XS_RESTRICT block) noexcept
+{
+    if constexpr (isSame<T2, char16> && isSame<T, char32>) {
+        return utfCountSurrogates(block) == 0;
+    } else if constexpr (isSame<T2, char32> && isSame<T, char16>) {
+        return utfCountAtLeast<0x10000>(block) == 0;
+    } else {
+        // UTF8 and ASCII can only be directly converted when all characters are ASCII
+        return utfCountAtLeast<0x80>(block) == 0;
+    }
+}
+
+/**
+ * Decode a single code point.
+ * @note UTF8 input must be valid while UTF16 input decodes unpaired surrogates as individual code points.
+ * @tparam T2 Type of source character.
+ * @param [in,out] string The current position in the input, updated to point to the next code point.
+ * @param          end    The end of the input.
+ * @returns The decoded code point.
+ */
+template<typename T2>
+XS_INLINE char32 utfDecode(const T2* XS_RESTRICT& string, [[maybe_unused]] const T2* const XS_RESTRICT end) noexcept
+{
+    if constexpr (isSame<T2, char8>) {
+        const auto lead = static_cast<char32>(*string++);
+        if (lead < 0x80) {
+            return lead;
+        }
+        if (lead < 0xE0) {
+            const char32 ret = ((lead & 0x1F) << 6) | (string[0] & 0x3F);
+            string += 1;
+            return ret;
+        }
+        if (lead < 0xF0) {
+            const char32 ret = ((lead & 0x0F) << 12) | ((string[0] & 0x3F) << 6) | (string[1] & 0x3F);
+            string += 2;
+            return ret;
+        }
+        const char32 ret =
+            ((lead & 0x07) << 18) | ((string[0] & 0x3F) << 12) | ((string[1] & 0x3F) << 6) | (string[2] & 0x3F);
+        string += 3;
+        return ret;
+    } else if constexpr (isSame<T2, char16>) {
+        const auto w1 = static_cast<char32>(*string++);
+        if ((w1 & 0xFC00) == 0xD800 && string < end && (*string & 0xFC00) == 0xDC00) {
+            const auto w2 = static_cast<char32>(*string++);
+            return (((w1 & 0x3FF) << 10) | (w2 & 0x3FF)) + 0x10000;
+        }
+        return w1;
+    } else {
+        return *string++;
+    }
+}
+
+/**
+ * Get the number of characters required to encode a code point.
+ * @tparam T Type of destination character.
+ * @param value The code point.
+ * @returns The number of characters.
+ */
+template<typename T>
+XS_INLINE uint0 utfEncodeLength(const char32 value) noexcept
+{
+    if constexpr (isSame<T, char8>) {
+        // Values above the Unicode range use the original 5 and 6 byte UTF8 sequences
+        return 1 + (value >= 0x80) + (value >= 0x800) + (value >= 0x10000) + (value >= 0x200000) +
+            (value >= 0x4000000);
+    } else if constexpr (isSame<T, char16>) {
+        return value >= 0x10000 ? 2 : 1;
+    } else {
+        return 1;
+    }
+}
+
+/**
+ * Encode a single code point.
+ * @note Conversion to ASCII only keeps the lower 7 bits.
+ * @tparam T Type of destination character.
+ * @param       value The code point.
+ * @param [out] dest  Location to store the encoded characters.
+ * @returns The number of characters written.
+ */
+template<typename T>
+XS_INLINE uint0 utfEncode(char32 value, T* const XS_RESTRICT dest) noexcept
+{
+    if constexpr (isSame<T, char8>) {
+        const uint0 length = utfEncodeLength<T>(value);
+        if (length == 1) {
+            dest[0] = static_cast<T>(value);
+            return 1;
+        }
+        // The lead byte contains a marker for the number of bytes followed by the highest bits
+        for (uint0 i = length - 1; i > 0; --i) {
+            dest[i] = static_cast<T>(0x80 | (value & 0x3F));
+            value >>= 6;
+        }
+        dest[0] = static_cast<T>((0xFF00 >> length) | (value & (0x7F >> length)));
+        return length;
+    } else if constexpr (isSame<T, char16>) {
+        if (value < 0x10000) {
+            dest[0] = static_cast<T>(value);
+            return 1;
+        }
+        value -= 0x10000;
+        dest[0] = static_cast<T>(0xD800 | ((value >> 10) & 0x3FF));
+        dest[1] = static_cast<T>(0xDC00 | (value & 0x3FF));
+        return 2;
+    } else if constexpr (isSame<T, char>) {
+        dest[0] = static_cast<T>(value & 0x7F);
+        return 1;
+    } else {
+        dest[0] = static_cast<T>(value);
+        return 1;
+    }
+}
+
+#if XS_ISA == XS_X86
+/**
+ * Find the characters in a block that have a case equivalent.
+ * @note ASCII letters are found for all types. UTF16/32 also find Latin-1 supplement letters while UTF8 finds the
+ * same letters by checking for continuation bytes that follow a 0xC3 lead byte.
+ * @tparam Upper True to find lower case letters (that can be converted to upper case), false for upper case letters.
+ * @tparam T     Type of character.
+ * @param input    The block of characters.
+ * @param previous The characters preceding each of those in input (only used for UTF8).
+ * @returns The case bit (0x20) of each found character, all other characters are zero.
+ */
+template<bool Upper, typename T>
+XS_INLINE __m128i utfCaseMask(const __m128i input, [[maybe_unused]] const __m128i previous) noexcept
+{
+    const auto set = [](const uint32 value) {
+        if constexpr (sizeof(T) == 1) {
+            return _mm_set1_epi8(static_cast<int8>(value));
+        } else if constexpr (sizeof(T) == 2) {
+            return _mm_set1_epi16(static_cast<int16>(value));
+        } else {
+            return _mm_set1_epi32(static_cast<int32>(value));
+        }
+    };
+    const auto equal = [&set](const __m128i value, const uint32 check) {
+        if constexpr (sizeof(T) == 1) {
+            return _mm_cmpeq_epi8(value, set(check));
+        } else if constexpr (sizeof(T) == 2) {
+            return _mm_cmpeq_epi16(value, set(check));
+        } else {
+            return _mm_cmpeq_epi32(value, set(check));
+        }
+    };
+    // There is no unsigned compare so the start of the range is moved to the minimum signed value instead
+    const auto inRange = [&set, input](const uint32 low, const uint32 count) {
+        constexpr uint32 sign = 1U << (sizeof(T) * 8 - 1);
+        if constexpr (sizeof(T) == 1) {
+            return _mm_cmpgt_epi8(set(sign + count), _mm_add_epi8(input, set(sign - low)));
+        } else if constexpr (sizeof(T) == 2) {
+            return _mm_cmpgt_epi16(set(sign + count), _mm_add_epi16(input, set(sign - low)));
+        } else {
+            return _mm_cmpgt_epi32(set(sign + count), _mm_add_epi32(input, set(sign - low)));
+        }
+    };
+    __m128i mask = inRange(Upper ? 0x61 : 0x41, 26);
+    if constexpr (isSame<T, char8>) {
+        const __m128i latin = _mm_andnot_si128(equal(input, Upper ? 0xB7 : 0x97), inRange(Upper ? 0xA0 : 0x80, 31));
+        mask = _mm_or_si128(mask, _mm_and_si128(latin, equal(previous, 0xC3)));
+    } else if constexpr (!isSame<T, char>) {
+        // The multiplication and division signs are the only non-letters in the range
+        const __m128i latin = _mm_andnot_si128(equal(input, Upper ? 0xF7 : 0xD7), inRange(Upper ? 0xE0 : 0xC0, 31));
+        mask = _mm_or_si128(mask, latin);
+    }
+    return _mm_and_si128(mask, set(0x20));
+}
+
+/**
+ * Find the characters in a block that have a case equivalent.
+ * @note ASCII letters are found for all types. UTF16/32 also find Latin-1 supplement letters while UTF8 finds the
+ * same letters by checking for continuation bytes that follow a 0xC3 lead byte.
+ * @tparam Upper True to find lower case letters (that can be converted to upper case), false for upper case letters.
+ * @tparam T     Type of character.
+ * @param input    The block of characters.
+ * @param previous The characters preceding each of those in input (only used for UTF8).
+ * @returns The case bit (0x20) of each found character, all other characters are zero.
+ */
+template<bool Upper, typename T>
+XS_INLINE __m256i utfCaseMask(const __m256i input, [[maybe_unused]] const __m256i previous) noexcept
+{
+    const auto set = [](const uint32 value) {
+        if constexpr (sizeof(T) == 1) {
+            return _mm256_set1_epi8(static_cast<int8>(value));
+        } else if constexpr (sizeof(T) == 2) {
+            return _mm256_set1_epi16(static_cast<int16>(value));
+        } else {
+            return _mm256_set1_epi32(static_cast<int32>(value));
+        }
+    };
+    const auto equal = [&set](const __m256i value, const uint32 check) {
+        if constexpr (sizeof(T) == 1) {
+            return _mm256_cmpeq_epi8(value, set(check));
+        } else if constexpr (sizeof(T) == 2) {
+            return _mm256_cmpeq_epi16(value, set(check));
+        } else {
+            return _mm256_cmpeq_epi32(value, set(check));
+        }
+    };
+    const auto inRange = [&set, input](const uint32 low, const uint32 count) {
+        constexpr uint32 sign = 1U << (sizeof(T) * 8 - 1);
+        if constexpr (sizeof(T) == 1) {
+            return _mm256_cmpgt_epi8(set(sign + count), _mm256_add_epi8(input, set(sign - low)));
+        } else if constexpr (sizeof(T) == 2) {
+            return _mm256_cmpgt_epi16(set(sign + count), _mm256_add_epi16(input, set(sign - low)));
+        } else {
+            return _mm256_cmpgt_epi32(set(sign + count), _mm256_add_epi32(input, set(sign - low)));
+        }
+    };
+    __m256i mask = inRange(Upper ? 0x61 : 0x41, 26);
+    if constexpr (isSame<T, char8>) {
+        const __m256i latin =
+            _mm256_andnot_si256(equal(input, Upper ? 0xB7 : 0x97), inRange(Upper ? 0xA0 : 0x80, 31));
+        mask = _mm256_or_si256(mask, _mm256_and_si256(latin, equal(previous, 0xC3)));
+    } else if constexpr (!isSame<T, char>) {
+        const __m256i latin =
+            _mm256_andnot_si256(equal(input, Upper ? 0xF7 : 0xD7), inRange(Upper ? 0xE0 : 0xC0, 31));
+        mask = _mm256_or_si256(mask, latin);
+    }
+    return _mm256_and_si256(mask, set(0x20));
+}
+
+/**
+ * Find the characters in a block that have a case equivalent.
+ * @note Finds the same characters as the 128b version using unsigned compares into mask registers.
+ * @tparam Upper True to find lower case letters (that can be converted to upper case), false for upper case letters.
+ * @tparam T     Type of character.
+ * @param input    The block of characters.
+ * @param previous The characters preceding each of those in input (only used for UTF8).
+ * @returns The case bit (0x20) of each found character, all other characters are zero.
+ */
+template<bool Upper, typename T>
+XS_INLINE __m512i utfCaseMask(const __m512i input, [[maybe_unused]] const __m512i previous) noexcept
+{
+    const auto set = [](const uint32 value) {
+        if constexpr (sizeof(T) == 1) {
+            return _mm512_set1_epi8(static_cast<int8>(value));
+        } else if constexpr (sizeof(T) == 2) {
+            return _mm512_set1_epi16(static_cast<int16>(value));
+        } else {
+            return _mm512_set1_epi32(static_cast<int32>(value));
+        }
+    };
+    const auto notEqual = [&set](const __m512i value, const uint32 check) {
+        if constexpr (sizeof(T) == 1) {
+            return _mm512_cmpneq_epi8_mask(value, set(check));
+        } else if constexpr (sizeof(T) == 2) {
+            return _mm512_cmpneq_epi16_mask(value, set(check));
+        } else {
+            return _mm512_cmpneq_epi32_mask(value, set(check));
+        }
+    };
+    const auto inRange = [&set, input](const uint32 low, const uint32 count) {
+        if constexpr (sizeof(T) == 1) {
+            return _mm512_cmplt_epu8_mask(_mm512_sub_epi8(input, set(low)), set(count));
+        } else if constexpr (sizeof(T) == 2) {
+            return _mm512_cmplt_epu16_mask(_mm512_sub_epi16(input, set(low)), set(count));
+        } else {
+            return _mm512_cmplt_epu32_mask(_mm512_sub_epi32(input, set(low)), set(count));
+        }
+    };
+    auto mask = inRange(Upper ? 0x61 : 0x41, 26);
+    if constexpr (isSame<T, char8>) {
+        mask |= inRange(Upper ? 0xA0 : 0x80, 31) & notEqual(input, Upper ? 0xB7 : 0x97) &
+            _mm512_cmpeq_epi8_mask(previous, set(0xC3));
+    } else if constexpr (!isSame<T, char>) {
+        mask |= inRange(Upper ? 0xE0 : 0xC0, 31) & notEqual(input, Upper ? 0xF7 : 0xD7);
+    }
+    if constexpr (sizeof(T) == 1) {
+        return _mm512_maskz_mov_epi8(mask, set(0x20));
+    } else if constexpr (sizeof(T) == 2) {
+        return _mm512_maskz_mov_epi16(mask, set(0x20));
+    } else {
+        return _mm512_maskz_mov_epi32(mask, set(0x20));
+    }
+}
+#endif
+
+/**
+ * Convert the case of a single character.
+ * @note Uses the same character ranges as utfCaseMask.
+ * @tparam Upper True to convert to upper case, false for lower case.
+ * @tparam T     Type of character.
+ * @param value    The character to convert.
+ * @param previous The preceding character (only used for UTF8).
+ * @returns The converted character.
+ */
+template<bool Upper, typename T>
+XS_INLINE T utfChangeCase(const T value, [[maybe_unused]] const T previous) noexcept
+{
+    const auto current = static_cast<uint32>(value);
+    bool change = current - (Upper ? 0x61U : 0x41U) < 26;
+    if constexpr (isSame<T, char8>) {
+        change |= (previous == 0xC3) & (current - (Upper ? 0xA0U : 0x80U) < 31) & (current != (Upper ? 0xB7U : 0x97U));
+    } else if constexpr (!isSame<T, char>) {
+        change |= (current - (Upper ? 0xE0U : 0xC0U) < 31) & (current != (Upper ? 0xF7U : 0xD7U));
+    }
+    return change ? static_cast<T>(value ^ 0x20) : value;
+}
+
+/**
+ * Convert the case of a sequence of characters.
+ * @tparam Upper True to convert to upper case, false for lower case.
+ * @tparam T     Type of character.
+ * @param [in,out] string Pointer to the characters to convert.
+ * @param          number The number of characters.
+ */
+template<bool Upper, typename T>
+XS_INLINE void utfChangeCase(T* const XS_RESTRICT string, const uint0 number) noexcept
+{
+    // Only ASCII and continuation bytes are changed so the preceding UTF8 characters can be safely reloaded even
+    // after they have been converted
+    uint0 i = 0;
+#if XS_ISA == XS_X86
+    if constexpr (hasISAFeature<ISAFeature::AVX512BW>) {
+        for (; i + 64 / sizeof(T) <= number; i += 64 / sizeof(T)) {
+            const __m512i input = _mm512_loadu_si512(string + i);
+            __m512i previous = input;
+            if constexpr (isSame<T, char8>) {
+                previous = i > 0 ? _mm512_loadu_si512(string + i - 1) :
+                                   _mm512_alignr_epi8(input, _mm512_alignr_epi64(input, _mm512_setzero_si512(), 6), 15);
+            }
+            _mm512_storeu_si512(string + i, _mm512_xor_si512(input, utfCaseMask<Upper, T>(input, previous)));
+        }
+    }
+    if constexpr (hasISAFeature<ISAFeature::AVX2>) {
+        for (; i + 32 / sizeof(T) <= number; i += 32 / sizeof(T)) {
+            const __m256i input = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(string + i));
+            __m256i previous = input;
+            if constexpr (isSame<T, char8>) {
+                previous = i > 0 ? _mm256_loadu_si256(reinterpret_cast<const __m256i*>(string + i - 1)) :
+                                   _mm256_alignr_epi8(input, _mm256_permute2x128_si256(input, input, 0x08), 15);
+            }
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(string + i),
+                _mm256_xor_si256(input, utfCaseMask<Upper, T>(input, previous)));
+        }
+    }
+    if constexpr (hasISAFeature<ISAFeature::SSE2>) {
+        for (; i + 16 / sizeof(T) <= number; i += 16 / sizeof(T)) {
+            const __m128i input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(string + i));
+            __m128i previous = input;
+            if constexpr (isSame<T, char8>) {
+                previous = i > 0 ? _mm_loadu_si128(reinterpret_cast<const __m128i*>(string + i - 1)) :
+                                   _mm_slli_si128(input, 1);
+            }
+            _mm_storeu_si128(
+                reinterpret_cast<__m128i*>(string + i), _mm_xor_si128(input, utfCaseMask<Upper, T>(input, previous)));
+        }
+    }
+#endif
+    T previous = i > 0 ? string[i - 1] : T{0};
+    for (; i < number; ++i) {
+        const T current = string[i];
+        string[i] = utfChangeCase<Upper>(current, previous);
+        previous = current;
+    }
+}
+} // namespace NoExport
+
+/**
+ * Check if a sequence of characters is valid UTF8.
+ * @note Rejects overlong encodings, surrogates, code points above 0x10FFFF and truncated sequences. Blocks of
+ * characters are checked at the same time using lookup tables indexed by the nibbles of each pair of bytes.
+ * @param string Pointer to the characters to check.
+ * @param number The number of characters.
+ * @returns True if valid, false if not.
+ */
+XS_INLINE bool utf8Validate(const char8* const XS_RESTRICT string, const uint0 number) noexcept
+{
+#if XS_ISA == XS_X86
+    if constexpr (hasISAFeature<ISAFeature::AVX512BW>) {
+        __m512i error = _mm512_setzero_si512();
+        __m512i previous = _mm512_setzero_si512();
+        __m512i incomplete = _mm512_setzero_si512();
+        const __m512i incompleteMax = _mm512_load_si512(NoExport::utf8IncompleteMax);
+        const auto check = [&](const __m512i input) {
+            if (_mm512_movepi8_mask(input) == 0) {
+                error = _mm512_or_si512(error, incomplete);
+                incomplete = _mm512_setzero_si512();
+            } else {
+                error = _mm512_or_si512(error, NoExport::utf8CheckBlock(input, previous));
+                incomplete = _mm512_subs_epu8(input, incompleteMax);
+            }
+            previous = input;
+        };
+        uint0 i = 0;
+        for (; i + 64 <= number; i += 64) {
+            check(_mm512_loadu_si512(string + i));
+        }
+        alignas(64) uint8 last[64] = {}; // NOLINT(modernize-avoid-c-arrays)
+        memCopy<uint8>(last, reinterpret_cast<const uint8*>(string + i), number - i);
+        check(_mm512_load_si512(last));
+        return _mm512_test_epi64_mask(error, error) == 0;
+    } else if constexpr (hasISAFeature<ISAFeature::AVX2>) {
+        __m256i error = _mm256_setzero_si256();
+        __m256i previous = _mm256_setzero_si256();
+        __m256i incomplete = _mm256_setzero_si256();
+        const __m256i incompleteMax =
+            _mm256_load_si256(reinterpret_cast<const __m256i*>(NoExport::utf8IncompleteMax + 32));
+        const auto check = [&](const __m256i input) {
+            if (_mm256_movemask_epi8(input) == 0) {
+                // ASCII block, only need to check that the previous block didn't end mid sequence
+                error = _mm256_or_si256(error, incomplete);
+                incomplete = _mm256_setzero_si256();
+            } else {
+                error = _mm256_or_si256(error, NoExport::utf8CheckBlock(input, previous));
+                incomplete = _mm256_subs_epu8(input, incompleteMax);
+            }
+            previous = input;
+        };
+        uint0 i = 0;
+        for (; i + 32 <= number; i += 32) {
+            check(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(string + i)));
+        }
+        // Pad the remaining characters with zeros so that any trailing incomplete sequence is detected
+        alignas(32) uint8 last[32] = {}; // NOLINT(modernize-avoid-c-arrays)
+        memCopy<uint8>(last, reinterpret_cast<const uint8*>(string + i), number - i);
+        check(_mm256_load_si256(reinterpret_cast<const __m256i*>(last)));
+        return _mm256_testz_si256(error, error) != 0;
+    } else if constexpr (hasISAFeature<ISAFeature::SSSE3>) {
+        __m128i error = _mm_setzero_si128();
+        __m128i previous = _mm_setzero_si128();
+        __m128i incomplete = _mm_setzero_si128();
+        const __m128i incompleteMax =
+            _mm_load_si128(reinterpret_cast<const __m128i*>(NoExport::utf8IncompleteMax + 48));
+        const auto check = [&](const __m128i input) {
+            if (_mm_movemask_epi8(input) == 0) {
+                error = _mm_or_si128(error, incomplete);
+                incomplete = _mm_setzero_si128();
+            } else {
+                error = _mm_or_si128(error, NoExport::utf8CheckBlock(input, previous));
+                incomplete = _mm_subs_epu8(input, incompleteMax);
+            }
+            previous = input;
+        };
+        uint0 i = 0;
+        for (; i + 16 <= number; i += 16) {
+            check(_mm_loadu_si128(reinterpret_cast<const __m128i*>(string + i)));
+        }
+        alignas(16) uint8 last[16] = {}; // NOLINT(modernize-avoid-c-arrays)
+        memCopy<uint8>(last, reinterpret_cast<const uint8*>(string + i), number - i);
+        check(_mm_load_si128(reinterpret_cast<const __m128i*>(last)));
+        return _mm_movemask_epi8(_mm_cmpeq_epi8(error, _mm_setzero_si128())) == 0xFFFF;
+    }
+#endif
+    const char8* XS_RESTRICT pos = string;
+    const char8* const end = string + number;
+    while (pos < end) {
+        const char8 lead = *pos;
+        if (lead < 0x80) {
+            ++pos;
+            continue;
+        }
+        uint0 length;
+        char8 minNext = 0x80;
+        char8 maxNext = 0xBF;
+        if (lead < 0xC2) {
+            return false;
+        }
+        if (lead < 0xE0) {
+            length = 2;
+        } else if (lead < 0xF0) {
+            length = 3;
+            minNext = (lead == 0xE0) ? 0xA0 : minNext;
+            maxNext = (lead == 0xED) ? 0x9F : maxNext;
+        } else if (lead < 0xF5) {
+            length = 4;
+            minNext = (lead == 0xF0) ? 0x90 : minNext;
+            maxNext = (lead == 0xF4) ? 0x8F : maxNext;
+        } else {
+            return false;
+        }
+        if (static_cast<uint0>(end - pos) < length || pos[1] < minNext || pos[1] > maxNext) {
+            return false;
+        }
+        for (uint0 i = 2; i < length; ++i) {
+            if ((pos[i] & 0xC0) != 0x80) {
+                return false;
+            }
+        }
+        pos += length;
+    }
+    return true;
+}
+
+/**
+ * Get the number of characters required to convert a sequence of characters to a different encoding.
+ * @note UTF8 input must be valid (see utf8Validate). Conversion to char is treated as ASCII and uses a single
+ * character per code point.
+ * @tparam CharType  Type of destination character.
+ * @tparam CharType2 Type of source character.
+ * @param string Pointer to the characters to convert.
+ * @param number The number of characters in the input.
+ * @returns The number of characters required to store the converted string.
+ */
+template<typename CharType, typename CharType2>
+requires(isSameAny<CharType, char, char8, char16, char32> && isSameAny<CharType2, char8, char16, char32>)
+XS_INLINE uint0 utfConvertLength(const CharType2* XS_RESTRICT string, const uint0 number) noexcept
+{
+    using namespace NoExport;
+    if constexpr (isSame<CharType, CharType2> || (isSame<CharType2, char32> && isSameAny<CharType, char, char32>)) {
+        return number;
+    } else {
+        uint0 ret = 0;
+        const CharType2* const end = string + number;
+        if constexpr (isSame<CharType2, char8>) {
+            // Every character that is not a continuation byte starts a new code point
+            for (; static_cast<uint0>(end - string) >= utfBlockLength; string += utfBlockLength) {
+                ret += utfBlockLength - (utfCountAtLeast<0x80>(string) - utfCountAtLeast<0xC0>(string));
+                if constexpr (isSame<CharType, char16>) {
+                    ret += utfCountAtLeast<0xF0>(string);
+                }
+            }
+            for (; string < end; ++string) {
+                ret += (*string & 0xC0) != 0x80 ? 1 : 0;
+                if constexpr (isSame<CharType, char16>) {
+                    ret += *string >= 0xF0 ? 1 : 0;
+                }
+            }
+        } else if constexpr (isSame<CharType2, char16>) {
+            while (static_cast<uint0>(end - string) >= utfBlockLength) {
+                if (utfCountSurrogates(string) == 0) [[likely]] {
+                    ret += utfBlockLength;
+                    if constexpr (isSame<CharType, char8>) {
+                        ret += utfCountAtLeast<0x80>(string) + utfCountAtLeast<0x800>(string);
+                    }
+                    string += utfBlockLength;
+                } else {
+                    const CharType2* const blockEnd = string + utfBlockLength;
+                    while (string < blockEnd) {
+                        ret += utfEncodeLength<CharType>(utfDecode(string, end));
+                    }
+                }
+            }
+            while (string < end) {
+                ret += utfEncodeLength<CharType>(utfDecode(string, end));
+            }
+        } else {
+            for (; static_cast<uint0>(end - string) >= utfBlockLength; string += utfBlockLength) {
+                ret += utfBlockLength + utfCountAtLeast<0x10000>(string);
+                if constexpr (isSame<CharType, char8>) {
+                    ret += utfCountAtLeast<0x80>(string) + utfCountAtLeast<0x800>(string) +
+                        utfCountAtLeast<0x200000>(string) + utfCountAtLeast<0x4000000>(string);
+                }
+            }
+            for (; string < end; ++string) {
+                ret += utfEncodeLength<CharType>(*string);
+            }
+        }
+        return ret;
+    }
+}
+
+/**
+ * Convert a sequence of characters to a different encoding.
+ * @note UTF8 input must be valid (see utf8Validate). Conversion to char is treated as ASCII and only keeps the lower 7
+ * bits of each code point. Blocks of characters that map directly to the output encoding (e.g. ASCII) are converted
+ * at the same time.
+ * @tparam CharType  Type of destination character.
+ * @tparam CharType2 Type of source character.
+ * @param       string Pointer to the characters to convert.
+ * @param       number The number of characters in the input.
+ * @param [out] dest   Location to store the converted characters, must have space for the number of characters
+ *  returned by utfConvertLength.
+ * @returns The number of characters written.
+ */
+template<typename CharType, typename CharType2>
+requires(isSameAny<CharType, char, char8, char16, char32> && isSameAny<CharType2, char8, char16, char32>)
+XS_INLINE uint0 utfConvert(
+    const CharType2* XS_RESTRICT string, const uint0 number, CharType* XS_RESTRICT dest) noexcept
+{
+    using namespace NoExport;
+    if constexpr (isSame<CharType, CharType2>) {
+        memCopy<CharType>(dest, string, number * sizeof(CharType));
+        return number;
+    } else {
+        CharType* const start = dest;
+        const CharType2* const end = string + number;
+        while (static_cast<uint0>(end - string) >= utfBlockLength) {
+            if (utfIsCopyBlock<CharType>(string)) [[likely]] {
+                utfCopyBlock(string, dest);
+                string += utfBlockLength;
+                dest += utfBlockLength;
+            } else {
+                const CharType2* const blockEnd = string + utfBlockLength;
+                while (string < blockEnd) {
+                    dest += utfEncode(utfDecode(string, end), dest);
+                }
+            }
+        }
+        while (string < end) {
+            dest += utfEncode(utfDecode(string, end), dest);
+        }
+        return static_cast<uint0>(dest - start);
+    }
+}
+
+/**
+ * Convert a sequence of characters to lower case.
+ * @note Converts ASCII letters for all character types. UTF8/16/32 also convert the letters of the Latin-1
+ * supplement, these have the same encoded length in either case. Blocks of characters are converted at the same time.
+ * @tparam CharType Type of character.
+ * @param [in,out] string Pointer to the characters to convert.
+ * @param          number The number of characters.
+ */
+template<typename CharType>
+requires(isSameAny<CharType, char, char8, char16, char32>)
+XS_INLINE void utfToLower(CharType* const XS_RESTRICT string, const uint0 number) noexcept
+{
+    NoExport::utfChangeCase<false>(string, number);
+}
+
+/**
+ * Convert a sequence of characters to upper case.
+ * @note Converts the same characters as utfToLower.
+ * @tparam CharType Type of character.
+ * @param [in,out] string Pointer to the characters to convert.
+ * @param          number The number of characters.
+ */
+template<typename CharType>
+requires(isSameAny<CharType, char, char8, char16, char32>)
+XS_INLINE void utfToUpper(CharType* const XS_RESTRICT string, const uint0 number) noexcept
+{
+    NoExport::utfChangeCase<true>(string, number);
+}
+
+/**
+ * Compare two sequences of characters ignoring case.
+ * @note Characters are compared as if converted with utfToLower without modifying either input.
+ * @tparam CharType Type of character.
+ * @param string1 Pointer to the first sequence of characters.
+ * @param number1 The number of characters in the first sequence.
+ * @param string2 Pointer to the second sequence of characters.
+ * @param number2 The number of characters in the second sequence.
+ * @return Integer describing character comparison (0=equal, >0=greater than, <0=less than).
+ */
+template<typename CharType>
+requires(isSameAny<CharType, char, char8, char16, char32>)
+XS_INLINE int32 utfCompareIgnoreCase(const CharType* const XS_RESTRICT string1, const uint0 number1,
+    const CharType* const XS_RESTRICT string2, const uint0 number2) noexcept
+{
+    using namespace NoExport;
+    const uint0 number = min(number1, number2);
+    uint0 i = 0;
+    // Blocks are compared until one differs, the exact difference is then found using the individual characters
+#if XS_ISA == XS_X86
+    if constexpr (hasISAFeature<ISAFeature::AVX512BW>) {
+        const auto fold = [&i](const CharType* const XS_RESTRICT string) {
+            const __m512i input = _mm512_loadu_si512(string + i);
+            __m512i previous = input;
+            if constexpr (isSame<CharType, char8>) {
+                previous = i > 0 ? _mm512_loadu_si512(string + i - 1) :
+                                   _mm512_alignr_epi8(input, _mm512_alignr_epi64(input, _mm512_setzero_si512(), 6), 15);
+            }
+            return _mm512_xor_si512(input, utfCaseMask<false, CharType>(input, previous));
+        };
+        for (; i + 64 / sizeof(CharType) <= number; i += 64 / sizeof(CharType)) {
+            if (_mm512_cmpneq_epi64_mask(fold(string1), fold(string2)) != 0) {
+                break;
+            }
+        }
+    }
+    if constexpr (hasISAFeature<ISAFeature::AVX2>) {
+        const auto fold = [&i](const CharType* const XS_RESTRICT string) {
+            const __m256i input = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(string + i));
+            __m256i previous = input;
+            if constexpr (isSame<CharType, char8>) {
+                previous = i > 0 ? _mm256_loadu_si256(reinterpret_cast<const __m256i*>(string + i - 1)) :
+                                   _mm256_alignr_epi8(input, _mm256_permute2x128_si256(input, input, 0x08), 15);
+            }
+            return _mm256_xor_si256(input, utfCaseMask<false, CharType>(input, previous));
+        };
+        for (; i + 32 / sizeof(CharType) <= number; i += 32 / sizeof(CharType)) {
+            if (_mm256_movemask_epi8(_mm256_cmpeq_epi8(fold(string1), fold(string2))) != -1) {
+                break;
+            }
+        }
+    }
+    if constexpr (hasISAFeature<ISAFeature::SSE2>) {
+        const auto fold = [&i](const CharType* const XS_RESTRICT string) {
+            const __m128i input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(string + i));
+            __m128i previous = input;
+            if constexpr (isSame<CharType, char8>) {
+                previous = i > 0 ? _mm_loadu_si128(reinterpret_cast<const __m128i*>(string + i - 1)) :
+                                   _mm_slli_si128(input, 1);
+            }
+            return _mm_xor_si128(input, utfCaseMask<false, CharType>(input, previous));
+        };
+        for (; i + 16 / sizeof(CharType) <= number; i += 16 / sizeof(CharType)) {
+            if (_mm_movemask_epi8(_mm_cmpeq_epi8(fold(string1), fold(string2))) != 0xFFFF) {
+                break;
+            }
+        }
+    }
+#endif
+    CharType previous1 = i > 0 ? string1[i - 1] : CharType{0};
+    CharType previous2 = i > 0 ? string2[i - 1] : CharType{0};
+    for (; i < number; ++i) {
+        const CharType char1 = utfChangeCase<false>(string1[i], previous1);
+        const CharType char2 = utfChangeCase<false>(string2[i], previous2);
+        if (char1 != char2) {
+            return static_cast<int32>(char1) - static_cast<int32>(char2);
+        }
+        previous1 = string1[i];
+        previous2 = string2[i];
+    }
+    return static_cast<int32>(number1 - number2);
+}
+} // namespace Shift
@@ -1301,7 +1301,7 @@ public:
      * Get as an integer where each bit corresponds to a member bool.
      * @returns The required integer.
      */
-    XS_INLINE constexpr uint8 getAsInteger() noexcept
+    XS_INLINE constexpr uint8 getAsInteger() const noexcept
     {
 #if XS_ISA == XS_X86
         if constexpr (IsSIMD) {
@@ -1948,7 +1948,7 @@ public:
      * Get as an integer where each bit corresponds to a member bool.
      * @returns The required integer.
      */
-    XS_INLINE constexpr uint8 getAsInteger() noexcept
+    XS_INLINE constexpr uint8 getAsInteger() const noexcept
     {
 #if XS_ISA == XS_X86
         if constexpr (IsSIMD) {
@@ -0,0 +1,36 @@
+#pragma once
+/**
+ * Copyright Matthew Oliver
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "XSBit.hpp"
+
+#include <atomic>
+
+namespace Shift {
+/**< Size of a cache line, used to pad data shared between threads to prevent false sharing */
+inline constexpr uint0 cacheLineSize = 64;
+
+/**
+ * Hint to the processor that the calling thread is waiting in a spin loop.
+ * @note This reduces power usage and frees execution resources for any sibling hyper-thread.
+ */
+XS_INLINE void cpuPause() noexcept
+{
+#if XS_ISA == XS_X86
+    _mm_pause();
+#endif
+}
+} // namespace Shift
@@ -0,0 +1,329 @@
+#pragma once
+/**
+ * Copyright Matthew Oliver
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Memory/XSAllocatorHeap.hpp"
+#include "Memory/XSRingUtility.hpp"
+#include "Threading/XSAtomic.hpp"
+
+namespace Shift {
+namespace NoExport {
+/**
+ * A single slot within a MPMCQueue.
+ * @tparam T Type of element stored within the slot.
+ */
+template<typename T>
+class MPMCQueueCell
+{
+public:
+    std::atomic<uint0> sequence;         /**< Sequence number used to determine if the slot is free or used */
+    alignas(T) uint8 storage[sizeof(T)]; /**< Storage for the element */ // NOLINT(modernize-avoid-c-arrays)
+
+    /**
+     * Get the element stored in the slot.
+     * @returns Pointer to the element.
+     */
+    XS_INLINE T* getElement() noexcept
+    {
+        return reinterpret_cast<T*>(storage);
+    }
+};
+} // namespace NoExport
+
+/**
+ * Bounded lock-free queue that supports multiple producer and multiple consumer threads.
+ * @note Each slot stores a sequence number that tells producers and consumers whether the slot is ready for them.
+ * Threads claim a slot by incrementing the shared position with a single compare and swap and then publish the
+ * result by updating the slots sequence number. When Blocking is enabled then blocking push and pop functions are
+ * available which put the calling thread to sleep using an atomic wait while the queue is full/empty.
+ * @tparam T        Type of element stored within the queue.
+ * @tparam Blocking True to enable blocking push and pop operations.
+ * @tparam Alloc    Type of allocator used to allocate elements.
+ */
+template<typename T, bool Blocking = false, class Alloc = AllocRegionHeap<T>>
+class MPMCQueue
+{
+public:
+    using Type = T;
+    using Cell = NoExport::MPMCQueueCell<Type>;
+    using Allocator = typename Alloc::template Allocator<Cell, cacheLineSize>;
+    using Handle = typename Allocator::Handle;
+
+    alignas(cacheLineSize) std::atomic<uint0> tail = 0; /**< Position of the next slot to push into */
+    alignas(cacheLineSize) std::atomic<uint0> head = 0; /**< Position of the next slot to pop from */
+    alignas(cacheLineSize) Handle handle;               /**< The handle used to store the slots */
+    uint0 capacity = 0;                                 /**< Number of allocated slots (power of 2) */
+
+    /**
+     * Constructor that reserves space for a number of elements.
+     * @note The reserved space is rounded up to the next power of 2.
+     * @param number The number of elements to reserve space for.
+     */
+    explicit XS_INLINE MPMCQueue(const uint0 number) noexcept
+        : handle(NoExport::ringCapacityFor(number))
+    {
+        if (handle.pointer != nullptr) [[likely]] {
+            capacity = NoExport::ringCapacityFor(number);
+            for (uint0 i = 0; i < capacity; ++i) {
+                memConstruct<std::atomic<uint0>>(&handle.pointer[i].sequence, i);
+            }
+        }
+    }
+
+    XS_INLINE MPMCQueue(const MPMCQueue& other) noexcept = delete;
+
+    XS_INLINE MPMCQueue(MPMCQueue&& other) noexcept = delete;
+
+    /** Destructor. */
+    XS_INLINE ~MPMCQueue() noexcept
+    {
+        if constexpr (!isTriviallyDestructible<Type>) {
+            const uint0 end = tail.load(std::memory_order_relaxed);
+            for (uint0 i = head.load(std::memory_order_relaxed); i != end; ++i) {
+                memDestruct<Type>(handle.pointer[i & (capacity - 1)].getElement());
+            }
+        }
+    }
+
+    XS_INLINE MPMCQueue& operator=(const MPMCQueue& other) noexcept = delete;
+
+    XS_INLINE MPMCQueue& operator=(MPMCQueue&& other) noexcept = delete;
+
+    /**
+     * Checks whether the queue has any allocated memory.
+     * @returns True if valid, false if not.
+     */
+    XS_INLINE bool isValid() const noexcept
+    {
+        return capacity != 0;
+    }
+
+    /**
+     * Get the approximate number of elements in the queue.
+     * @note As other threads may be modifying the queue the result may already be out of date.
+     * @returns The number of elements currently stored within the queue.
+     */
+    XS_INLINE uint0 getLength() const noexcept
+    {
+        const uint0 first = head.load(std::memory_order_acquire);
+        const uint0 last = tail.load(std::memory_order_acquire);
+        return last > first ? last - first : 0;
+    }
+
+    /**
+     * Get the number of elements currently reserved for.
+     * @returns The number of elements that can be stored before the queue is full.
+     */
+    XS_INLINE uint0 getReservedLength() const noexcept
+    {
+        return capacity;
+    }
+
+    /**
+     * Add an element to the end of the queue.
+     * @param element The new element.
+     * @returns False if the queue is full.
+     */
+    XS_INLINE bool tryPush(const Type& element) noexcept
+    {
+        uint0 position;
+        Cell* cell = claimPush<false>(position);
+        if (cell == nullptr) [[unlikely]] {
+            return false;
+        }
+        memConstruct<Type>(cell->getElement(), element);
+        publishPush(cell, position);
+        return true;
+    }
+
+    /**
+     * Add an element to the end of the queue using direct construction.
+     * @tparam Args Type of the arguments.
+     * @param values The values used to construct the new element.
+     * @returns False if the queue is full.
+     */
+    template<typename... Args>
+    requires(isNothrowConstructible<Type, Args...>)
+    XS_INLINE bool tryPush(Args&&... values) noexcept
+    {
+        uint0 position;
+        Cell* cell = claimPush<false>(position);
+        if (cell == nullptr) [[unlikely]] {
+            return false;
+        }
+        memConstruct<Type>(cell->getElement(), forward<Args>(values)...);
+        publishPush(cell, position);
+        return true;
+    }
+
+    /**
+     * Add an element to the end of the queue, waiting for space if the queue is full.
+     * @param element The new element.
+     */
+    XS_INLINE void push(const Type& element) noexcept
+    requires(Blocking)
+    {
+        uint0 position;
+        Cell* cell = claimPush<true>(position);
+        memConstruct<Type>(cell->getElement(), element);
+        publishPush(cell, position);
+    }
+
+    /**
+     * Add an element to the end of the queue using direct construction, waiting for space if the queue is full.
+     * @tparam Args Type of the arguments.
+     * @param values The values used to construct the new element.
+     */
+    template<typename... Args>
+    requires(Blocking && isNothrowConstructible<Type, Args...>)
+    XS_INLINE void push(Args&&... values) noexcept
+    {
+        uint0 position;
+        Cell* cell = claimPush<true>(position);
+        memConstruct<Type>(cell->getElement(), forward<Args>(values)...);
+        publishPush(cell, position);
+    }
+
+    /**
+     * Remove the first element from the queue.
+     * @param [out] element Variable to move the removed element into.
+     * @returns False if the queue was empty.
+     */
+    XS_INLINE bool tryPop(Type& element) noexcept
+    {
+        uint0 position;
+        Cell* cell = claimPop<false>(position);
+        if (cell == nullptr) [[unlikely]] {
+            return false;
+        }
+        publishPop(cell, position, element);
+        return true;
+    }
+
+    /**
+     * Remove the first element from the queue, waiting for an element if the queue is empty.
+     * @param [out] element Variable to move the removed element into.
+     */
+    XS_INLINE void pop(Type& element) noexcept
+    requires(Blocking)
+    {
+        uint0 position;
+        Cell* cell = claimPop<true>(position);
+        publishPop(cell, position, element);
+    }
+
+private:
+    /**
+     * Claim a slot to push an element into.
+     * @tparam Wait True to wait for a slot to become free if the queue is full.
+     * @param [out] position The position of the claimed slot.
+     * @returns The claimed slot, nullptr if the queue is full.
+     */
+    template<bool Wait>
+    XS_INLINE Cell* claimPush(uint0& position) noexcept
+    {
+        XS_ASSERT(isValid());
+        position = tail.load(std::memory_order_relaxed);
+        while (true) {
+            Cell* cell = &handle.pointer[position & (capacity - 1)];
+            const uint0 sequence = cell->sequence.load(std::memory_order_acquire);
+            const auto difference = static_cast<int0>(sequence - position);
+            if (difference == 0) {
+                // Slot is free so try and claim it
+                if (tail.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) [[likely]] {
+                    return cell;
+                }
+            } else if (difference < 0) {
+                // Slot still contains an element from the previous pass so the queue is full
+                if constexpr (!Wait) {
+                    return nullptr;
+                } else {
+                    cell->sequence.wait(sequence, std::memory_order_acquire);
+                }
+                position = tail.load(std::memory_order_relaxed);
+            } else {
+                // Another producer claimed the slot
+                position = tail.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     * Mark a claimed slot as containing a new element.
+     * @param cell     The slot that the element was added to.
+     * @param position The position of the slot.
+     */
+    XS_INLINE void publishPush(Cell* cell, const uint0 position) noexcept
+    {
+        cell->sequence.store(position + 1, std::memory_order_release);
+        if constexpr (Blocking) {
+            cell->sequence.notify_all();
+        }
+    }
+
+    /**
+     * Claim a slot to pop an element from.
+     * @tparam Wait True to wait for an element to be added if the queue is empty.
+     * @param [out] position The position of the claimed slot.
+     * @returns The claimed slot, nullptr if the queue is empty.
+     */
+    template<bool Wait>
+    XS_INLINE Cell* claimPop(uint0& position) noexcept
+    {
+        XS_ASSERT(isValid());
+        position = head.load(std::memory_order_relaxed);
+        while (true) {
+            Cell* cell = &handle.pointer[position & (capacity - 1)];
+            const uint0 sequence = cell->sequence.load(std::memory_order_acquire);
+            const auto difference = static_cast<int0>(sequence - (position + 1));
+            if (difference == 0) {
+                // Slot contains an element so try and claim it
+                if (head.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) [[likely]] {
+                    return cell;
+                }
+            } else if (difference < 0) {
+                // Slot has not been filled yet so the queue is empty
+                if constexpr (!Wait) {
+                    return nullptr;
+                } else {
+                    cell->sequence.wait(sequence, std::memory_order_acquire);
+                }
+                position = head.load(std::memory_order_relaxed);
+            } else {
+                // Another consumer claimed the slot
+                position = head.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     * Move an element out of a claimed slot and mark the slot as free for the next pass.
+     * @param       cell     The slot to remove the element from.
+     * @param       position The position of the slot.
+     * @param [out] element  Variable to move the removed element into.
+     */
+    XS_INLINE void publishPop(Cell* cell, const uint0 position, Type& element) noexcept
+    {
+        Type* stored = cell->getElement();
+        element = move(*stored);
+        memDestruct<Type>(stored);
+        cell->sequence.store(position + capacity, std::memory_order_release);
+        if constexpr (Blocking) {
+            cell->sequence.notify_all();
+        }
+    }
+};
+} // namespace Shift
@@ -0,0 +1,518 @@
+#pragma once
+/**
+ * Copyright Matthew Oliver
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Memory/XSAllocatorHeap.hpp"
+#include "Memory/XSArrayView.hpp"
+#include "SIMD/XSSIMDTraits.hpp"
+#include "Threading/XSThreadPool.hpp"
+
+namespace Shift {
+namespace NoExport {
+/**< Minimum number of bytes processed by each parallel task so that the cost of creating the task is amortised */
+inline constexpr uint0 parallelMinimumBytes = 32768;
+
+/**< Number of tasks created for each worker thread so that uneven work can be balanced through stealing */
+inline constexpr uint0 parallelTasksPerThread = 4;
+
+/**
+ * Splits a range of elements into chunks that can be processed in parallel.
+ * @note Every chunk starts at a multiple of grain elements from the start of the range, so if the range is cache line
+ * aligned then each chunk is as well and no 2 chunks write to the same cache line. All chunk lengths are a multiple
+ * of the SIMD width and any remaining elements that do not fill a SIMD register are left as a separate tail.
+ * @tparam T  Type of the input elements.
+ * @tparam T2 Type of the output elements.
+ */
+template<typename T, typename T2 = T>
+class ParallelChunks
+{
+public:
+    /**< Number of elements processed by a single SIMD operation */
+    static constexpr uint0 width = max<uint0>(numValues<T, defaultWidthSIMD<T>>, numValues<T2, defaultWidthSIMD<T2>>);
+    /**< Number of elements that chunk lengths are a multiple of */
+    static constexpr uint0 grain = max<uint0>(width, max<uint0>(cacheLineSize / min<uint0>(sizeof(T), sizeof(T2)), 1));
+
+    uint0 bulk;   /**< Number of elements covered by the chunks (excludes the tail) */
+    uint0 length; /**< Number of elements in each chunk (last chunk may be shorter) */
+    uint0 count;  /**< Number of chunks */
+
+    /**
+     * Constructor.
+     * @param number  The number of elements in the range.
+     * @param threads The number of threads that will process the chunks.
+     */
+    XS_INLINE ParallelChunks(const uint0 number, const uint32 threads) noexcept
+        : bulk(number - (number % width))
+    {
+        constexpr uint0 minimum = max<uint0>(parallelMinimumBytes / max<uint0>(sizeof(T), sizeof(T2)), 1);
+        const uint0 tasks = max<uint0>(threads, 1) * parallelTasksPerThread;
+        const uint0 perTask = (bulk + tasks - 1) / tasks;
+        length = max<uint0>(perTask, minimum);
+        length = ((length + grain - 1) / grain) * grain;
+        count = (bulk + length - 1) / length;
+    }
+
+    /**
+     * Get the position of the first element in a chunk.
+     * @param chunk The index of the chunk.
+     * @returns The position.
+     */
+    XS_INLINE uint0 getStart(const uint0 chunk) const noexcept
+    {
+        return chunk * length;
+    }
+
+    /**
+     * Get the number of elements in a chunk.
+     * @param chunk The index of the chunk.
+     * @returns The number of elements.
+     */
+    XS_INLINE uint0 getLength(const uint0 chunk) const noexcept
+    {
+        return min<uint0>(length, bulk - chunk * length);
+    }
+};
+
+/**
+ * Run a function once for each chunk and wait for all of them to complete.
+ * @note The first chunk is run on the calling thread.
+ * @tparam F Type of the function.
+ * @param pool     The thread pool used to run the chunks.
+ * @param count    The number of chunks.
+ * @param function The function to run, is passed the index of the chunk.
+ */
+template<typename F>
+XS_INLINE void parallelRun(ThreadPool& pool, const uint0 count, F&& function) noexcept
+{
+    if (count > 1) {
+        TaskGroup group(pool);
+        for (uint0 i = 1; i < count; ++i) {
+            group.run([&function, i]() { function(i); });
+        }
+        function(0);
+        group.wait();
+    } else if (count == 1) {
+        function(0);
+    }
+}
+
+/**
+ * Sequentially scan a range of elements.
+ * @tparam Inclusive True to perform an inclusive scan, false for exclusive.
+ * @tparam T         Type of the elements.
+ * @tparam F         Type of the operation.
+ * @param input     The input elements.
+ * @param output    The output elements (may be the same as input).
+ * @param number    The number of elements.
+ * @param carry     The result of all elements before the range.
+ * @param hasCarry  False if there are no elements before the range (only used for inclusive scans).
+ * @param operation The associative operation used to combine elements.
+ */
+template<bool Inclusive, typename T, typename F>
+XS_INLINE void scanRange(
+    const T* input, T* output, uint0 number, T carry, const bool hasCarry, F& operation) noexcept
+{
+    if constexpr (Inclusive) {
+        if (!hasCarry && number != 0) {
+            carry = *input;
+            *output = carry;
+            ++input;
+            ++output;
+            --number;
+        }
+        for (; number != 0; --number) {
+            carry = operation(carry, *input);
+            *output = carry;
+            ++input;
+            ++output;
+        }
+    } else {
+        for (; number != 0; --number) {
+            const T value = *input;
+            *output = carry;
+            carry = operation(carry, value);
+            ++input;
+            ++output;
+        }
+    }
+}
+
+/**
+ * Scan a range of elements in parallel.
+ * @note Performs a parallel reduction of each chunk, a sequential scan of the chunk totals and then a parallel scan
+ * of each chunk starting from its chunks total.
+ * @tparam Inclusive True to perform an inclusive scan, false for exclusive.
+ * @tparam T         Type of the elements.
+ * @tparam F         Type of the operation.
+ * @param input     The input elements.
+ * @param output    The output elements (may be the same as input).
+ * @param number    The number of elements.
+ * @param identity  The identity value of the operation (only used for exclusive scans).
+ * @param operation The associative operation used to combine elements.
+ * @param pool      The thread pool used to run the scan.
+ */
+template<bool Inclusive, typename T, typename F>
+XS_INLINE void parallelScan(
+    const T* input, T* output, const uint0 number, const T& identity, F& operation, ThreadPool& pool) noexcept
+{
+    const ParallelChunks<T> chunks(number, pool.getThreadCount());
+    typename AllocRegionHeap<T>::Handle partials(chunks.count > 1 ? chunks.count : 0);
+    if (chunks.count <= 1 || partials.pointer == nullptr) {
+        scanRange<Inclusive>(input, output, number, identity, !Inclusive, operation);
+        return;
+    }
+    // Reduce each chunk to a single total
+    parallelRun(pool, chunks.count, [&](const uint0 chunk) {
+        const T* elements = input + chunks.getStart(chunk);
+        T total = *elements;
+        for (uint0 i = 1; i < chunks.getLength(chunk); ++i) {
+            total = operation(total, elements[i]);
+        }
+        memConstruct<T>(&partials.pointer[chunk], total);
+    });
+    // Convert the totals into the value carried into each chunk
+    T carry = Inclusive ? partials.pointer[0] : identity;
+    for (uint0 i = Inclusive ? 1 : 0; i < chunks.count; ++i) {
+        const T total = partials.pointer[i];
+        partials.pointer[i] = carry;
+        carry = operation(carry, total);
+    }
+    // Scan each chunk from its carried value
+    parallelRun(pool, chunks.count, [&](const uint0 chunk) {
+        const uint0 start = chunks.getStart(chunk);
+        scanRange<Inclusive>(input + start, output + start, chunks.getLength(chunk), partials.pointer[chunk],
+            !Inclusive || chunk != 0, operation);
+    });
+    scanRange<Inclusive>(input + chunks.bulk, output + chunks.bulk, number - chunks.bulk, carry, true, operation);
+    memDestructRange<T>(partials.pointer, chunks.count * sizeof(T));
+}
+} // namespace NoExport
+
+/**
+ * Run a function over a range of elements in parallel.
+ * @note The function is called with sub-ranges whose length is a multiple of the SIMD width and whose start is a
+ * multiple of a cache line from the start of the range. Any remaining elements that do not fill a SIMD register are
+ * passed in a single separate call (the tail). The function may be called concurrently from multiple threads.
+ * @tparam T Type of the elements.
+ * @tparam F Type of the function, must be callable as function(T* elements, uint0 number).
+ * @param elements The elements.
+ * @param number   The number of elements.
+ * @param function The function to run.
+ * @param pool     (Optional) The thread pool used to run the function.
+ */
+template<typename T, typename F>
+XS_INLINE void parallelFor(
+    T* const elements, const uint0 number, F&& function, ThreadPool& pool = getDefaultThreadPool()) noexcept
+{
+    const NoExport::ParallelChunks<removeConst<T>> chunks(number, pool.getThreadCount());
+    NoExport::parallelRun(pool, chunks.count, [&](const uint0 chunk) {
+        function(elements + chunks.getStart(chunk), chunks.getLength(chunk));
+    });
+    if (chunks.bulk != number) {
+        function(elements + chunks.bulk, number - chunks.bulk);
+    }
+}
+
+/**
+ * Run a function over the elements of an array in parallel.
+ * @tparam T     Type of the elements.
+ * @tparam Alloc Type of the arrays allocator.
+ * @tparam F     Type of the function, must be callable as function(T* elements, uint0 number).
+ * @param array    The array.
+ * @param function The function to run.
+ * @param pool     (Optional) The thread pool used to run the function.
+ */
+template<typename T, class Alloc, typename F>
+XS_INLINE void parallelFor(Array<T, Alloc>& array, F&& function, ThreadPool& pool = getDefaultThreadPool()) noexcept
+{
+    parallelFor(array.getData(), array.getLength(), forward<F>(function), pool);
+}
+
+/**
+ * Run a function over the elements of an array in parallel.
+ * @tparam T     Type of the elements.
+ * @tparam Alloc Type of the arrays allocator.
+ * @tparam F     Type of the function, must be callable as function(const T* elements, uint0 number).
+ * @param array    The array.
+ * @param function The function to run.
+ * @param pool     (Optional) The thread pool used to run the function.
+ */
+template<typename T, class Alloc, typename F>
+XS_INLINE void parallelFor(
+    const Array<T, Alloc>& array, F&& function, ThreadPool& pool = getDefaultThreadPool()) noexcept
+{
+    parallelFor(array.getData(), array.getLength(), forward<F>(function), pool);
+}
+
+/**
+ * Run a function over the elements of an array view in parallel.
+ * @tparam T Type of the elements.
+ * @tparam F Type of the function, must be callable as function(const T* elements, uint0 number).
+ * @param view     The array view.
+ * @param function The function to run.
+ * @param pool     (Optional) The thread pool used to run the function.
+ */
+template<typename T, typename F>
+XS_INLINE void parallelFor(const ArrayView<T>& view, F&& function, ThreadPool& pool = getDefaultThreadPool()) noexcept
+{
+    parallelFor(view.getData(), view.getLength(), forward<F>(function), pool);
+}
+
+/**
+ * Reduce a range of elements to a single value in parallel.
+ * @note The function is called with sub-ranges in the same way as parallelFor and returns the reduced value of that
+ * sub-range. The results of each sub-range are then combined in order using the reduce function, so the reduce
+ * function only needs to be associative.
+ * @tparam T  Type of the elements.
+ * @tparam R  Type of the result.
+ * @tparam F  Type of the function, must be callable as function(const T* elements, uint0 number) and return R.
+ * @tparam F2 Type of the reduce function, must be callable as reduce(R first, R second) and return R.
+ * @param elements The elements.
+ * @param number   The number of elements.
+ * @param identity The identity value of the reduction.
+ * @param function The function used to reduce each sub-range.
+ * @param reduce   The function used to combine the results of 2 sub-ranges.
+ * @param pool     (Optional) The thread pool used to run the function.
+ * @returns The reduced value.
+ */
+template<typename T, typename R, typename F, typename F2>
+XS_INLINE R parallelReduce(const T* const elements, const uint0 number, const R& identity, F&& function, F2&& reduce,
+    ThreadPool& pool = getDefaultThreadPool()) noexcept
+{
+    const NoExport::ParallelChunks<T> chunks(number, pool.getThreadCount());
+    typename AllocRegionHeap<R>::Handle partials(chunks.count > 1 ? chunks.count : 0);
+    R result = identity;
+    if (chunks.count <= 1 || partials.pointer == nullptr) {
+        if (chunks.bulk != 0) {
+            result = reduce(result, function(elements, chunks.bulk));
+        }
+    } else {
+        NoExport::parallelRun(pool, chunks.count, [&](const uint0 chunk) {
+            memConstruct<R>(
+                &partials.pointer[chunk], function(elements + chunks.getStart(chunk), chunks.getLength(chunk)));
+        });
+        for (uint0 i = 0; i < chunks.count; ++i) {
+            result = reduce(result, partials.pointer[i]);
+        }
+        memDestructRange<R>(partials.pointer, chunks.count * sizeof(R));
+    }
+    if (chunks.bulk != number) {
+        result = reduce(result, function(elements + chunks.bulk, number - chunks.bulk));
+    }
+    return result;
+}
+
+/**
+ * Reduce the elements of an array to a single value in parallel.
+ * @tparam T     Type of the elements.
+ * @tparam Alloc Type of the arrays allocator.
+ * @tparam R     Type of the result.
+ * @tparam F     Type of the function, must be callable as function(const T* elements, uint0 number) and return R.
+ * @tparam F2    Type of the reduce function, must be callable as reduce(R first, R second) and return R.
+ * @param array    The array.
+ * @param identity The identity value of the reduction.
+ * @param function The function used to reduce each sub-range.
+ * @param reduce   The function used to combine the results of 2 sub-ranges.
+ * @param pool     (Optional) The thread pool used to run the function.
+ * @returns The reduced value.
+ */
+template<typename T, class Alloc, typename R, typename F, typename F2>
+XS_INLINE R parallelReduce(const Array<T, Alloc>& array, const R& identity, F&& function, F2&& reduce,
+    ThreadPool& pool = getDefaultThreadPool()) noexcept
+{
+    return parallelReduce(
+        array.getData(), array.getLength(), identity, forward<F>(function), forward<F2>(reduce), pool);
+}
+
+/**
+ * Reduce the elements of an array view to a single value in parallel.
+ * @tparam T  Type of the elements.
+ * @tparam R  Type of the result.
+ * @tparam F  Type of the function, must be callable as function(const T* elements, uint0 number) and return R.
+ * @tparam F2 Type of the reduce function, must be callable as reduce(R first, R second) and return R.
+ * @param view     The array view.
+ * @param identity The identity value of the reduction.
+ * @param function The function used to reduce each sub-range.
+ * @param reduce   The function used to combine the results of 2 sub-ranges.
+ * @param pool     (Optional) The thread pool used to run the function.
+ * @returns The reduced value.
+ */
+template<typename T, typename R, typename F, typename F2>
+XS_INLINE R parallelReduce(const ArrayView<T>& view, const R& identity, F&& function, F2&& reduce,
+    ThreadPool& pool = getDefaultThreadPool()) noexcept
+{
+    return parallelReduce(
+        view.getData(), view.getLength(), identity, forward<F>(function), forward<F2>(reduce), pool);
+}
+
+/**
+ * Transform a range of elements into an output range in parallel.
+ * @note The function is called with matching input and output sub-ranges in the same way as parallelFor.
+ * @tparam T  Type of the input elements.
+ * @tparam T2 Type of the output elements.
+ * @tparam F  Type of the function, must be callable as function(const T* input, T2* output, uint0 number).
+ * @param input    The input elements.
+ * @param output   The output elements (may be the same as input).
+ * @param number   The number of elements.
+ * @param function The function used to transform each sub-range.
+ * @param pool     (Optional) The thread pool used to run the function.
+ */
+template<typename T, typename T2, typename F>
+XS_INLINE void parallelTransform(const T* const input, T2* const output, const uint0 number, F&& function,
+    ThreadPool& pool = getDefaultThreadPool()) noexcept
+{
+    const NoExport::ParallelChunks<T, T2> chunks(number, pool.getThreadCount());
+    NoExport::parallelRun(pool, chunks.count, [&](const uint0 chunk) {
+        const uint0 start = chunks.getStart(chunk);
+        function(input + start, output + start, chunks.getLength(chunk));
+    });
+    if (chunks.bulk != number) {
+        function(input + chunks.bulk, output + chunks.bulk, number - chunks.bulk);
+    }
+}
+
+/**
+ * Transform the elements of an array into another array in parallel.
+ * @tparam T      Type of the input elements.
+ * @tparam Alloc  Type of the input arrays allocator.
+ * @tparam T2     Type of the output elements.
+ * @tparam Alloc2 Type of the output arrays allocator.
+ * @tparam F      Type of the function, must be callable as function(const T* input, T2* output, uint0 number).
+ * @param input    The input array.
+ * @param output   The output array, must already contain at least as many elements as the input.
+ * @param function The function used to transform each sub-range.
+ * @param pool     (Optional) The thread pool used to run the function.
+ * @returns False if the output array is too small.
+ */
+template<typename T, class Alloc, typename T2, class Alloc2, typename F>
+XS_INLINE bool parallelTransform(const Array<T, Alloc>& input, Array<T2, Alloc2>& output, F&& function,
+    ThreadPool& pool = getDefaultThreadPool()) noexcept
+{
+    if (output.getLength() < input.getLength()) [[unlikely]] {
+        return false;
+    }
+    parallelTransform(input.getData(), output.getData(), input.getLength(), forward<F>(function), pool);
+    return true;
+}
+
+/**
+ * Transform the elements of an array view into an array in parallel.
+ * @tparam T      Type of the input elements.
+ * @tparam T2     Type of the output elements.
+ * @tparam Alloc2 Type of the output arrays allocator.
+ * @tparam F      Type of the function, must be callable as function(const T* input, T2* output, uint0 number).
+ * @param input    The input array view.
+ * @param output   The output array, must already contain at least as many elements as the input.
+ * @param function The function used to transform each sub-range.
+ * @param pool     (Optional) The thread pool used to run the function.
+ * @returns False if the output array is too small.
+ */
+template<typename T, typename T2, class Alloc2, typename F>
+XS_INLINE bool parallelTransform(const ArrayView<T>& input, Array<T2, Alloc2>& output, F&& function,
+    ThreadPool& pool = getDefaultThreadPool()) noexcept
+{
+    if (output.getLength() < input.getLength()) [[unlikely]] {
+        return false;
+    }
+    parallelTransform(input.getData(), output.getData(), input.getLength(), forward<F>(function), pool);
+    return true;
+}
+
+/**
+ * Calculate the inclusive prefix scan of a range of elements in parallel.
+ * @note Each output element is the combination of all input elements up to and including itself.
+ * @tparam T Type of the elements.
+ * @tparam F Type of the operation, must be associative and callable as operation(T first, T second).
+ * @param input     The input elements.
+ * @param output    The output elements (may be the same as input).
+ * @param number    The number of elements.
+ * @param operation The operation used to combine elements.
+ * @param pool      (Optional) The thread pool used to run the scan.
+ */
+template<typename T, typename F>
+XS_INLINE void parallelInclusiveScan(const T* const input, T* const output, const uint0 number, F&& operation,
+    ThreadPool& pool = getDefaultThreadPool()) noexcept
+{
+    NoExport::parallelScan<true>(input, output, number, T(), operation, pool);
+}
+
+/**
+ * Calculate the inclusive prefix scan of an array in parallel.
+ * @tparam T      Type of the elements.
+ * @tparam Alloc  Type of the input arrays allocator.
+ * @tparam Alloc2 Type of the output arrays allocator.
+ * @tparam F      Type of the operation, must be associative and callable as operation(T first, T second).
+ * @param input     The input array.
+ * @param output    The output array (may be the same as input), must already contain at least as many elements.
+ * @param operation The operation used to combine elements.
+ * @param pool      (Optional) The thread pool used to run the scan.
+ * @returns False if the output array is too small.
+ */
+template<typename T, class Alloc, class Alloc2, typename F>
+XS_INLINE bool parallelInclusiveScan(const Array<T, Alloc>& input, Array<T, Alloc2>& output, F&& operation,
+    ThreadPool& pool = getDefaultThreadPool()) noexcept
+{
+    if (output.getLength() < input.getLength()) [[unlikely]] {
+        return false;
+    }
+    parallelInclusiveScan(input.getData(), output.getData(), input.getLength(), forward<F>(operation), pool);
+    return true;
+}
+
+/**
+ * Calculate the exclusive prefix scan of a range of elements in parallel.
+ * @note Each output element is the combination of all input elements before itself.
+ * @tparam T Type of the elements.
+ * @tparam F Type of the operation, must be associative and callable as operation(T first, T second).
+ * @param input     The input elements.
+ * @param output    The output elements (may be the same as input).
+ * @param number    The number of elements.
+ * @param identity  The identity value of the operation, used as the first output element.
+ * @param operation The operation used to combine elements.
+ * @param pool      (Optional) The thread pool used to run the scan.
+ */
+template<typename T, typename F>
+XS_INLINE void parallelExclusiveScan(const T* const input, T* const output, const uint0 number, const T& identity,
+    F&& operation, ThreadPool& pool = getDefaultThreadPool()) noexcept
+{
+    NoExport::parallelScan<false>(input, output, number, identity, operation, pool);
+}
+
+/**
+ * Calculate the exclusive prefix scan of an array in parallel.
+ * @tparam T      Type of the elements.
+ * @tparam Alloc  Type of the input arrays allocator.
+ * @tparam Alloc2 Type of the output arrays allocator.
+ * @tparam F      Type of the operation, must be associative and callable as operation(T first, T second).
+ * @param input     The input array.
+ * @param output    The output array (may be the same as input), must already contain at least as many elements.
+ * @param identity  The identity value of the operation, used as the first output element.
+ * @param operation The operation used to combine elements.
+ * @param pool      (Optional) The thread pool used to run the scan.
+ * @returns False if the output array is too small.
+ */
+template<typename T, class Alloc, class Alloc2, typename F>
+XS_INLINE bool parallelExclusiveScan(const Array<T, Alloc>& input, Array<T, Alloc2>& output, const T& identity,
+    F&& operation, ThreadPool& pool = getDefaultThreadPool()) noexcept
+{
+    if (output.getLength() < input.getLength()) [[unlikely]] {
+        return false;
+    }
+    parallelExclusiveScan(
+        input.getData(), output.getData(), input.getLength(), identity, forward<F>(operation), pool);
+    return true;
+}
+} // namespace Shift
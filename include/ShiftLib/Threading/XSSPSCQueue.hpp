@@ -0,0 +1,263 @@
+#pragma once
+/**
+ * Copyright Matthew Oliver
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Memory/XSAllocatorHeap.hpp"
+#include "Memory/XSRingUtility.hpp"
+#include "Threading/XSAtomic.hpp"
+
+namespace Shift {
+/**
+ * Bounded lock-free queue used to pass elements from a single producer thread to a single consumer thread.
+ * @note Only a single thread may call the push functions and only a single (possibly different) thread may call the
+ * pop functions. The producer and consumer positions are kept on separate cache lines and each side keeps a cached
+ * copy of the other sides position so that the shared positions are only re-read when the cached value indicates the
+ * queue is full or empty.
+ * @tparam T     Type of element stored within the queue.
+ * @tparam Alloc Type of allocator used to allocate elements.
+ */
+template<typename T, class Alloc = AllocRegionHeap<T>>
+class SPSCQueue
+{
+public:
+    using Type = T;
+    using Handle = typename Alloc::Handle;
+    using Allocator = Alloc;
+
+    /**< Number of slots provided by a fixed size allocator */
+    static constexpr uint0 fixedCapacity = Handle::isResizable ? 0 : Handle::maxSize / sizeof(Type);
+
+    static_assert((fixedCapacity & (fixedCapacity - 1)) == 0,
+        "SPSCQueue requires a fixed size allocator to have a power of 2 number of elements");
+
+    alignas(cacheLineSize) std::atomic<uint0> head = 0; /**< Position of the next element to pop (consumer owned) */
+    uint0 cachedTail = 0;                               /**< Consumers last read value of tail */
+    alignas(cacheLineSize) std::atomic<uint0> tail = 0; /**< Position of the next element to push (producer owned) */
+    uint0 cachedHead = 0;                               /**< Producers last read value of head */
+    alignas(cacheLineSize) Handle handle;               /**< The handle used to store elements */
+    uint0 capacity = fixedCapacity;                     /**< Number of allocated slots (power of 2) */
+
+    /**
+     * Constructor that reserves space for a number of elements.
+     * @note The reserved space is rounded up to the next power of 2.
+     * @param number The number of elements to reserve space for.
+     */
+    explicit XS_INLINE SPSCQueue(const uint0 number = fixedCapacity) noexcept
+        : handle(Handle::isResizable ? NoExport::ringCapacityFor(number) : fixedCapacity)
+    {
+        if constexpr (Handle::isResizable) {
+            if (handle.pointer != nullptr) [[likely]] {
+                capacity = NoExport::ringCapacityFor(number);
+            }
+        }
+    }
+
+    XS_INLINE SPSCQueue(const SPSCQueue& other) noexcept = delete;
+
+    XS_INLINE SPSCQueue(SPSCQueue&& other) noexcept = delete;
+
+    /** Destructor. */
+    XS_INLINE ~SPSCQueue() noexcept
+    {
+        if constexpr (!isTriviallyDestructible<Type>) {
+            const uint0 end = tail.load(std::memory_order_relaxed);
+            for (uint0 i = head.load(std::memory_order_relaxed); i != end; ++i) {
+                memDestruct<Type>(&handle.pointer[i & (capacity - 1)]);
+            }
+        }
+    }
+
+    XS_INLINE SPSCQueue& operator=(const SPSCQueue& other) noexcept = delete;
+
+    XS_INLINE SPSCQueue& operator=(SPSCQueue&& other) noexcept = delete;
+
+    /**
+     * Checks whether the queue has any allocated memory.
+     * @returns True if valid, false if not.
+     */
+    XS_INLINE bool isValid() const noexcept
+    {
+        return capacity != 0;
+    }
+
+    /**
+     * Check if the queue is empty or not.
+     * @note When called from a thread that is not the producer or consumer the result may be out of date.
+     * @returns Boolean signaling if queue is empty.
+     */
+    XS_INLINE bool isEmpty() const noexcept
+    {
+        return tail.load(std::memory_order_acquire) == head.load(std::memory_order_acquire);
+    }
+
+    /**
+     * Get the number of elements in the queue.
+     * @note When called from a thread that is not the producer or consumer the result may be out of date.
+     * @returns The number of elements currently stored within the queue.
+     */
+    XS_INLINE uint0 getLength() const noexcept
+    {
+        const uint0 first = head.load(std::memory_order_acquire);
+        return tail.load(std::memory_order_acquire) - first;
+    }
+
+    /**
+     * Get the number of elements currently reserved for.
+     * @returns The number of elements that can be stored before the queue is full.
+     */
+    XS_INLINE uint0 getReservedLength() const noexcept
+    {
+        return capacity;
+    }
+
+    /**
+     * Add an element to the end of the queue.
+     * @note Must only be called from the producer thread.
+     * @param element The new element.
+     * @returns False if the queue is full.
+     */
+    XS_INLINE bool tryPush(const Type& element) noexcept
+    {
+        const uint0 position = tail.load(std::memory_order_relaxed);
+        if (!checkSpace(position, 1)) [[unlikely]] {
+            return false;
+        }
+        memConstruct<Type>(&handle.pointer[position & (capacity - 1)], element);
+        tail.store(position + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * Add an element to the end of the queue using direct construction.
+     * @note Must only be called from the producer thread.
+     * @tparam Args Type of the arguments.
+     * @param values The values used to construct the new element.
+     * @returns False if the queue is full.
+     */
+    template<typename... Args>
+    requires(isNothrowConstructible<Type, Args...>)
+    XS_INLINE bool tryPush(Args&&... values) noexcept
+    {
+        const uint0 position = tail.load(std::memory_order_relaxed);
+        if (!checkSpace(position, 1)) [[unlikely]] {
+            return false;
+        }
+        memConstruct<Type>(&handle.pointer[position & (capacity - 1)], forward<Args>(values)...);
+        tail.store(position + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * Add multiple elements to the end of the queue.
+     * @note Must only be called from the producer thread. If there is not enough space for all elements then as many
+     * as possible are added.
+     * @param elements Pointer to list of elements to add.
+     * @param number   The number of elements in the input list.
+     * @returns The number of elements actually added.
+     */
+    XS_INLINE uint0 tryPush(const Type* const XS_RESTRICT elements, uint0 number) noexcept
+    {
+        const uint0 position = tail.load(std::memory_order_relaxed);
+        if (!checkSpace(position, number)) [[unlikely]] {
+            number = capacity - (position - cachedHead);
+            if (number == 0) {
+                return 0;
+            }
+        }
+        const uint0 start = position & (capacity - 1);
+        const uint0 first = min(number, capacity - start);
+        memConstructRange<Type, Type, Handle::maxSize>(&handle.pointer[start], elements, first * sizeof(Type));
+        memConstructRange<Type, Type, Handle::maxSize>(
+            handle.pointer, elements + first, (number - first) * sizeof(Type));
+        tail.store(position + number, std::memory_order_release);
+        return number;
+    }
+
+    /**
+     * Remove the first element from the queue.
+     * @note Must only be called from the consumer thread.
+     * @param [out] element Variable to move the removed element into.
+     * @returns False if the queue was empty.
+     */
+    XS_INLINE bool tryPop(Type& element) noexcept
+    {
+        const uint0 position = head.load(std::memory_order_relaxed);
+        if (!checkAvailable(position, 1)) [[unlikely]] {
+            return false;
+        }
+        NoExport::ringMoveOut(&element, &handle.pointer[position & (capacity - 1)], 1);
+        head.store(position + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * Remove multiple elements from the start of the queue.
+     * @note Must only be called from the consumer thread.
+     * @param [out] elements Pointer to list of elements to move the removed elements into.
+     * @param       number   The maximum number of elements to remove.
+     * @returns The number of elements actually removed.
+     */
+    XS_INLINE uint0 tryPop(Type* const XS_RESTRICT elements, uint0 number) noexcept
+    {
+        const uint0 position = head.load(std::memory_order_relaxed);
+        if (!checkAvailable(position, number)) [[unlikely]] {
+            number = cachedTail - position;
+            if (number == 0) {
+                return 0;
+            }
+        }
+        const uint0 start = position & (capacity - 1);
+        const uint0 first = min(number, capacity - start);
+        NoExport::ringMoveOut(elements, &handle.pointer[start], first);
+        NoExport::ringMoveOut(elements + first, handle.pointer, number - first);
+        head.store(position + number, std::memory_order_release);
+        return number;
+    }
+
+private:
+    /**
+     * Check if there is enough free space to push a number of elements.
+     * @note Only reloads the consumers position if the cached value does not have enough space.
+     * @param position The current tail position.
+     * @param number   The number of elements to check for.
+     * @returns True if there is enough space.
+     */
+    XS_INLINE bool checkSpace(const uint0 position, const uint0 number) noexcept
+    {
+        if (capacity - (position - cachedHead) >= number) [[likely]] {
+            return true;
+        }
+        cachedHead = head.load(std::memory_order_acquire);
+        return capacity - (position - cachedHead) >= number;
+    }
+
+    /**
+     * Check if there are enough elements available to pop.
+     * @note Only reloads the producers position if the cached value does not have enough elements.
+     * @param position The current head position.
+     * @param number   The number of elements to check for.
+     * @returns True if there are enough elements.
+     */
+    XS_INLINE bool checkAvailable(const uint0 position, const uint0 number) noexcept
+    {
+        if (cachedTail - position >= number) [[likely]] {
+            return true;
+        }
+        cachedTail = tail.load(std::memory_order_acquire);
+        return cachedTail - position >= number;
+    }
+};
+} // namespace Shift
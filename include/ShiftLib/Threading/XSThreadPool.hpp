@@ -0,0 +1,506 @@
+#pragma once
+/**
+ * Copyright Matthew Oliver
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Memory/XSAllocatorHeap.hpp"
+#include "Threading/XSAtomic.hpp"
+#include "Threading/XSMPMCQueue.hpp"
+#include "Threading/XSWorkStealingDeque.hpp"
+
+#include <thread>
+
+#if XS_PLATFORM == XS_LINUX
+#    include <pthread.h>
+#    include <sched.h>
+#endif
+
+namespace Shift {
+namespace NoExport {
+/** Base class for a unit of work that has been submitted to a ThreadPool. */
+class ThreadPoolTask
+{
+public:
+    using Function = void (*)(ThreadPoolTask*) noexcept;
+
+    Function execute;                      /**< Function that runs the task and then frees it */
+    std::atomic<uint32>* pending{nullptr}; /**< Outstanding task counter of the owning task group (may be nullptr) */
+
+    /**
+     * Constructor.
+     * @param function The function used to run the task.
+     */
+    explicit XS_INLINE ThreadPoolTask(const Function function) noexcept
+        : execute(function)
+    {}
+};
+
+/**
+ * A task that runs a callable object.
+ * @tparam F Type of the callable object.
+ */
+template<typename F>
+class ThreadPoolTaskFunction : public ThreadPoolTask
+{
+public:
+    using Allocator = AllocRegionHeap<ThreadPoolTaskFunction>;
+
+    F function; /**< The callable object */
+
+    /**
+     * Constructor.
+     * @tparam F2 Type of the callable object.
+     * @param callable The callable object to run.
+     */
+    template<typename F2>
+    explicit XS_INLINE ThreadPoolTaskFunction(F2&& callable) noexcept
+        : ThreadPoolTask(&run)
+        , function(forward<F2>(callable))
+    {}
+
+    /**
+     * Run the callable object and then free the task.
+     * @param task The task to run.
+     */
+    XS_INLINE static void run(ThreadPoolTask* task) noexcept
+    {
+        auto* self = static_cast<ThreadPoolTaskFunction*>(task);
+        self->function();
+        memDestruct<ThreadPoolTaskFunction>(self);
+        Allocator::Unallocate(self);
+    }
+};
+
+/** Per thread data used by each worker within a ThreadPool. */
+class ThreadPoolWorker
+{
+public:
+    WorkStealingDeque<ThreadPoolTask*> deque; /**< Tasks submitted from the worker thread */
+    std::thread thread;                       /**< The worker thread */
+
+    /**
+     * Constructor.
+     * @param number The number of tasks to reserve space for in the workers deque.
+     */
+    explicit XS_INLINE ThreadPoolWorker(const uint0 number) noexcept
+        : deque(number)
+    {}
+};
+} // namespace NoExport
+
+/**
+ * Work stealing thread pool used to run tasks across multiple cores.
+ * @note Each worker thread owns a Chase-Lev deque that tasks submitted from that thread are pushed onto, which keeps
+ * related work on the same core. Tasks submitted from outside the pool are placed in a shared injection queue. Idle
+ * workers first check their own deque, then the injection queue and then steal from the other workers. If all
+ * queues are full then the task is run directly on the submitting thread. Workers that cannot find any work spin
+ * briefly and then sleep until new work is submitted.
+ */
+class ThreadPool
+{
+public:
+    using Task = NoExport::ThreadPoolTask;
+    using Worker = NoExport::ThreadPoolWorker;
+    using Handle = AllocRegionHeap<Worker, cacheLineSize>::Handle;
+
+    /**< Number of times an idle thread polls for work before yielding */
+    static constexpr uint32 spinCount = 64;
+    /**< Number of times an idle thread yields before going to sleep */
+    static constexpr uint32 yieldCount = 16;
+
+    /**< The pool that the current thread is a worker of (nullptr if not a worker) */
+    static inline thread_local ThreadPool* currentPool = nullptr;
+    /**< The worker index of the current thread within currentPool */
+    static inline thread_local uint32 currentWorker = 0;
+    /**< Rotating start position used when stealing to spread thieves across workers */
+    static inline thread_local uint32 stealPosition = 0;
+
+    Handle workers;                                           /**< The handle used to store the worker data */
+    uint32 threadCount = 0;                                   /**< Number of worker threads */
+    MPMCQueue<Task*> injection;                               /**< Tasks submitted from outside the pool */
+    alignas(cacheLineSize) std::atomic<uint32> epoch = 0;     /**< Incremented to wake sleeping threads */
+    std::atomic<uint32> sleepers = 0;                         /**< Number of threads currently sleeping */
+    alignas(cacheLineSize) std::atomic<bool> stopping{false}; /**< Set when the worker threads should exit */
+
+    /**
+     * Constructor that starts the worker threads.
+     * @param threads     The number of worker threads to create (0 to use one per hardware thread).
+     * @param pin         True to pin each worker thread to its own core.
+     * @param queueLength The number of tasks to reserve space for in each of the queues.
+     */
+    explicit XS_INLINE ThreadPool(const uint32 threads = 0, const bool pin = false,
+        const uint0 queueLength = 1024) noexcept
+        : workers(threadsFor(threads))
+        , injection(queueLength)
+    {
+        if (workers.pointer == nullptr || !injection.isValid()) [[unlikely]] {
+            return;
+        }
+        const uint32 number = threadsFor(threads);
+        bool valid = true;
+        for (uint32 i = 0; i < number; ++i) {
+            memConstruct<Worker>(&workers.pointer[i], queueLength);
+            valid = valid && workers.pointer[i].deque.isValid();
+        }
+        if (!valid) [[unlikely]] {
+            memDestructRange<Worker>(workers.pointer, number * sizeof(Worker));
+            return;
+        }
+        threadCount = number;
+        for (uint32 i = 0; i < threadCount; ++i) {
+            workers.pointer[i].thread = std::thread(&ThreadPool::run, this, i, pin);
+        }
+    }
+
+    XS_INLINE ThreadPool(const ThreadPool& other) noexcept = delete;
+
+    XS_INLINE ThreadPool(ThreadPool&& other) noexcept = delete;
+
+    /**
+     * Destructor.
+     * @note Any tasks that are still queued are run before the worker threads exit.
+     */
+    XS_INLINE ~ThreadPool() noexcept
+    {
+        if (threadCount == 0) {
+            return;
+        }
+        stopping.store(true, std::memory_order_release);
+        epoch.fetch_add(1, std::memory_order_release);
+        epoch.notify_all();
+        for (uint32 i = 0; i < threadCount; ++i) {
+            workers.pointer[i].thread.join();
+        }
+        memDestructRange<Worker>(workers.pointer, threadCount * sizeof(Worker));
+    }
+
+    XS_INLINE ThreadPool& operator=(const ThreadPool& other) noexcept = delete;
+
+    XS_INLINE ThreadPool& operator=(ThreadPool&& other) noexcept = delete;
+
+    /**
+     * Checks whether the pool was successfully created.
+     * @returns True if valid, false if not.
+     */
+    XS_INLINE bool isValid() const noexcept
+    {
+        return threadCount != 0;
+    }
+
+    /**
+     * Get the number of worker threads.
+     * @returns The number of threads.
+     */
+    XS_INLINE uint32 getThreadCount() const noexcept
+    {
+        return threadCount;
+    }
+
+    /**
+     * Submit a task to be run by the pool.
+     * @note If the task cannot be queued then it is run directly on the calling thread.
+     * @tparam F Type of the callable object.
+     * @param function The callable object to run.
+     * @param pending  (Optional) Outstanding task counter to increment and then decrement once the task completes.
+     */
+    template<typename F>
+    XS_INLINE void submit(F&& function, std::atomic<uint32>* pending = nullptr) noexcept
+    {
+        using TaskFunction = NoExport::ThreadPoolTaskFunction<decay<F>>;
+        TaskFunction* task = TaskFunction::Allocator::Allocate(sizeof(TaskFunction));
+        if (task == nullptr) [[unlikely]] {
+            function();
+            return;
+        }
+        memConstruct<TaskFunction>(task, forward<F>(function));
+        if (pending != nullptr) {
+            pending->fetch_add(1, std::memory_order_relaxed);
+            task->pending = pending;
+        }
+        if (isValid()) [[likely]] {
+            if (currentPool == this && workers.pointer[currentWorker].deque.tryPush(task)) [[likely]] {
+                wake();
+                return;
+            }
+            if (injection.tryPush(task)) [[likely]] {
+                wake();
+                return;
+            }
+        }
+        // Queues are full so run the task on the calling thread
+        execute(task);
+    }
+
+    /**
+     * Wait for an outstanding task counter to reach zero.
+     * @note The calling thread helps run queued tasks while it waits.
+     * @param pending The outstanding task counter.
+     */
+    XS_INLINE void wait(const std::atomic<uint32>& pending) noexcept
+    {
+        uint32 spins = 0;
+        while (pending.load(std::memory_order_acquire) != 0) {
+            Task* task;
+            if (findTask(task)) {
+                execute(task);
+                spins = 0;
+                continue;
+            }
+            idle(spins, [&pending]() { return pending.load(std::memory_order_acquire) == 0; });
+        }
+    }
+
+    /**
+     * Get the number of worker threads to create.
+     * @param threads The number of requested threads (0 to use one per hardware thread).
+     * @returns The number of threads.
+     */
+    XS_INLINE static uint32 threadsFor(const uint32 threads) noexcept
+    {
+        if (threads != 0) {
+            return threads;
+        }
+        return max(std::thread::hardware_concurrency(), 1U);
+    }
+
+    /**
+     * Pin the calling thread to a specific core.
+     * @param core The index of the core, wraps around if greater than the number of hardware threads.
+     * @returns True if succeeded, false if not supported or failed.
+     */
+    XS_INLINE static bool pinThread(uint32 core) noexcept
+    {
+        core %= threadsFor(0);
+#if XS_PLATFORM == XS_WINDOWS
+        constexpr uint32 maskBits = sizeof(DWORD_PTR) * 8;
+        return SetThreadAffinityMask(GetCurrentThread(), static_cast<DWORD_PTR>(1) << (core % maskBits)) != 0;
+#elif XS_PLATFORM == XS_LINUX
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(core % CPU_SETSIZE, &set);
+        return pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &set) == 0;
+#else
+        return false;
+#endif
+    }
+
+private:
+    /**
+     * Main loop of each worker thread.
+     * @param index The index of the worker.
+     * @param pin   True to pin the worker to a core.
+     */
+    XS_INLINE void run(const uint32 index, const bool pin) noexcept
+    {
+        if (pin) {
+            pinThread(index);
+        }
+        currentPool = this;
+        currentWorker = index;
+        stealPosition = index + 1;
+        uint32 spins = 0;
+        while (true) {
+            // Must check for exit before looking for work so that tasks queued before stopping are not lost
+            const bool exit = stopping.load(std::memory_order_acquire);
+            Task* task;
+            if (findTask(task)) {
+                execute(task);
+                spins = 0;
+                continue;
+            }
+            if (exit) {
+                break;
+            }
+            idle(spins, [this]() { return stopping.load(std::memory_order_acquire); });
+        }
+        currentPool = nullptr;
+    }
+
+    /**
+     * Find a queued task to run.
+     * @param [out] task The found task.
+     * @returns True if a task was found.
+     */
+    XS_INLINE bool findTask(Task*& task) noexcept
+    {
+        if (!isValid()) [[unlikely]] {
+            return false;
+        }
+        const bool isWorker = currentPool == this;
+        if (isWorker && workers.pointer[currentWorker].deque.tryPop(task)) {
+            return true;
+        }
+        if (injection.tryPop(task)) {
+            return true;
+        }
+        const uint32 start = stealPosition++;
+        for (uint32 i = 0; i < threadCount; ++i) {
+            const uint32 victim = (start + i) % threadCount;
+            if (isWorker && victim == currentWorker) {
+                continue;
+            }
+            if (workers.pointer[victim].deque.trySteal(task)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * Run a task and update its task groups outstanding counter.
+     * @param task The task to run.
+     */
+    XS_INLINE void execute(Task* task) noexcept
+    {
+        std::atomic<uint32>* pending = task->pending;
+        task->execute(task);
+        if (pending != nullptr && pending->fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            wake();
+        }
+    }
+
+    /**
+     * Check if there are any queued tasks.
+     * @returns True if a task is queued.
+     */
+    XS_INLINE bool hasWork() const noexcept
+    {
+        if (injection.getLength() != 0) {
+            return true;
+        }
+        for (uint32 i = 0; i < threadCount; ++i) {
+            if (!workers.pointer[i].deque.isEmpty()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * Back off after failing to find any work.
+     * @note Spins and then yields for a number of calls before putting the thread to sleep until new work is
+     * submitted or the finished condition is signalled.
+     * @tparam F Type of the finished condition.
+     * @param [in,out] spins    The number of times in a row that no work has been found.
+     * @param          finished Callable that returns true if the thread should stop waiting.
+     */
+    template<typename F>
+    XS_INLINE void idle(uint32& spins, F&& finished) noexcept
+    {
+        if (spins < spinCount) {
+            ++spins;
+            cpuPause();
+            return;
+        }
+        if (spins < spinCount + yieldCount) {
+            ++spins;
+            std::this_thread::yield();
+            return;
+        }
+        // Register as a sleeper before the final check so that any wake after the check is not missed
+        const uint32 current = epoch.load(std::memory_order_acquire);
+        sleepers.fetch_add(1, std::memory_order_seq_cst);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (!finished() && !hasWork()) {
+            epoch.wait(current, std::memory_order_acquire);
+        }
+        sleepers.fetch_sub(1, std::memory_order_relaxed);
+        spins = 0;
+    }
+
+    /** Wake any sleeping threads after work has been submitted or a task group has completed. */
+    XS_INLINE void wake() noexcept
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (sleepers.load(std::memory_order_relaxed) != 0) {
+            epoch.fetch_add(1, std::memory_order_release);
+            epoch.notify_all();
+        }
+    }
+};
+
+/**
+ * Get the shared thread pool.
+ * @note The pool is created on first use with one worker per hardware thread.
+ * @returns The thread pool.
+ */
+XS_INLINE ThreadPool& getDefaultThreadPool() noexcept
+{
+    static ThreadPool pool;
+    return pool;
+}
+
+/**
+ * A group of tasks that can be waited on for completion.
+ * @note The destructor waits for any outstanding tasks.
+ */
+class TaskGroup
+{
+public:
+    ThreadPool& pool;                                       /**< The thread pool used to run tasks */
+    alignas(cacheLineSize) std::atomic<uint32> pending = 0; /**< Number of outstanding tasks */
+
+    /**
+     * Constructor.
+     * @param threadPool (Optional) The thread pool used to run tasks.
+     */
+    explicit XS_INLINE TaskGroup(ThreadPool& threadPool = getDefaultThreadPool()) noexcept
+        : pool(threadPool)
+    {}
+
+    XS_INLINE TaskGroup(const TaskGroup& other) noexcept = delete;
+
+    XS_INLINE TaskGroup(TaskGroup&& other) noexcept = delete;
+
+    /** Destructor. */
+    XS_INLINE ~TaskGroup() noexcept
+    {
+        wait();
+    }
+
+    XS_INLINE TaskGroup& operator=(const TaskGroup& other) noexcept = delete;
+
+    XS_INLINE TaskGroup& operator=(TaskGroup&& other) noexcept = delete;
+
+    /**
+     * Submit a task to be run as part of the group.
+     * @tparam F Type of the callable object.
+     * @param function The callable object to run.
+     */
+    template<typename F>
+    XS_INLINE void run(F&& function) noexcept
+    {
+        pool.submit(forward<F>(function), &pending);
+    }
+
+    /**
+     * Wait for all tasks in the group to complete.
+     * @note The calling thread helps run queued tasks while it waits.
+     */
+    XS_INLINE void wait() noexcept
+    {
+        pool.wait(pending);
+    }
+
+    /**
+     * Check if all tasks in the group have completed.
+     * @returns True if there are no outstanding tasks.
+     */
+    XS_INLINE bool isDone() const noexcept
+    {
+        return pending.load(std::memory_order_acquire) == 0;
+    }
+};
+} // namespace Shift
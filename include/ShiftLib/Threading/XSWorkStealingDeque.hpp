@@ -0,0 +1,182 @@
+#pragma once
+/**
+ * Copyright Matthew Oliver
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Memory/XSAllocatorHeap.hpp"
+#include "Memory/XSRingUtility.hpp"
+#include "Threading/XSAtomic.hpp"
+
+namespace Shift {
+/**
+ * Bounded lock-free Chase-Lev work stealing deque.
+ * @note A single owner thread pushes and pops elements at the bottom of the deque in LIFO order while any number of
+ * other threads may steal elements from the top in FIFO order. The owner only needs to synchronise with thieves when
+ * the deque contains a single element. Elements must be trivially copyable as they are stored in atomic slots, this
+ * is typically used to store pointers to tasks.
+ * @tparam T     Type of element stored within the deque.
+ * @tparam Alloc Type of allocator used to allocate elements.
+ */
+template<typename T, class Alloc = AllocRegionHeap<T>>
+class WorkStealingDeque
+{
+public:
+    using Type = T;
+    using Slot = std::atomic<Type>;
+    using Allocator = typename Alloc::template Allocator<Slot>;
+    using Handle = typename Allocator::Handle;
+
+    static_assert(isTriviallyCopyable<Type>, "WorkStealingDeque requires a trivially copyable type");
+
+    alignas(cacheLineSize) std::atomic<int0> top = 0;    /**< Position of the next element to steal */
+    alignas(cacheLineSize) std::atomic<int0> bottom = 0; /**< Position of the next element to push (owner owned) */
+    alignas(cacheLineSize) Handle handle;                /**< The handle used to store the slots */
+    int0 capacity = 0;                                   /**< Number of allocated slots (power of 2) */
+
+    /**
+     * Constructor that reserves space for a number of elements.
+     * @note The reserved space is rounded up to the next power of 2.
+     * @param number The number of elements to reserve space for.
+     */
+    explicit XS_INLINE WorkStealingDeque(const uint0 number) noexcept
+        : handle(NoExport::ringCapacityFor(number))
+    {
+        if (handle.pointer != nullptr) [[likely]] {
+            capacity = static_cast<int0>(NoExport::ringCapacityFor(number));
+            for (int0 i = 0; i < capacity; ++i) {
+                memConstruct<Slot>(&handle.pointer[i], Type());
+            }
+        }
+    }
+
+    XS_INLINE WorkStealingDeque(const WorkStealingDeque& other) noexcept = delete;
+
+    XS_INLINE WorkStealingDeque(WorkStealingDeque&& other) noexcept = delete;
+
+    /** Destructor. */
+    XS_INLINE ~WorkStealingDeque() noexcept = default;
+
+    XS_INLINE WorkStealingDeque& operator=(const WorkStealingDeque& other) noexcept = delete;
+
+    XS_INLINE WorkStealingDeque& operator=(WorkStealingDeque&& other) noexcept = delete;
+
+    /**
+     * Checks whether the deque has any allocated memory.
+     * @returns True if valid, false if not.
+     */
+    XS_INLINE bool isValid() const noexcept
+    {
+        return capacity != 0;
+    }
+
+    /**
+     * Check if the deque is empty or not.
+     * @note As other threads may be modifying the deque the result may already be out of date.
+     * @returns Boolean signaling if deque is empty.
+     */
+    XS_INLINE bool isEmpty() const noexcept
+    {
+        return getLength() == 0;
+    }
+
+    /**
+     * Get the approximate number of elements in the deque.
+     * @note As other threads may be modifying the deque the result may already be out of date.
+     * @returns The number of elements currently stored within the deque.
+     */
+    XS_INLINE uint0 getLength() const noexcept
+    {
+        const int0 first = top.load(std::memory_order_acquire);
+        const int0 last = bottom.load(std::memory_order_acquire);
+        return last > first ? static_cast<uint0>(last - first) : 0;
+    }
+
+    /**
+     * Get the number of elements currently reserved for.
+     * @returns The number of elements that can be stored before the deque is full.
+     */
+    XS_INLINE uint0 getReservedLength() const noexcept
+    {
+        return static_cast<uint0>(capacity);
+    }
+
+    /**
+     * Add an element to the bottom of the deque.
+     * @note Must only be called from the owner thread.
+     * @param element The new element.
+     * @returns False if the deque is full.
+     */
+    XS_INLINE bool tryPush(const Type element) noexcept
+    {
+        XS_ASSERT(isValid());
+        const int0 position = bottom.load(std::memory_order_relaxed);
+        const int0 first = top.load(std::memory_order_acquire);
+        if (position - first >= capacity) [[unlikely]] {
+            return false;
+        }
+        handle.pointer[position & (capacity - 1)].store(element, std::memory_order_relaxed);
+        bottom.store(position + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * Remove the most recently pushed element from the bottom of the deque.
+     * @note Must only be called from the owner thread.
+     * @param [out] element Variable to store the removed element into.
+     * @returns False if the deque was empty.
+     */
+    XS_INLINE bool tryPop(Type& element) noexcept
+    {
+        XS_ASSERT(isValid());
+        const int0 position = bottom.load(std::memory_order_relaxed) - 1;
+        bottom.store(position, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int0 first = top.load(std::memory_order_relaxed);
+        if (first > position) [[unlikely]] {
+            // Deque was already empty
+            bottom.store(position + 1, std::memory_order_release);
+            return false;
+        }
+        element = handle.pointer[position & (capacity - 1)].load(std::memory_order_relaxed);
+        if (first != position) [[likely]] {
+            return true;
+        }
+        // Last element so must race any thieves for it
+        const bool won =
+            top.compare_exchange_strong(first, first + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+        bottom.store(position + 1, std::memory_order_release);
+        return won;
+    }
+
+    /**
+     * Remove the oldest element from the top of the deque.
+     * @note May be called from any thread. May spuriously fail if another thread removed an element at the same time.
+     * @param [out] element Variable to store the removed element into.
+     * @returns False if the deque was empty or the element was taken by another thread.
+     */
+    XS_INLINE bool trySteal(Type& element) noexcept
+    {
+        XS_ASSERT(isValid());
+        int0 first = top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const int0 last = bottom.load(std::memory_order_acquire);
+        if (first >= last) {
+            return false;
+        }
+        element = handle.pointer[first & (capacity - 1)].load(std::memory_order_relaxed);
+        return top.compare_exchange_strong(first, first + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+    }
+};
+} // namespace Shift
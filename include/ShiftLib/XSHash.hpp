@@ -0,0 +1,583 @@
+#pragma once
+/**
+ * Copyright Matthew Oliver
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Memory/XSStringView.hpp"
+#include "XSArchitecture.hpp"
+#include "XSBit.hpp"
+#include "XSMath.hpp"
+#include "XSTraits.hpp"
+#include "XSUInt128.hpp"
+
+#include <cstring>
+
+namespace Shift {
+template<typename CharType, class Alloc>
+class String;
+template<typename T, SIMDWidth Width>
+class SIMD2;
+template<typename T, SIMDWidth Width>
+class SIMD3;
+template<typename T, SIMDWidth Width>
+class SIMD4;
+template<typename T, SIMDWidth Width>
+class SIMD6;
+template<typename T, SIMDWidth Width>
+class SIMD8;
+template<typename T, SIMDWidth Width>
+class SIMD12;
+template<typename T, SIMDWidth Width>
+class SIMD16;
+template<typename T, SIMDWidth Width>
+class SIMD3x2;
+template<typename T, SIMDWidth Width>
+class SIMD3x3;
+template<typename T, SIMDWidth Width>
+class SIMD3x4;
+template<typename T, SIMDWidth Width>
+class Point3D;
+template<typename T, SIMDWidth Width>
+class Vector3D;
+
+namespace NoExport {
+/**< Secret values used to key the hash functions */
+inline constexpr uint64 hashSecret[24] = {// NOLINT(modernize-avoid-c-arrays)
+    0x2CB0F69F4ABEA221_ui64, 0x9417034723148989_ui64, 0xDD555950609DFE03_ui64, 0xDBAFB150DEB12800_ui64,
+    0x7E789B2E6C442CB6_ui64, 0xF41E5636C7E4F8C4_ui64, 0x0959D150F8FBA7E4_ui64, 0xA97316F13CDB9EEA_ui64,
+    0x74CD8258F9520068_ui64, 0x55C74A62E116868B_ui64, 0xD2F4C799A2023CBD_ui64, 0xDF98CB79A37B51B9_ui64,
+    0x396F5885524F3905_ui64, 0xAF1D56386CA3B276_ui64, 0xA9FFBE6B5104E85A_ui64, 0x6BD0C51B9FD533B3_ui64,
+    0x980CE91C50AB4B56_ui64, 0x28AC395780FE62C5_ui64, 0x768912E3A6BCEDC7_ui64, 0x50B3E8C9332C7C88_ui64,
+    0xCE3BBFE520BD47DA_ui64, 0xCBA6C8E8E0BB7C4F_ui64, 0xBF194DB8434A346D_ui64, 0x7D8F2A7B60416D7F_ui64};
+
+/**< Number of bytes processed by each block of the bulk hash */
+inline constexpr uint0 hashBlockSize = 1024;
+/**< Number of bytes processed by each stripe of the bulk hash */
+inline constexpr uint0 hashStripeSize = 64;
+
+/**
+ * Read an unaligned 64bit value.
+ * @param pointer The memory to read from.
+ * @returns The value.
+ */
+XS_INLINE uint64 hashRead64(const uint8* const XS_RESTRICT pointer) noexcept
+{
+    uint64 ret;
+    memcpy(&ret, pointer, sizeof(uint64));
+    return ret;
+}
+
+/**
+ * Read an unaligned 32bit value.
+ * @param pointer The memory to read from.
+ * @returns The value.
+ */
+XS_INLINE uint64 hashRead32(const uint8* const XS_RESTRICT pointer) noexcept
+{
+    uint32 ret;
+    memcpy(&ret, pointer, sizeof(uint32));
+    return ret;
+}
+
+/**
+ * Multiply two 64bit values and fold the 128bit result back into the 2 inputs.
+ * @param [in,out] param1 The first value, returns the low half of the product.
+ * @param [in,out] param2 The second value, returns the high half of the product.
+ */
+XS_INLINE void hashMum(uint64& param1, uint64& param2) noexcept
+{
+    const UInt128 full = mul<uint64>(param1, param2);
+    param1 = full.low;
+    param2 = full.high;
+}
+} // namespace NoExport
+
+/**
+ * Mix two 64bit values into a single 64bit value.
+ * @note Uses a full 64x64->128bit multiply so that all input bits affect all output bits.
+ * @param param1 The first value.
+ * @param param2 The second value.
+ * @returns The mixed value.
+ */
+XS_INLINE uint64 hashMix(uint64 param1, uint64 param2) noexcept
+{
+    NoExport::hashMum(param1, param2);
+    return param1 ^ param2;
+}
+
+/**
+ * Combine an existing hash with another.
+ * @param seed The existing hash.
+ * @param hash The hash to combine with.
+ * @returns The combined hash value.
+ */
+XS_INLINE uint64 hashCombine(const uint64 seed, const uint64 hash) noexcept
+{
+    return hashMix(seed ^ NoExport::hashSecret[0], hash ^ NoExport::hashSecret[1]);
+}
+
+/**
+ * Hash a 64bit integer value.
+ * @param value The value to hash.
+ * @param seed  (Optional) The seed value.
+ * @returns The 64bit hash value.
+ */
+XS_INLINE uint64 hashInteger(const uint64 value, const uint64 seed = 0) noexcept
+{
+    return hashMix(value ^ seed ^ NoExport::hashSecret[0], NoExport::hashSecret[1]);
+}
+
+namespace NoExport {
+/**
+ * Hash a buffer of less than a block in size.
+ * @param data The data to hash.
+ * @param size The size of the data (in Bytes).
+ * @param seed The seed value.
+ * @returns The 64bit hash value.
+ */
+XS_INLINE uint64 hashSmall(const uint8* XS_RESTRICT data, const uint0 size, uint64 seed) noexcept
+{
+    seed ^= hashMix(seed ^ hashSecret[0], hashSecret[1]);
+    uint64 a;
+    uint64 b;
+    if (size <= 16) [[likely]] {
+        if (size >= 4) [[likely]] {
+            const uint0 offset = (size >> 3) << 2;
+            a = (hashRead32(data) << 32) | hashRead32(data + offset);
+            b = (hashRead32(data + size - 4) << 32) | hashRead32(data + size - 4 - offset);
+        } else if (size > 0) {
+            a = (static_cast<uint64>(data[0]) << 16) | (static_cast<uint64>(data[size >> 1]) << 8) | data[size - 1];
+            b = 0;
+        } else {
+            a = b = 0;
+        }
+    } else {
+        uint0 remaining = size;
+        if (remaining > 48) [[unlikely]] {
+            // Use 3 independent lanes to hide multiply latency
+            uint64 seed1 = seed;
+            uint64 seed2 = seed;
+            do {
+                seed = hashMix(hashRead64(data) ^ hashSecret[1], hashRead64(data + 8) ^ seed);
+                seed1 = hashMix(hashRead64(data + 16) ^ hashSecret[2], hashRead64(data + 24) ^ seed1);
+                seed2 = hashMix(hashRead64(data + 32) ^ hashSecret[3], hashRead64(data + 40) ^ seed2);
+                data += 48;
+                remaining -= 48;
+            } while (remaining > 48);
+            seed ^= seed1 ^ seed2;
+        }
+        while (remaining > 16) {
+            seed = hashMix(hashRead64(data) ^ hashSecret[1], hashRead64(data + 8) ^ seed);
+            data += 16;
+            remaining -= 16;
+        }
+        a = hashRead64(data + remaining - 16);
+        b = hashRead64(data + remaining - 8);
+    }
+    a ^= hashSecret[1];
+    b ^= seed;
+    hashMum(a, b);
+    return hashMix(a ^ hashSecret[0] ^ static_cast<uint64>(size), b ^ hashSecret[1]);
+}
+
+/**
+ * Hash a buffer using striped accumulators.
+ * @param data The data to hash.
+ * @param size The size of the data (in Bytes).
+ * @param seed The seed value.
+ * @returns The 64bit hash value.
+ */
+XS_INLINE uint64 hashBulk(const uint8* XS_RESTRICT data, uint0 size, uint64 seed) noexcept
+{
+    constexpr uint0 stripes = hashBlockSize / hashStripeSize;
+    constexpr uint64 prime = 0x9E3779B1_ui64;
+    const uint0 length = size;
+    alignas(32) uint64 accumulators[8]; // NOLINT(modernize-avoid-c-arrays)
+    for (uint0 i = 0; i < 8; ++i) {
+        accumulators[i] = seed ^ hashSecret[i + 16];
+    }
+#if XS_ISA == XS_X86
+    if constexpr (hasISAFeature<ISAFeature::AVX2>) {
+        __m256i acc0 = _mm256_load_si256(reinterpret_cast<const __m256i*>(&accumulators[0]));
+        __m256i acc1 = _mm256_load_si256(reinterpret_cast<const __m256i*>(&accumulators[4]));
+        const __m256i primeV = _mm256_set1_epi64x(static_cast<int64>(prime));
+        for (; size >= hashBlockSize; size -= hashBlockSize) {
+            for (uint0 stripe = 0; stripe < stripes; ++stripe) {
+                const auto* secret = reinterpret_cast<const __m256i*>(&hashSecret[stripe]);
+                const __m256i data0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+                const __m256i data1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + 32));
+                const __m256i key0 = _mm256_xor_si256(data0, _mm256_loadu_si256(secret));
+                const __m256i key1 = _mm256_xor_si256(data1, _mm256_loadu_si256(secret + 1));
+                // Multiply low and high 32bits of each keyed value
+                acc0 = _mm256_add_epi64(acc0, _mm256_mul_epu32(key0, _mm256_srli_epi64(key0, 32)));
+                acc1 = _mm256_add_epi64(acc1, _mm256_mul_epu32(key1, _mm256_srli_epi64(key1, 32)));
+                // Add raw data to neighbouring accumulator
+                acc0 = _mm256_add_epi64(acc0, _mm256_shuffle_epi32(data0, _MM_SHUFFLE(1, 0, 3, 2)));
+                acc1 = _mm256_add_epi64(acc1, _mm256_shuffle_epi32(data1, _MM_SHUFFLE(1, 0, 3, 2)));
+                data += hashStripeSize;
+            }
+            // Scramble accumulators
+            const auto* secret = reinterpret_cast<const __m256i*>(&hashSecret[16]);
+            acc0 = _mm256_xor_si256(_mm256_xor_si256(acc0, _mm256_srli_epi64(acc0, 47)), _mm256_loadu_si256(secret));
+            acc1 =
+                _mm256_xor_si256(_mm256_xor_si256(acc1, _mm256_srli_epi64(acc1, 47)), _mm256_loadu_si256(secret + 1));
+            acc0 = _mm256_add_epi64(_mm256_mul_epu32(acc0, primeV),
+                _mm256_slli_epi64(_mm256_mul_epu32(_mm256_srli_epi64(acc0, 32), primeV), 32));
+            acc1 = _mm256_add_epi64(_mm256_mul_epu32(acc1, primeV),
+                _mm256_slli_epi64(_mm256_mul_epu32(_mm256_srli_epi64(acc1, 32), primeV), 32));
+        }
+        _mm256_store_si256(reinterpret_cast<__m256i*>(&accumulators[0]), acc0);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(&accumulators[4]), acc1);
+    } else
+#endif
+    {
+        for (; size >= hashBlockSize; size -= hashBlockSize) {
+            for (uint0 stripe = 0; stripe < stripes; ++stripe) {
+                for (uint0 i = 0; i < 8; ++i) {
+                    const uint64 value = hashRead64(data + i * sizeof(uint64));
+                    const uint64 key = value ^ hashSecret[stripe + i];
+                    accumulators[i ^ 1] += value;
+                    accumulators[i] += (key & 0xFFFFFFFF_ui64) * (key >> 32);
+                }
+                data += hashStripeSize;
+            }
+            for (uint0 i = 0; i < 8; ++i) {
+                uint64 value = accumulators[i];
+                value ^= value >> 47;
+                value ^= hashSecret[16 + i];
+                accumulators[i] = value * prime;
+            }
+        }
+    }
+    // Merge accumulators and then hash any remaining tail
+    uint64 ret = static_cast<uint64>(length) * hashSecret[15];
+    for (uint0 i = 0; i < 8; i += 2) {
+        ret += hashMix(accumulators[i] ^ hashSecret[i], accumulators[i + 1] ^ hashSecret[i + 1]);
+    }
+    return hashSmall(data, size, ret);
+}
+} // namespace NoExport
+
+/**
+ * Hash an arbitrary buffer.
+ * @note Buffers larger than a single block use a striped accumulator that is vectorised with AVX2 where available.
+ * The returned value is the same regardless of the instruction set used.
+ * @param data The data to hash.
+ * @param size The size of the data (in Bytes).
+ * @param seed (Optional) The seed value.
+ * @returns The 64bit hash value.
+ */
+XS_INLINE uint64 hash64(const void* const XS_RESTRICT data, const uint0 size, const uint64 seed = 0) noexcept
+{
+    const auto* bytes = static_cast<const uint8*>(data);
+    if (size < NoExport::hashBlockSize) [[likely]] {
+        return NoExport::hashSmall(bytes, size, seed);
+    }
+    return NoExport::hashBulk(bytes, size, seed);
+}
+
+/**
+ * Calculate the CRC32C (Castagnoli) checksum of a buffer.
+ * @note Uses the SSE4.2 crc32 instruction where available.
+ * @param data The data to checksum.
+ * @param size The size of the data (in Bytes).
+ * @param crc  (Optional) A previous checksum to continue from.
+ * @returns The checksum.
+ */
+XS_INLINE uint32 crc32c(const void* const XS_RESTRICT data, uint0 size, uint32 crc = 0) noexcept
+{
+    const auto* bytes = static_cast<const uint8*>(data);
+    crc = ~crc;
+#if XS_ISA == XS_X86
+    if constexpr (hasISAFeature<ISAFeature::SSE42>) {
+        if constexpr (currentArch == Architecture::Bit64) {
+            uint64 crc64 = crc;
+            for (; size >= sizeof(uint64); size -= sizeof(uint64)) {
+                crc64 = _mm_crc32_u64(crc64, NoExport::hashRead64(bytes));
+                bytes += sizeof(uint64);
+            }
+            crc = static_cast<uint32>(crc64);
+        } else {
+            for (; size >= sizeof(uint32); size -= sizeof(uint32)) {
+                crc = _mm_crc32_u32(crc, static_cast<uint32>(NoExport::hashRead32(bytes)));
+                bytes += sizeof(uint32);
+            }
+        }
+        for (; size > 0; --size) {
+            crc = _mm_crc32_u8(crc, *bytes);
+            ++bytes;
+        }
+        return ~crc;
+    } else
+#endif
+    {
+        constexpr auto table = []() {
+            struct Table
+            {
+                uint32 values[256]; // NOLINT(modernize-avoid-c-arrays)
+            } ret{};
+            for (uint32 i = 0; i < 256; ++i) {
+                uint32 value = i;
+                for (uint32 j = 0; j < 8; ++j) {
+                    value = (value >> 1) ^ ((value & 1) ? 0x82F63B78_ui32 : 0_ui32);
+                }
+                ret.values[i] = value;
+            }
+            return ret;
+        }();
+        for (; size > 0; --size) {
+            crc = table.values[(crc ^ *bytes) & 0xFF] ^ (crc >> 8);
+            ++bytes;
+        }
+        return ~crc;
+    }
+}
+
+/**
+ * Hash functor.
+ * @note Specialisations are provided for integer, floating point, pointer, string and SIMD/geometry types.
+ * @tparam T Type of value being hashed.
+ */
+template<typename T>
+class Hash;
+
+/**
+ * Hash functor for integer and pointer types.
+ * @tparam T Type of value being hashed.
+ */
+template<typename T>
+requires(isInteger<T> || isPointer<T>)
+class Hash<T>
+{
+public:
+    /**
+     * Hash a value.
+     * @param value The value to hash.
+     * @returns The 64bit hash value.
+     */
+    XS_INLINE uint64 operator()(const T value) const noexcept
+    {
+        if constexpr (isPointer<T>) {
+            return hashInteger(static_cast<uint64>(reinterpret_cast<uint0>(value)));
+        } else if constexpr (sizeof(T) <= sizeof(uint64)) {
+            return hashInteger(static_cast<uint64>(value));
+        } else {
+            return hash64(&value, sizeof(T));
+        }
+    }
+};
+
+/**
+ * Hash functor for floating point types.
+ * @note Positive and negative zero hash to the same value as they compare equal.
+ * @tparam T Type of value being hashed.
+ */
+template<typename T>
+requires(isFloat<T>)
+class Hash<T>
+{
+public:
+    /**
+     * Hash a value.
+     * @param value The value to hash.
+     * @returns The 64bit hash value.
+     */
+    XS_INLINE uint64 operator()(const T value) const noexcept
+    {
+        const T check = (value == T{0}) ? T{0} : value;
+        if constexpr (sizeof(T) == sizeof(uint32)) {
+            return hashInteger(bitCast<uint32>(check));
+        } else {
+            return hashInteger(bitCast<uint64>(static_cast<float64>(check)));
+        }
+    }
+};
+
+/**
+ * Hash functor for strings.
+ * @note Also accepts string views and null terminated character sequences so that they can be used to lookup string
+ * keys without first creating a string.
+ * @tparam CharType Type of the character.
+ * @tparam Alloc    Type of allocator used by the string.
+ */
+template<typename CharType, class Alloc>
+class Hash<String<CharType, Alloc>>
+{
+public:
+    /**
+     * Hash a value.
+     * @param value The value to hash.
+     * @returns The 64bit hash value.
+     */
+    XS_INLINE uint64 operator()(const String<CharType, Alloc>& value) const noexcept
+    {
+        return hash64(value.getData(), value.getLength() * sizeof(CharType));
+    }
+
+    /**
+     * Hash a value.
+     * @param value The value to hash.
+     * @returns The 64bit hash value.
+     */
+    XS_INLINE uint64 operator()(const StringView<CharType>& value) const noexcept
+    {
+        return hash64(value.data(), value.length() * sizeof(CharType));
+    }
+
+    /**
+     * Hash a value.
+     * @param value The value to hash.
+     * @returns The 64bit hash value.
+     */
+    XS_INLINE uint64 operator()(const CharType* const XS_RESTRICT value) const noexcept
+    {
+        return hash64(value, String<CharType, Alloc>::CharLength(value) * sizeof(CharType));
+    }
+};
+
+namespace NoExport {
+/**
+ * Hash functor for types that provide a trivially copyable Data type.
+ * @note Values are hashed bitwise so positive and negative zero hash differently.
+ * @tparam T Type of value being hashed.
+ */
+template<typename T>
+class HashData
+{
+public:
+    /**
+     * Hash a value.
+     * @param value The value to hash.
+     * @returns The 64bit hash value.
+     */
+    XS_INLINE uint64 operator()(const T& value) const noexcept
+    {
+        const typename T::Data data(value);
+        return hash64(&data, sizeof(data));
+    }
+};
+} // namespace NoExport
+
+template<typename T, SIMDWidth Width>
+class Hash<SIMD2<T, Width>> : public NoExport::HashData<SIMD2<T, Width>>
+{};
+
+template<typename T, SIMDWidth Width>
+class Hash<SIMD3<T, Width>> : public NoExport::HashData<SIMD3<T, Width>>
+{};
+
+template<typename T, SIMDWidth Width>
+class Hash<SIMD4<T, Width>> : public NoExport::HashData<SIMD4<T, Width>>
+{};
+
+template<typename T, SIMDWidth Width>
+class Hash<SIMD6<T, Width>> : public NoExport::HashData<SIMD6<T, Width>>
+{};
+
+template<typename T, SIMDWidth Width>
+class Hash<SIMD8<T, Width>> : public NoExport::HashData<SIMD8<T, Width>>
+{};
+
+template<typename T, SIMDWidth Width>
+class Hash<SIMD12<T, Width>> : public NoExport::HashData<SIMD12<T, Width>>
+{};
+
+template<typename T, SIMDWidth Width>
+class Hash<SIMD16<T, Width>> : public NoExport::HashData<SIMD16<T, Width>>
+{};
+
+template<typename T, SIMDWidth Width>
+class Hash<SIMD3x2<T, Width>> : public NoExport::HashData<SIMD3x2<T, Width>>
+{};
+
+template<typename T, SIMDWidth Width>
+class Hash<SIMD3x3<T, Width>> : public NoExport::HashData<SIMD3x3<T, Width>>
+{};
+
+template<typename T, SIMDWidth Width>
+class Hash<SIMD3x4<T, Width>> : public NoExport::HashData<SIMD3x4<T, Width>>
+{};
+
+template<typename T, SIMDWidth Width>
+class Hash<Point3D<T, Width>> : public NoExport::HashData<Point3D<T, Width>>
+{};
+
+template<typename T, SIMDWidth Width>
+class Hash<Vector3D<T, Width>> : public NoExport::HashData<Vector3D<T, Width>>
+{};
+
+/**
+ * Hash multiple keys at once.
+ * @note Integer keys are hashed 4 at a time using AVX2 where available. The results are identical to hashing each
+ * key individually using Hash.
+ * @tparam T Type of the keys.
+ * @tparam H Type of the hash functor.
+ * @param       keys   The keys to hash.
+ * @param       number The number of keys.
+ * @param [out] hashes The output hash values (must have space for number values).
+ */
+template<typename T, typename H = Hash<T>>
+XS_INLINE void hashBatch(
+    const T* const XS_RESTRICT keys, const uint0 number, uint64* const XS_RESTRICT hashes) noexcept
+{
+    uint0 i = 0;
+#if XS_ISA == XS_X86
+    if constexpr (hasISAFeature<ISAFeature::AVX2> && isSame<H, Hash<T>> && isInteger<T> &&
+        (sizeof(T) == sizeof(uint32) || sizeof(T) == sizeof(uint64))) {
+        // Emulate a full 64x64->128bit multiply using 32bit partial products
+        const __m256i secret0 = _mm256_set1_epi64x(static_cast<int64>(NoExport::hashSecret[0]));
+        const __m256i secret1 = _mm256_set1_epi64x(static_cast<int64>(NoExport::hashSecret[1]));
+        const __m256i secret1High = _mm256_srli_epi64(secret1, 32);
+        const __m256i lowMask = _mm256_set1_epi64x(0xFFFFFFFF_i64);
+        for (; i + 4 <= number; i += 4) {
+            __m256i value;
+            if constexpr (sizeof(T) == sizeof(uint64)) {
+                value = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&keys[i]));
+            } else if constexpr (isSigned<T>) {
+                value = _mm256_cvtepi32_epi64(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&keys[i])));
+            } else {
+                value = _mm256_cvtepu32_epi64(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&keys[i])));
+            }
+            value = _mm256_xor_si256(value, secret0);
+            const __m256i valueHigh = _mm256_srli_epi64(value, 32);
+            const __m256i ll = _mm256_mul_epu32(value, secret1);
+            const __m256i lh = _mm256_mul_epu32(value, secret1High);
+            const __m256i hl = _mm256_mul_epu32(valueHigh, secret1);
+            const __m256i hh = _mm256_mul_epu32(valueHigh, secret1High);
+            const __m256i mid = _mm256_add_epi64(_mm256_add_epi64(_mm256_srli_epi64(ll, 32), _mm256_and_si256(lh, lowMask)),
+                _mm256_and_si256(hl, lowMask));
+            const __m256i low = _mm256_or_si256(_mm256_and_si256(ll, lowMask), _mm256_slli_epi64(mid, 32));
+            const __m256i high = _mm256_add_epi64(_mm256_add_epi64(hh, _mm256_srli_epi64(mid, 32)),
+                _mm256_add_epi64(_mm256_srli_epi64(lh, 32), _mm256_srli_epi64(hl, 32)));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(&hashes[i]), _mm256_xor_si256(low, high));
+        }
+    } else
+#endif
+    {
+        // Unroll to allow multiple independent hashes to be in flight at once
+        const H hasher;
+        for (; i + 4 <= number; i += 4) {
+            hashes[i] = hasher(keys[i]);
+            hashes[i + 1] = hasher(keys[i + 1]);
+            hashes[i + 2] = hasher(keys[i + 2]);
+            hashes[i + 3] = hasher(keys[i + 3]);
+        }
+    }
+    const H hasher;
+    for (; i < number; ++i) {
+        hashes[i] = hasher(keys[i]);
+    }
+}
+} // namespace Shift
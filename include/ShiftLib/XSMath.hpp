@@ -210,19 +210,19 @@ XS_INLINE constexpr promote<T> mul(T param1, T param2) noexcept
 #if ((XS_COMPILER == XS_ICL) || (XS_COMPILER == XS_ICC) || (XS_COMPILER == XS_CLANGWIN)) && (XS_ISA == XS_X86)
     if constexpr (isSame<T, int32>) {
         uint32 reth, retl;
-        __asm__("imull %3" : "=a"(reth), "=d"(retl) : "%0"(param1), "rm"(param2));
+        __asm__("imull %3" : "=a"(retl), "=d"(reth) : "%0"(param1), "rm"(param2));
         return (static_cast<int64>(reth) << 32) | retl;
     } else if constexpr (isSame<T, uint32>) {
         uint32 reth, retl;
-        __asm__("mull %3" : "=a"(reth), "=d"(retl) : "%0"(param1), "rm"(param2));
+        __asm__("mull %3" : "=a"(retl), "=d"(reth) : "%0"(param1), "rm"(param2));
         return (static_cast<uint64>(reth) << 32) | retl;
     } else if constexpr (isSame<T, int64> && currentArch == Architecture::Bit64) {
         uint128 ret;
-        __asm__("imulq %3" : "=a"(ret.high), "=d"(ret.low) : "%0"(param1), "rm"(param2));
+        __asm__("imulq %3" : "=a"(ret.low), "=d"(ret.high) : "%0"(param1), "rm"(param2));
         return ret;
     } else if constexpr (isSame<T, uint64> && currentArch == Architecture::Bit64) {
         uint128 ret;
-        __asm__("mulq %3" : "=a"(ret.high), "=d"(ret.low) : "%0"(param1), "rm"(param2));
+        __asm__("mulq %3" : "=a"(ret.low), "=d"(ret.high) : "%0"(param1), "rm"(param2));
         return ret;
     } else
 #elif (XS_COMPILER == XS_MSVC) && (XS_ISA == XS_X86)
@@ -239,6 +239,14 @@ XS_INLINE constexpr promote<T> mul(T param1, T param2) noexcept
         const uint64 low = _umul128(param1, param2, &high);
         return UInt128(high, low);
     } else
+#elif (XS_COMPILER == XS_GNUC) || (XS_COMPILER == XS_CLANG)
+    if constexpr (isSame<T, int64> && currentArch == Architecture::Bit64) {
+        const __int128_t ret = static_cast<__int128_t>(param1) * param2;
+        return Int128(static_cast<int64>(ret >> 64), static_cast<uint64>(ret));
+    } else if constexpr (isSame<T, uint64> && currentArch == Architecture::Bit64) {
+        const __uint128_t ret = static_cast<__uint128_t>(param1) * param2;
+        return UInt128(static_cast<uint64>(ret >> 64), static_cast<uint64>(ret));
+    } else
 #endif
         if constexpr (isSame<T, uint64> && currentArch == Architecture::Bit32) {
         //   x= (2^32)a + b
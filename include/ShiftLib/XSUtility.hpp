@@ -145,6 +145,46 @@ public:
     constexpr Quartet& operator=(Quartet&& other) noexcept = default;
 };
 
+/**
+ * Function object that compares 2 objects using less than.
+ * @tparam T Type of object to compare.
+ */
+template<typename T>
+class Less
+{
+public:
+    /**
+     * Compare 2 objects.
+     * @param first  The first object.
+     * @param second The second object.
+     * @returns True if first is less than second.
+     */
+    constexpr bool operator()(const T& first, const T& second) const noexcept
+    {
+        return first < second;
+    }
+};
+
+/**
+ * Function object that compares 2 objects using greater than.
+ * @tparam T Type of object to compare.
+ */
+template<typename T>
+class Greater
+{
+public:
+    /**
+     * Compare 2 objects.
+     * @param first  The first object.
+     * @param second The second object.
+     * @returns True if first is greater than second.
+     */
+    constexpr bool operator()(const T& first, const T& second) const noexcept
+    {
+        return first > second;
+    }
+};
+
 /**
  * Swap 2 objects.
  * @tparam T Generic type parameter.
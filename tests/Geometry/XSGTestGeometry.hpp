@@ -89,6 +89,12 @@ namespace XS_OVERRIDE_SHIFT_NS {
 #    endif
 #    include "Geometry/XSPoint3D2.hpp"
 #endif
+#ifdef XS_TESTING_POINT3DSTREAM
+#    ifndef XS_TESTING_POINT3D4
+#        define XS_TESTING_POINT3D4 // Needed for PrinTo(row)
+#    endif
+#    include "Geometry/XSPoint3DStream.hpp"
+#endif
 #ifdef XS_TESTING_POINT3D4
 #    ifndef XS_TESTING_POINT3D
 #        define XS_TESTING_POINT3D // Needed for PrinTo(row)
@@ -119,6 +125,12 @@ namespace XS_OVERRIDE_SHIFT_NS {
 #    endif
 #    include "Geometry/XSVector3D2.hpp"
 #endif
+#ifdef XS_TESTING_VECTOR3DSTREAM
+#    ifndef XS_TESTING_VECTOR3D4
+#        define XS_TESTING_VECTOR3D4 // Needed for PrinTo(row)
+#    endif
+#    include "Geometry/XSVector3DStream.hpp"
+#endif
 #ifdef XS_TESTING_VECTOR3D4
 #    ifndef XS_TESTING_VECTOR3D
 #        define XS_TESTING_VECTOR3D // Needed for PrinTo(row)
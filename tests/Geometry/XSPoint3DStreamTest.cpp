@@ -0,0 +1,124 @@
+/**
+ * Copyright Matthew Oliver
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef XSTESTMAIN
+#    include "XSCompilerOptions.h"
+
+#    define XS_OVERRIDE_SHIFT_NS TESTISA(Point3DStreamTest)
+#    define XS_TESTING_POINT3DSTREAM
+#    define XS_TESTING_POINT3D4
+#    define XS_TESTING_POINT3D
+#    include "Geometry/XSGTestGeometry.hpp"
+using namespace XS_OVERRIDE_SHIFT_NS;
+using namespace XS_OVERRIDE_SHIFT_NS::Shift;
+
+template<typename T>
+class TESTISA(P3DStream)
+    : public ::testing::Test
+{
+public:
+    using Type = T;
+    using TypeInt = typename T::Type; // requested type
+};
+
+using Point3DStreamTestTypes = ::testing::Types<Point3DStream<float32>>;
+
+TYPED_TEST_SUITE(TESTISA(P3DStream), Point3DStreamTestTypes);
+
+TYPED_TEST_NS2(Point3DStream, TESTISA(P3DStream), AddGet)
+{
+    using TestType = typename TestFixture::Type;
+    using Point = typename TestType::Element;
+    using Block = typename TestType::Block;
+    TestType test1;
+    ASSERT_FALSE(test1.isValid());
+
+    for (uint32 i = 0; i < 10; ++i) {
+        const auto value = static_cast<float32>(i);
+        ASSERT_TRUE(test1.add(Point(value, value + 100.0f, -value)));
+    }
+    ASSERT_EQ(test1.getLength(), 10);
+    ASSERT_EQ(test1.getReservedLength() % TestType::blockLength, 0);
+    ASSERT_EQ(test1.getBlockCount(), 3);
+    ASSERT_EQ(test1.getBlockLength(2), 2);
+    ASSERT_PRED4((assertPoint3D<float32, Point::width>), test1.at(5), 5.0f, 105.0f, -5.0f);
+    ASSERT_PRED13((assertPoint3D4<float32, true, Block::width>), test1.getBlock(1), 4.0f, 104.0f, -4.0f, 5.0f,
+        105.0f, -5.0f, 6.0f, 106.0f, -6.0f, 7.0f, 107.0f, -7.0f);
+
+    // Unused lanes in the last block must repeat the last element
+    ASSERT_PRED13((assertPoint3D4<float32, true, Block::width>), test1.getBlock(2), 8.0f, 108.0f, -8.0f, 9.0f,
+        109.0f, -9.0f, 9.0f, 109.0f, -9.0f, 9.0f, 109.0f, -9.0f);
+
+    test1.remove(0);
+    test1.removeBack();
+    ASSERT_EQ(test1.getLength(), 8);
+    ASSERT_PRED4((assertPoint3D<float32, Point::width>), test1.at(0), 1.0f, 101.0f, -1.0f);
+    ASSERT_PRED13((assertPoint3D4<float32, true, Block::width>), test1.getBlock(1), 5.0f, 105.0f, -5.0f, 6.0f,
+        106.0f, -6.0f, 7.0f, 107.0f, -7.0f, 8.0f, 108.0f, -8.0f);
+    ASSERT_TRUE(test1.add(Block(typename Block::Point3DDef(-1.0f, -2.0f, -3.0f))));
+    ASSERT_EQ(test1.getLength(), 12);
+    ASSERT_PRED4((assertPoint3D<float32, Point::width>), test1.at(11), -1.0f, -2.0f, -3.0f);
+}
+
+TYPED_TEST_NS2(Point3DStream, TESTISA(P3DStream), Convert)
+{
+    using TestType = typename TestFixture::Type;
+    using Data = typename TestType::ElementData;
+    using Block = typename TestType::Block;
+    Data elements[13]; // NOLINT(modernize-avoid-c-arrays)
+    for (uint32 i = 0; i < 13; ++i) {
+        const auto value = static_cast<float32>(i);
+        elements[i].setData(value, value * 2.0f, value * 3.0f);
+    }
+    Array<Data> array(elements, 13);
+
+    // Adding at the start of a block uses the transposed conversion
+    TestType test1(16);
+    ASSERT_TRUE(test1.add(array));
+    ASSERT_EQ(test1.getLength(), 13);
+
+    // Adding part way through a block must give the same result
+    TestType test2;
+    ASSERT_TRUE(test2.add(elements, 1));
+    ASSERT_TRUE(test2.add(array));
+    ASSERT_EQ(test2.getLength(), 14);
+    for (uint32 i = 0; i < 13; ++i) {
+        const auto value = static_cast<float32>(i);
+        ASSERT_PRED4((assertPoint3D<float32, TestType::Element::width>), test1.at(i), value, value * 2.0f,
+            value * 3.0f);
+        ASSERT_PRED4((assertPoint3D<float32, TestType::Element::width>), test2.at(i + 1), value, value * 2.0f,
+            value * 3.0f);
+    }
+    ASSERT_PRED13((assertPoint3D4<float32, true, Block::width>), test1.getBlock(3), 12.0f, 24.0f, 36.0f, 12.0f,
+        24.0f, 36.0f, 12.0f, 24.0f, 36.0f, 12.0f, 24.0f, 36.0f);
+    ASSERT_PRED13((assertPoint3D4<float32, true, Block::width>), test2.getBlock(3), 11.0f, 22.0f, 33.0f, 12.0f,
+        24.0f, 36.0f, 12.0f, 24.0f, 36.0f, 12.0f, 24.0f, 36.0f);
+
+    Array<Data> output(array);
+    ASSERT_FALSE(test2.get(output));
+    for (uint32 i = 0; i < 13; ++i) {
+        output.at(i).setData(0.0f, 0.0f, 0.0f);
+    }
+    ASSERT_TRUE(test1.get(output));
+    for (uint32 i = 0; i < 13; ++i) {
+        const auto value = static_cast<float32>(i);
+        ASSERT_EQ(output.at(i).values.value0, value);
+        ASSERT_EQ(output.at(i).values.value1, value * 2.0f);
+        ASSERT_EQ(output.at(i).values.value2, value * 3.0f);
+    }
+}
+#endif
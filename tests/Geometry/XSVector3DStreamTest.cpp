@@ -0,0 +1,69 @@
+/**
+ * Copyright Matthew Oliver
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef XSTESTMAIN
+#    include "XSCompilerOptions.h"
+
+#    define XS_OVERRIDE_SHIFT_NS TESTISA(Vector3DStreamTest)
+#    define XS_TESTING_VECTOR3DSTREAM
+#    define XS_TESTING_VECTOR3D4
+#    define XS_TESTING_VECTOR3D
+#    include "Geometry/XSGTestGeometry.hpp"
+using namespace XS_OVERRIDE_SHIFT_NS;
+using namespace XS_OVERRIDE_SHIFT_NS::Shift;
+
+template<typename T>
+class TESTISA(V3DStream)
+    : public ::testing::Test
+{
+public:
+    using Type = T;
+    using TypeInt = typename T::Type; // requested type
+};
+
+using Vector3DStreamTestTypes = ::testing::Types<Vector3DStream<float32>>;
+
+TYPED_TEST_SUITE(TESTISA(V3DStream), Vector3DStreamTestTypes);
+
+TYPED_TEST_NS2(Vector3DStream, TESTISA(V3DStream), Vector3DStream)
+{
+    using TestType = typename TestFixture::Type;
+    using Vector = typename TestType::Element;
+    using Block = typename TestType::Block;
+    TestType test1;
+    for (uint32 i = 0; i < 6; ++i) {
+        const auto value = static_cast<float32>(i);
+        ASSERT_TRUE(test1.add(Vector(value, -value, value * 0.5f)));
+    }
+    ASSERT_EQ(test1.getBlockCount(), 2);
+    ASSERT_PRED4((assertVector3D<float32, Vector::width>), test1.at(3), 3.0f, -3.0f, 1.5f);
+    ASSERT_PRED13((assertVector3D4<float32, true, Block::width>), test1.getBlock(1), 4.0f, -4.0f, 2.0f, 5.0f, -5.0f,
+        2.5f, 5.0f, -5.0f, 2.5f, 5.0f, -5.0f, 2.5f);
+
+    // Process the stream a block at a time
+    for (uint0 i = 0; i < test1.getBlockCount(); ++i) {
+        test1.setBlock(i, test1.getBlock(i) + test1.getBlock(i));
+    }
+    ASSERT_PRED4((assertVector3D<float32, Vector::width>), test1.at(5), 10.0f, -10.0f, 5.0f);
+
+    typename TestType::ElementData data[6]; // NOLINT(modernize-avoid-c-arrays)
+    test1.get(data, 0, 6);
+    ASSERT_EQ(data[2].values.value0, 4.0f);
+    ASSERT_EQ(data[2].values.value1, -4.0f);
+    ASSERT_EQ(data[2].values.value2, 2.0f);
+}
+#endif
@@ -0,0 +1,201 @@
+/**
+ * Copyright Matthew Oliver
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifdef XSTESTMAIN
+#    include "Memory/XSArrayView.hpp"
+#    include "Memory/XSDArray.hpp"
+
+#    include "XSGTest.hpp"
+
+using namespace Shift;
+
+template<typename T>
+class ArrayViewTest : public ::testing::Test
+{
+public:
+    using Type = T;
+
+    /** Array of structures record used to test field projections. */
+    struct Record
+    {
+        uint8 tag;
+        T value;
+        uint16 other;
+    };
+};
+
+using ArrayViewTestTypes = ::testing::Types<uint8, uint16, uint32, uint64, float32, float64>;
+
+class ArrayViewTestNames
+{
+public:
+    template<typename T>
+    static std::string GetName(int)
+    {
+        if (std::is_same<T, uint8>()) {
+            return "uint8";
+        }
+        if (std::is_same<T, uint16>()) {
+            return "uint16";
+        }
+        if (std::is_same<T, uint32>()) {
+            return "uint32";
+        }
+        if (std::is_same<T, uint64>()) {
+            return "uint64";
+        }
+        if (std::is_same<T, float32>()) {
+            return "float32";
+        }
+        if (std::is_same<T, float64>()) {
+            return "float64";
+        }
+        return "def";
+    }
+};
+
+TYPED_TEST_SUITE(ArrayViewTest, ArrayViewTestTypes, ArrayViewTestNames);
+
+TYPED_TEST_NS2(ArrayView, ArrayViewTest, View)
+{
+    using TestType = typename TestFixture::Type;
+
+    DArray<TestType> test1;
+    for (uint32 i = 0; i < 100; ++i) {
+        ASSERT_TRUE(test1.add(static_cast<TestType>(i)));
+    }
+
+    // Views reference the original elements without copying
+    const ArrayView<TestType> view1(test1);
+    ASSERT_EQ(view1.getData(), test1.getData());
+    ASSERT_EQ(view1.getLength(), 100);
+    ASSERT_EQ(view1.getSize(), 100 * sizeof(TestType));
+    TestType check(0);
+    for (const auto& i : view1) {
+        ASSERT_EQ(i, check);
+        ++check;
+    }
+
+    const ArrayView<TestType> view2(test1, 10, 30);
+    ASSERT_EQ(view2.getLength(), 20);
+    ASSERT_EQ(view2.at(0), static_cast<TestType>(10));
+    ASSERT_EQ(view2.indexOfFirst(static_cast<TestType>(25)), 15);
+    ASSERT_EQ(view2.indexOfFirst(static_cast<TestType>(35)), UINT_MAX);
+
+    const ArrayView<TestType> view3 = view2.subview(5, 8);
+    ASSERT_EQ(view3.getLength(), 3);
+    ASSERT_EQ(view3.at(view3.iteratorAt(2)), static_cast<TestType>(17));
+    ASSERT_EQ(view3.getData(), &test1.at(15));
+    ASSERT_TRUE(view2.subview(4, 4).isEmpty());
+
+    // Copies and swaps only change which elements are viewed
+    ArrayView<TestType> view4(view3);
+    ArrayView<TestType> view5;
+    ASSERT_TRUE(view5.isEmpty());
+    view5.swap(view4);
+    ASSERT_TRUE(view4.isEmpty());
+    ASSERT_EQ(view5.getData(), view3.getData());
+    view4 = view1;
+    ASSERT_EQ(view4.getLength(), 100);
+    ASSERT_EQ(test1.at(99), static_cast<TestType>(99));
+}
+
+TYPED_TEST_NS2(ArrayView, ArrayViewTest, Stride)
+{
+    using TestType = typename TestFixture::Type;
+
+    DArray<TestType> test1;
+    for (uint32 i = 0; i < 100; ++i) {
+        ASSERT_TRUE(test1.add(static_cast<TestType>(i)));
+    }
+    const ArrayView<TestType> view1(test1);
+
+    const StridedArrayView<TestType> view2 = view1.stride(3);
+    ASSERT_EQ(view2.getLength(), 34);
+    ASSERT_EQ(view2.getStride(), 3 * sizeof(TestType));
+    ASSERT_FALSE(view2.isContiguous());
+    uint32 check = 0;
+    for (const auto& i : view2) {
+        ASSERT_EQ(i, static_cast<TestType>(check));
+        check += 3;
+    }
+    ASSERT_EQ(view2.end() - view2.begin(), 34);
+    ASSERT_EQ(view2.positionAt(view2.iteratorAt(7)), 7);
+
+    // Strides and sub views can be combined
+    const StridedArrayView<TestType> view3 = view1.stride(4, 2).subview(3, 10).stride(2, 1);
+    ASSERT_EQ(view3.getLength(), 3);
+    ASSERT_EQ(view3.at(0), static_cast<TestType>(18));
+    ASSERT_EQ(view3.at(2), static_cast<TestType>(34));
+    auto iterator = view3.cend();
+    --iterator;
+    ASSERT_EQ(*iterator, static_cast<TestType>(34));
+    iterator -= 1;
+    ASSERT_EQ(view3.at(iterator), static_cast<TestType>(26));
+    ASSERT_TRUE(view1.stride(3, 100).isEmpty());
+    ASSERT_EQ(view1.stride(1).getLength(), 100);
+    ASSERT_TRUE(StridedArrayView<TestType>(test1).isContiguous());
+
+    // Gather every length and offset so that both the SIMD and remaining elements are used
+    TestType output[40]; // NOLINT(modernize-avoid-c-arrays)
+    for (const uint0 step : {1, 2, 5, 33}) {
+        const StridedArrayView<TestType> view4 = view1.stride(step);
+        for (uint0 start = 0; start < 4 && start < view4.getLength(); ++start) {
+            for (uint0 number = 0; start + number <= view4.getLength() && number <= 40; ++number) {
+                view4.gather(start, number, output);
+                for (uint0 i = 0; i < number; ++i) {
+                    ASSERT_EQ(output[i], static_cast<TestType>((start + i) * step));
+                }
+            }
+        }
+    }
+}
+
+TYPED_TEST_NS2(ArrayView, ArrayViewTest, Field)
+{
+    using TestType = typename TestFixture::Type;
+    using Record = typename TestFixture::Record;
+
+    DArray<Record> test1;
+    for (uint32 i = 0; i < 50; ++i) {
+        ASSERT_TRUE(test1.add(Record{static_cast<uint8>(i), static_cast<TestType>(i * 2), static_cast<uint16>(i + 7)}));
+    }
+    const ArrayView<Record> view1(test1);
+
+    const StridedArrayView<TestType> view2 = view1.field(&Record::value);
+    ASSERT_EQ(view2.getLength(), 50);
+    ASSERT_EQ(view2.getStride(), sizeof(Record));
+    ASSERT_EQ(&view2.at(4), &test1.at(4).value);
+    uint32 check = 0;
+    for (const auto& i : view2) {
+        ASSERT_EQ(i, static_cast<TestType>(check));
+        check += 2;
+    }
+
+    // Projections of strided views keep the combined stride
+    const StridedArrayView<uint16> view3 = view1.stride(2, 1).field(&Record::other);
+    ASSERT_EQ(view3.getLength(), 25);
+    ASSERT_EQ(view3.getStride(), 2 * sizeof(Record));
+    ASSERT_EQ(view3.at(3), 14);
+
+    TestType output[50]; // NOLINT(modernize-avoid-c-arrays)
+    view2.gather(0, 50, output);
+    for (uint32 i = 0; i < 50; ++i) {
+        ASSERT_EQ(output[i], static_cast<TestType>(i * 2));
+    }
+    ASSERT_TRUE(ArrayView<Record>().field(&Record::tag).isEmpty());
+}
+#endif
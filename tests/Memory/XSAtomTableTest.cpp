@@ -0,0 +1,179 @@
+/**
+ * Copyright Matthew Oliver
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifdef XSTESTMAIN
+#    include "Memory/XSAtomTable.hpp"
+#    include "Memory/XSHashMap.hpp"
+
+#    include "XSGTest.hpp"
+
+#    include <thread>
+#    include <vector>
+
+using namespace Shift;
+
+template<typename T>
+class AtomTableTest : public ::testing::Test
+{
+public:
+    using Type = T;
+};
+
+using AtomTableTestTypes = ::testing::Types<char, char8, char16, char32>;
+
+class AtomTableTestNames
+{
+public:
+    template<typename T>
+    static std::string GetName(int)
+    {
+        if (std::is_same<T, char>()) {
+            return "char";
+        }
+        if (std::is_same<T, char8>()) {
+            return "char8";
+        }
+        if (std::is_same<T, char16>()) {
+            return "char16";
+        }
+        if (std::is_same<T, char32>()) {
+            return "char32";
+        }
+        return "def";
+    }
+};
+
+TYPED_TEST_SUITE(AtomTableTest, AtomTableTestTypes, AtomTableTestNames);
+
+TYPED_TEST_NS2(AtomTable, AtomTableTest, FindOrAdd)
+{
+    using TestType = typename TestFixture::Type;
+
+    AtomTable<TestType> test1;
+    ASSERT_EQ(test1.getLength(), 0);
+    ASSERT_FALSE(Atom().isValid());
+
+    const String<TestType> hello("Hello");
+    const String<TestType> world("World");
+    const Atom atom1 = test1.findOrAdd(hello);
+    const Atom atom2 = test1.findOrAdd(world);
+    ASSERT_TRUE(atom1.isValid());
+    ASSERT_TRUE(atom2.isValid());
+    ASSERT_NE(atom1, atom2);
+    ASSERT_EQ(test1.getLength(), 2);
+
+    // Adding an existing string returns the same atom
+    const String<TestType> hello2("Hello");
+    ASSERT_EQ(test1.findOrAdd(hello2), atom1);
+    ASSERT_EQ(test1.findOrAdd(StringView<TestType>(hello2.getData(), hello2.getLength())), atom1);
+    ASSERT_EQ(test1.getLength(), 2);
+    ASSERT_EQ(Hash<Atom>()(test1.findOrAdd(hello2)), Hash<Atom>()(atom1));
+
+    ASSERT_EQ(test1.getString(atom1), hello);
+    ASSERT_EQ(test1.getString(atom2), world);
+    ASSERT_EQ(test1.getLength(atom1), 5);
+    ASSERT_EQ(test1.getView(atom2), StringView<TestType>(world.getData(), world.getLength()));
+    ASSERT_EQ(test1.getData(atom1)[5], TestType{0});
+
+    const String<TestType> missing("Missing");
+    ASSERT_FALSE(test1.find(StringView<TestType>(missing.getData(), missing.getLength())).isValid());
+    ASSERT_FALSE(test1.contains(StringView<TestType>(missing.getData(), missing.getLength())));
+    ASSERT_EQ(test1.find(StringView<TestType>(world.getData(), world.getLength())), atom2);
+
+    // Empty strings are valid
+    const Atom atom3 = test1.findOrAdd(StringView<TestType>());
+    ASSERT_TRUE(atom3.isValid());
+    ASSERT_EQ(test1.getLength(atom3), 0);
+    ASSERT_EQ(test1.findOrAdd(String<TestType>()), atom3);
+}
+
+TYPED_TEST_NS2(AtomTable, AtomTableTest, Stable)
+{
+    using TestType = typename TestFixture::Type;
+
+    // Add enough strings to require several blocks, index resizes and character chunks
+    AtomTable<TestType> test1;
+    const Atom first = test1.findOrAdd(String<TestType>("first"));
+    const TestType* firstData = test1.getData(first);
+    std::vector<Atom> atoms;
+    String<TestType> string;
+    for (uint32 i = 0; i < 5000; ++i) {
+        ASSERT_TRUE(string.set(i));
+        atoms.push_back(test1.findOrAdd(string));
+        ASSERT_TRUE(atoms.back().isValid());
+    }
+    ASSERT_EQ(test1.getLength(), 5001);
+    for (uint32 i = 0; i < 5000; ++i) {
+        ASSERT_TRUE(string.set(i));
+        ASSERT_EQ(test1.findOrAdd(string), atoms[i]);
+        ASSERT_EQ(test1.getString(atoms[i]), string);
+    }
+    ASSERT_EQ(test1.getData(first), firstData);
+    ASSERT_EQ(test1.getString(first), String<TestType>("first"));
+
+    // Strings larger than a chunk
+    String<TestType> large;
+    for (uint32 i = 0; i < 10000; ++i) {
+        ASSERT_TRUE(large.add(TestType('a' + (i % 26))));
+    }
+    const Atom atom1 = test1.findOrAdd(large);
+    ASSERT_EQ(test1.getString(atom1), large);
+    ASSERT_EQ(test1.findOrAdd(large), atom1);
+
+    // Atoms can be used as hash map keys
+    HashMap<Atom, uint32> test2;
+    for (uint32 i = 0; i < 5000; ++i) {
+        ASSERT_TRUE(test2.add(atoms[i], i));
+    }
+    for (uint32 i = 0; i < 5000; ++i) {
+        ASSERT_EQ(test2.at(atoms[i]), i);
+    }
+}
+
+TEST_NS2(AtomTable, AtomTableTest, Threads)
+{
+    AtomTable<char> test1;
+    constexpr uint32 threadCount = 4;
+    constexpr uint32 count = 2000;
+    std::vector<std::vector<Atom>> atoms(threadCount);
+    std::vector<std::thread> threads;
+    for (uint32 i = 0; i < threadCount; ++i) {
+        threads.emplace_back([&test1, &atoms, i] {
+            // Every thread adds the same strings starting from a different position
+            String<char> string;
+            atoms[i].resize(count);
+            for (uint32 j = 0; j < count; ++j) {
+                const uint32 value = (j * 7 + i * (count / threadCount)) % count;
+                string.set(value);
+                atoms[i][value] = test1.findOrAdd(string);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    ASSERT_EQ(test1.getLength(), count);
+    String<char> string;
+    for (uint32 j = 0; j < count; ++j) {
+        ASSERT_TRUE(string.set(j));
+        for (uint32 i = 0; i < threadCount; ++i) {
+            ASSERT_EQ(atoms[i][j], atoms[0][j]);
+        }
+        ASSERT_EQ(test1.getString(atoms[0][j]), string);
+    }
+}
+
+#endif
@@ -0,0 +1,133 @@
+/**
+ * Copyright Matthew Oliver
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifdef XSTESTMAIN
+
+#    include "Memory/XSBitArray.hpp"
+
+#    include "XSGTest.hpp"
+
+using namespace Shift;
+
+TEST_NS2(BitArray, BitArrayTest, AddRemove)
+{
+    BitArray<> test1;
+    ASSERT_FALSE(test1.isValid());
+    ASSERT_TRUE(test1.isEmpty());
+    ASSERT_EQ(test1.indexOfFirstValid(), 0);
+
+    // Grow several times so that the words are relocated
+    for (uint32 i = 0; i < 2000; ++i) {
+        ASSERT_TRUE(test1.add(i % 3 == 0));
+    }
+    ASSERT_EQ(test1.getLength(), 2000);
+    ASSERT_EQ(test1.getReservedLength() % BitArray<>::blockBits, 0);
+    ASSERT_EQ(reinterpret_cast<uint0>(test1.getData()) % BitArray<>::alignment, 0);
+    for (uint32 i = 0; i < 2000; ++i) {
+        ASSERT_EQ(test1.getBool(i), i % 3 == 0);
+    }
+    ASSERT_EQ(test1.getCount(), 667);
+
+    test1.setBoolFalse(0);
+    test1.setBoolTrue(1);
+    test1.setBool(2, true);
+    ASSERT_FALSE(test1.getBool(0));
+    ASSERT_TRUE(test1.getBool(1));
+    ASSERT_TRUE(test1.getBool(2));
+    ASSERT_EQ(test1.getCount(), 668);
+
+    // Removed bits must no longer be counted
+    test1.removeBack(1000);
+    ASSERT_EQ(test1.getLength(), 1000);
+    ASSERT_EQ(test1.getCount(), 335);
+    ASSERT_TRUE(test1.add(false));
+    ASSERT_FALSE(test1.getBool(1000));
+
+    BitArray<> test2(test1);
+    ASSERT_TRUE(test1.setReservedLength(5000));
+    ASSERT_EQ(test1.getReservedLength(), 5120);
+    ASSERT_EQ(test2.getLength(), 1001);
+    ASSERT_EQ(test2.getCount(), test1.getCount());
+    ASSERT_TRUE(test1.setReservedLength(0));
+    ASSERT_EQ(test1.getReservedLength(), 1024);
+
+    test2.removeAll();
+    ASSERT_TRUE(test2.isEmpty());
+    ASSERT_TRUE(test2.isValid());
+    ASSERT_EQ(test2.getCount(), 0);
+}
+
+TEST_NS2(BitArray, BitArrayTest, Operations)
+{
+    BitArray<> test1(1000, false);
+    BitArray<> test2(1000, true);
+    ASSERT_TRUE(test1.getNone());
+    ASSERT_TRUE(test2.getAll());
+    ASSERT_EQ(test2.getCount(), 1000);
+    for (uint32 i = 0; i < 1000; i += 7) {
+        test1.setBoolTrue(i);
+    }
+
+    BitArray<> test3(test2);
+    test3 &= test1;
+    ASSERT_EQ(test3.getCount(), 143);
+    test3 |= test2;
+    ASSERT_EQ(test3.getCount(), 1000);
+    test3 ^= test1;
+    ASSERT_EQ(test3.getCount(), 857);
+
+    // Inverting must not set any bits past the end
+    test3.invert();
+    ASSERT_EQ(test3.getCount(), 143);
+    test2.invert();
+    ASSERT_TRUE(test2.getNone());
+
+    // Iterate over set bits
+    ASSERT_EQ(test3.indexOfFirstValid(), 0);
+    ASSERT_EQ(test3.indexOfNextValid(1), 7);
+    ASSERT_EQ(test3.indexOfNextValid(995), 1000);
+    uint0 expected = 0;
+    test3.forEachValid([&](const uint0 index) {
+        ASSERT_EQ(index, expected);
+        expected += 7;
+    });
+    ASSERT_EQ(expected, 1001);
+}
+
+TEST_NS2(BitArray, BitArrayTest, Bools)
+{
+    BitArray<> test1;
+    ASSERT_TRUE(test1.add(Bool4<>(true, false, true, true)));
+    ASSERT_TRUE(test1.add(false));
+    for (uint32 i = 0; i < 5; ++i) {
+        ASSERT_TRUE(test1.add(Bool8<>(0xA5_ui8)));
+    }
+    ASSERT_EQ(test1.getLength(), 45);
+    ASSERT_EQ(test1.getBool4(0).getAsInteger(), 0xD);
+    ASSERT_EQ(test1.getBool8(5).getAsInteger(), 0xA5);
+    // Read across a word boundary
+    ASSERT_EQ(test1.getBool8(29).getAsInteger(), 0xA5);
+    ASSERT_EQ(test1.getBool4(33).getAsInteger(), 0xA);
+
+    test1.setBool8(28, Bool8<>(0xFF_ui8));
+    ASSERT_EQ(test1.getBool8(28).getAsInteger(), 0xFF);
+    ASSERT_EQ(test1.getBool4(26).getAsInteger(), 0xD);
+    ASSERT_EQ(test1.getBool4(36).getAsInteger(), 0xB);
+    test1.setBool4(30, Bool4<>(0x0_ui8));
+    ASSERT_EQ(test1.getBool8(28).getAsInteger(), 0xC3);
+}
+
+#endif
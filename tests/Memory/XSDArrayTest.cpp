@@ -130,5 +130,16 @@ TYPED_TEST_NS2(DArray, DArrayTest, AddElement)
     test2.add(check);
     ASSERT_EQ(test2.getLength(), (2 * test1.getLength()) + 1);
     ASSERT_EQ(test2.atBack(), check);
+
+    // Adding a range must reserve space for each element and not just the number of bytes
+    TestType elements[100]; // NOLINT(modernize-avoid-c-arrays)
+    for (uint32 i = 0; i < 100; ++i) {
+        elements[i] = static_cast<TestType>(i);
+    }
+    DArray<TestType> test3;
+    ASSERT_TRUE(test3.add(elements, 100));
+    ASSERT_EQ(test3.getLength(), 100);
+    ASSERT_GE(test3.getReservedLength(), 100);
+    ASSERT_EQ(test3.atBack(), static_cast<TestType>(99));
 }
 #endif
@@ -0,0 +1,128 @@
+/**
+ * Copyright Matthew Oliver
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifdef XSTESTMAIN
+
+#    include "Memory/XSDeque.hpp"
+#    include "Memory/XSString.hpp"
+
+#    include "XSGTest.hpp"
+
+using namespace Shift;
+
+template<typename T>
+class DequeTest : public ::testing::Test
+{
+public:
+    using Type = T;
+};
+
+using DequeTestTypes = ::testing::Types<uint8, uint32, uint64, float32, float64>;
+
+class DequeTestNames
+{
+public:
+    template<typename T>
+    static std::string GetName(int)
+    {
+        if (std::is_same<T, uint8>()) {
+            return "uint8";
+        }
+        if (std::is_same<T, uint32>()) {
+            return "uint32";
+        }
+        if (std::is_same<T, uint64>()) {
+            return "uint64";
+        }
+        if (std::is_same<T, float32>()) {
+            return "float32";
+        }
+        if (std::is_same<T, float64>()) {
+            return "float64";
+        }
+        return "def";
+    }
+};
+
+TYPED_TEST_SUITE(DequeTest, DequeTestTypes, DequeTestNames);
+
+TYPED_TEST_NS2(Deque, DequeTest, PushPop)
+{
+    using TestType = typename TestFixture::Type;
+    Deque<TestType> test1;
+    ASSERT_FALSE(test1.isValid());
+
+    // Grow from both ends so that the contents are wrapped when growing
+    for (uint32 i = 0; i < 50; ++i) {
+        ASSERT_TRUE(test1.pushBack(static_cast<TestType>(i + 50)));
+        ASSERT_TRUE(test1.pushFront(static_cast<TestType>(49 - i)));
+    }
+    ASSERT_EQ(test1.getLength(), 100);
+    ASSERT_EQ(test1.getReservedLength(), 128);
+    for (uint32 i = 0; i < 100; ++i) {
+        ASSERT_EQ(test1.at(i), static_cast<TestType>(i));
+    }
+
+    TestType value;
+    ASSERT_TRUE(test1.popFront(value));
+    ASSERT_EQ(value, static_cast<TestType>(0));
+    ASSERT_TRUE(test1.popBack(value));
+    ASSERT_EQ(value, static_cast<TestType>(99));
+    ASSERT_EQ(test1.getLength(), 98);
+
+    // Check copy
+    Deque<TestType> test2(test1);
+    ASSERT_EQ(test2.getLength(), 98);
+    ASSERT_EQ(test2.atBegin(), static_cast<TestType>(1));
+    ASSERT_EQ(test2.atBack(), static_cast<TestType>(98));
+}
+
+TYPED_TEST_NS2(Deque, DequeTest, Bulk)
+{
+    using TestType = typename TestFixture::Type;
+    Deque<TestType> test1(4);
+
+    TestType values[40]; // NOLINT(modernize-avoid-c-arrays)
+    for (uint32 i = 0; i < 40; ++i) {
+        values[i] = static_cast<TestType>(i);
+    }
+    ASSERT_TRUE(test1.pushBack(values + 20, 20));
+    ASSERT_TRUE(test1.pushFront(values, 20));
+    ASSERT_EQ(test1.getLength(), 40);
+
+    TestType results[40]; // NOLINT(modernize-avoid-c-arrays)
+    ASSERT_EQ(test1.popFront(results, 40), 40);
+    for (uint32 i = 0; i < 40; ++i) {
+        ASSERT_EQ(results[i], static_cast<TestType>(i));
+    }
+    ASSERT_TRUE(test1.isEmpty());
+}
+
+TEST_NS2(Deque, DequeTest, String)
+{
+    Deque<String<char>> test1;
+    for (uint32 i = 0; i < 20; ++i) {
+        ASSERT_TRUE(test1.pushBack("back"));
+        ASSERT_TRUE(test1.pushFront("front"));
+    }
+    ASSERT_EQ(test1.getLength(), 40);
+    ASSERT_EQ(test1.atBegin(), "front");
+    ASSERT_EQ(test1.atBack(), "back");
+    ASSERT_EQ(test1.at(19), "front");
+    ASSERT_EQ(test1.at(20), "back");
+}
+
+#endif
@@ -0,0 +1,160 @@
+/**
+ * Copyright Matthew Oliver
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifdef XSTESTMAIN
+
+#    include "Memory/XSHashMap.hpp"
+#    include "Memory/XSString.hpp"
+
+#    include "XSGTest.hpp"
+
+using namespace Shift;
+
+template<typename T>
+class HashMapTest : public ::testing::Test
+{
+public:
+    using Type = T;
+};
+
+using HashMapTestTypes = ::testing::Types<uint8, uint16, uint32, uint64, int32, int64>;
+
+class HashMapTestNames
+{
+public:
+    template<typename T>
+    static std::string GetName(int)
+    {
+        if (std::is_same<T, uint8>()) {
+            return "uint8";
+        }
+        if (std::is_same<T, uint16>()) {
+            return "uint16";
+        }
+        if (std::is_same<T, uint32>()) {
+            return "uint32";
+        }
+        if (std::is_same<T, uint64>()) {
+            return "uint64";
+        }
+        if (std::is_same<T, int32>()) {
+            return "int32";
+        }
+        if (std::is_same<T, int64>()) {
+            return "int64";
+        }
+        return "def";
+    }
+};
+
+TYPED_TEST_SUITE(HashMapTest, HashMapTestTypes, HashMapTestNames);
+
+TYPED_TEST_NS2(HashMap, HashMapTest, Constructor)
+{
+    using TestType = typename TestFixture::Type;
+
+    HashMap<TestType, uint32> test1;
+    ASSERT_FALSE(test1.isValid());
+    ASSERT_TRUE(test1.isEmpty());
+
+    HashMap<TestType, uint32> test2(100);
+    ASSERT_TRUE(test2.isValid());
+    ASSERT_TRUE(test2.getReservedLength() >= 100);
+    ASSERT_EQ(test2.getLength(), 0);
+}
+
+TYPED_TEST_NS2(HashMap, HashMapTest, AddFindRemove)
+{
+    using TestType = typename TestFixture::Type;
+    HashMap<TestType, uint32> test1;
+
+    // Add enough elements to force several rehashes
+    constexpr uint32 number = 100;
+    for (uint32 i = 0; i < number; ++i) {
+        ASSERT_TRUE(test1.add(static_cast<TestType>(i), i * 2));
+    }
+    ASSERT_EQ(test1.getLength(), number);
+    for (uint32 i = 0; i < number; ++i) {
+        ASSERT_TRUE(test1.contains(static_cast<TestType>(i)));
+        ASSERT_EQ(test1.at(static_cast<TestType>(i)), i * 2);
+    }
+    ASSERT_EQ(test1.find(static_cast<TestType>(number)), nullptr);
+
+    // Replace existing value
+    ASSERT_TRUE(test1.add(static_cast<TestType>(5), 7_ui32));
+    ASSERT_EQ(test1.getLength(), number);
+    ASSERT_EQ(*test1.find(static_cast<TestType>(5)), 7);
+
+    // Remove every second element
+    for (uint32 i = 0; i < number; i += 2) {
+        ASSERT_TRUE(test1.remove(static_cast<TestType>(i)));
+    }
+    ASSERT_FALSE(test1.remove(static_cast<TestType>(0)));
+    ASSERT_EQ(test1.getLength(), number / 2);
+    for (uint32 i = 0; i < number; ++i) {
+        ASSERT_EQ(test1.contains(static_cast<TestType>(i)), (i % 2) != 0);
+    }
+
+    // Re-add removed elements to reuse deleted slots
+    for (uint32 i = 0; i < number; i += 2) {
+        ASSERT_NE(test1.findOrAdd(static_cast<TestType>(i)), nullptr);
+    }
+    ASSERT_EQ(test1.getLength(), number);
+    ASSERT_EQ(test1.at(static_cast<TestType>(0)), 0);
+
+    // Check iteration visits each element once
+    uint32 count = 0;
+    uint64 sum = 0;
+    for (auto& i : test1) {
+        ++count;
+        sum += static_cast<uint64>(i.first);
+    }
+    ASSERT_EQ(count, number);
+    ASSERT_EQ(sum, (number * (number - 1)) / 2);
+
+    // Check copy
+    HashMap<TestType, uint32> test2(test1);
+    ASSERT_EQ(test2.getLength(), test1.getLength());
+    ASSERT_EQ(test2.at(static_cast<TestType>(number - 1)), (number - 1) * 2);
+
+    test1.removeAll();
+    ASSERT_TRUE(test1.isEmpty());
+    ASSERT_TRUE(test1.isValid());
+    ASSERT_FALSE(test1.contains(static_cast<TestType>(1)));
+    test1.clear();
+    ASSERT_FALSE(test1.isValid());
+}
+
+TEST_NS2(HashMap, HashMapTest, StringKey)
+{
+    HashMap<String<char>, uint32> test1;
+    ASSERT_TRUE(test1.add(String<char>("first"), 1_ui32));
+    ASSERT_TRUE(test1.add(String<char>("second"), 2_ui32));
+    ASSERT_TRUE(test1.add(String<char>("third"), 3_ui32));
+    ASSERT_EQ(test1.getLength(), 3);
+
+    // Lookup using both strings and raw character sequences
+    ASSERT_EQ(test1.at(String<char>("first")), 1);
+    ASSERT_EQ(*test1.find("second"), 2);
+    ASSERT_TRUE(test1.contains("third"));
+    ASSERT_FALSE(test1.contains("fourth"));
+
+    ASSERT_TRUE(test1.remove("second"));
+    ASSERT_FALSE(test1.contains("second"));
+    ASSERT_EQ(test1.getLength(), 2);
+}
+
+#endif
@@ -0,0 +1,205 @@
+/**
+ * Copyright Matthew Oliver
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifdef XSTESTMAIN
+#    include "Memory/XSNumberFormat.hpp"
+#    include "Memory/XSNumberParse.hpp"
+#    include "Memory/XSString.hpp"
+
+#    include "XSGTest.hpp"
+
+#    include <cfloat>
+#    include <cmath>
+#    include <cstring>
+
+using namespace Shift;
+
+template<typename T>
+class NumberFormatTest : public ::testing::Test
+{
+public:
+    using Type = T;
+
+    /**
+     * Format a number into a string of the tests character type.
+     * @tparam T2 Type of number to format.
+     * @param number The number to format.
+     * @returns The formatted string.
+     */
+    template<typename T2>
+    static String<T> format(const T2 number)
+    {
+        T buffer[numberFormatLength<T2>];
+        const uint0 length = formatNumber(number, buffer);
+        EXPECT_LE(length, numberFormatLength<T2>);
+        return String<T>(buffer, length);
+    }
+
+    /**
+     * Check that a formatted number parses back to exactly the same value.
+     * @tparam T2 Type of number to format.
+     * @param number The number to check.
+     * @returns True if the number round trips.
+     */
+    template<typename T2>
+    static bool roundTrip(const T2 number)
+    {
+        const String<T> string = format(number);
+        const NumberParse<T2> parse = parseNumber<T2>(string.getData(), string.getLength());
+        return parse.isValid() && parse.length == string.getLength() &&
+            memcmp(&parse.value, &number, sizeof(T2)) == 0;
+    }
+};
+
+using NumberFormatTestTypes = ::testing::Types<char, char8, char16, char32>;
+
+class NumberFormatTestNames
+{
+public:
+    template<typename T>
+    static std::string GetName(int)
+    {
+        if (std::is_same<T, char>()) {
+            return "char";
+        }
+        if (std::is_same<T, char8>()) {
+            return "char8";
+        }
+        if (std::is_same<T, char16>()) {
+            return "char16";
+        }
+        if (std::is_same<T, char32>()) {
+            return "char32";
+        }
+        return "def";
+    }
+};
+
+TYPED_TEST_SUITE(NumberFormatTest, NumberFormatTestTypes, NumberFormatTestNames);
+
+TYPED_TEST_NS2(NumberFormat, NumberFormatTest, Integer)
+{
+    using TestType = typename TestFixture::Type;
+
+    ASSERT_EQ(TestFixture::format(0_ui32), String<TestType>("0"));
+    ASSERT_EQ(TestFixture::format(static_cast<uint8>(255)), String<TestType>("255"));
+    ASSERT_EQ(TestFixture::format(static_cast<int8>(-128)), String<TestType>("-128"));
+    ASSERT_EQ(TestFixture::format(static_cast<int16>(-32768)), String<TestType>("-32768"));
+    ASSERT_EQ(TestFixture::format(9_ui32), String<TestType>("9"));
+    ASSERT_EQ(TestFixture::format(10_ui32), String<TestType>("10"));
+    ASSERT_EQ(TestFixture::format(99_ui32), String<TestType>("99"));
+    ASSERT_EQ(TestFixture::format(100_ui32), String<TestType>("100"));
+    ASSERT_EQ(TestFixture::format(4294967295_ui32), String<TestType>("4294967295"));
+    ASSERT_EQ(TestFixture::format(-2147483647_i32 - 1), String<TestType>("-2147483648"));
+    ASSERT_EQ(TestFixture::format(4294967296_ui64), String<TestType>("4294967296"));
+    ASSERT_EQ(TestFixture::format(18446744073709551615_ui64), String<TestType>("18446744073709551615"));
+    ASSERT_EQ(TestFixture::format(-9223372036854775807_i64 - 1), String<TestType>("-9223372036854775808"));
+
+    // Check every length boundary
+    uint64 power = 1;
+    for (uint32 i = 1; i < 20; ++i) {
+        power *= 10;
+        ASSERT_EQ(TestFixture::format(power - 1).getLength(), i);
+        ASSERT_EQ(TestFixture::format(power).getLength(), i + 1);
+    }
+}
+
+TYPED_TEST_NS2(NumberFormat, NumberFormatTest, Integer128)
+{
+    using TestType = typename TestFixture::Type;
+
+    ASSERT_EQ(TestFixture::format(UInt128(0_ui64, 12345_ui64)), String<TestType>("12345"));
+    ASSERT_EQ(TestFixture::format(UInt128(1_ui64, 0_ui64)), String<TestType>("18446744073709551616"));
+    ASSERT_EQ(TestFixture::format(UInt128(0xFFFFFFFFFFFFFFFF_ui64, 0xFFFFFFFFFFFFFFFF_ui64)),
+        String<TestType>("340282366920938463463374607431768211455"));
+    ASSERT_EQ(TestFixture::format(UInt128(0x0000000000000005_ui64, 0x6BC75E2D63100000_ui64)),
+        String<TestType>("100000000000000000000"));
+    ASSERT_EQ(TestFixture::format(Int128(-1_i64, 0xFFFFFFFFFFFFFFFF_ui64)), String<TestType>("-1"));
+    ASSERT_EQ(TestFixture::format(Int128(-1_i64, 0_ui64)), String<TestType>("-18446744073709551616"));
+    ASSERT_EQ(TestFixture::format(Int128(0x7FFFFFFFFFFFFFFF_i64, 0xFFFFFFFFFFFFFFFF_ui64)),
+        String<TestType>("170141183460469231731687303715884105727"));
+    ASSERT_EQ(TestFixture::format(Int128(static_cast<int64>(0x8000000000000000_ui64), 0_ui64)),
+        String<TestType>("-170141183460469231731687303715884105728"));
+}
+
+TYPED_TEST_NS2(NumberFormat, NumberFormatTest, Float)
+{
+    using TestType = typename TestFixture::Type;
+
+    ASSERT_EQ(TestFixture::format(0.0), String<TestType>("0.0"));
+    ASSERT_EQ(TestFixture::format(-0.0f), String<TestType>("-0.0"));
+    ASSERT_EQ(TestFixture::format(1.0), String<TestType>("1.0"));
+    ASSERT_EQ(TestFixture::format(0.3), String<TestType>("3.0e-001"));
+    ASSERT_EQ(TestFixture::format(0.3f), String<TestType>("3.0e-01"));
+    ASSERT_EQ(TestFixture::format(0.1 + 0.2), String<TestType>("3.0000000000000004e-001"));
+    ASSERT_EQ(TestFixture::format(451258.03125f), String<TestType>("451258.03"));
+    ASSERT_EQ(TestFixture::format(451258.03125), String<TestType>("451258.03125"));
+    ASSERT_EQ(TestFixture::format(-9784531246597.0), String<TestType>("-9784531246597.0"));
+    ASSERT_EQ(TestFixture::format(123456789.0f), String<TestType>("123456790.0"));
+    ASSERT_EQ(TestFixture::format(1e9f), String<TestType>("1.0e09"));
+    ASSERT_EQ(TestFixture::format(1e16), String<TestType>("10000000000000000.0"));
+    ASSERT_EQ(TestFixture::format(1e17), String<TestType>("1.0e017"));
+    ASSERT_EQ(TestFixture::format(1e23), String<TestType>("1.0e023"));
+    ASSERT_EQ(TestFixture::format(DBL_MAX), String<TestType>("1.7976931348623157e308"));
+    ASSERT_EQ(TestFixture::format(DBL_MIN), String<TestType>("2.2250738585072014e-308"));
+    ASSERT_EQ(TestFixture::format(4.9406564584124654e-324), String<TestType>("5.0e-324"));
+    ASSERT_EQ(TestFixture::format(4.9406564584124654e-323), String<TestType>("5.0e-323"));
+    ASSERT_EQ(TestFixture::format(FLT_MAX), String<TestType>("3.4028235e38"));
+    ASSERT_EQ(TestFixture::format(FLT_MIN), String<TestType>("1.1754944e-38"));
+    ASSERT_EQ(TestFixture::format(1.4e-45f), String<TestType>("1.0e-45"));
+    ASSERT_EQ(TestFixture::format(INFINITY), String<TestType>("inf"));
+    ASSERT_EQ(TestFixture::format(-static_cast<float64>(INFINITY)), String<TestType>("-inf"));
+    ASSERT_EQ(TestFixture::format(static_cast<float64>(NAN)), String<TestType>("nan"));
+}
+
+TYPED_TEST_NS2(NumberFormat, NumberFormatTest, FloatRoundTrip)
+{
+    // Powers of 2 have an asymmetric rounding interval
+    for (int32 i = -1074; i < 1024; ++i) {
+        ASSERT_TRUE(TestFixture::roundTrip(std::ldexp(1.0, i)));
+    }
+    for (int32 i = -149; i < 128; ++i) {
+        ASSERT_TRUE(TestFixture::roundTrip(std::ldexp(1.0f, i)));
+    }
+    // Walk through the bit patterns with a step that covers every exponent
+    for (uint64 bits = 1; bits < 0x7FF0000000000000_ui64; bits += 0x0000F123456789AB_ui64) {
+        float64 value;
+        memcpy(&value, &bits, sizeof(float64));
+        ASSERT_TRUE(TestFixture::roundTrip(value));
+        ASSERT_TRUE(TestFixture::roundTrip(-value));
+    }
+    for (uint32 bits = 1; bits < 0x7F800000_ui32; bits += 0x00001235_ui32) {
+        float32 value;
+        memcpy(&value, &bits, sizeof(float32));
+        ASSERT_TRUE(TestFixture::roundTrip(value));
+    }
+}
+
+TYPED_TEST_NS2(NumberFormat, NumberFormatTest, String)
+{
+    using TestType = typename TestFixture::Type;
+
+    String<TestType> test1 = String<TestType>("value=", 6);
+    ASSERT_TRUE(test1.appendNumber(-42_i32));
+    ASSERT_TRUE(test1.add(TestType(',')));
+    ASSERT_TRUE(test1.appendNumber(0.5));
+    ASSERT_EQ(test1, String<TestType>("value=-42,5.0e-001"));
+
+    ASSERT_EQ(toString<TestType>(UInt128(1_ui64, 0_ui64)), String<TestType>("18446744073709551616"));
+    ASSERT_EQ(toString<TestType>(2.5f), String<TestType>("2.5"));
+    ASSERT_EQ(toString(12345_ui64), String<char>("12345"));
+}
+#endif
@@ -0,0 +1,221 @@
+/**
+ * Copyright Matthew Oliver
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifdef XSTESTMAIN
+#    include "Memory/XSNumberParse.hpp"
+#    include "Memory/XSString.hpp"
+
+#    include "XSGTest.hpp"
+
+#    include <cfloat>
+#    include <cmath>
+
+using namespace Shift;
+
+template<typename T>
+class NumberParseTest : public ::testing::Test
+{
+public:
+    using Type = T;
+
+    /**
+     * Parse a number from an ASCII string converted to the tests character type.
+     * @tparam T2 Type of number to parse.
+     * @param string The string to parse.
+     * @returns The result of the parse.
+     */
+    template<typename T2>
+    static NumberParse<T2> parse(const char* string)
+    {
+        const String<T> test(string);
+        return parseNumber<T2>(test.getData(), test.getLength());
+    }
+};
+
+using NumberParseTestTypes = ::testing::Types<char, char8, char16, char32>;
+
+class NumberParseTestNames
+{
+public:
+    template<typename T>
+    static std::string GetName(int)
+    {
+        if (std::is_same<T, char>()) {
+            return "char";
+        }
+        if (std::is_same<T, char8>()) {
+            return "char8";
+        }
+        if (std::is_same<T, char16>()) {
+            return "char16";
+        }
+        if (std::is_same<T, char32>()) {
+            return "char32";
+        }
+        return "def";
+    }
+};
+
+TYPED_TEST_SUITE(NumberParseTest, NumberParseTestTypes, NumberParseTestNames);
+
+TYPED_TEST_NS2(NumberParse, NumberParseTest, Integer)
+{
+    const auto test1 = TestFixture::template parse<uint64>("12345678901234567890");
+    ASSERT_TRUE(test1.isValid());
+    ASSERT_EQ(test1.value, 12345678901234567890_ui64);
+    ASSERT_EQ(test1.length, 20);
+
+    const auto test2 = TestFixture::template parse<int32>("-2147483648 and more");
+    ASSERT_TRUE(test2.isValid());
+    ASSERT_EQ(test2.value, -2147483647 - 1);
+    ASSERT_EQ(test2.length, 11);
+
+    const auto test3 = TestFixture::template parse<uint8>("+000000000000000000000000000042");
+    ASSERT_TRUE(test3.isValid());
+    ASSERT_EQ(test3.value, 42);
+    ASSERT_EQ(test3.length, 31);
+
+    const auto test4 = TestFixture::template parse<int16>("1234x5678");
+    ASSERT_TRUE(test4.isValid());
+    ASSERT_EQ(test4.value, 1234);
+    ASSERT_EQ(test4.length, 4);
+
+    // Invalid strings
+    ASSERT_EQ(TestFixture::template parse<int32>("").error, ParseError::Invalid);
+    ASSERT_EQ(TestFixture::template parse<int32>("-").error, ParseError::Invalid);
+    ASSERT_EQ(TestFixture::template parse<int32>("x12").error, ParseError::Invalid);
+    ASSERT_EQ(TestFixture::template parse<uint32>("-1").error, ParseError::Invalid);
+    ASSERT_EQ(TestFixture::template parse<uint32>("-1").length, 0);
+
+    // Out of range values are clamped
+    ASSERT_TRUE(TestFixture::template parse<int8>("127").isValid());
+    ASSERT_TRUE(TestFixture::template parse<int8>("-128").isValid());
+    ASSERT_EQ(TestFixture::template parse<int8>("128").error, ParseError::Range);
+    ASSERT_EQ(TestFixture::template parse<int8>("128").value, 127);
+    ASSERT_EQ(TestFixture::template parse<int8>("-129").value, -128);
+    ASSERT_EQ(TestFixture::template parse<uint64>("18446744073709551615").value, 0xFFFFFFFFFFFFFFFF_ui64);
+    ASSERT_EQ(TestFixture::template parse<uint64>("18446744073709551616").error, ParseError::Range);
+    ASSERT_EQ(TestFixture::template parse<uint64>("88786976294838206464").error, ParseError::Range);
+    ASSERT_EQ(TestFixture::template parse<int64>("-9223372036854775808").value, -9223372036854775807_i64 - 1);
+    ASSERT_EQ(TestFixture::template parse<int64>("9223372036854775808").value, 9223372036854775807_i64);
+    const auto test5 = TestFixture::template parse<int64>("-123456789012345678901234567890123456789012345");
+    ASSERT_EQ(test5.error, ParseError::Range);
+    ASSERT_EQ(test5.value, -9223372036854775807_i64 - 1);
+    ASSERT_EQ(test5.length, 46);
+}
+
+TYPED_TEST_NS2(NumberParse, NumberParseTest, Integer128)
+{
+    const auto test1 = TestFixture::template parse<UInt128>("123456789012345678901234567890");
+    ASSERT_TRUE(test1.isValid());
+    ASSERT_TRUE(test1.value == UInt128(0x18EE90FF6_ui64, 0xC373E0EE4E3F0AD2_ui64));
+
+    const auto test2 = TestFixture::template parse<UInt128>("340282366920938463463374607431768211455");
+    ASSERT_TRUE(test2.isValid());
+    ASSERT_TRUE(test2.value == UInt128(0xFFFFFFFFFFFFFFFF_ui64, 0xFFFFFFFFFFFFFFFF_ui64));
+    ASSERT_EQ(TestFixture::template parse<UInt128>("340282366920938463463374607431768211456").error, ParseError::Range);
+
+    const auto test3 = TestFixture::template parse<Int128>("-170141183460469231731687303715884105728");
+    ASSERT_TRUE(test3.isValid());
+    ASSERT_TRUE(test3.value == Int128(-9223372036854775807_i64 - 1, 0_ui64));
+
+    const auto test4 = TestFixture::template parse<Int128>("170141183460469231731687303715884105728");
+    ASSERT_EQ(test4.error, ParseError::Range);
+    ASSERT_TRUE(test4.value == Int128(9223372036854775807_i64, 0xFFFFFFFFFFFFFFFF_ui64));
+
+    const auto test5 = TestFixture::template parse<Int128>("-42");
+    ASSERT_TRUE(test5.isValid());
+    ASSERT_TRUE(test5.value == Int128(-1_i64, 0xFFFFFFFFFFFFFFD6_ui64));
+}
+
+TYPED_TEST_NS2(NumberParse, NumberParseTest, Float)
+{
+    const auto test1 = TestFixture::template parse<float64>("-875421.0003215468975");
+    ASSERT_TRUE(test1.isValid());
+    ASSERT_EQ(test1.value, -875421.0003215468975);
+    ASSERT_EQ(test1.length, 21);
+
+    const auto test2 = TestFixture::template parse<float32>("451258.32658741xyz");
+    ASSERT_TRUE(test2.isValid());
+    ASSERT_EQ(test2.value, 451258.32658741f);
+    ASSERT_EQ(test2.length, 15);
+
+    ASSERT_EQ(TestFixture::template parse<float64>("0.1").value, 0.1);
+    ASSERT_EQ(TestFixture::template parse<float64>("1e23").value, 1e23);
+    ASSERT_EQ(TestFixture::template parse<float64>("1.5E-3").value, 1.5e-3);
+    ASSERT_EQ(TestFixture::template parse<float64>(".5").value, 0.5);
+    ASSERT_EQ(TestFixture::template parse<float64>("5.").length, 2);
+    ASSERT_EQ(TestFixture::template parse<float64>("1.25e").length, 4);
+    ASSERT_EQ(TestFixture::template parse<float64>("1.25e+x").length, 4);
+    ASSERT_EQ(TestFixture::template parse<float64>("0.000000000000000000000000000001234567890123456789").value,
+        1.234567890123456789e-30);
+    ASSERT_EQ(TestFixture::template parse<float64>("1.7976931348623157e308").value, DBL_MAX);
+    ASSERT_EQ(TestFixture::template parse<float64>("4.9406564584124654e-324").value, 4.9406564584124654e-324);
+    ASSERT_EQ(TestFixture::template parse<float64>("2.2250738585072011e-308").value, 2.2250738585072011e-308);
+    ASSERT_EQ(TestFixture::template parse<float32>("3.4028235e38").value, FLT_MAX);
+    ASSERT_EQ(TestFixture::template parse<float32>("1.401298464324817e-45").value, 1.401298464324817e-45f);
+
+    // Out of range values
+    const auto test3 = TestFixture::template parse<float64>("-2e308");
+    ASSERT_EQ(test3.error, ParseError::Range);
+    ASSERT_EQ(test3.value, -HUGE_VAL);
+    ASSERT_EQ(TestFixture::template parse<float64>("1e-400").error, ParseError::Range);
+    ASSERT_EQ(TestFixture::template parse<float32>("3.5e38").value, HUGE_VALF);
+    ASSERT_EQ(TestFixture::template parse<float32>("1e-46").value, 0.0f);
+    ASSERT_TRUE(TestFixture::template parse<float64>("0e999999999999").isValid());
+
+    // Special values
+    ASSERT_EQ(TestFixture::template parse<float64>("inf").value, HUGE_VAL);
+    ASSERT_EQ(TestFixture::template parse<float64>("-Infinity").value, -HUGE_VAL);
+    ASSERT_EQ(TestFixture::template parse<float64>("INFINIT").length, 3);
+    ASSERT_TRUE(std::isnan(TestFixture::template parse<float32>("NaN").value));
+    ASSERT_EQ(TestFixture::template parse<float64>(".").error, ParseError::Invalid);
+    ASSERT_EQ(TestFixture::template parse<float64>("-e5").error, ParseError::Invalid);
+    ASSERT_EQ(TestFixture::template parse<float64>("in").error, ParseError::Invalid);
+}
+
+TYPED_TEST_NS2(NumberParse, NumberParseTest, FloatRounding)
+{
+    // Values exactly halfway between 2 floats round to even
+    ASSERT_EQ(TestFixture::template parse<float64>("9007199254740993").value, 9007199254740992.0);
+    ASSERT_EQ(TestFixture::template parse<float64>("9007199254740995").value, 9007199254740996.0);
+    ASSERT_EQ(TestFixture::template parse<float32>("16777217").value, 16777216.0f);
+
+    // Digits past the first 19 affect rounding
+    ASSERT_EQ(TestFixture::template parse<float64>("9007199254740993.0000000000000000001").value, 9007199254740994.0);
+    ASSERT_EQ(TestFixture::template parse<float64>("9007199254740992.9999999999999999999").value, 9007199254740992.0);
+    ASSERT_EQ(TestFixture::template parse<float32>("16777217.000000000000000000001").value, 16777218.0f);
+
+    // Exact halfway point between 0 and the smallest subnormal
+#    define HALFWAY_DIGITS                                                                                     \
+        "2.47032822920623272088284396434110686182529901307162382212792841250337753635104375932649918180817996" \
+        "1898982823477228588654633283551779698981993873980053909390631503565951557022639229085839244910518443" \
+        "5931802849936536152500319370457678249219365623669863658480757001585769269903706311928279558551332927" \
+        "8343384093519780155312465972635795746227664652728272200563740064854999770965994704540208281662262378" \
+        "5739345073633900796776193057750674017632467360096895134053553745851666113422376667860416215968046191" \
+        "4467291840300530057530849048765391711386591646239524912623653881879636239373280423891018672348497668" \
+        "2350898633885879256283027559956575244555072551893136908362547791869486679949683240497058210285131854" \
+        "51396213837722826145437693412532098591327667236328125"
+    const auto test1 = TestFixture::template parse<float64>(HALFWAY_DIGITS "e-324");
+    ASSERT_EQ(test1.value, 0.0);
+    ASSERT_EQ(test1.error, ParseError::Range);
+    ASSERT_EQ(TestFixture::template parse<float64>(HALFWAY_DIGITS "1e-324").value, 4.9406564584124654e-324);
+    ASSERT_EQ(TestFixture::template parse<float64>(HALFWAY_DIGITS "0000000000e-324").value, 0.0);
+    ASSERT_EQ(TestFixture::template parse<float64>(HALFWAY_DIGITS "000000000000000000000000000001e-324").value,
+        4.9406564584124654e-324);
+#    undef HALFWAY_DIGITS
+}
+#endif
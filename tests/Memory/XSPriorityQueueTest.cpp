@@ -0,0 +1,154 @@
+/**
+ * Copyright Matthew Oliver
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifdef XSTESTMAIN
+
+#    include "Memory/XSPriorityQueue.hpp"
+
+#    include "XSGTest.hpp"
+
+using namespace Shift;
+
+template<typename T>
+class PriorityQueueTest : public ::testing::Test
+{
+public:
+    using Type = T;
+};
+
+using PriorityQueueTestTypes = ::testing::Types<uint32, int32, float32, uint64, float64>;
+
+class PriorityQueueTestNames
+{
+public:
+    template<typename T>
+    static std::string GetName(int)
+    {
+        if (std::is_same<T, uint32>()) {
+            return "uint32";
+        }
+        if (std::is_same<T, int32>()) {
+            return "int32";
+        }
+        if (std::is_same<T, float32>()) {
+            return "float32";
+        }
+        if (std::is_same<T, uint64>()) {
+            return "uint64";
+        }
+        if (std::is_same<T, float64>()) {
+            return "float64";
+        }
+        return "def";
+    }
+};
+
+TYPED_TEST_SUITE(PriorityQueueTest, PriorityQueueTestTypes, PriorityQueueTestNames);
+
+TYPED_TEST_NS2(PriorityQueue, PriorityQueueTest, AddRemove)
+{
+    using TestType = typename TestFixture::Type;
+    PriorityQueue<TestType> test1;
+    ASSERT_TRUE(test1.isEmpty());
+
+    // Add values in a scrambled order with duplicates
+    for (uint32 i = 0; i < 200; ++i) {
+        ASSERT_TRUE(test1.add(static_cast<TestType>((i * 37) % 101)));
+    }
+    ASSERT_EQ(test1.getLength(), 200);
+    TestType previous = test1.pop();
+    while (!test1.isEmpty()) {
+        ASSERT_LE(previous, test1.getTop());
+        previous = test1.pop();
+    }
+    ASSERT_EQ(previous, static_cast<TestType>(100));
+
+    // Highest first using an 8-ary heap
+    PriorityQueue<TestType, Greater<TestType>, AllocRegionHeap<TestType>, 8> test2;
+    for (uint32 i = 0; i < 199; ++i) {
+        ASSERT_TRUE(test2.add(static_cast<TestType>((i * 53) % 199)));
+    }
+    for (uint32 i = 0; i < 199; ++i) {
+        ASSERT_EQ(test2.getTop(), static_cast<TestType>(198 - i));
+        test2.removeTop();
+    }
+    ASSERT_TRUE(test2.isEmpty());
+}
+
+TYPED_TEST_NS2(PriorityQueue, PriorityQueueTest, Heapify)
+{
+    using TestType = typename TestFixture::Type;
+    DArray<TestType> array(300);
+    for (uint32 i = 0; i < 300; ++i) {
+        array.add(static_cast<TestType>((i * 71) % 300));
+    }
+    PriorityQueue<TestType> test1(array);
+    ASSERT_EQ(test1.getLength(), 300);
+
+    // Bulk add into an existing queue
+    ASSERT_TRUE(test1.add(array));
+    ASSERT_TRUE(test1.add(array.getData(), 10));
+    ASSERT_EQ(test1.getLength(), 610);
+    ASSERT_EQ(test1.pop(), static_cast<TestType>(0));
+    ASSERT_EQ(test1.pop(), static_cast<TestType>(0));
+    ASSERT_EQ(test1.pop(), static_cast<TestType>(0));
+    TestType previous = test1.pop();
+    ASSERT_EQ(previous, static_cast<TestType>(1));
+    while (!test1.isEmpty()) {
+        ASSERT_LE(previous, test1.getTop());
+        previous = test1.pop();
+    }
+    ASSERT_EQ(previous, static_cast<TestType>(299));
+}
+
+TYPED_TEST_NS2(PriorityQueue, PriorityQueueTest, Indexed)
+{
+    using TestType = typename TestFixture::Type;
+    IndexedPriorityQueue<TestType> test1;
+    for (uint32 i = 0; i < 100; ++i) {
+        ASSERT_TRUE(test1.add(i, static_cast<TestType>(1000 - i)));
+    }
+    ASSERT_TRUE(test1.contains(50));
+    ASSERT_FALSE(test1.contains(100));
+    ASSERT_EQ(test1.getTopIndex(), 99);
+
+    // Decrease key of a deep element to move it to the top
+    test1.decreaseKey(3, static_cast<TestType>(5));
+    ASSERT_EQ(test1.getTopIndex(), 3);
+    ASSERT_EQ(test1.getTop(), static_cast<TestType>(5));
+
+    // Increase key to move it back down
+    test1.update(3, static_cast<TestType>(2000));
+    ASSERT_EQ(test1.getTopIndex(), 99);
+    ASSERT_EQ(test1.getKey(3), static_cast<TestType>(2000));
+
+    ASSERT_TRUE(test1.remove(60));
+    ASSERT_FALSE(test1.remove(60));
+    ASSERT_FALSE(test1.contains(60));
+    ASSERT_EQ(test1.getLength(), 99);
+
+    TestType previous = test1.getTop();
+    while (!test1.isEmpty()) {
+        ASSERT_LE(previous, test1.getTop());
+        previous = test1.getTop();
+        const uint32 index = test1.getTopIndex();
+        test1.removeTop();
+        ASSERT_FALSE(test1.contains(index));
+    }
+    ASSERT_EQ(previous, static_cast<TestType>(2000));
+}
+
+#endif
@@ -0,0 +1,198 @@
+/**
+ * Copyright Matthew Oliver
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifdef XSTESTMAIN
+
+#    include "Memory/XSAllocatorStack.hpp"
+#    include "Memory/XSRingBuffer.hpp"
+#    include "Memory/XSString.hpp"
+
+#    include "XSGTest.hpp"
+
+using namespace Shift;
+
+template<typename T>
+class RingBufferTest : public ::testing::Test
+{
+public:
+    using Type = T;
+};
+
+using RingBufferTestTypes = ::testing::Types<uint8, uint32, uint64, float32, float64>;
+
+class RingBufferTestNames
+{
+public:
+    template<typename T>
+    static std::string GetName(int)
+    {
+        if (std::is_same<T, uint8>()) {
+            return "uint8";
+        }
+        if (std::is_same<T, uint32>()) {
+            return "uint32";
+        }
+        if (std::is_same<T, uint64>()) {
+            return "uint64";
+        }
+        if (std::is_same<T, float32>()) {
+            return "float32";
+        }
+        if (std::is_same<T, float64>()) {
+            return "float64";
+        }
+        return "def";
+    }
+};
+
+TYPED_TEST_SUITE(RingBufferTest, RingBufferTestTypes, RingBufferTestNames);
+
+TYPED_TEST_NS2(RingBuffer, RingBufferTest, Constructor)
+{
+    using TestType = typename TestFixture::Type;
+
+    RingBuffer<TestType> test1;
+    ASSERT_FALSE(test1.isValid());
+    ASSERT_TRUE(test1.isEmpty());
+    ASSERT_FALSE(test1.pushBack(static_cast<TestType>(1)));
+
+    RingBuffer<TestType> test2(100);
+    ASSERT_TRUE(test2.isValid());
+    ASSERT_EQ(test2.getReservedLength(), 128);
+    ASSERT_EQ(test2.getLength(), 0);
+
+    RingBuffer<TestType, AllocRegionStack<TestType, 16>> test3;
+    ASSERT_TRUE(test3.isValid());
+    ASSERT_EQ(test3.getReservedLength(), 16);
+}
+
+TYPED_TEST_NS2(RingBuffer, RingBufferTest, PushPop)
+{
+    using TestType = typename TestFixture::Type;
+    RingBuffer<TestType> test1(8);
+
+    // Cycle through the buffer several times so that it wraps
+    uint32 next = 0;
+    uint32 expected = 0;
+    for (uint32 i = 0; i < 5; ++i) {
+        while (!test1.isFull()) {
+            ASSERT_TRUE(test1.pushBack(static_cast<TestType>(next++)));
+        }
+        ASSERT_FALSE(test1.pushBack(static_cast<TestType>(next)));
+        for (uint32 j = 0; j < 5; ++j) {
+            TestType value;
+            ASSERT_TRUE(test1.popFront(value));
+            ASSERT_EQ(value, static_cast<TestType>(expected++));
+        }
+    }
+    ASSERT_EQ(test1.getLength(), 3);
+    ASSERT_EQ(test1.atBegin(), static_cast<TestType>(expected));
+    ASSERT_EQ(test1.atBack(), static_cast<TestType>(next - 1));
+
+    // Add and remove from the opposite ends
+    ASSERT_TRUE(test1.pushFront(static_cast<TestType>(100)));
+    ASSERT_EQ(test1.at(0), static_cast<TestType>(100));
+    ASSERT_EQ(test1.at(1), static_cast<TestType>(expected));
+    TestType value;
+    ASSERT_TRUE(test1.popBack(value));
+    ASSERT_EQ(value, static_cast<TestType>(next - 1));
+    ASSERT_EQ(test1.getLength(), 3);
+
+    test1.removeFront();
+    test1.removeBack(2);
+    ASSERT_TRUE(test1.isEmpty());
+    ASSERT_FALSE(test1.popFront(value));
+    ASSERT_FALSE(test1.popBack(value));
+}
+
+TYPED_TEST_NS2(RingBuffer, RingBufferTest, Bulk)
+{
+    using TestType = typename TestFixture::Type;
+    RingBuffer<TestType> test1(16);
+
+    TestType values[16]; // NOLINT(modernize-avoid-c-arrays)
+    for (uint32 i = 0; i < 16; ++i) {
+        values[i] = static_cast<TestType>(i);
+    }
+
+    // Move the start so that bulk operations must wrap
+    ASSERT_TRUE(test1.pushBack(values, 10));
+    TestType results[16]; // NOLINT(modernize-avoid-c-arrays)
+    ASSERT_EQ(test1.popFront(results, 10), 10);
+    ASSERT_TRUE(test1.pushBack(values, 12));
+    ASSERT_FALSE(test1.pushBack(values, 5));
+    ASSERT_EQ(test1.getLength(), 12);
+
+    auto spans = test1.getSpans();
+    ASSERT_EQ(spans.first.length, 6);
+    ASSERT_EQ(spans.second.length, 6);
+    ASSERT_EQ(spans.first.pointer[0], static_cast<TestType>(0));
+    ASSERT_EQ(spans.second.pointer[0], static_cast<TestType>(6));
+
+    ASSERT_TRUE(test1.pushFront(values, 4));
+    ASSERT_TRUE(test1.isFull());
+    ASSERT_EQ(test1.popBack(results, 2), 2);
+    ASSERT_EQ(results[0], static_cast<TestType>(10));
+    ASSERT_EQ(results[1], static_cast<TestType>(11));
+    ASSERT_EQ(test1.popFront(results, 16), 14);
+    for (uint32 i = 0; i < 4; ++i) {
+        ASSERT_EQ(results[i], static_cast<TestType>(i));
+    }
+    for (uint32 i = 0; i < 10; ++i) {
+        ASSERT_EQ(results[i + 4], static_cast<TestType>(i));
+    }
+    ASSERT_TRUE(test1.isEmpty());
+
+    // Construct directly into the free space
+    test1.pushBack(values, 3);
+    auto freeSpans = test1.getFreeSpans();
+    ASSERT_EQ(freeSpans.first.length + freeSpans.second.length, 13);
+    freeSpans.first.pointer[0] = static_cast<TestType>(42);
+    test1.commitBack(1);
+    ASSERT_EQ(test1.atBack(), static_cast<TestType>(42));
+
+    // Check copy
+    RingBuffer<TestType> test2(test1);
+    ASSERT_EQ(test2.getLength(), 4);
+    ASSERT_EQ(test2.at(0), static_cast<TestType>(0));
+    ASSERT_EQ(test2.at(3), static_cast<TestType>(42));
+
+    ASSERT_TRUE(test2.setReservedLength(64));
+    ASSERT_EQ(test2.getReservedLength(), 64);
+    ASSERT_EQ(test2.at(3), static_cast<TestType>(42));
+
+    test1.removeAll();
+    ASSERT_TRUE(test1.isEmpty());
+    ASSERT_TRUE(test1.isValid());
+    test1.clear();
+    ASSERT_FALSE(test1.isValid());
+}
+
+TEST_NS2(RingBuffer, RingBufferTest, String)
+{
+    RingBuffer<String<char>> test1(4);
+    ASSERT_TRUE(test1.pushBack(String<char>("first")));
+    ASSERT_TRUE(test1.pushBack("second"));
+    ASSERT_TRUE(test1.pushFront(String<char>("zero")));
+    String<char> value;
+    ASSERT_TRUE(test1.popFront(value));
+    ASSERT_EQ(value, "zero");
+    ASSERT_TRUE(test1.popBack(value));
+    ASSERT_EQ(value, "second");
+    ASSERT_EQ(test1.getLength(), 1);
+}
+
+#endif
@@ -0,0 +1,120 @@
+/**
+ * Copyright Matthew Oliver
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifdef XSTESTMAIN
+
+#    include "Memory/XSSArrayIndex.hpp"
+
+#    include "XSGTest.hpp"
+
+using namespace Shift;
+
+template<typename T>
+class SArrayIndexTest : public ::testing::Test
+{
+public:
+    using Type = T;
+};
+
+using SArrayIndexTestTypes = ::testing::Types<uint8, int16, uint32, int32, uint64, int64, float32, float64>;
+
+class SArrayIndexTestNames
+{
+public:
+    template<typename T>
+    static std::string GetName(int)
+    {
+        if (std::is_same<T, uint8>()) {
+            return "uint8";
+        }
+        if (std::is_same<T, int16>()) {
+            return "int16";
+        }
+        if (std::is_same<T, uint32>()) {
+            return "uint32";
+        }
+        if (std::is_same<T, int32>()) {
+            return "int32";
+        }
+        if (std::is_same<T, uint64>()) {
+            return "uint64";
+        }
+        if (std::is_same<T, int64>()) {
+            return "int64";
+        }
+        if (std::is_same<T, float32>()) {
+            return "float32";
+        }
+        if (std::is_same<T, float64>()) {
+            return "float64";
+        }
+        return "def";
+    }
+};
+
+TYPED_TEST_SUITE(SArrayIndexTest, SArrayIndexTestTypes, SArrayIndexTestNames);
+
+TYPED_TEST_NS2(SArrayIndex, SArrayIndexTest, FindClosest)
+{
+    using TestType = typename TestFixture::Type;
+
+    // Use sizes that result in partially filled nodes and multiple tree layers
+    for (const uint32 number : {0_ui32, 1_ui32, 7_ui32, 64_ui32, 65_ui32, 1000_ui32, 5000_ui32}) {
+        SArray<TestType> test1(number);
+        for (uint32 i = 0; i < number; ++i) {
+            // Add some duplicates and let smaller types wrap
+            test1.add(static_cast<TestType>((i * 7) % 251));
+        }
+        SArrayIndex<TestType> index(test1);
+        ASSERT_EQ(index.getLength(), test1.getLength());
+
+        TestType values[260]; // NOLINT(modernize-avoid-c-arrays)
+        uint0 results[260];   // NOLINT(modernize-avoid-c-arrays)
+        for (uint32 i = 0; i < 260; ++i) {
+            values[i] = static_cast<TestType>(i);
+        }
+        index.findClosest(values, 260, results);
+        for (uint32 i = 0; i < 260; ++i) {
+            const uint0 expected = test1.findClosest(values[i]) - test1.begin();
+            ASSERT_EQ(index.findClosest(values[i]), expected);
+            ASSERT_EQ(results[i], expected);
+        }
+    }
+}
+
+TEST_NS2(SArrayIndex, SArrayIndexTest, Limits)
+{
+    SArray<float32> test1(100);
+    for (uint32 i = 0; i < 100; ++i) {
+        test1.add(static_cast<float32>(i) - 50.0f);
+    }
+    SArrayIndex<float32> index(test1);
+    ASSERT_EQ(index.findClosest(-1000.0f), 0);
+    ASSERT_EQ(index.findClosest(1000.0f), 100);
+    ASSERT_EQ(index.findClosest(Limits<float32>::Max()), 100);
+    ASSERT_EQ(index.findClosest(0.5f), 51);
+
+    SArray<uint32> test2(100);
+    for (uint32 i = 0; i < 100; ++i) {
+        test2.add(0xFFFFFF00_ui32 + i);
+    }
+    SArrayIndex<uint32> index2(test2);
+    ASSERT_EQ(index2.findClosest(0_ui32), 0);
+    ASSERT_EQ(index2.findClosest(0xFFFFFF10_ui32), 16);
+    ASSERT_EQ(index2.findClosest(0xFFFFFFFF_ui32), 100);
+}
+
+#endif
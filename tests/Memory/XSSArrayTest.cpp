@@ -192,4 +192,61 @@ TYPED_TEST_NS2(SArray, SArrayTest, AddElement)
     }
 }
 
+TYPED_TEST_NS2(SArray, SArrayTest, AddRange)
+{
+    using TestType = typename TestFixture::Type;
+    auto test1 = SArray<TestType>(24);
+
+    // Add initial sorted data that interleaves with the later ranges
+    const TestType sorted[4] = {TestType(1), TestType(5), TestType(9), TestType(13)}; // NOLINT(modernize-avoid-c-arrays)
+    ASSERT_TRUE(test1.addSorted(sorted, 4));
+    ASSERT_EQ(test1.getLength(), 4);
+
+    // Add unsorted data including a duplicate
+    const TestType unsorted[6] = {// NOLINT(modernize-avoid-c-arrays)
+        TestType(14), TestType(0), TestType(7), TestType(5), TestType(3), TestType(11)};
+    ASSERT_TRUE(test1.addRange(unsorted, 6));
+    ASSERT_EQ(test1.getLength(), 10);
+    const TestType expected[10] = {// NOLINT(modernize-avoid-c-arrays)
+        TestType(0), TestType(1), TestType(3), TestType(5), TestType(5), TestType(7), TestType(9), TestType(11),
+        TestType(13), TestType(14)};
+    for (uint0 i = 0; i < 10; ++i) {
+        ASSERT_EQ(test1.at(i), expected[i]);
+    }
+
+    // Add deferred elements which are merged on next search
+    test1.addDeferred(TestType(2));
+    test1.addDeferred(TestType(15));
+    test1.addDeferred(TestType(6));
+    ASSERT_EQ(test1.pending, 3);
+    ASSERT_EQ(*test1.findClosest(TestType(6)), TestType(6));
+    ASSERT_EQ(test1.pending, 0);
+    ASSERT_EQ(test1.getLength(), 13);
+    for (uint0 i = 1; i < test1.getLength(); ++i) {
+        ASSERT_FALSE(test1.at(i) < test1.at(i - 1));
+    }
+
+    // Deferred elements that already belong at the end
+    test1.addDeferred(TestType(17));
+    test1.addDeferred(TestType(16));
+    ASSERT_TRUE(test1.merge());
+    ASSERT_EQ(test1.atBack(), TestType(17));
+    ASSERT_EQ(test1.at(test1.getLength() - 2), TestType(16));
+
+    // Swapping keeps deferred elements with the array they were added to
+    auto test2 = SArray<TestType>(4);
+    test2.add(TestType(4));
+    test1.addDeferred(TestType(8));
+    test1.swap(test2);
+    ASSERT_EQ(test1.pending, 0);
+    ASSERT_EQ(test2.pending, 1);
+    ASSERT_EQ(test1.getLength(), 1);
+    ASSERT_EQ(test2.getLength(), 16);
+    ASSERT_TRUE(test2.merge());
+    ASSERT_EQ(*test2.findClosest(TestType(8)), TestType(8));
+    for (uint0 i = 1; i < test2.getLength(); ++i) {
+        ASSERT_FALSE(test2.at(i) < test2.at(i - 1));
+    }
+}
+
 #endif
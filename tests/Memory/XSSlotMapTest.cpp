@@ -0,0 +1,110 @@
+/**
+ * Copyright Matthew Oliver
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifdef XSTESTMAIN
+
+#    include "Memory/XSSlotMap.hpp"
+
+#    include "XSGTest.hpp"
+
+using namespace Shift;
+
+template<typename T>
+class SlotMapTest : public ::testing::Test
+{
+public:
+    using Type = T;
+};
+
+using SlotMapTestTypes = ::testing::Types<uint32, uint64>;
+
+class SlotMapTestNames
+{
+public:
+    template<typename T>
+    static std::string GetName(int)
+    {
+        if (std::is_same<T, uint32>()) {
+            return "uint32";
+        }
+        if (std::is_same<T, uint64>()) {
+            return "uint64";
+        }
+        return "def";
+    }
+};
+
+TYPED_TEST_SUITE(SlotMapTest, SlotMapTestTypes, SlotMapTestNames);
+
+TYPED_TEST_NS2(SlotMap, SlotMapTest, AddRemove)
+{
+    using TestType = SlotMap<uint32, AllocRegionHeap<uint32>, typename TestFixture::Type>;
+    using Key = typename TestType::Key;
+    TestType test1;
+    ASSERT_TRUE(test1.isEmpty());
+    ASSERT_FALSE(test1.isValid(Key()));
+
+    Key keys[100]; // NOLINT(modernize-avoid-c-arrays)
+    for (uint32 i = 0; i < 100; ++i) {
+        keys[i] = test1.add(i);
+        ASSERT_TRUE(keys[i].isValid());
+    }
+    ASSERT_EQ(test1.getLength(), 100);
+    for (uint32 i = 0; i < 100; ++i) {
+        ASSERT_TRUE(test1.isValid(keys[i]));
+        ASSERT_EQ(test1.at(keys[i]), i);
+    }
+
+    // Removing moves the last element into the hole but keys must still resolve
+    for (uint32 i = 0; i < 100; i += 2) {
+        ASSERT_TRUE(test1.remove(keys[i]));
+    }
+    ASSERT_EQ(test1.getLength(), 50);
+    for (uint32 i = 0; i < 100; ++i) {
+        if (i % 2 == 0) {
+            ASSERT_FALSE(test1.isValid(keys[i]));
+            ASSERT_EQ(test1.find(keys[i]), nullptr);
+            ASSERT_FALSE(test1.remove(keys[i]));
+        } else {
+            ASSERT_EQ(*test1.find(keys[i]), i);
+        }
+    }
+
+    // Dense elements must map back to their keys
+    for (uint0 i = 0; i < test1.getLength(); ++i) {
+        ASSERT_EQ(test1.at(test1.getKey(i)), test1.getData()[i]);
+    }
+
+    // Reused slots must not validate stale keys
+    const Key key = test1.add(1000);
+    ASSERT_EQ(key.getIndex(), keys[98].getIndex());
+    ASSERT_NE(key, keys[98]);
+    ASSERT_FALSE(test1.isValid(keys[98]));
+    ASSERT_EQ(test1.at(key), 1000);
+
+    TestType test2(test1);
+    test1.removeAll();
+    ASSERT_TRUE(test1.isEmpty());
+    ASSERT_FALSE(test1.isValid(key));
+    ASSERT_EQ(test2.at(key), 1000);
+    uint32 sum = 0;
+    for (const auto& i : test2) {
+        sum += i;
+    }
+    ASSERT_EQ(sum, 2500 + 1000);
+}
+
+#endif
@@ -0,0 +1,113 @@
+/**
+ * Copyright Matthew Oliver
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifdef XSTESTMAIN
+
+#    include "Memory/XSSoAArray.hpp"
+
+#    include "XSGTest.hpp"
+
+using namespace Shift;
+
+using SoAArrayTestType = SoAArray<float32, uint32, uint8>;
+
+TEST_NS2(SoAArray, SoAArrayTest, AddRemove)
+{
+    SoAArrayTestType test1;
+    ASSERT_FALSE(test1.isValid());
+    ASSERT_TRUE(test1.isEmpty());
+
+    // Grow several times so that the buffers are relocated
+    for (uint32 i = 0; i < 100; ++i) {
+        ASSERT_TRUE(test1.add(static_cast<float32>(i), i * 2, static_cast<uint8>(i)));
+    }
+    ASSERT_EQ(test1.getLength(), 100);
+    ASSERT_EQ(test1.getReservedLength() % SoAArrayTestType::blockPadding, 0);
+    for (uint32 i = 0; i < 100; ++i) {
+        ASSERT_EQ(test1.at<0>(i), static_cast<float32>(i));
+        ASSERT_EQ(test1.at<1>(i), i * 2);
+        ASSERT_EQ(test1.at<2>(i), static_cast<uint8>(i));
+    }
+
+    // Each field buffer must be aligned for SIMD access
+    ASSERT_EQ(reinterpret_cast<uint0>(test1.getData<0>()) % SoAArrayTestType::alignment, 0);
+    ASSERT_EQ(reinterpret_cast<uint0>(test1.getData<1>()) % SoAArrayTestType::alignment, 0);
+    ASSERT_EQ(reinterpret_cast<uint0>(test1.getData<2>()) % SoAArrayTestType::alignment, 0);
+
+    test1.remove(10);
+    test1.removeBack(9);
+    ASSERT_EQ(test1.getLength(), 90);
+    for (uint32 i = 0; i < 90; ++i) {
+        const uint32 value = i < 10 ? i : i + 1;
+        ASSERT_EQ(test1.at<0>(i), static_cast<float32>(value));
+        ASSERT_EQ(test1.at<1>(i), value * 2);
+        ASSERT_EQ(test1.at<2>(i), static_cast<uint8>(value));
+    }
+
+    SoAArrayTestType test2(test1);
+    ASSERT_TRUE(test1.setReservedLength(1000));
+    ASSERT_EQ(test1.getReservedLength(), 1008);
+    ASSERT_EQ(test2.getLength(), 90);
+    for (uint32 i = 0; i < 90; ++i) {
+        ASSERT_EQ(test1.at<1>(i), test2.at<1>(i));
+    }
+    ASSERT_TRUE(test1.setReservedLength(0));
+    ASSERT_EQ(test1.getReservedLength(), 96);
+
+    test2.removeAll();
+    ASSERT_TRUE(test2.isEmpty());
+    ASSERT_TRUE(test2.isValid());
+}
+
+TEST_NS2(SoAArray, SoAArrayTest, Blocks)
+{
+    SoAArrayTestType test1(37);
+    for (uint32 i = 0; i < 37; ++i) {
+        test1.addUnChecked(static_cast<float32>(i), i, 1);
+    }
+    ASSERT_EQ(test1.getBlockCount<4>(), 10);
+    ASSERT_EQ(test1.getBlockCount<8>(), 5);
+    ASSERT_EQ(test1.getBlockCount<16>(), 3);
+    ASSERT_EQ(test1.getBlockLength<4>(8), 4);
+    ASSERT_EQ(test1.getBlockLength<4>(9), 1);
+    ASSERT_EQ(test1.getBlockLength<16>(2), 5);
+
+    // Modify all elements a block at a time
+    for (uint0 i = 0; i < test1.getBlockCount<8>(); ++i) {
+        const auto block = test1.loadBlock<0, 8>(i);
+        test1.storeBlock<0, 8>(i, block + SIMD8<float32>(1.0f));
+    }
+    for (uint32 i = 0; i < 37; ++i) {
+        ASSERT_EQ(test1.at<0>(i), static_cast<float32>(i + 1));
+    }
+
+    // Tail lanes must be filled or masked out
+    float32 sum = 0.0f;
+    for (uint0 i = 0; i < test1.getBlockCount<16>(); ++i) {
+        const SIMD16Data<float32> data(test1.loadBlock<0, 16>(i, 0.0f));
+        const float32* values = &data.value0;
+        for (uint32 j = 0; j < 16; ++j) {
+            sum += values[j];
+        }
+    }
+    ASSERT_EQ(sum, 703.0f);
+    const auto mask = test1.getBlockMask<0, 4>(9);
+    const SIMD4Data<float32> data(SIMD4<float32>(-1.0f).blendVar(test1.loadBlock<0, 4>(9), mask));
+    ASSERT_EQ(data.value0, 37.0f);
+    ASSERT_EQ(data.value1, -1.0f);
+}
+
+#endif
@@ -0,0 +1,173 @@
+/**
+ * Copyright Matthew Oliver
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifdef XSTESTMAIN
+#    include "Memory/XSStringBuilder.hpp"
+
+#    include "XSGTest.hpp"
+
+using namespace Shift;
+
+template<typename T>
+class StringBuilderTest : public ::testing::Test
+{
+public:
+    using Type = T;
+};
+
+using StringBuilderTestTypes = ::testing::Types<char, char8, char16, char32>;
+
+class StringBuilderTestNames
+{
+public:
+    template<typename T>
+    static std::string GetName(int)
+    {
+        if (std::is_same<T, char>()) {
+            return "char";
+        }
+        if (std::is_same<T, char8>()) {
+            return "char8";
+        }
+        if (std::is_same<T, char16>()) {
+            return "char16";
+        }
+        if (std::is_same<T, char32>()) {
+            return "char32";
+        }
+        return "def";
+    }
+};
+
+TYPED_TEST_SUITE(StringBuilderTest, StringBuilderTestTypes, StringBuilderTestNames);
+
+TYPED_TEST_NS2(StringBuilder, StringBuilderTest, Add)
+{
+    using TestType = typename TestFixture::Type;
+
+    StringBuilder<TestType> test1;
+    ASSERT_TRUE(test1.isEmpty());
+    ASSERT_EQ(test1.toString(), String<TestType>());
+
+    const String<TestType> hello("Hello");
+    const String<TestType> world(" World");
+    ASSERT_TRUE(test1.add(hello));
+    ASSERT_TRUE(test1.add(StringView<TestType>(world.getData(), world.getLength())));
+    ASSERT_TRUE(test1.add(TestType(' ')));
+    ASSERT_TRUE(test1.add(-12));
+    ASSERT_TRUE(test1.add(TestType(' ')));
+    ASSERT_TRUE(test1.add(345_ui32));
+    test1 += world;
+    ASSERT_EQ(test1.getLength(), 25);
+    ASSERT_EQ(test1.toString(), String<TestType>("Hello World -12 345 World"));
+
+    // Add to the end of an existing string
+    String<TestType> test2(hello);
+    ASSERT_TRUE(test1.toString(test2));
+    ASSERT_EQ(test2, String<TestType>("HelloHello World -12 345 World"));
+
+    StringBuilder<TestType> test3(test1);
+    test1.removeAll();
+    ASSERT_TRUE(test1.isEmpty());
+    ASSERT_EQ(test3.toString(), String<TestType>("Hello World -12 345 World"));
+    test1 = move(test3);
+    ASSERT_EQ(test1.getLength(), 25);
+}
+
+TYPED_TEST_NS2(StringBuilder, StringBuilderTest, Chunks)
+{
+    using TestType = typename TestFixture::Type;
+
+    // Add enough characters to require several chunks
+    StringBuilder<TestType> test1;
+    String<TestType> test2;
+    for (uint32 i = 0; i < 1000; ++i) {
+        ASSERT_TRUE(test1.add(i));
+        ASSERT_TRUE(test1.add(TestType(',')));
+        ASSERT_TRUE(test2.add(i));
+        ASSERT_TRUE(test2.add(TestType(',')));
+    }
+    ASSERT_GT(test1.chunks.getLength(), 1);
+    ASSERT_EQ(test1.getLength(), test2.getLength());
+    const String<TestType> test3(test1.toString());
+    ASSERT_EQ(test3, test2);
+
+    // Clearing keeps the chunks so no new allocations are needed
+    const uint0 reserved = test1.getReservedLength();
+    const uint0 chunks = test1.chunks.getLength();
+    test1.removeAll();
+    ASSERT_EQ(test1.getReservedLength(), reserved);
+    for (uint32 i = 0; i < 1000; ++i) {
+        ASSERT_TRUE(test1.add(i));
+        ASSERT_TRUE(test1.add(TestType(',')));
+    }
+    ASSERT_EQ(test1.chunks.getLength(), chunks);
+    ASSERT_EQ(test1.toString(), test2);
+
+    // Large additions are split across chunks
+    StringBuilder<TestType> test4(4);
+    ASSERT_TRUE(test4.add(test2));
+    ASSERT_TRUE(test4.add(test2));
+    ASSERT_EQ(test4.toString(), test2 + test2);
+}
+
+TYPED_TEST_NS2(StringBuilder, StringBuilderTest, Concat)
+{
+    using TestType = typename TestFixture::Type;
+
+    const String<TestType> hello("Hello");
+    const String<TestType> space(" ");
+    const String<TestType> world("World");
+    const StringView<TestType> view(world.getData(), 3);
+
+    const auto test1 = concat(hello, space, world);
+    ASSERT_EQ(test1.getLength(), 11);
+    ASSERT_EQ(test1, String<TestType>("Hello World"));
+    ASSERT_NE(test1, String<TestType>("Hello Worlds"));
+    ASSERT_NE(test1, String<TestType>("Hello Wordl"));
+
+    const String<TestType> test2 = concat(hello, space, view) + space + world;
+    ASSERT_EQ(test2, String<TestType>("Hello Wor World"));
+
+    String<TestType> test3(hello);
+    test3 += concat(space, world);
+    ASSERT_EQ(test3, String<TestType>("Hello World"));
+    ASSERT_EQ(concat(hello, view).toString(), String<TestType>("HelloWor"));
+
+    StringBuilder<TestType> test4;
+    ASSERT_TRUE(test4.add(concat(hello, space, world)));
+    ASSERT_EQ(test4.toString(), String<TestType>("Hello World"));
+
+    // Operator+ creates a new string so the result does not reference its inputs
+    const auto test5 = hello + space + world;
+    ASSERT_EQ(test5, String<TestType>("Hello World"));
+
+    // Expressions that reference the string being added to must survive reallocation
+    String<TestType> test6(hello);
+    ASSERT_TRUE(test6.setReservedLength(test6.getLength()));
+    test6 += test6 + space;
+    ASSERT_EQ(test6, String<TestType>("HelloHello "));
+    ASSERT_TRUE(test6.setReservedLength(test6.getLength()));
+    test6 += concat(test6, space, test6);
+    ASSERT_EQ(test6, String<TestType>("HelloHello HelloHello  HelloHello "));
+    for (uint32 i = 0; i < 10; ++i) {
+        ASSERT_TRUE(test6.setReservedLength(test6.getLength()));
+        ASSERT_TRUE(test6.add(concat(world, test6)));
+    }
+    ASSERT_EQ(test6.getLength(), 39 * 1024 - 5);
+}
+
+#endif
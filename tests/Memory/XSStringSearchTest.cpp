@@ -0,0 +1,145 @@
+/**
+ * Copyright Matthew Oliver
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifdef XSTESTMAIN
+#    include "Memory/XSString.hpp"
+#    include "Memory/XSStringSearch.hpp"
+
+#    include "XSGTest.hpp"
+
+using namespace Shift;
+
+template<typename T>
+class StringSearchTest : public ::testing::Test
+{
+public:
+    using Type = T;
+};
+
+using StringSearchTestTypes = ::testing::Types<char, char8, char16, char32>;
+
+class StringSearchTestNames
+{
+public:
+    template<typename T>
+    static std::string GetName(int)
+    {
+        if (std::is_same<T, char>()) {
+            return "char";
+        }
+        if (std::is_same<T, char8>()) {
+            return "char8";
+        }
+        if (std::is_same<T, char16>()) {
+            return "char16";
+        }
+        if (std::is_same<T, char32>()) {
+            return "char32";
+        }
+        return "def";
+    }
+};
+
+TYPED_TEST_SUITE(StringSearchTest, StringSearchTestTypes, StringSearchTestNames);
+
+TYPED_TEST_NS2(StringSearch, StringSearchTest, Find)
+{
+    using TestType = typename TestFixture::Type;
+
+    const String<TestType> test1("The quick brown fox jumps over the lazy dog, the quick brown fox jumps again");
+    const String<TestType> test2("quick brown fox");
+    const StringSearch<TestType> search1(test2.getData(), test2.getLength());
+    ASSERT_FALSE(search1.isLong());
+    ASSERT_EQ(search1.findFirst(test1.getData(), test1.getLength()), 4);
+    ASSERT_EQ(search1.findLast(test1.getData(), test1.getLength()), 49);
+    ASSERT_EQ(search1.findFirst(test1.getData(), 18), UINT_MAX);
+    ASSERT_EQ(search1.findLast(test1.getData(), 63), 4);
+
+    // Needles at the very start and end as well as single characters
+    const String<TestType> test3("Th");
+    const StringSearch<TestType> search2(test3.getData(), test3.getLength());
+    ASSERT_EQ(search2.findFirst(test1.getData(), test1.getLength()), 0);
+    ASSERT_EQ(search2.findLast(test1.getData(), test1.getLength()), 0);
+    const String<TestType> test4("n");
+    const StringSearch<TestType> search3(test4.getData(), test4.getLength());
+    ASSERT_EQ(search3.findFirst(test1.getData(), test1.getLength()), 14);
+    ASSERT_EQ(search3.findLast(test1.getData(), test1.getLength()), 75);
+
+    // Empty needles and needles longer than the input are never found
+    const StringSearch<TestType> search4(test4.getData(), 0);
+    ASSERT_EQ(search4.findFirst(test1.getData(), test1.getLength()), UINT_MAX);
+    ASSERT_EQ(search4.findLast(test1.getData(), test1.getLength()), UINT_MAX);
+    ASSERT_EQ(search1.findFirst(test4.getData(), test4.getLength()), UINT_MAX);
+    ASSERT_EQ(search1.findLast(test4.getData(), test4.getLength()), UINT_MAX);
+}
+
+TYPED_TEST_NS2(StringSearch, StringSearchTest, FindLong)
+{
+    using TestType = typename TestFixture::Type;
+
+    const String<TestType> test1(
+        "Skip tables are used for long needles. The quick brown fox jumps over the lazy dog. Some filler text to skip. "
+        "The quick brown fox jumps over the lazy cat. The quick brown fox jumps over the lazy dog. Final text.");
+    const String<TestType> test2("The quick brown fox jumps over the lazy dog.");
+    const StringSearch<TestType> search1(test2.getData(), test2.getLength());
+    ASSERT_TRUE(search1.isLong());
+    ASSERT_EQ(search1.findFirst(test1.getData(), test1.getLength()), 39);
+    ASSERT_EQ(search1.findLast(test1.getData(), test1.getLength()), 155);
+    ASSERT_EQ(search1.findFirst(test1.getData() + 40, test1.getLength() - 40), 115);
+    ASSERT_EQ(search1.findLast(test1.getData(), 155), 39);
+    ASSERT_EQ(search1.findLast(test1.getData(), 82), UINT_MAX);
+
+    const String<TestType> test3("The quick brown fox jumps over the lazy cow.");
+    const StringSearch<TestType> search2(test3.getData(), test3.getLength());
+    ASSERT_EQ(search2.findFirst(test1.getData(), test1.getLength()), UINT_MAX);
+    ASSERT_EQ(search2.findLast(test1.getData(), test1.getLength()), UINT_MAX);
+}
+
+TYPED_TEST_NS2(StringSearch, StringSearchTest, FindAll)
+{
+    using TestType = typename TestFixture::Type;
+
+    // Repeated patterns produce many partial and overlapping matches
+    String<TestType> test1;
+    String<TestType> test2;
+    for (uint0 i = 0; i < 40; ++i) {
+        test1 += String<TestType>(i % 3 == 0 ? "aab" : "ab");
+    }
+    test2 = String<TestType>("abaab");
+    for (const uint0 length : {1, 2, 5, 40}) {
+        const StringSearch<TestType> search(test1.getData() + 6, length);
+        DArray<uint0> positions;
+        ASSERT_TRUE(search.findAll(test1.getData(), test1.getLength(), positions));
+
+        // Compare against checking every position
+        DArray<uint0> expected;
+        for (uint0 i = 0; i + length <= test1.getLength(); ++i) {
+            if (NoExport::stringEqual(test1.getData() + i, test1.getData() + 6, length)) {
+                ASSERT_TRUE(expected.add(i));
+            }
+        }
+        ASSERT_EQ(positions.getLength(), expected.getLength());
+        for (uint0 i = 0; i < expected.getLength(); ++i) {
+            ASSERT_EQ(positions.at(i), expected.at(i));
+        }
+        ASSERT_EQ(search.findFirst(test1.getData(), test1.getLength()), expected.at(0));
+        ASSERT_EQ(search.findLast(test1.getData(), test1.getLength()), expected.at(expected.getLength() - 1));
+    }
+    const DArray<uint0> positions = test1.indexOfAll(test2);
+    ASSERT_EQ(positions.getLength(), 13);
+    ASSERT_EQ(positions.at(0), 5);
+}
+#endif
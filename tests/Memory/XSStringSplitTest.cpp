@@ -0,0 +1,210 @@
+/**
+ * Copyright Matthew Oliver
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifdef XSTESTMAIN
+#    include "Memory/XSString.hpp"
+#    include "Memory/XSStringSplit.hpp"
+
+#    include "XSGTest.hpp"
+
+using namespace Shift;
+
+template<typename T>
+class StringSplitTest : public ::testing::Test
+{
+public:
+    using Type = T;
+    using View = StringView<T>;
+
+    /**
+     * Check that the lazy tokens and the bulk offsets both match splitting one character at a time.
+     * @param split The splitter to check.
+     * @returns True if all tokens match.
+     */
+    static bool check(StringSplit<T>& split)
+    {
+        const View string = split.string;
+        const View delimiter(split.delimiters, split.delimiterLength);
+        const bool isClass = split.classLength > 1;
+
+        // Find each delimiter one position at a time
+        DArray<uint32> expected;
+        for (uint0 i = 0; i < string.size();) {
+            if (isClass ? delimiter.find(string[i]) != View::npos : string.substr(i).starts_with(delimiter)) {
+                EXPECT_TRUE(expected.add(static_cast<uint32>(i)));
+                i += split.matchLength;
+            } else {
+                ++i;
+            }
+        }
+
+        DArray<uint32> offsets;
+        if (!split.splitAll(offsets) || offsets.getLength() != expected.getLength()) {
+            return false;
+        }
+        split.reset();
+        View token;
+        for (uint0 i = 0; i <= expected.getLength(); ++i) {
+            if (i < expected.getLength() && offsets.at(i) != expected.at(i)) {
+                return false;
+            }
+            if (!split.next(token) || token != split.getToken(offsets, i)) {
+                return false;
+            }
+        }
+        return !split.next(token);
+    }
+};
+
+using StringSplitTestTypes = ::testing::Types<char, char8, char16, char32>;
+
+class StringSplitTestNames
+{
+public:
+    template<typename T>
+    static std::string GetName(int)
+    {
+        if (std::is_same<T, char>()) {
+            return "char";
+        }
+        if (std::is_same<T, char8>()) {
+            return "char8";
+        }
+        if (std::is_same<T, char16>()) {
+            return "char16";
+        }
+        if (std::is_same<T, char32>()) {
+            return "char32";
+        }
+        return "def";
+    }
+};
+
+TYPED_TEST_SUITE(StringSplitTest, StringSplitTestTypes, StringSplitTestNames);
+
+TYPED_TEST_NS2(StringSplit, StringSplitTest, Character)
+{
+    using TestType = typename TestFixture::Type;
+    using View = typename TestFixture::View;
+
+    const String<TestType> test1("id,name,,value,");
+    StringSplit<TestType> split1 = test1.split(TestType(','));
+    View token;
+    ASSERT_TRUE(split1.next(token));
+    ASSERT_EQ(String<TestType>(token.data(), token.size()), String<TestType>("id"));
+    ASSERT_TRUE(split1.next(token));
+    ASSERT_EQ(String<TestType>(token.data(), token.size()), String<TestType>("name"));
+    ASSERT_TRUE(split1.next(token));
+    ASSERT_TRUE(token.empty());
+    ASSERT_TRUE(split1.next(token));
+    ASSERT_EQ(String<TestType>(token.data(), token.size()), String<TestType>("value"));
+    ASSERT_TRUE(split1.next(token));
+    ASSERT_TRUE(token.empty());
+    ASSERT_FALSE(split1.next(token));
+    ASSERT_FALSE(split1.next(token));
+
+    // Tokens are views into the original string
+    split1.reset();
+    ASSERT_TRUE(split1.next(token));
+    ASSERT_EQ(token.data(), test1.getData());
+    ASSERT_TRUE(TestFixture::check(split1));
+
+    // Empty input and input without any delimiters have a single token
+    StringSplit<TestType> split2(View(), TestType(','));
+    ASSERT_TRUE(split2.next(token));
+    ASSERT_TRUE(token.empty());
+    ASSERT_FALSE(split2.next(token));
+    const String<TestType> test2("no delimiters");
+    StringSplit<TestType> split3 = test2.split(TestType(','));
+    ASSERT_TRUE(split3.next(token));
+    ASSERT_EQ(token.size(), test2.getLength());
+    ASSERT_FALSE(split3.next(token));
+}
+
+TYPED_TEST_NS2(StringSplit, StringSplitTest, Sequence)
+{
+    using TestType = typename TestFixture::Type;
+    using View = typename TestFixture::View;
+
+    const String<TestType> test1("first line\r\nsecond\rline\r\n\r\nlast\r");
+    StringSplit<TestType> split1 = test1.split(String<TestType>("\r\n"));
+    DArray<uint32> offsets;
+    ASSERT_TRUE(split1.splitAll(offsets));
+    ASSERT_EQ(offsets.getLength(), 3);
+    ASSERT_EQ(split1.getToken(offsets, 1), View(test1.getData() + 12, 11));
+    ASSERT_TRUE(split1.getToken(offsets, 2).empty());
+    ASSERT_EQ(split1.getToken(offsets, 3), View(test1.getData() + 27, 5));
+    ASSERT_TRUE(TestFixture::check(split1));
+
+    // Repeated characters only match once per delimiter
+    const String<TestType> test2("aaaaa");
+    StringSplit<TestType> split2 = test2.split(String<TestType>("aa"));
+    View token;
+    ASSERT_TRUE(split2.next(token));
+    ASSERT_TRUE(token.empty());
+    ASSERT_TRUE(split2.next(token));
+    ASSERT_TRUE(token.empty());
+    ASSERT_TRUE(split2.next(token));
+    ASSERT_EQ(token, View(test2.getData() + 4, 1));
+    ASSERT_FALSE(split2.next(token));
+}
+
+TYPED_TEST_NS2(StringSplit, StringSplitTest, AnyOf)
+{
+    using TestType = typename TestFixture::Type;
+    using View = typename TestFixture::View;
+
+    const String<TestType> test1("2024-01-01 12:00:00\tINFO  request=42,status=ok");
+    StringSplit<TestType> split1 = test1.split(String<TestType>(" \t,="), SplitDelimiter::AnyOf);
+    DArray<uint32> offsets;
+    ASSERT_TRUE(split1.splitAll(offsets));
+    ASSERT_EQ(offsets.getLength(), 7);
+    ASSERT_EQ(split1.getToken(offsets, 2), View(test1.getData() + 20, 4));
+    ASSERT_TRUE(split1.getToken(offsets, 3).empty());
+    ASSERT_EQ(split1.getToken(offsets, 7), View(test1.getData() + 44, 2));
+    ASSERT_TRUE(TestFixture::check(split1));
+}
+
+TYPED_TEST_NS2(StringSplit, StringSplitTest, Blocks)
+{
+    using TestType = typename TestFixture::Type;
+    using View = typename TestFixture::View;
+
+    // Build input long enough to use many blocks with delimiters at every offset within a block
+    String<TestType> test1;
+    for (uint32 i = 0; i < 600; ++i) {
+        ASSERT_TRUE(test1.add(static_cast<TestType>(i % 7 == 0 || i % 61 == 0 ? ';' : 'a' + i % 3)));
+        if (i % 97 == 0) {
+            ASSERT_TRUE(test1.add(TestType(',')));
+            ASSERT_TRUE(test1.add(TestType(' ')));
+        }
+    }
+    const TestType delimiters[] = {';', ',', ' ', 'c'}; // NOLINT(modernize-avoid-c-arrays)
+    for (uint0 start = 0; start < 70; start += 3) {
+        for (const uint0 length : {0, 1, 15, 16, 63, 64, 65, 200, 500}) {
+            const View view(test1.getData() + start, length);
+            StringSplit<TestType> split1(view, TestType(';'));
+            ASSERT_TRUE(TestFixture::check(split1));
+            StringSplit<TestType> split2(view, View(delimiters, 2));
+            ASSERT_TRUE(TestFixture::check(split2));
+            StringSplit<TestType> split3(view, View(delimiters + 1, 2), SplitDelimiter::Sequence);
+            ASSERT_TRUE(TestFixture::check(split3));
+            StringSplit<TestType> split4(view, View(delimiters, 4), SplitDelimiter::AnyOf);
+            ASSERT_TRUE(TestFixture::check(split4));
+        }
+    }
+}
+#endif
@@ -101,34 +101,34 @@ TYPED_TEST_NS2(String, StringTest, Constructor)
     ASSERT_EQ(test5, String<TestType>("-985432514552658892"));
 
     test5 = String<TestType>(451258.03125f);
-    ASSERT_EQ(test5, String<TestType>("451258.03125"));
+    ASSERT_EQ(test5, String<TestType>("451258.03"));
 
     test5 = String<TestType>(-451258.3125f);
-    ASSERT_EQ(test5, String<TestType>("-451258.3125"));
+    ASSERT_EQ(test5, String<TestType>("-451258.3"));
 
     test5 = String<TestType>(0.32312408f);
     ASSERT_EQ(test5, String<TestType>("3.2312408e-01"));
 
     test5 = String<TestType>(1.0218521356f);
-    ASSERT_EQ(test5, String<TestType>("1.0218521356"));
+    ASSERT_EQ(test5, String<TestType>("1.0218521"));
 
     test5 = String<TestType>(-1.000218510627f);
-    ASSERT_EQ(test5, String<TestType>("-1.000218510627"));
+    ASSERT_EQ(test5, String<TestType>("-1.0002185"));
 
     test5 = String<TestType>(451258.0f);
     ASSERT_EQ(test5, String<TestType>("451258.0"));
 
     test5 = String<TestType>(-0.00000002f);
-    ASSERT_EQ(test5, String<TestType>("-1.99999997e-08"));
+    ASSERT_EQ(test5, String<TestType>("-2.0e-08"));
 
     test5 = String<TestType>(451258304.0f);
-    ASSERT_EQ(test5, String<TestType>("451258304.0"));
+    ASSERT_EQ(test5, String<TestType>("451258300.0"));
 
     test5 = String<TestType>(0.00218521244f);
-    ASSERT_EQ(test5, String<TestType>("2.18521244e-03"));
+    ASSERT_EQ(test5, String<TestType>("2.1852124e-03"));
 
     test5 = String<TestType>(751257971000000000000.0f);
-    ASSERT_EQ(test5, String<TestType>("7.51257971e20"));
+    ASSERT_EQ(test5, String<TestType>("7.51258e20"));
 
     test5 = String<TestType>(451258.03125);
     ASSERT_EQ(test5, String<TestType>("451258.03125"));
@@ -137,34 +137,94 @@ TYPED_TEST_NS2(String, StringTest, Constructor)
     ASSERT_EQ(test5, String<TestType>("-451258.3125"));
 
     test5 = String<TestType>(1.0218521356);
-    ASSERT_EQ(test5, String<TestType>("1.02185213560000009985"));
+    ASSERT_EQ(test5, String<TestType>("1.0218521356"));
 
     test5 = String<TestType>(-1.000218510627);
-    ASSERT_EQ(test5, String<TestType>("-1.0002185106270000680691"));
+    ASSERT_EQ(test5, String<TestType>("-1.000218510627"));
 
     test5 = String<TestType>(451258.0);
     ASSERT_EQ(test5, String<TestType>("451258.0"));
 
     test5 = String<TestType>(-0.00000002);
-    ASSERT_EQ(test5, String<TestType>("-2.000000000000000036e-008"));
+    ASSERT_EQ(test5, String<TestType>("-2.0e-008"));
 
     test5 = String<TestType>(451258304.0);
     ASSERT_EQ(test5, String<TestType>("451258304.0"));
 
     test5 = String<TestType>(0.00218521244);
-    ASSERT_EQ(test5, String<TestType>("2.185212440000000148e-003"));
+    ASSERT_EQ(test5, String<TestType>("2.18521244e-003"));
 
     test5 = String<TestType>(751257971000000000000.0);
-    ASSERT_EQ(test5, String<TestType>("7.51257970999999987e020"));
+    ASSERT_EQ(test5, String<TestType>("7.51257971e020"));
 
     test5 = String<TestType>(875421.0003215469187125563618);
-    ASSERT_EQ(test5, String<TestType>("875421.0003215469187125563618"));
+    ASSERT_EQ(test5, String<TestType>("875421.0003215469"));
 
     test5 = String<TestType>(-9784531246597.0);
     ASSERT_EQ(test5, String<TestType>("-9784531246597.0"));
 
     test5 = String<TestType>(25160000000000000000000000000000000000.0);
-    ASSERT_EQ(test5, String<TestType>("2.515999999999999917e037"));
+    ASSERT_EQ(test5, String<TestType>("2.516e037"));
+}
+
+TYPED_TEST_NS2(String, StringTest, CharLength)
+{
+    using TestType = typename TestFixture::Type;
+
+    ASSERT_EQ(String<TestType>::CharLength("Hello"), 5);
+    ASSERT_EQ(String<TestType>::CharLength(u"Hello"), 5);
+    ASSERT_EQ(String<TestType>::CharLength(U""), 0);
+
+    // Check every start alignment and length across multiple blocks including characters that contain zero bytes
+    alignas(64) TestType buffer[256];
+    for (uint0 i = 0; i < 256; ++i) {
+        buffer[i] = static_cast<TestType>(sizeof(TestType) > 1 ? 0x0100 + i : 0x20 + (i % 90));
+    }
+    for (uint0 end = 0; end < 200; ++end) {
+        const TestType backup = buffer[end];
+        buffer[end] = 0;
+        for (uint0 start = 0; start <= end && start < 70; ++start) {
+            ASSERT_EQ(String<TestType>::CharLength(buffer + start), end - start);
+        }
+        buffer[end] = backup;
+    }
+
+    // Construction and comparison against null terminated strings use the same length calculation
+    buffer[100] = 0;
+    const String<TestType> test1(buffer + 3);
+    ASSERT_EQ(test1.getLength(), 97);
+    ASSERT_TRUE(test1 == buffer + 3);
+    ASSERT_FALSE(test1 == buffer + 4);
+}
+
+TYPED_TEST_NS2(String, StringTest, Unicode)
+{
+    using TestType = typename TestFixture::Type;
+
+    // Long enough that the conversions operate on multiple blocks
+    const String<TestType> test1(u8"ASCII only text to fill a block W\u00F6rld \u4F60\u597D \U0001F600 end");
+    const String<TestType> test2(u"ASCII only text to fill a block W\u00F6rld \u4F60\u597D \U0001F600 end");
+    const String<TestType> test3(U"ASCII only text to fill a block W\u00F6rld \u4F60\u597D \U0001F600 end");
+    if constexpr (!isSame<TestType, char>) {
+        ASSERT_EQ(test1, test2);
+        ASSERT_EQ(test1, test3);
+        const String<char8> test5(U"ASCII only text to fill a block W\u00F6rld \u4F60\u597D \U0001F600 end");
+        ASSERT_EQ(String<TestType>(test5.getData(), test5.getLength()), test1);
+        const String<char16> test6(u8"ASCII only text to fill a block W\u00F6rld \u4F60\u597D \U0001F600 end");
+        ASSERT_EQ(String<TestType>(test6.getData(), test6.getLength()), test1);
+    } else {
+        // Each code point is reduced to a single ASCII character
+        ASSERT_EQ(test1.getLength(), test3.getLength());
+        ASSERT_EQ(test2.getLength(), test3.getLength());
+    }
+    ASSERT_EQ(test1.getReservedLength(), test1.getLength());
+
+    // Invalid input is still converted without reading past the end
+    const char8 invalid[] = {u8'a', 0xC0, 0x80, u8'b', 0xF0, 0x9F};
+    const String<TestType> test4(invalid, 6);
+    ASSERT_EQ(test4.getLength(), (isSame<TestType, char8> ? 6 : 4));
+    ASSERT_EQ(test4.at(0), TestType('a'));
+    ASSERT_EQ(test4.at(isSame<TestType, char8> ? 3 : 2), TestType('b'));
 }
 
 TYPED_TEST_NS2(String, StringTest, Add)
@@ -392,28 +452,28 @@ TYPED_TEST_NS2(String, StringTest, SetNumber)
     ASSERT_EQ(test9, String<TestType>("********************"));
 
     test8.set(1, 451258.03125f);
-    ASSERT_EQ(test8, String<TestType>("*451258.03125*******"));
+    ASSERT_EQ(test8, String<TestType>("*451258.03**********"));
 
     test9.set(iterator5, -451258.03125f);
-    ASSERT_EQ(test9, String<TestType>("*-451258.03125******"));
+    ASSERT_EQ(test9, String<TestType>("*-451258.03*********"));
 
     test8.set(1, -0.00000002f);
-    ASSERT_EQ(test8, String<TestType>("*-1.99999997e-08****"));
+    ASSERT_EQ(test8, String<TestType>("*-2.0e-083**********"));
 
     test9.set(iterator5, 751257971000000000000.0f);
-    ASSERT_EQ(test9, String<TestType>("*7.51257971e20******"));
+    ASSERT_EQ(test9, String<TestType>("*7.51258e20*********"));
 
     test8.set(1, 25160000000000000000000000000000000000.0);
-    ASSERT_EQ(test8, String<TestType>("*2.515999999999999917e037"));
+    ASSERT_EQ(test8, String<TestType>("*2.516e037**********"));
 
     test9.set(iterator5, -25160000000000000000000000000000000000.0);
-    ASSERT_EQ(test9, String<TestType>("*-2.515999999999999917e037"));
+    ASSERT_EQ(test9, String<TestType>("*-2.516e037*********"));
 
     test8.set(1, 875421.0003215469187125563618);
-    ASSERT_EQ(test8, String<TestType>("*875421.0003215469187125563618"));
+    ASSERT_EQ(test8, String<TestType>("*875421.0003215469**"));
 
     test9.set(iterator5, 875421.0003215469187125563618);
-    ASSERT_EQ(test9, String<TestType>("*875421.0003215469187125563618"));
+    ASSERT_EQ(test9, String<TestType>("*875421.0003215469**"));
 
     test8.set(static_cast<uint16_t>(12587));
     ASSERT_EQ(test8, String<TestType>("12587"));
@@ -434,16 +494,16 @@ TYPED_TEST_NS2(String, StringTest, SetNumber)
     ASSERT_EQ(test8, String<TestType>("-985432514552658892"));
 
     test8.set(451258.3125f);
-    ASSERT_EQ(test8, String<TestType>("451258.3125"));
+    ASSERT_EQ(test8, String<TestType>("451258.3"));
 
     test8.set(-451258.3125f);
-    ASSERT_EQ(test8, String<TestType>("-451258.3125"));
+    ASSERT_EQ(test8, String<TestType>("-451258.3"));
 
     test8.set(875421.0003215469187125563618);
-    ASSERT_EQ(test8, String<TestType>("875421.0003215469187125563618"));
+    ASSERT_EQ(test8, String<TestType>("875421.0003215469"));
 
     test8.set(-875421.0003215469187125563618);
-    ASSERT_EQ(test8, String<TestType>("-875421.0003215469187125563618"));
+    ASSERT_EQ(test8, String<TestType>("-875421.0003215469"));
 }
 
 TYPED_TEST_NS2(String, StringTest, SetString)
@@ -510,6 +570,24 @@ TYPED_TEST_NS2(String, StringTest, CaseConversion)
 
     test2.toLower();
     ASSERT_EQ(test2, String<TestType>("helmit"));
+
+    // Long enough to be converted in blocks, also checks characters either side of the letter ranges
+    String<TestType> test3("@AZ[`az{ The Quick Brown Fox Jumps Over The Lazy Dog 0123456789");
+    test3.toUpper();
+    ASSERT_EQ(test3, String<TestType>("@AZ[`AZ{ THE QUICK BROWN FOX JUMPS OVER THE LAZY DOG 0123456789"));
+    test3.toLower();
+    ASSERT_EQ(test3, String<TestType>("@az[`az{ the quick brown fox jumps over the lazy dog 0123456789"));
+
+    const String<TestType> test4("@AZ[`AZ{ THE QUICK brown fox JUMPS over THE lazy DOG 0123456789");
+    ASSERT_EQ(test3.compareIgnoreCase(test4), 0);
+    ASSERT_TRUE(test3.equalsIgnoreCase(test4));
+    ASSERT_TRUE(test4.equalsIgnoreCase(test3.getData()));
+    ASSERT_FALSE(test3.equalsIgnoreCase(String<TestType>("@AZ[`AZ{ THE")));
+    ASSERT_GT(test3.compareIgnoreCase(String<TestType>("@AZ[`AZ{ THE")), 0);
+    ASSERT_LT(test4.compareIgnoreCase(String<TestType>("@az[`az{ the quick brown fox jumps over the lazy dog 1")), 0);
+    ASSERT_GT(test4.compareIgnoreCase(String<TestType>("@az[`az{ the quick brown fox jumps over the lazy dog /")), 0);
+    ASSERT_FALSE(
+        test4.equalsIgnoreCase(String<TestType>("@az[`az{ the quick brown fox jumps over the lazy dog 0123456788")));
 }
 
 TYPED_TEST_NS2(String, StringTest, NumberConversion)
@@ -528,13 +606,26 @@ TYPED_TEST_NS2(String, StringTest, NumberConversion)
 
     ASSERT_EQ(String<TestType>("-985432514552658892", 19).template toNumber<int64>(), -985432514552658892);
 
-    // ASSERT_FLOAT_EQ(String<TestType>( "451258.32658741", 15 ).toFloat32(), 451258.32658741);
+    ASSERT_FLOAT_EQ(String<TestType>("451258.32658741", 15).template toNumber<float32>(), 451258.32658741f);
 
-    // ASSERT_FLOAT_EQ(String<TestType>( "-451258.32658741", 16 ).toFloat32(), -451258.32658741);
+    ASSERT_FLOAT_EQ(String<TestType>("-451258.32658741", 16).template toNumber<float32>(), -451258.32658741f);
 
-    // ASSERT_FLOAT_EQ(String<TestType>( "875421.0003215468975", 20 ).toFloat64(), 875421.0003215468975);
+    ASSERT_DOUBLE_EQ(String<TestType>("875421.0003215468975", 20).template toNumber<float64>(), 875421.0003215468975);
 
-    // ASSERT_FLOAT_EQ(String<TestType>( "-875421.0003215468975", 21 ).toFloat64(),-875421.0003215468975);
+    ASSERT_DOUBLE_EQ(
+        String<TestType>("-875421.0003215468975", 21).template toNumber<float64>(), -875421.0003215468975);
+
+    const String<TestType> test("x = 1.5e3, y = -42");
+    ASSERT_EQ(test.template toNumber<float64>(4), 1500.0);
+    ASSERT_EQ(test.template toNumber<int32>(test.iteratorAt(15)), -42);
+    ASSERT_EQ(test.template toNumber<int32>(), 0);
+
+    const auto parse1 = test.template parseNumber<float32>(4);
+    ASSERT_TRUE(parse1.isValid());
+    ASSERT_EQ(parse1.value, 1500.0f);
+    ASSERT_EQ(parse1.length, 5);
+    ASSERT_EQ(test.template parseNumber<int32>().error, ParseError::Invalid);
+    ASSERT_EQ(String<TestType>("70000").template parseNumber<int16>().error, ParseError::Range);
 }
 
 TYPED_TEST_NS2(String, StringTest, Find)
@@ -563,6 +654,11 @@ TYPED_TEST_NS2(String, StringTest, Find)
     ASSERT_EQ(test2.findFirst(String<TestType>("elm", 3)), 'e');
 
     ASSERT_EQ(test2.findLast(String<TestType>("elm", 3)), 'e');
+
+    ASSERT_EQ(test2.findFirst(String<TestType>("mit", 3), 3), 'm');
+    ASSERT_EQ(&test2.findFirst(String<TestType>("elm", 3), 2), nullptr);
+    ASSERT_EQ(test2.findLast(String<TestType>("Hel", 3)), 'H');
+    ASSERT_EQ(&test2.findLast(String<TestType>("mit", 3), 5), nullptr);
 }
 
 TYPED_TEST_NS2(String, StringTest, Index)
@@ -591,6 +687,21 @@ TYPED_TEST_NS2(String, StringTest, Index)
     ASSERT_EQ(test2.indexOfFirst(String<TestType>("elm", 3)), 1);
 
     ASSERT_EQ(test2.indexOfLast(String<TestType>("mit", 3)), 3);
+
+    ASSERT_EQ(test2.indexOfLast(String<TestType>("Hel", 3)), 0);
+    ASSERT_EQ(test2.indexOfFirst(String<TestType>("Helmits", 7)), UINT_MAX);
+
+    // Precompiled searches can be reused
+    const String<TestType> test3("Hel");
+    const StringSearch<TestType> search(test3.getData(), test3.getLength());
+    const String<TestType> test4("Helmit Helmit Helmit");
+    ASSERT_EQ(test4.indexOfFirst(search), 0);
+    ASSERT_EQ(test4.indexOfFirst(search, 1), 7);
+    ASSERT_EQ(test4.indexOfLast(search), 14);
+    ASSERT_EQ(test4.indexOfLast(search, 16), 7);
+    const DArray<uint0> positions = test4.indexOfAll(search);
+    ASSERT_EQ(positions.getLength(), 3);
+    ASSERT_EQ(positions.at(2), 14);
 }
 
 TYPED_TEST_NS2(String, StringTest, Compare)
@@ -605,4 +716,54 @@ TYPED_TEST_NS2(String, StringTest, Compare)
 
     ASSERT_EQ(test2.compare(String<TestType>("Helmet", 6)), 4);
 }
+
+TYPED_TEST_NS2(String, StringTest, Small)
+{
+    using TestType = typename TestFixture::Type;
+    using SmallType = SmallString<TestType>;
+    constexpr uint0 inlineLength = 24 / sizeof(TestType);
+
+    SmallType test0;
+    ASSERT_FALSE(test0.isValid());
+
+    // Short strings are stored inline
+    SmallType test1("Hi");
+    ASSERT_FALSE(test1.handle.isHeap());
+    ASSERT_EQ(test1.getReservedLength(), inlineLength);
+    ASSERT_EQ(reinterpret_cast<uint8*>(test1.getData()), test1.handle.storage);
+
+    // Growing past the inline storage moves to the heap
+    for (uint0 i = 0; i < inlineLength; ++i) {
+        ASSERT_TRUE(test1.add(TestType('a')));
+    }
+    ASSERT_TRUE(test1.handle.isHeap());
+    ASSERT_EQ(test1.getLength(), inlineLength + 2);
+    ASSERT_EQ(test1.at(0), TestType('H'));
+    ASSERT_EQ(test1.at(1), TestType('i'));
+    ASSERT_EQ(test1.at(inlineLength + 1), TestType('a'));
+
+    // Moving an inline string must copy its contents
+    SmallType test2("Hello");
+    SmallType test3(move(test2));
+    ASSERT_FALSE(test2.isValid());
+    ASSERT_EQ(test3, SmallType("Hello"));
+    ASSERT_TRUE(test3.add(SmallType(" World")));
+    ASSERT_EQ(test3, SmallType("Hello World"));
+
+    // Swapping inline and heap strings
+    const SmallType test4(test1);
+    test3.swap(test1);
+    ASSERT_EQ(test1, SmallType("Hello World"));
+    ASSERT_EQ(test3, test4);
+    test2 = move(test1);
+    ASSERT_EQ(test2, SmallType("Hello World"));
+    ASSERT_TRUE(test2.add(TestType('!')));
+    ASSERT_EQ(test2.getLength(), 12);
+
+    // Conversion to and from other strings
+    const String<TestType> test5(test2);
+    ASSERT_EQ(test5, String<TestType>("Hello World!"));
+    const SmallType test6 = test2 + SmallType("?");
+    ASSERT_EQ(test6, SmallType("Hello World!?"));
+}
 #endif
@@ -0,0 +1,170 @@
+/**
+ * Copyright Matthew Oliver
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifdef XSTESTMAIN
+#    include "Memory/XSUnicode.hpp"
+
+#    include "XSGTest.hpp"
+
+#    include <string>
+
+using namespace Shift;
+
+// Long enough to cover several blocks with both ASCII and multi-byte sequences crossing block boundaries
+static constexpr char8 utf8Test[] = u8"Hello World, ASCII only block. Wörld éè "
+                                    u8"你好世界 \U0001F600\U0001F601 and some more ASCII text to end";
+static constexpr char16 utf16Test[] = u"Hello World, ASCII only block. Wörld éè "
+                                      u"你好世界 \U0001F600\U0001F601 and some more ASCII text to end";
+static constexpr char32 utf32Test[] = U"Hello World, ASCII only block. Wörld éè "
+                                      U"你好世界 \U0001F600\U0001F601 and some more ASCII text to end";
+
+TEST_NS2(Unicode, UnicodeTest, Validate)
+{
+    ASSERT_TRUE(utf8Validate(utf8Test, std::size(utf8Test) - 1));
+    ASSERT_TRUE(utf8Validate(utf8Test, 0));
+
+    // Insert invalid sequences at different positions so that they are found within and across blocks
+    const std::u8string base(160, u8'a');
+    const std::u8string invalid[] = {
+        u8"\xC0\x80",         // Overlong 2 byte
+        u8"\xE0\x80\x80",     // Overlong 3 byte
+        u8"\xF0\x80\x80\x80", // Overlong 4 byte
+        u8"\xED\xA0\x80",     // Surrogate
+        u8"\xF4\x90\x80\x80", // Above 0x10FFFF
+        u8"\xF8\x88\x80\x80", // 5 byte sequence
+        u8"\x80",             // Unexpected continuation
+        u8"\xC3\xA9\xA9",     // Too many continuations
+        u8"\xE4\xBD",         // Too few continuations
+    };
+    for (const auto& sequence : invalid) {
+        for (const uint0 position : {0, 14, 15, 30, 31, 32, 47, 62, 63, 64, 127}) {
+            std::u8string test = base;
+            test.replace(position, sequence.length(), sequence);
+            ASSERT_FALSE(utf8Validate(test.data(), test.length())) << position;
+        }
+    }
+
+    // Sequences truncated by the end of the input
+    for (const uint0 length : {31, 32, 63, 64, 80, 127}) {
+        const std::u8string test = std::u8string(length, u8'a') + u8"\U0001F600";
+        ASSERT_TRUE(utf8Validate(test.data(), test.length()));
+        for (uint0 i = 1; i < 4; ++i) {
+            ASSERT_FALSE(utf8Validate(test.data(), test.length() - i)) << length;
+        }
+    }
+}
+
+TEST_NS2(Unicode, UnicodeTest, Convert)
+{
+    const uint0 length8 = std::size(utf8Test) - 1;
+    const uint0 length16 = std::size(utf16Test) - 1;
+    const uint0 length32 = std::size(utf32Test) - 1;
+
+    ASSERT_EQ(utfConvertLength<char16>(utf8Test, length8), length16);
+    ASSERT_EQ(utfConvertLength<char32>(utf8Test, length8), length32);
+    ASSERT_EQ(utfConvertLength<char8>(utf16Test, length16), length8);
+    ASSERT_EQ(utfConvertLength<char32>(utf16Test, length16), length32);
+    ASSERT_EQ(utfConvertLength<char8>(utf32Test, length32), length8);
+    ASSERT_EQ(utfConvertLength<char16>(utf32Test, length32), length16);
+    ASSERT_EQ(utfConvertLength<char>(utf8Test, length8), length32);
+
+    std::u8string test8(length8, u8'\0');
+    std::u16string test16(length16, u'\0');
+    std::u32string test32(length32, U'\0');
+    ASSERT_EQ(utfConvert(utf8Test, length8, test16.data()), length16);
+    ASSERT_EQ(test16, utf16Test);
+    ASSERT_EQ(utfConvert(utf8Test, length8, test32.data()), length32);
+    ASSERT_EQ(test32, utf32Test);
+    ASSERT_EQ(utfConvert(utf16Test, length16, test8.data()), length8);
+    ASSERT_TRUE(test8 == utf8Test);
+    ASSERT_EQ(utfConvert(utf16Test, length16, test32.data()), length32);
+    ASSERT_EQ(test32, utf32Test);
+    ASSERT_EQ(utfConvert(utf32Test, length32, test8.data()), length8);
+    ASSERT_TRUE(test8 == utf8Test);
+    ASSERT_EQ(utfConvert(utf32Test, length32, test16.data()), length16);
+    ASSERT_EQ(test16, utf16Test);
+
+    // Unpaired surrogates are kept as individual code points
+    const char16 unpaired[] = {u'a', 0xD800, u'b', 0xDC00};
+    ASSERT_EQ(utfConvertLength<char32>(unpaired, 4), 4);
+    ASSERT_EQ(utfConvertLength<char8>(unpaired, 4), 8);
+    char32 test[4];
+    ASSERT_EQ(utfConvert(unpaired, 4, test), 4);
+    ASSERT_EQ(test[1], 0xD800);
+    ASSERT_EQ(test[3], 0xDC00);
+}
+
+TEST_NS2(Unicode, UnicodeTest, Case)
+{
+    // Latin-1 letters are converted for all UTF types while other characters (including the multiplication and
+    // division signs and letters without a single character equivalent) are unchanged
+    std::u8string test8(u8"Quick Brown Fox \u00C0\u00C9\u00CE\u00D5\u00DC\u00D7"
+                        u8"\u00E0\u00E9\u00EE\u00F5\u00FC\u00F7 \u00DF\u00FF\u0100 Jumps Over The Lazy Dog");
+    std::u16string test16(u"Quick Brown Fox \u00C0\u00C9\u00CE\u00D5\u00DC\u00D7"
+                          u"\u00E0\u00E9\u00EE\u00F5\u00FC\u00F7 \u00DF\u00FF\u0100 Jumps Over The Lazy Dog");
+    std::u32string test32(U"Quick Brown Fox \u00C0\u00C9\u00CE\u00D5\u00DC\u00D7"
+                          U"\u00E0\u00E9\u00EE\u00F5\u00FC\u00F7 \u00DF\u00FF\u0100 Jumps Over The Lazy Dog");
+    const std::u32string upper(U"QUICK BROWN FOX \u00C0\u00C9\u00CE\u00D5\u00DC\u00D7"
+                               U"\u00C0\u00C9\u00CE\u00D5\u00DC\u00F7 \u00DF\u00FF\u0100 JUMPS OVER THE LAZY DOG");
+    const std::u32string lower(U"quick brown fox \u00E0\u00E9\u00EE\u00F5\u00FC\u00D7"
+                               U"\u00E0\u00E9\u00EE\u00F5\u00FC\u00F7 \u00DF\u00FF\u0100 jumps over the lazy dog");
+    const auto check = [](const auto& string, const std::u32string& expected) {
+        std::u32string converted(expected.length(), U'\0');
+        converted.resize(utfConvert(string.data(), string.length(), converted.data()));
+        return converted == expected;
+    };
+
+    const std::u8string original8(test8);
+    const std::u16string original16(test16);
+    const std::u32string original32(test32);
+    utfToUpper(test8.data(), test8.length());
+    ASSERT_TRUE(check(test8, upper));
+    utfToUpper(test16.data(), test16.length());
+    ASSERT_TRUE(check(test16, upper));
+    utfToUpper(test32.data(), test32.length());
+    ASSERT_TRUE(check(test32, upper));
+
+    ASSERT_EQ(utfCompareIgnoreCase(test8.data(), test8.length(), original8.data(), original8.length()), 0);
+    ASSERT_EQ(utfCompareIgnoreCase(test16.data(), test16.length(), original16.data(), original16.length()), 0);
+    ASSERT_EQ(utfCompareIgnoreCase(test32.data(), test32.length(), original32.data(), original32.length()), 0);
+    ASSERT_NE(utfCompareIgnoreCase(test8.data(), test8.length(), original8.data(), original8.length() - 1), 0);
+
+    utfToLower(test8.data(), test8.length());
+    ASSERT_TRUE(check(test8, lower));
+    utfToLower(test16.data(), test16.length());
+    ASSERT_TRUE(check(test16, lower));
+    utfToLower(test32.data(), test32.length());
+    ASSERT_TRUE(check(test32, lower));
+
+    // UTF8 letters split across the end of a block use the lead byte from the previous block
+    for (const uint0 length : {15, 31, 63}) {
+        std::u8string test = std::u8string(length, u8'A') + u8"\u00C9" + std::u8string(length, u8'A');
+        const std::u8string expected = std::u8string(length, u8'a') + u8"\u00E9" + std::u8string(length, u8'a');
+        ASSERT_EQ(utfCompareIgnoreCase(test.data(), test.length(), expected.data(), expected.length()), 0) << length;
+        utfToLower(test.data(), test.length());
+        ASSERT_TRUE(test == expected) << length;
+    }
+
+    // Differences are found at every position within a block
+    for (uint0 i = 0; i < test32.length(); ++i) {
+        std::u32string test(test32);
+        test[i] = U'\U0001F600';
+        ASSERT_GT(utfCompareIgnoreCase(test.data(), test.length(), test32.data(), test32.length()), 0) << i;
+        ASSERT_LT(utfCompareIgnoreCase(test32.data(), test32.length(), test.data(), test.length()), 0) << i;
+    }
+}
+
+#endif
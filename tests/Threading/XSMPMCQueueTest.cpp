@@ -0,0 +1,117 @@
+/**
+ * Copyright Matthew Oliver
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifdef XSTESTMAIN
+
+#    include "Memory/XSString.hpp"
+#    include "Threading/XSMPMCQueue.hpp"
+
+#    include "XSGTest.hpp"
+
+#    include <thread>
+#    include <vector>
+
+using namespace Shift;
+
+TEST_NS2(MPMCQueue, MPMCQueueTest, PushPop)
+{
+    MPMCQueue<uint32> test1(6);
+    ASSERT_TRUE(test1.isValid());
+    ASSERT_EQ(test1.getReservedLength(), 8);
+
+    // Cycle through the queue several times so that it wraps
+    uint32 next = 0;
+    uint32 expected = 0;
+    for (uint32 i = 0; i < 5; ++i) {
+        while (test1.tryPush(next)) {
+            ++next;
+        }
+        ASSERT_EQ(test1.getLength(), 8);
+        for (uint32 j = 0; j < 5; ++j) {
+            uint32 value;
+            ASSERT_TRUE(test1.tryPop(value));
+            ASSERT_EQ(value, expected++);
+        }
+    }
+    uint32 value;
+    while (test1.tryPop(value)) {
+        ASSERT_EQ(value, expected++);
+    }
+    ASSERT_EQ(expected, next);
+    ASSERT_EQ(test1.getLength(), 0);
+
+    // Remaining elements must be destructed with the queue
+    MPMCQueue<String<char>> test2(4);
+    ASSERT_TRUE(test2.tryPush("first"));
+    ASSERT_TRUE(test2.tryPush(String<char>("second")));
+    String<char> string;
+    ASSERT_TRUE(test2.tryPop(string));
+    ASSERT_EQ(string, "first");
+}
+
+TEST_NS2(MPMCQueue, MPMCQueueTest, Threaded)
+{
+    constexpr uint32 producers = 3;
+    constexpr uint32 consumers = 3;
+    constexpr uint32 number = 30000;
+    MPMCQueue<uint32, true> test1(16);
+
+    // Each producer pushes its own range of values which must all arrive exactly once
+    std::vector<std::thread> threads;
+    for (uint32 i = 0; i < producers; ++i) {
+        threads.emplace_back([&test1, i]() {
+            for (uint32 j = 0; j < number; ++j) {
+                if ((j & 1) == 0) {
+                    test1.push(i * number + j);
+                } else {
+                    while (!test1.tryPush(i * number + j)) {
+                        std::this_thread::yield();
+                    }
+                }
+            }
+        });
+    }
+    std::vector<uint32> received[consumers]; // NOLINT(modernize-avoid-c-arrays)
+    for (uint32 i = 0; i < consumers; ++i) {
+        threads.emplace_back([&test1, &received, i]() {
+            for (uint32 j = 0; j < number; ++j) {
+                uint32 value;
+                test1.pop(value);
+                received[i].push_back(value);
+            }
+        });
+    }
+    for (auto& i : threads) {
+        i.join();
+    }
+
+    std::vector<uint32> counts(producers * number, 0);
+    for (const auto& i : received) {
+        // Values from the same producer must arrive in order
+        uint32 last[producers] = {}; // NOLINT(modernize-avoid-c-arrays)
+        for (const auto j : i) {
+            ++counts[j];
+            ASSERT_TRUE(j % number >= last[j / number]);
+            last[j / number] = j % number;
+        }
+    }
+    for (const auto i : counts) {
+        ASSERT_EQ(i, 1);
+    }
+    ASSERT_EQ(test1.getLength(), 0);
+}
+
+#endif
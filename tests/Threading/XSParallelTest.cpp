@@ -0,0 +1,179 @@
+/**
+ * Copyright Matthew Oliver
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifdef XSTESTMAIN
+
+#    include "Memory/XSDArray.hpp"
+#    include "Threading/XSParallel.hpp"
+
+#    include "XSGTest.hpp"
+
+#    include <vector>
+
+using namespace Shift;
+
+TEST_NS2(Parallel, ParallelTest, For)
+{
+    ThreadPool pool(4);
+    constexpr uint0 width = NoExport::ParallelChunks<uint32>::width;
+    constexpr uint0 number = 1000003;
+    std::vector<uint32> values(number, 0);
+
+    // Every element is visited once and only the tail may be shorter than a SIMD register
+    std::atomic<uint32> tails{0};
+    std::atomic<uint32> calls{0};
+    parallelFor(
+        values.data(), number,
+        [&](uint32* elements, const uint0 length) {
+            if (length % width != 0) {
+                tails.fetch_add(1, std::memory_order_relaxed);
+                EXPECT_LT(length, width);
+                EXPECT_EQ(elements + length, values.data() + number);
+            }
+            EXPECT_EQ((elements - values.data()) % width, 0);
+            calls.fetch_add(1, std::memory_order_relaxed);
+            for (uint0 i = 0; i < length; ++i) {
+                ++elements[i];
+            }
+        },
+        pool);
+    ASSERT_EQ(tails.load(), number % width != 0 ? 1 : 0);
+    ASSERT_GT(calls.load(), 1);
+    for (const auto i : values) {
+        ASSERT_EQ(i, 1);
+    }
+
+    // Small ranges are run directly on the calling thread
+    uint32 small[3] = {1, 2, 3}; // NOLINT(modernize-avoid-c-arrays)
+    parallelFor(
+        small, 3,
+        [](uint32* elements, const uint0 length) {
+            for (uint0 i = 0; i < length; ++i) {
+                elements[i] *= 2;
+            }
+        },
+        pool);
+    ASSERT_EQ(small[2], 6);
+
+    DArray<uint32> array(values.data(), number);
+    parallelFor(
+        array,
+        [](uint32* elements, const uint0 length) {
+            for (uint0 i = 0; i < length; ++i) {
+                elements[i] += 2;
+            }
+        },
+        pool);
+    ASSERT_EQ(array.at(0), 3);
+    ASSERT_EQ(array.atBack(), 3);
+}
+
+TEST_NS2(Parallel, ParallelTest, Reduce)
+{
+    ThreadPool pool(4);
+    constexpr uint0 number = 1000001;
+    std::vector<uint64> values(number);
+    for (uint0 i = 0; i < number; ++i) {
+        values[i] = i;
+    }
+    const auto sum = [](const uint64* elements, const uint0 length) {
+        uint64 ret = 0;
+        for (uint0 i = 0; i < length; ++i) {
+            ret += elements[i];
+        }
+        return ret;
+    };
+    const auto add = [](const uint64 first, const uint64 second) { return first + second; };
+    constexpr uint64 expected = (static_cast<uint64>(number) * (number - 1)) / 2;
+    ASSERT_EQ(parallelReduce(values.data(), number, uint64{0}, sum, add, pool), expected);
+    ASSERT_EQ(parallelReduce(values.data(), 0, uint64{7}, sum, add, pool), 7);
+    ASSERT_EQ(parallelReduce(values.data(), 5, uint64{0}, sum, add, pool), 10);
+
+    // Sub-range results must be combined in order so non-commutative reductions work
+    const auto first = [](const uint64* elements, const uint0 length) {
+        return length != 0 ? elements[0] : ~uint64{0};
+    };
+    const auto keepFirst = [](const uint64 a, const uint64 b) { return a != ~uint64{0} ? a : b; };
+    ASSERT_EQ(parallelReduce(values.data() + 3, number - 3, ~uint64{0}, first, keepFirst, pool), 3);
+
+    DArray<uint64> array(values.data(), number);
+    ASSERT_EQ(parallelReduce(array, uint64{0}, sum, add, pool), expected);
+}
+
+TEST_NS2(Parallel, ParallelTest, Transform)
+{
+    ThreadPool pool(4);
+    constexpr uint0 number = 500009;
+    std::vector<float32> input(number);
+    for (uint0 i = 0; i < number; ++i) {
+        input[i] = static_cast<float32>(i);
+    }
+    std::vector<float64> output(number, 0.0);
+    const auto scale = [](const float32* in, float64* out, const uint0 length) {
+        for (uint0 i = 0; i < length; ++i) {
+            out[i] = static_cast<float64>(in[i]) * 2.0 + 1.0;
+        }
+    };
+    parallelTransform(input.data(), output.data(), number, scale, pool);
+    for (uint0 i = 0; i < number; ++i) {
+        ASSERT_EQ(output[i], static_cast<float64>(i) * 2.0 + 1.0);
+    }
+
+    DArray<float32> array(input.data(), number);
+    DArray<float64> result(output.data(), number);
+    const auto negate = [](const float32* in, float64* out, const uint0 length) {
+        for (uint0 i = 0; i < length; ++i) {
+            out[i] = -static_cast<float64>(in[i]);
+        }
+    };
+    ASSERT_TRUE(parallelTransform(array, result, negate, pool));
+    ASSERT_EQ(result.at(12345), -12345.0);
+    DArray<float64> tooSmall(output.data(), 10);
+    ASSERT_FALSE(parallelTransform(array, tooSmall, negate, pool));
+}
+
+TEST_NS2(Parallel, ParallelTest, Scan)
+{
+    ThreadPool pool(4);
+    const auto add = [](const uint64 first, const uint64 second) { return first + second; };
+    for (const uint0 number : {uint0{0}, uint0{1}, uint0{17}, uint0{300007}}) {
+        std::vector<uint64> values(number);
+        for (uint0 i = 0; i < number; ++i) {
+            values[i] = i + 1;
+        }
+        std::vector<uint64> inclusive(number, 0);
+        parallelInclusiveScan(values.data(), inclusive.data(), number, add, pool);
+        std::vector<uint64> exclusive(number, 0);
+        parallelExclusiveScan(values.data(), exclusive.data(), number, uint64{5}, add, pool);
+        for (uint0 i = 0; i < number; ++i) {
+            ASSERT_EQ(inclusive[i], ((i + 1) * (i + 2)) / 2);
+            ASSERT_EQ(exclusive[i], 5 + (i * (i + 1)) / 2);
+        }
+
+        // Scans can be performed in place
+        parallelExclusiveScan(values.data(), values.data(), number, uint64{5}, add, pool);
+        ASSERT_EQ(values, exclusive);
+    }
+
+    DArray<uint64> array(uint0{8});
+    for (uint64 i = 0; i < 100000; ++i) {
+        array.add(i);
+    }
+    ASSERT_TRUE(parallelInclusiveScan(array, array, add, pool));
+    ASSERT_EQ(array.atBack(), (99999ULL * 100000ULL) / 2);
+}
+
+#endif
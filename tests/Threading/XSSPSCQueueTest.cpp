@@ -0,0 +1,108 @@
+/**
+ * Copyright Matthew Oliver
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifdef XSTESTMAIN
+
+#    include "Threading/XSSPSCQueue.hpp"
+
+#    include "XSGTest.hpp"
+
+#    include <thread>
+
+using namespace Shift;
+
+TEST_NS2(SPSCQueue, SPSCQueueTest, PushPop)
+{
+    SPSCQueue<uint32> test1(6);
+    ASSERT_TRUE(test1.isValid());
+    ASSERT_TRUE(test1.isEmpty());
+    ASSERT_EQ(test1.getReservedLength(), 8);
+
+    // Cycle through the queue several times so that it wraps
+    uint32 next = 0;
+    uint32 expected = 0;
+    for (uint32 i = 0; i < 5; ++i) {
+        while (test1.tryPush(next)) {
+            ++next;
+        }
+        ASSERT_EQ(test1.getLength(), 8);
+        for (uint32 j = 0; j < 5; ++j) {
+            uint32 value;
+            ASSERT_TRUE(test1.tryPop(value));
+            ASSERT_EQ(value, expected++);
+        }
+    }
+
+    // Bulk operations only transfer what fits
+    uint32 values[16]; // NOLINT(modernize-avoid-c-arrays)
+    for (uint32 i = 0; i < 16; ++i) {
+        values[i] = next + i;
+    }
+    ASSERT_EQ(test1.tryPush(values, 16), 5);
+    ASSERT_EQ(test1.tryPush(values, 16), 0);
+    uint32 results[16]; // NOLINT(modernize-avoid-c-arrays)
+    ASSERT_EQ(test1.tryPop(results, 16), 8);
+    for (uint32 i = 0; i < 8; ++i) {
+        ASSERT_EQ(results[i], expected++);
+    }
+    ASSERT_TRUE(test1.isEmpty());
+    ASSERT_EQ(test1.tryPop(results, 16), 0);
+    uint32 value;
+    ASSERT_FALSE(test1.tryPop(value));
+}
+
+TEST_NS2(SPSCQueue, SPSCQueueTest, Threaded)
+{
+    constexpr uint32 number = 200000;
+    SPSCQueue<uint32> test1(64);
+
+    // Producer uses a mix of single and batch pushes of varying sizes
+    std::thread producer([&test1]() {
+        uint32 values[37]; // NOLINT(modernize-avoid-c-arrays)
+        uint32 next = 0;
+        uint32 batch = 1;
+        while (next < number) {
+            if (batch == 1) {
+                if (test1.tryPush(next)) {
+                    ++next;
+                }
+            } else {
+                const uint32 count = min(batch, number - next);
+                for (uint32 i = 0; i < count; ++i) {
+                    values[i] = next + i;
+                }
+                next += static_cast<uint32>(test1.tryPush(values, count));
+            }
+            batch = batch % 37 + 1;
+        }
+    });
+
+    uint32 results[23]; // NOLINT(modernize-avoid-c-arrays)
+    uint32 expected = 0;
+    bool ordered = true;
+    while (expected < number) {
+        const uint0 count = test1.tryPop(results, 23);
+        for (uint0 i = 0; i < count; ++i) {
+            ordered = ordered && (results[i] == expected);
+            ++expected;
+        }
+    }
+    producer.join();
+    ASSERT_TRUE(ordered);
+    ASSERT_TRUE(test1.isEmpty());
+}
+
+#endif
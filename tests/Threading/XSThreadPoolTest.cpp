@@ -0,0 +1,107 @@
+/**
+ * Copyright Matthew Oliver
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifdef XSTESTMAIN
+
+#    include "Threading/XSThreadPool.hpp"
+
+#    include "XSGTest.hpp"
+
+#    include <vector>
+
+using namespace Shift;
+
+/**
+ * Recursively calculate a fibonacci number by spawning nested task groups.
+ * @param pool  The thread pool.
+ * @param value The fibonacci index.
+ * @returns The fibonacci number.
+ */
+static uint64 fibonacci(ThreadPool& pool, const uint32 value) noexcept
+{
+    if (value < 2) {
+        return value;
+    }
+    uint64 first = 0;
+    uint64 second = 0;
+    TaskGroup group(pool);
+    group.run([&pool, &first, value]() { first = fibonacci(pool, value - 1); });
+    second = fibonacci(pool, value - 2);
+    group.wait();
+    return first + second;
+}
+
+TEST_NS2(ThreadPool, ThreadPoolTest, Constructor)
+{
+    ThreadPool test1(3);
+    ASSERT_TRUE(test1.isValid());
+    ASSERT_EQ(test1.getThreadCount(), 3);
+
+    ThreadPool test2(0, true, 16);
+    ASSERT_TRUE(test2.isValid());
+    ASSERT_EQ(test2.getThreadCount(), ThreadPool::threadsFor(0));
+    ASSERT_GE(test2.getThreadCount(), 1);
+
+    ASSERT_TRUE(getDefaultThreadPool().isValid());
+    ASSERT_EQ(&getDefaultThreadPool(), &getDefaultThreadPool());
+}
+
+TEST_NS2(ThreadPool, ThreadPoolTest, TaskGroup)
+{
+    ThreadPool test1(4, false, 64);
+    constexpr uint32 number = 10000;
+    std::vector<uint32> values(number, 0);
+
+    // More tasks than the queues can hold so some must be run by the submitting thread
+    TaskGroup group(test1);
+    for (uint32 i = 0; i < number; ++i) {
+        group.run([&values, i]() { values[i] = i * 2; });
+    }
+    group.wait();
+    ASSERT_TRUE(group.isDone());
+    for (uint32 i = 0; i < number; ++i) {
+        ASSERT_EQ(values[i], i * 2);
+    }
+
+    // Groups can be reused after waiting
+    std::atomic<uint32> count{0};
+    for (uint32 i = 0; i < 100; ++i) {
+        group.run([&count]() { count.fetch_add(1, std::memory_order_relaxed); });
+    }
+    group.wait();
+    ASSERT_EQ(count.load(), 100);
+
+    // Tasks without a group still run before the pool is destroyed
+    {
+        ThreadPool test2(2);
+        for (uint32 i = 0; i < 100; ++i) {
+            test2.submit([&count]() { count.fetch_add(1, std::memory_order_relaxed); });
+        }
+    }
+    ASSERT_EQ(count.load(), 200);
+}
+
+TEST_NS2(ThreadPool, ThreadPoolTest, Nested)
+{
+    // Waiting from inside a task must help run other tasks instead of blocking the worker
+    ThreadPool test1(2);
+    ASSERT_EQ(fibonacci(test1, 20), 6765);
+
+    ThreadPool test2(1, true);
+    ASSERT_EQ(fibonacci(test2, 15), 610);
+}
+
+#endif
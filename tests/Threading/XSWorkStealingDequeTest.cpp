@@ -0,0 +1,119 @@
+/**
+ * Copyright Matthew Oliver
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifdef XSTESTMAIN
+
+#    include "Threading/XSWorkStealingDeque.hpp"
+
+#    include "XSGTest.hpp"
+
+#    include <thread>
+#    include <vector>
+
+using namespace Shift;
+
+TEST_NS2(WorkStealingDeque, WorkStealingDequeTest, PushPop)
+{
+    WorkStealingDeque<uint32> test1(6);
+    ASSERT_TRUE(test1.isValid());
+    ASSERT_TRUE(test1.isEmpty());
+    ASSERT_EQ(test1.getReservedLength(), 8);
+
+    // Owner pops in LIFO order while thieves steal in FIFO order
+    for (uint32 i = 0; i < 8; ++i) {
+        ASSERT_TRUE(test1.tryPush(i));
+    }
+    ASSERT_FALSE(test1.tryPush(8));
+    ASSERT_EQ(test1.getLength(), 8);
+    uint32 value;
+    ASSERT_TRUE(test1.tryPop(value));
+    ASSERT_EQ(value, 7);
+    ASSERT_TRUE(test1.trySteal(value));
+    ASSERT_EQ(value, 0);
+    ASSERT_TRUE(test1.trySteal(value));
+    ASSERT_EQ(value, 1);
+    ASSERT_TRUE(test1.tryPop(value));
+    ASSERT_EQ(value, 6);
+
+    // Cycle through the deque several times so that it wraps
+    for (uint32 i = 0; i < 20; ++i) {
+        ASSERT_TRUE(test1.tryPush(100 + i));
+        ASSERT_TRUE(test1.trySteal(value));
+        ASSERT_EQ(value, i < 4 ? 2 + i : 96 + i);
+    }
+    ASSERT_EQ(test1.getLength(), 4);
+    for (uint32 i = 0; i < 4; ++i) {
+        ASSERT_TRUE(test1.tryPop(value));
+        ASSERT_EQ(value, 119 - i);
+    }
+    ASSERT_TRUE(test1.isEmpty());
+    ASSERT_FALSE(test1.tryPop(value));
+    ASSERT_FALSE(test1.trySteal(value));
+}
+
+TEST_NS2(WorkStealingDeque, WorkStealingDequeTest, Threaded)
+{
+    constexpr uint32 thieves = 3;
+    constexpr uint32 number = 100000;
+    WorkStealingDeque<uint32> test1(64);
+
+    // Every value must be removed exactly once by either the owner or one of the thieves
+    std::atomic<bool> done{false};
+    std::vector<uint32> counts[thieves + 1]; // NOLINT(modernize-avoid-c-arrays)
+    std::vector<std::thread> threads;
+    for (uint32 i = 0; i < thieves; ++i) {
+        counts[i + 1].resize(number, 0);
+        threads.emplace_back([&test1, &done, &counts, i]() {
+            uint32 value;
+            while (!done.load(std::memory_order_acquire) || !test1.isEmpty()) {
+                if (test1.trySteal(value)) {
+                    ++counts[i + 1][value];
+                }
+            }
+        });
+    }
+    counts[0].resize(number, 0);
+    uint32 value;
+    for (uint32 i = 0; i < number; ++i) {
+        while (!test1.tryPush(i)) {
+            if (test1.tryPop(value)) {
+                ++counts[0][value];
+            }
+        }
+        // Periodically pop from the owner side to race thieves for the last element
+        if ((i % 3) == 0 && test1.tryPop(value)) {
+            ++counts[0][value];
+        }
+    }
+    while (test1.tryPop(value)) {
+        ++counts[0][value];
+    }
+    done.store(true, std::memory_order_release);
+    for (auto& i : threads) {
+        i.join();
+    }
+
+    for (uint32 i = 0; i < number; ++i) {
+        uint32 count = 0;
+        for (const auto& j : counts) {
+            count += j[i];
+        }
+        ASSERT_EQ(count, 1);
+    }
+    ASSERT_TRUE(test1.isEmpty());
+}
+
+#endif
@@ -0,0 +1,109 @@
+/**
+ * Copyright Matthew Oliver
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "XSHash.hpp"
+
+#include "Memory/XSString.hpp"
+#include "XSCompilerOptions.h"
+#include "XSGTest.hpp"
+
+using namespace Shift;
+
+#ifdef XSTESTMAIN
+TEST_NS(Hash, Hash, Types)
+{
+    // Positive and negative zero must hash the same as they compare equal
+    ASSERT_EQ(Hash<float32>()(0.0f), Hash<float32>()(-0.0f));
+    ASSERT_EQ(Hash<float64>()(0.0), Hash<float64>()(-0.0));
+    ASSERT_NE(Hash<float32>()(1.0f), Hash<float32>()(2.0f));
+
+    // Integers of different sizes with the same value hash the same
+    ASSERT_EQ(Hash<uint32>()(42_ui32), Hash<uint64>()(42_ui64));
+    ASSERT_NE(Hash<uint32>()(42_ui32), Hash<uint32>()(43_ui32));
+
+    // Strings must match views and character sequences
+    const String<char> string("Hash this string");
+    ASSERT_EQ(Hash<String<char>>()(string), Hash<String<char>>()("Hash this string"));
+    ASSERT_EQ(Hash<String<char>>()(string), Hash<String<char>>()(StringView<char>("Hash this string")));
+    ASSERT_NE(Hash<String<char>>()(string), Hash<String<char>>()("Hash this string!"));
+}
+#endif
+
+#if !defined(XSTESTMAIN) || (XS_ISA != XS_X86)
+/**
+ * Fill a buffer with a repeatable pattern.
+ * @param [out] buffer The buffer to fill.
+ * @param       size   The size of the buffer.
+ */
+static void hashTestFill(uint8* buffer, const uint0 size)
+{
+    for (uint0 i = 0; i < size; ++i) {
+        buffer[i] = static_cast<uint8>(i * 131 + 7);
+    }
+}
+
+TEST_NS2(Hash, Hash, TESTISA(Hash64))
+{
+    // Results must be identical for all instruction sets
+    uint8 buffer[4096]; // NOLINT(modernize-avoid-c-arrays)
+    hashTestFill(buffer, sizeof(buffer));
+    ASSERT_EQ(hash64(buffer, 0), 0xCA238795E8BB14AD_ui64);
+    ASSERT_EQ(hash64(buffer, 3), 0xF99458FC1D6190B8_ui64);
+    ASSERT_EQ(hash64(buffer, 8), 0x28417BE971699B92_ui64);
+    ASSERT_EQ(hash64(buffer, 17), 0xF6E71C4941FC64F5_ui64);
+    ASSERT_EQ(hash64(buffer, 100), 0xA95D59DDD1B39475_ui64);
+    ASSERT_EQ(hash64(buffer, 1023), 0x620EFE1A08A36C95_ui64);
+    ASSERT_EQ(hash64(buffer, 1024), 0x01FB3C1FBF9CD8DB_ui64);
+    ASSERT_EQ(hash64(buffer, 3000), 0x92B526BF2BEE7944_ui64);
+    ASSERT_EQ(hash64(buffer, 100, 12345), 0xB72846972161325F_ui64);
+
+    // Changing a single byte in a bulk block must change the result
+    const uint64 check = hash64(buffer, 3000);
+    buffer[1500] ^= 1;
+    ASSERT_NE(hash64(buffer, 3000), check);
+}
+
+TEST_NS2(Hash, Hash, TESTISA(Crc32c))
+{
+    ASSERT_EQ(crc32c("123456789", 9), 0xE3069283_ui32);
+    uint8 buffer[3000]; // NOLINT(modernize-avoid-c-arrays)
+    hashTestFill(buffer, sizeof(buffer));
+    ASSERT_EQ(crc32c(buffer, sizeof(buffer)), 0x53DD59BE_ui32);
+    // Continuing a checksum must match checksumming in one go
+    ASSERT_EQ(crc32c(buffer + 1000, 2000, crc32c(buffer, 1000)), 0x53DD59BE_ui32);
+}
+
+TEST_NS2(Hash, Hash, TESTISA(HashBatch))
+{
+    ASSERT_EQ(Hash<uint64>()(42_ui64), 0x95C1605493056289_ui64);
+
+    const uint64 keys64[7] = {1, 2, 3, 4, 5, 6, 0xFFFFFFFFFFFFFFFF_ui64}; // NOLINT(modernize-avoid-c-arrays)
+    uint64 hashes64[7];                                                   // NOLINT(modernize-avoid-c-arrays)
+    hashBatch(keys64, 7, hashes64);
+    for (uint0 i = 0; i < 7; ++i) {
+        ASSERT_EQ(hashes64[i], Hash<uint64>()(keys64[i]));
+    }
+    ASSERT_EQ(hashes64[6], 0x5FEF3179CFF998DF_ui64);
+
+    const int32 keys32[9] = {-5, -1, 0, 1, 2, 3, 4, 5, 100000}; // NOLINT(modernize-avoid-c-arrays)
+    uint64 hashes32[9];                                         // NOLINT(modernize-avoid-c-arrays)
+    hashBatch(keys32, 9, hashes32);
+    for (uint0 i = 0; i < 9; ++i) {
+        ASSERT_EQ(hashes32[i], Hash<int32>()(keys32[i]));
+    }
+    ASSERT_EQ(hashes32[0], 0xAF4BC41D7B4A72A4_ui64);
+}
+#endif
@@ -116,6 +116,10 @@ TEST_NS(Math, Math, Mul)
     ASSERT_EQ(Shift::mul<int64>(-INT64_MAX, 5_i64), int128(-3_i64, 9223372036854775813_ui64));
 
     ASSERT_EQ(Shift::mul<uint64>(UINT64_MAX, 5_ui64), uint128(4_ui64, 18446744073709551611_ui64));
+    ASSERT_EQ(Shift::mul<uint64>(UINT64_MAX, UINT64_MAX), uint128(18446744073709551614_ui64, 1_ui64));
+    ASSERT_EQ(Shift::mul<uint64>(0x123456789ABCDEF0_ui64, 0x0FEDCBA987654321_ui64),
+        uint128(0x0121FA00AD77D742_ui64, 0x2236D88FE5618CF0_ui64));
+    ASSERT_EQ(Shift::mul<uint64>(0_ui64, UINT64_MAX), uint128(0_ui64, 0_ui64));
 }
 
 TEST_NS(Math, Math, Addc)